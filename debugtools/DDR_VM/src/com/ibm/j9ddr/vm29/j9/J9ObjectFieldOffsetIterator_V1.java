@@ -48,9 +48,14 @@ import java.util.NoSuchElementException;
 
 import com.ibm.j9ddr.AddressedCorruptDataException;
 import com.ibm.j9ddr.CorruptDataException;
+import com.ibm.j9ddr.NoSuchFieldException;
+import com.ibm.j9ddr.vm29.j9.HashTable.HashEqualFunction;
+import com.ibm.j9ddr.vm29.j9.HashTable.HashFunction;
 import com.ibm.j9ddr.vm29.pointer.generated.J9BuildFlags;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ClassPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HashTablePointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9HiddenInstanceFieldPointer;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HotFieldLayoutTableEntryPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JavaVMPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ROMClassPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9ROMFieldShapePointer;
@@ -59,6 +64,7 @@ import com.ibm.j9ddr.vm29.pointer.helper.J9ObjectHelper;
 import com.ibm.j9ddr.vm29.pointer.helper.J9ROMClassHelper;
 import com.ibm.j9ddr.vm29.pointer.helper.J9ROMFieldShapeHelper;
 import com.ibm.j9ddr.vm29.pointer.helper.ValueTypeHelper;
+import com.ibm.j9ddr.vm29.structure.J9Consts;
 import com.ibm.j9ddr.vm29.structure.J9JavaAccessFlags;
 import com.ibm.j9ddr.vm29.types.IDATA;
 import com.ibm.j9ddr.vm29.types.Scalar;
@@ -110,6 +116,13 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 
 	private boolean isHidden;
 
+	/* state for -XX:+HotFieldLayout, see setHotInstanceFields() */
+	private long hotInstanceFields;
+	private int instanceFieldsSeen;
+	private int hotObjectsSeen;
+	private int hotObjectSlots;
+	private boolean hotObjectTakesBackfill;
+
 	@SuppressWarnings("unused")
 	private UDATA finalizeLinkOffset = new UDATA(0);
 	private int hiddenInstanceFieldWalkIndex = -1;
@@ -117,6 +130,9 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 
 	private static final UDATA NO_LOCKWORD_NEEDED = new UDATA(-1);
 	private static final UDATA LOCKWORD_NEEDED = new UDATA(-2);
+	/* Only the first 64 instance fields of a class can be moved by a hot field layout, as in resolvefield.cpp */
+	private static final int HOT_FIELD_LAYOUT_MAX_INDEX = 64;
+	private static final long J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT = J9ConstantHelper.getLong(J9Consts.class, "J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT", 0);
 
 	private J9ObjectFieldOffset next;
 
@@ -218,6 +234,8 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 					}
 				}
 			} else {
+				int instanceIndex = instanceFieldsSeen;
+				instanceFieldsSeen += 1;
 				if (walkFlags.anyBitsIn(J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE)) {
 					if (modifiers.anyBitsIn(J9FieldFlagObject)) {
 						if (valueTypeHelper.isFlattenableFieldSignature(J9ROMFieldShapeHelper.getSignature(localField))
@@ -267,24 +285,10 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 									}
 								}
 							} else {
-								if (walkFlags.anyBitsIn(J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
-									// Assert_VM_true(state->backfillOffsetToUse >= 0);
-									offset = new UDATA(backfillOffsetToUse);
-									walkFlags = walkFlags.bitAnd(~J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD);
-								} else {
-									offset = firstObjectOffset.add(objectsSeen.mult(fj9object_t_SizeOf));
-									objectsSeen = objectsSeen.add(1);
-								}
+								offset = nextInstanceObjectOffset(instanceIndex);
 							}
 						} else {
-							if (walkFlags.anyBitsIn(J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
-								// Assert_VM_true(state->backfillOffsetToUse >= 0);
-								offset = new UDATA(backfillOffsetToUse);
-								walkFlags = walkFlags.bitAnd(~J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD);
-							} else {
-								offset = firstObjectOffset.add(objectsSeen.mult(fj9object_t_SizeOf));
-								objectsSeen = objectsSeen.add(1);
-							}
+							offset = nextInstanceObjectOffset(instanceIndex);
 						}
 						field = localField;
 						break;
@@ -312,6 +316,104 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 		return;
 	}
 
+	// Based on nextInstanceObjectOffset in resolvefield.cpp
+	private UDATA nextInstanceObjectOffset(int instanceIndex) {
+		UDATA objectOffset;
+		boolean isHot = (instanceIndex < HOT_FIELD_LAYOUT_MAX_INDEX) && (0 != (hotInstanceFields & (1L << instanceIndex)));
+
+		if (walkFlags.anyBitsIn(J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD) && (isHot || !hotObjectTakesBackfill)) {
+			objectOffset = new UDATA(backfillOffsetToUse);
+			walkFlags = walkFlags.bitAnd(~J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD);
+		} else if (isHot) {
+			objectOffset = firstObjectOffset.add(hotObjectsSeen * fj9object_t_SizeOf);
+			hotObjectsSeen += 1;
+		} else {
+			objectOffset = firstObjectOffset.add((hotObjectSlots + objectsSeen.intValue()) * fj9object_t_SizeOf);
+			objectsSeen = objectsSeen.add(1);
+		}
+		return objectOffset;
+	}
+
+	/**
+	 * Find the hot fields used to lay out instances of romClass with -XX:+HotFieldLayout.
+	 * The VM records the answer for every ROM class it gave hot fields to in J9JavaVM.hotFieldLayoutTable.
+	 * @return bit mask of the hot instance fields, indexed by instance field ordinal
+	 */
+	private long getHotFieldLayout() throws CorruptDataException {
+		long hotFields = 0;
+		try {
+			if (!vm.extendedRuntimeFlags3().anyBitsIn(J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT)) {
+				return 0;
+			}
+			J9HashTablePointer table = vm.hotFieldLayoutTable();
+			if (table.notNull()) {
+				SlotIterator<J9HotFieldLayoutTableEntryPointer> entries = HashTable.fromJ9HashTable(
+						table,
+						true,
+						J9HotFieldLayoutTableEntryPointer.class,
+						new HotFieldLayoutEqualFunction(),
+						new HotFieldLayoutHashFunction()).iterator();
+				while (entries.hasNext()) {
+					J9HotFieldLayoutTableEntryPointer entry = entries.next();
+					if (entry.romClass().equals(romClass)) {
+						hotFields = entry.hotFields().longValue();
+						break;
+					}
+				}
+			}
+		} catch (NoClassDefFoundError | NoSuchFieldException e) {
+			/* The core file predates -XX:+HotFieldLayout */
+		}
+		return hotFields;
+	}
+
+	// Based on setHotInstanceFields in resolvefield.cpp
+	private void setHotInstanceFields(long hotFields) throws CorruptDataException {
+		int hotObjectCount = 0;
+		int instanceIndex = 0;
+
+		if (0 == hotFields) {
+			return;
+		}
+		Iterator<?> fields = new J9ROMFieldShapeIterator(romClass.romFields(), romClass.romFieldCount());
+		while (fields.hasNext() && (instanceIndex < HOT_FIELD_LAYOUT_MAX_INDEX)) {
+			J9ROMFieldShapePointer localField = (J9ROMFieldShapePointer) fields.next();
+			UDATA modifiers = localField.modifiers();
+			if (!modifiers.anyBitsIn(J9AccStatic)) {
+				long fieldBit = 1L << instanceIndex;
+				if ((0 != (hotFields & fieldBit))
+					&& modifiers.allBitsIn(J9FieldFlagObject)
+					&& !(valueTypeHelper.areValueTypesSupported() && modifiers.anyBitsIn(J9FieldFlagIsNullRestricted))
+				) {
+					hotInstanceFields |= fieldBit;
+					hotObjectCount += 1;
+				}
+				instanceIndex += 1;
+			}
+		}
+
+		hotObjectSlots = hotObjectCount;
+		if ((0 != hotObjectCount) && walkFlags.allBitsIn(J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
+			/* The backfill slot goes to the hottest object field rather than the first one declared */
+			hotObjectTakesBackfill = true;
+			hotObjectSlots -= 1;
+		}
+	}
+
+	private static final class HotFieldLayoutHashFunction implements HashFunction<J9HotFieldLayoutTableEntryPointer> {
+		@Override
+		public UDATA hash(J9HotFieldLayoutTableEntryPointer entry) throws CorruptDataException {
+			return UDATA.cast(entry.romClass());
+		}
+	}
+
+	private static final class HotFieldLayoutEqualFunction implements HashEqualFunction<J9HotFieldLayoutTableEntryPointer> {
+		@Override
+		public boolean equal(J9HotFieldLayoutTableEntryPointer entry1, J9HotFieldLayoutTableEntryPointer entry2) throws CorruptDataException {
+			return entry1.romClass().equals(entry2.romClass());
+		}
+	}
+
 	// Based on fieldOffsetsStartDo in resolvefield.cpp
 
 	private LinkedList<HiddenInstanceField> copyHiddenInstanceFieldsList(J9JavaVMPointer vm) throws CorruptDataException {
@@ -455,6 +557,14 @@ public class J9ObjectFieldOffsetIterator_V1 extends J9ObjectFieldOffsetIterator
 			}
 		}
 
+		/*
+		 * With -XX:+HotFieldLayout, the hot object fields recorded for this class go first in its object area.
+		 * The DDR walker does not handle contended classes, which are never given hot fields.
+		 */
+		if (walkFlags.allBitsIn(J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE) && (0 != fieldInfo.getInstanceObjectCount())) {
+			setHotInstanceFields(getHotFieldLayout());
+		}
+
 		/*
 		 * Calculate offsets (from the object header) for hidden fields. Hidden fields follow immediately the instance fields of the same type.
 		 * Give instance fields priority for backfill slots.
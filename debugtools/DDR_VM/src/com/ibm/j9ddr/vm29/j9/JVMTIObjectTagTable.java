@@ -23,21 +23,29 @@ package com.ibm.j9ddr.vm29.j9;
 
 import static com.ibm.j9ddr.vm29.events.EventManager.raiseCorruptDataEvent;
 
+import java.util.ArrayList;
 import java.util.Iterator;
+import java.util.List;
+import java.util.NoSuchElementException;
 
 import com.ibm.j9ddr.CorruptDataException;
+import com.ibm.j9ddr.NoSuchFieldException;
+import com.ibm.j9ddr.vm29.pointer.generated.J9HashTablePointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIEnvPointer;
 import com.ibm.j9ddr.vm29.pointer.generated.J9JVMTIObjectTagPointer;
 import com.ibm.j9ddr.vm29.types.UDATA;
 
 public class JVMTIObjectTagTable implements IHashTable<J9JVMTIObjectTagPointer>
 {	
-	protected HashTable<J9JVMTIObjectTagPointer> objectTagTable;
+	/* Must match J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT in jvmtiInternal.h */
+	private static final int OBJECT_TAG_TABLE_SHARD_COUNT = 16;
+
+	protected List<HashTable<J9JVMTIObjectTagPointer>> objectTagTables;
 
 	// Not intended for construction, use the factory
-	protected JVMTIObjectTagTable(HashTable<J9JVMTIObjectTagPointer> hashTable) throws CorruptDataException
+	protected JVMTIObjectTagTable(List<HashTable<J9JVMTIObjectTagPointer>> hashTables) throws CorruptDataException
 	{
-		objectTagTable = hashTable;
+		objectTagTables = hashTables;
 	}
 
 	protected static class ObjectTagHashFunction implements HashTable.HashFunction<J9JVMTIObjectTagPointer> 
@@ -72,29 +80,77 @@ public class JVMTIObjectTagTable implements IHashTable<J9JVMTIObjectTagPointer>
 		}
 	};
 	
-	public static JVMTIObjectTagTable fromJ9JVMTIEnv(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
+	private static HashTable<J9JVMTIObjectTagPointer> fromJ9HashTable(J9HashTablePointer table) throws CorruptDataException
 	{
-		HashTable<J9JVMTIObjectTagPointer> hashTable = HashTable.fromJ9HashTable(
-				jvmtiEnv.objectTagTable(),
+		return HashTable.fromJ9HashTable(
+				table,
 				true, 
 				J9JVMTIObjectTagPointer.class,
 				new ObjectTagEqualFunction(),
 				new ObjectTagHashFunction());
-		return new JVMTIObjectTagTable(hashTable);
 	}
-	
+
+	public static JVMTIObjectTagTable fromJ9JVMTIEnv(J9JVMTIEnvPointer jvmtiEnv) throws CorruptDataException
+	{
+		List<HashTable<J9JVMTIObjectTagPointer>> hashTables = new ArrayList<>();
+		try {
+			// cores predating the sharded object tag table
+			hashTables.add(fromJ9HashTable(jvmtiEnv.objectTagTable()));
+		} catch (NoSuchFieldException e) {
+			for (int shard = 0; shard < OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+				J9HashTablePointer table = J9HashTablePointer.cast(jvmtiEnv.objectTagTablesEA().at(shard));
+				if (table.notNull()) {
+					hashTables.add(fromJ9HashTable(table));
+				}
+			}
+		}
+		return new JVMTIObjectTagTable(hashTables);
+	}
+
 	public Iterator<J9JVMTIObjectTagPointer> iterator()
 	{
-		return objectTagTable.iterator();
+		final Iterator<HashTable<J9JVMTIObjectTagPointer>> tables = objectTagTables.iterator();
+
+		return new Iterator<J9JVMTIObjectTagPointer>() {
+			private Iterator<J9JVMTIObjectTagPointer> current = null;
+
+			public boolean hasNext()
+			{
+				while (((null == current) || !current.hasNext()) && tables.hasNext()) {
+					current = tables.next().iterator();
+				}
+				return (null != current) && current.hasNext();
+			}
+
+			public J9JVMTIObjectTagPointer next()
+			{
+				if (!hasNext()) {
+					throw new NoSuchElementException("There are no more items available through this iterator");
+				}
+				return current.next();
+			}
+
+			public void remove()
+			{
+				throw new UnsupportedOperationException();
+			}
+		};
 	}
 
 	public long getCount()
 	{
-		return objectTagTable.getCount();
+		long count = 0;
+		for (HashTable<J9JVMTIObjectTagPointer> table : objectTagTables) {
+			count += table.getCount();
+		}
+		return count;
 	}
 
 	public String getTableName()
 	{
-		return objectTagTable.getTableName();
+		if (objectTagTables.isEmpty()) {
+			return "JVMTI object tag table";
+		}
+		return objectTagTables.get(0).getTableName();
 	}
 }
@@ -42,7 +42,8 @@ class CheckJVMTIObjectTagTables extends Check
 				GCJVMTIObjectTagTableListIterator objectTagTableList = GCJVMTIObjectTagTableListIterator.fromJ9JVMTIData(jvmtiData);
 				while(objectTagTableList.hasNext()) {
 					J9JVMTIEnvPointer list = objectTagTableList.next();
-					VoidPointer objectTagTable = VoidPointer.cast(list.objectTagTable());
+					/* the object tag table is split in shards, report errors against the environment owning them */
+					VoidPointer objectTagTable = VoidPointer.cast(list);
 					GCJVMTIObjectTagTableIterator objectTagTableIterator = GCJVMTIObjectTagTableIterator.fromJ9JVMTIEnv(list);
 					while(objectTagTableIterator.hasNext()) {
 						PointerPointer slot = PointerPointer.cast(objectTagTableIterator.nextAddress());
@@ -420,6 +420,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/net/Message.cpp \
     compiler/net/MessageTypes.cpp \
     compiler/net/ServerStream.cpp \
+    compiler/net/StreamCompressor.cpp \
     compiler/runtime/CompileService.cpp \
     compiler/runtime/JITClientSession.cpp \
     compiler/runtime/JITServerAOTCache.cpp \
@@ -430,6 +431,7 @@ JIT_PRODUCT_SOURCE_FILES+=\
     compiler/runtime/JITServerSharedROMClassCache.cpp \
     compiler/runtime/JITServerStatisticsThread.cpp \
     compiler/runtime/Listener.cpp \
+    compiler/runtime/MetricsHistogram.cpp \
     compiler/runtime/MetricsServer.cpp
 </#if>
 
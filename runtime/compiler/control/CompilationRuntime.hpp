@@ -787,7 +787,21 @@ public:
     void queueEntry(TR_MethodToBeCompiled *entry);
     void recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
-    void requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
+    void requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry, bool waitForNextRequest = false);
+
+    /**
+     * @brief Whether client requests are queued per compilation thread (-Xjit:jitserverUseShardedCompQueue);
+     *        AOT cache loads and saves stay in the main queue, which is served first
+     */
+    bool useShardedCompQueue();
+
+    /**
+     * @brief The queue shard that the current thread queues client requests to and serves next,
+     *        or NULL if the current thread is not a compilation thread serving client requests
+     */
+    TR::CompilationInfoPerThread *getOwnQueueShard();
+    void queueShardedEntry(TR_MethodToBeCompiled *entry);
+    TR_MethodToBeCompiled *dequeueShardedEntry(TR::CompilationInfoPerThread *compInfoPT);
 #endif /* defined(J9VM_OPT_JITSERVER) */
     TR_MethodToBeCompiled *adjustCompilationEntryAndRequeue(TR::IlGeneratorMethodDetails &details,
         TR_PersistentMethodInfo *methodInfo, TR_Hotness newOptLevel, bool useProfiling, CompilationPriority priority,
@@ -1739,6 +1753,8 @@ private:
     JITServerSharedROMClassCache *_sharedROMClassCache;
     JITServerAOTCacheMap *_JITServerAOTCacheMap;
     JITServerAOTDeserializer *_JITServerAOTDeserializer;
+    int32_t _numShardedEntries; // client requests in the queue shards of all compilation threads
+    uint64_t _numShardSteals; // requests taken from the queue shard of another thread; RAS
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
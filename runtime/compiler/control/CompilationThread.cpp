@@ -106,6 +106,7 @@
 #include "runtime/JITClientSession.hpp"
 #include "runtime/JITServerAOTDeserializer.hpp"
 #include "runtime/OMRRSSReport.hpp"
+#include "runtime/Listener.hpp"
 #include "net/ClientStream.hpp"
 #include "net/ServerStream.hpp"
 #include "net/CommunicationStream.hpp"
@@ -1087,6 +1088,9 @@ TR::CompilationInfoPerThread::CompilationInfoPerThread(TR::CompilationInfo &comp
 #if defined(J9VM_OPT_JITSERVER)
     _serverVM = NULL;
     _sharedCacheServerVM = NULL;
+    _queueShardHead = NULL;
+    _queueShardTail = NULL;
+    _queueShardSize = 0;
 
     if (compInfo.getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER) {
         _classesThatShouldNotBeNewlyExtended = new (PERSISTENT_NEW) PersistentUnorderedSet<TR_OpaqueClassBlock *>(
@@ -1150,6 +1154,9 @@ TR::CompilationInfo::CompilationInfo(J9JITConfig *jitConfig)
     // Initialize the compilation monitor
     //
     _compilationMonitor = TR::Monitor::create("JIT-CompilationQueueMonitor");
+    static char *printCompMonitorStats = feGetEnv("TR_PrintCompMonitorStats");
+    if (printCompMonitorStats && _compilationMonitor)
+        _compilationMonitor->enableHoldTimeStats();
     _schedulingMonitor = TR::Monitor::create("JIT-SchedulingMonitor");
 #if defined(J9VM_JIT_DYNAMIC_LOOP_TRANSFER)
     _dltMonitor = TR::Monitor::create("JIT-DLTmonitor");
@@ -2398,6 +2405,15 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
     // Generate a trace point
     Trc_JIT_purgeMethodQueue(vmThread);
 
+#if defined(J9VM_OPT_JITSERVER)
+    // Move the client requests from the queue shards to the main queue, so they are purged with the rest
+    while (_numShardedEntries > 0) {
+        TR_MethodToBeCompiled *cur = dequeueShardedEntry(NULL);
+        cur->_next = _methodQueue;
+        _methodQueue = cur;
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
     while (_methodQueue) {
         TR_MethodToBeCompiled *cur = _methodQueue;
         _methodQueue = cur->_next;
@@ -3416,6 +3432,15 @@ void TR::CompilationInfo::stopCompilationThreads()
             dependencyTable->printStats();
     }
 
+    static char *printCompMonitorStats = feGetEnv("TR_PrintCompMonitorStats");
+    if (printCompMonitorStats) {
+        getCompilationMonitor()->printHoldTimeStats(stderr, "Compilation monitor");
+#if defined(J9VM_OPT_JITSERVER)
+        if (useShardedCompQueue())
+            fprintf(stderr, "Compilation queue shards: requests stolen=%llu\n", (unsigned long long)_numShardSteals);
+#endif /* defined(J9VM_OPT_JITSERVER) */
+    }
+
 #ifdef STATS
     if (compBudgetSupport() || dynamicThreadPriority()) {
         fprintf(stderr, "Compilation request queue size at shutdown=%d\n", getMethodQueueSize());
@@ -3867,6 +3892,11 @@ void TR::CompilationInfoPerThread::waitForWork()
 void TR::CompilationInfoPerThread::doSuspend()
 {
     _compInfo.setSuspendThreadDueToLowPhysicalMemory(false);
+#if defined(J9VM_OPT_JITSERVER)
+    // Wake up the active threads to steal the requests left in the queue shard of this thread
+    if (_queueShardHead)
+        _compInfo.getCompilationMonitor()->notifyAll();
+#endif /* defined(J9VM_OPT_JITSERVER) */
     getCompThreadMonitor()->enter();
 
     // Set the new state
@@ -4898,6 +4928,15 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
     entry->_freeTag |= ENTRY_QUEUED;
 
+#if defined(J9VM_OPT_JITSERVER)
+    // AOT cache loads and saves stay in the main queue, which is served before the queue shards
+    if (entry->isOutOfProcessCompReq() && (entry->_stream != LOAD_AOTCACHE_REQUEST)
+        && (entry->_stream != SAVE_AOTCACHE_REQUEST) && useShardedCompQueue()) {
+        queueShardedEntry(entry);
+        return;
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
     if (!_methodQueue || _methodQueue->_priority < entry->_priority) {
         entry->_next = _methodQueue;
         _methodQueue = entry;
@@ -4912,6 +4951,115 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
     }
 }
 
+#if defined(J9VM_OPT_JITSERVER)
+bool TR::CompilationInfo::useShardedCompQueue()
+{
+    return TR::Options::_jitserverUseShardedCompQueue
+        && (getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER);
+}
+
+TR::CompilationInfoPerThread *TR::CompilationInfo::getOwnQueueShard()
+{
+    TR::CompilationInfoPerThread *compInfoPT = TR::compInfoPT;
+    return (compInfoPT && !compInfoPT->isDiagnosticThread()) ? compInfoPT : NULL;
+}
+
+//----------------------------- queueShardedEntry ----------------------------
+// Queue a client request on a compilation thread. A compilation thread that
+// requeues the stream it has just served keeps the stream and serves it next;
+// the listener picks the shortest shard, preferring threads that are not
+// compiling. Each shard is ordered by priority like the main queue, but since
+// client requests mostly have the same priority, they are appended in constant
+// time. Needs the compilation monitor in hand.
+//----------------------------------------------------------------------------
+void TR::CompilationInfo::queueShardedEntry(TR_MethodToBeCompiled *entry)
+{
+    TR::CompilationInfoPerThread *shard = getOwnQueueShard();
+    if (!shard) {
+        for (int32_t i = getFirstCompThreadID(); i <= getLastCompThreadID(); i++) {
+            TR::CompilationInfoPerThread *curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+            TR_ASSERT(curCompThreadInfoPT, "a thread's compinfo is missing\n");
+            if (!shard) {
+                shard = curCompThreadInfoPT;
+                continue;
+            }
+            bool curIsCompiling = curCompThreadInfoPT->getMethodBeingCompiled() != NULL;
+            bool shardIsCompiling = shard->getMethodBeingCompiled() != NULL;
+            if ((shardIsCompiling && !curIsCompiling)
+                || ((shardIsCompiling == curIsCompiling)
+                    && (curCompThreadInfoPT->_queueShardSize < shard->_queueShardSize)))
+                shard = curCompThreadInfoPT;
+        }
+    }
+
+    if (!shard->_queueShardHead) {
+        entry->_next = NULL;
+        shard->_queueShardHead = entry;
+        shard->_queueShardTail = entry;
+    } else if (shard->_queueShardTail->_priority >= entry->_priority) {
+        entry->_next = NULL;
+        shard->_queueShardTail->_next = entry;
+        shard->_queueShardTail = entry;
+    } else if (shard->_queueShardHead->_priority < entry->_priority) {
+        entry->_next = shard->_queueShardHead;
+        shard->_queueShardHead = entry;
+    } else {
+        // The tail has a lower priority than the entry, so the walk stops before it
+        TR_MethodToBeCompiled *prev = shard->_queueShardHead;
+        while (prev->_next->_priority >= entry->_priority)
+            prev = prev->_next;
+        entry->_next = prev->_next;
+        prev->_next = entry;
+    }
+    shard->_queueShardSize++;
+    _numShardedEntries++;
+}
+
+//----------------------------- dequeueShardedEntry --------------------------
+// Take the next client request for the given compilation thread: the head of
+// its own shard or, if that is empty, the head of the longest shard of a peer,
+// preferring peers that are busy compiling. A NULL compInfoPT takes from any
+// shard. Returns NULL if all shards are empty. The caller updates the queue
+// accounting. Needs the compilation monitor in hand.
+//----------------------------------------------------------------------------
+TR_MethodToBeCompiled *TR::CompilationInfo::dequeueShardedEntry(TR::CompilationInfoPerThread *compInfoPT)
+{
+    TR::CompilationInfoPerThread *shard = compInfoPT;
+    if (!shard || !shard->_queueShardHead) {
+        shard = NULL;
+        for (int32_t i = getFirstCompThreadID(); i <= getLastCompThreadID(); i++) {
+            TR::CompilationInfoPerThread *curCompThreadInfoPT = _arrayOfCompilationInfoPerThread[i];
+            TR_ASSERT(curCompThreadInfoPT, "a thread's compinfo is missing\n");
+            if (curCompThreadInfoPT == compInfoPT || !curCompThreadInfoPT->_queueShardHead)
+                continue;
+            if (!shard) {
+                shard = curCompThreadInfoPT;
+                continue;
+            }
+            bool curIsCompiling = curCompThreadInfoPT->getMethodBeingCompiled() != NULL;
+            bool shardIsCompiling = shard->getMethodBeingCompiled() != NULL;
+            if ((curIsCompiling && !shardIsCompiling)
+                || ((shardIsCompiling == curIsCompiling)
+                    && (curCompThreadInfoPT->_queueShardSize > shard->_queueShardSize)))
+                shard = curCompThreadInfoPT;
+        }
+        if (!shard)
+            return NULL;
+        if (compInfoPT)
+            _numShardSteals++;
+    }
+
+    TR_MethodToBeCompiled *entry = shard->_queueShardHead;
+    shard->_queueShardHead = entry->_next;
+    if (!shard->_queueShardHead)
+        shard->_queueShardTail = NULL;
+    entry->_next = NULL;
+    shard->_queueShardSize--;
+    _numShardedEntries--;
+    return entry;
+}
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
 //--------------------------------- requeue ----------------------------------
 // Put the request that is currently being compiled, back into the queue
 // and increment the number of queued methods
@@ -5113,6 +5261,14 @@ TR_MethodToBeCompiled *TR::CompilationInfo::peekNextMethodToBeCompiled()
 {
     if (_methodQueue)
         return _methodQueue;
+#if defined(J9VM_OPT_JITSERVER)
+    else if (_numShardedEntries > 0) {
+        for (int32_t i = getFirstCompThreadID(); i <= getLastCompThreadID(); i++)
+            if (_arrayOfCompilationInfoPerThread[i]->_queueShardHead)
+                return _arrayOfCompilationInfoPerThread[i]->_queueShardHead;
+        return NULL;
+    }
+#endif /* defined(J9VM_OPT_JITSERVER) */
     else if (getLowPriorityCompQueue().hasLowPriorityRequest() && canProcessLowPriorityRequest())
         // These upgrade requests should not hinder the application too much.
         // If possible, we should decrease the priority of the compilation thread
@@ -5266,6 +5422,13 @@ TR_MethodToBeCompiled *TR::CompilationInfo::getNextMethodToBeCompiled(TR::Compil
                 updateCompQueueAccountingOnDequeue(nextMethodToBeCompiled);
             }
         }
+#if defined(J9VM_OPT_JITSERVER)
+        // Client requests in the queue shards are compiled right away, like those in the main queue in server mode
+        else if (_numShardedEntries > 0) {
+            nextMethodToBeCompiled = dequeueShardedEntry(compInfoPT);
+            updateCompQueueAccountingOnDequeue(nextMethodToBeCompiled);
+        }
+#endif /* defined(J9VM_OPT_JITSERVER) */
         // When no request is in the main queue we can look in the low priority queue
         else if (getLowPriorityCompQueue().hasLowPriorityRequest() && canProcessLowPriorityRequest()) {
             // Check if we need to throttle
@@ -12157,7 +12320,9 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addOutOfProcessMethodToBeCompiled(JI
         // This needs to be served as soon as possible, so we give it a higher priority
         CompilationPriority priority = (stream == LOAD_AOTCACHE_REQUEST) ? CP_SYNC_BELOW_MAX : CP_SYNC_NORMAL;
         entry->initialize(details, NULL, priority, NULL);
-        if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance)) {
+        // The MetricsServer exports the time spent by requests in the queue
+        if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance)
+            || (getPersistentInfo()->getJITServerMetricsPort() != 0)) {
             PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
             entry->_entryTime = j9time_usec_clock();
         }
@@ -12196,16 +12361,27 @@ TR_MethodToBeCompiled *TR::CompilationInfo::addOutOfProcessMethodToBeCompiled(JI
     return entry;
 }
 
-void TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry)
+// When waitForNextRequest is true, the stream has just finished serving a request and
+// the client may not send the next one for a while. With the event-driven listener the
+// stream is then parked in the listener instead of occupying a compilation thread.
+void TR::CompilationInfo::requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry, bool waitForNextRequest)
 {
     TR_ASSERT(getPersistentInfo()->getRemoteCompilationMode() == JITServer::SERVER,
         "Should be called in JITServer server mode only");
 
     recycleCompilationEntry(entry);
 
+    if (waitForNextRequest && entry->_stream) {
+        TR_Listener *listener = ((TR_JitPrivateConfig *)(_jitConfig->privateConfig))->listener;
+        if (listener && listener->parkConnection(entry->_stream))
+            return;
+    }
+
     if (entry->_stream && addOutOfProcessMethodToBeCompiled(entry->_stream)) {
-        // successfully queued the new entry, so notify a thread
-        getCompilationMonitor()->notifyAll();
+        // successfully queued the new entry, so notify a thread, unless the entry went
+        // to the queue shard of this thread, which serves it next
+        if (!useShardedCompQueue() || !getOwnQueueShard())
+            getCompilationMonitor()->notifyAll();
     }
 }
 
@@ -553,6 +553,11 @@ protected:
     TR_J9ServerVM *_serverVM;
     TR_J9SharedCacheServerVM *_sharedCacheServerVM;
     PersistentUnorderedSet<TR_OpaqueClassBlock *> *_classesThatShouldNotBeNewlyExtended;
+    // Client requests queued on this thread when the server uses a sharded compilation queue;
+    // ordered by priority and protected by the compilation monitor, like the main queue
+    TR_MethodToBeCompiled *_queueShardHead;
+    TR_MethodToBeCompiled *_queueShardTail;
+    int32_t _queueShardSize;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
 }; // CompilationInfoPerThread
@@ -150,6 +150,10 @@ int32_t J9::Options::_veryHighActiveThreadThreshold = -1;
 int32_t J9::Options::_aotCachePersistenceMinDeltaMethods = 200;
 int32_t J9::Options::_aotCachePersistenceMinPeriodMs = 10000; // ms
 int32_t J9::Options::_jitserverMallocTrimInterval = 1000 * 30; // 30000ms = 30s
+int32_t J9::Options::_jitserverMsgCompressionLevel = 0; // 0 means message compression is disabled
+int32_t J9::Options::_jitserverMsgCompressionThreshold = 4096; // bytes
+bool J9::Options::_jitserverUseEpollListener = false;
+bool J9::Options::_jitserverUseShardedCompQueue = false;
 int32_t J9::Options::_lowCompDensityModeEnterThreshold
     = 4; // Maximum number of compilations per 10 min of CPU required to enter low compilation density mode. Use 0 to
          // disable feature
@@ -188,6 +192,7 @@ int32_t J9::Options::_iprofilerIntToTotalSampleRatio = 2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
+bool J9::Options::_iprofilerAggregateSamples = false;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
 #ifdef TR_HOST_64BIT
@@ -1047,6 +1052,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
     { "invocationThresholdToTriggerLowPriComp=",
      "M<nnn>\tNumber of times a loopy method must be invoked to be eligible for LPQ", TR::Options::setStaticNumeric,
      (intptr_t)&TR::Options::_invocationThresholdToTriggerLowPriComp, 0, "F%d", NOT_IN_SUBSET },
+    { "iprofilerAggregateSamples",
+     " \tmerge identical samples of an IProfiler buffer before adding them to the bytecode hash table",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_iprofilerAggregateSamples, 1, "F%d", NOT_IN_SUBSET },
     { "iprofilerBcHashTableSize=", "M<nnn>\tSize of the backbone for the IProfiler bytecode hash table",
      TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iProfilerBcHashTableSize, 0, "F%d", NOT_IN_SUBSET },
     { "iprofilerBufferInterarrivalTimeToExitDeepIdle=",
@@ -1103,6 +1111,16 @@ TR::OptionTable OMR::Options::_feOptions[] = {
      TR::Options::JITServerAOTCacheStoreLimitOption, 1, 0, "P%s" },
     { "jitserverMallocTrimInterval=",
      "M<nnn>\tmiminum time between two consecutive JITServer client malloc_trim invocations (ms)", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMallocTrimInterval, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverMsgCompressionLevel=",
+     "M<nnn>\tzlib level (1-9) used to compress JITServer messages; 0 disables compression", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMsgCompressionLevel, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverMsgCompressionThreshold=",
+     "M<nnn>\tminimum size (bytes) of a JITServer message to be compressed", TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jitserverMsgCompressionThreshold, 0, "F%d", NOT_IN_SUBSET },
+    { "jitserverUseEpollListener",
+     " \tkeep idle client connections in an epoll set instead of on compilation threads", TR::Options::setStaticBool,
+     (intptr_t)&TR::Options::_jitserverUseEpollListener, 1, "F%d", NOT_IN_SUBSET },
+    { "jitserverUseShardedCompQueue",
+     " \tqueue client requests per compilation thread, with idle threads stealing from busy ones",
+     TR::Options::setStaticBool, (intptr_t)&TR::Options::_jitserverUseShardedCompQueue, 1, "F%d", NOT_IN_SUBSET },
 #endif  /* defined(J9VM_OPT_JITSERVER) */
     { "jProfilingEnablementSampleThreshold=",
      "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies", TR::Options::setStaticNumeric,
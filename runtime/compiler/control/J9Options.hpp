@@ -345,6 +345,7 @@ public:
     static int32_t _iprofilerSamplesBeforeTurningOff;
     static int32_t _iprofilerNumOutstandingBuffers;
     static int32_t _iprofilerBufferMaxPercentageToDiscard;
+    static bool _iprofilerAggregateSamples;
     static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
     static int32_t _iprofilerBufferSize; // iprofilerbuffer size in kb
 
@@ -460,6 +461,10 @@ public:
     static int32_t _aotCachePersistenceMinDeltaMethods;
     static int32_t _aotCachePersistenceMinPeriodMs;
     static int32_t _jitserverMallocTrimInterval;
+    static int32_t _jitserverMsgCompressionLevel;
+    static int32_t _jitserverMsgCompressionThreshold;
+    static bool _jitserverUseEpollListener;
+    static bool _jitserverUseShardedCompQueue;
     static int32_t _lowCompDensityModeEnterThreshold;
     static int32_t _lowCompDensityModeExitThreshold;
     static int32_t _lowCompDensityModeExitLPQSize;
@@ -963,6 +963,7 @@ void TR::CompilationInfoPerThreadRemote::processAOTCacheMapRequest(const std::st
     if (aotCache) {
         auto cachedMethodMonitor = aotCache->getCachedMethodMonitor();
         try {
+            aotCache->loadSnapshot();
             {
                 OMR::CriticalSection cs(cachedMethodMonitor);
 
@@ -970,8 +971,12 @@ void TR::CompilationInfoPerThreadRemote::processAOTCacheMapRequest(const std::st
                 methodSignaturesV.reserve(aotCache->getCachedMethodMap().size());
 
                 for (; cachedAOTMethod != NULL; cachedAOTMethod = cachedAOTMethod->getNextRecord()) {
+                    // Methods from a snapshot that are not found yet have not been checked
+                    if (!cachedAOTMethod->hasValidSize())
+                        continue;
                     const SerializedAOTMethod &serializedAOTMethod = cachedAOTMethod->data();
-                    methodSignaturesV.emplace_back(std::string(serializedAOTMethod.signature()));
+                    methodSignaturesV.emplace_back(
+                        std::string(serializedAOTMethod.signature(), serializedAOTMethod.signatureSize()));
                 }
             }
         } catch (const std::bad_alloc &e) {
@@ -1017,7 +1022,7 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
         auto aotCacheMap = compInfo->getJITServerAOTCacheMap();
         TR_ASSERT(aotCacheMap, "aotCacheMap must exist if such a special request was issued");
         if (stream == LOAD_AOTCACHE_REQUEST)
-            aotCacheMap->loadNextQueuedAOTCacheFromFile(scratchSegmentProvider);
+            aotCacheMap->loadNextQueuedAOTCacheFromFile();
         else
             aotCacheMap->saveNextQueuedAOTCacheToFile();
 
@@ -1036,6 +1041,14 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
 
     _recompilationMethodInfo = NULL;
 
+    // Time spent by this request in the compilation queue, exported by the MetricsServer
+    bool recordQueueWaitTime = entry._entryTime && (compInfo->getPersistentInfo()->getJITServerMetricsPort() != 0);
+    uintptr_t queueWaitTime = 0;
+    if (recordQueueWaitTime) {
+        PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+        queueWaitTime = j9time_usec_clock() - entry._entryTime;
+    }
+
     // Release compMonitor before doing the blocking read
     compInfo->releaseCompMonitor(compThread);
 
@@ -1073,6 +1086,8 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
             processCompilationRequest(req, stream, compInfo, compThread, clientSession, entry, optPlan,
                 scratchSegmentProvider, clientId, seqNo, hasUpdatedSeqNo, useAotCompilation, isCriticalRequest,
                 hasIncNumActiveThreads, aotCacheHit, abortCompilation);
+            if (recordQueueWaitTime && clientSession)
+                clientSession->getQueueWaitHistogram().record(queueWaitTime, getCompThreadId());
         } else if (messageType == JITServer::MessageType::AOTCacheMap_request) {
             processAOTCacheMapRequest(cacheName, compInfo, stream);
             abortCompilation = true;
@@ -1214,7 +1229,7 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
 
         if (!compInfo->getPersistentInfo()->getDisableFurtherCompilation() && !deleteStream
             && !enableJITServerPerCompConn) {
-            compInfo->requeueOutOfProcessEntry(&entry);
+            compInfo->requeueOutOfProcessEntry(&entry, true /* waitForNextRequest */);
         } else {
             // Delete server stream if per compilation connections are enabled
             // or if the server disabled compilations due to a crash
@@ -1300,7 +1315,7 @@ void TR::CompilationInfoPerThreadRemote::processEntry(TR_MethodToBeCompiled &ent
 
     if (!compInfo->getPersistentInfo()->getDisableFurtherCompilation() && !enableJITServerPerCompConn
         && entry._compErrCode != compilationStreamFailure) {
-        compInfo->requeueOutOfProcessEntry(&entry);
+        compInfo->requeueOutOfProcessEntry(&entry, true /* waitForNextRequest */);
     } else {
         TR_ASSERT(entry._stream, "stream should still exist after compilation even if it encounters a streamFailure.");
         // Delete server stream if per compilation connections are enabled,
@@ -786,6 +786,35 @@ void JITServerHelpers::printJITServerMsgStats(J9JITConfig *jitConfig, TR::Compil
     j9tty_printf(PORTLIB, "Total amount of data received: %llu bytes\n",
         (unsigned long long)JITServer::CommunicationStream::_totalMsgSize);
 
+    uint64_t totalCompressedMsgCount = 0;
+    for (int i = 0; i < JITServer::MessageType_MAXTYPE; ++i)
+        totalCompressedMsgCount += JITServer::CommunicationStream::_msgCompressedCount[i];
+    if (totalCompressedMsgCount) {
+        j9tty_printf(PORTLIB, "Total amount of data received on the wire: %llu bytes\n",
+            (unsigned long long)JITServer::CommunicationStream::_totalWireMsgSize);
+        j9tty_printf(PORTLIB, "JITServer Message Compression Statistics:\n");
+        j9tty_printf(PORTLIB, "Type# #compressed\tUncompressed\tCompressed\tRatio");
+#if defined(MESSAGE_SIZE_STATS)
+        j9tty_printf(PORTLIB, "\t\tMaxRatio\tMinRatio");
+#endif /* defined(MESSAGE_SIZE_STATS) */
+        j9tty_printf(PORTLIB, "\t\tTypeName\n");
+        for (int i = 0; i < JITServer::MessageType_MAXTYPE; ++i) {
+            uint32_t compressedCount = JITServer::CommunicationStream::_msgCompressedCount[i];
+            if (compressedCount) {
+                uint64_t uncompressedSize = JITServer::CommunicationStream::_msgUncompressedSize[i];
+                uint64_t compressedSize = JITServer::CommunicationStream::_msgCompressedSize[i];
+                j9tty_printf(PORTLIB, "#%04d %7u\t%12llu\t%12llu\t%f", i, compressedCount,
+                    (unsigned long long)uncompressedSize, (unsigned long long)compressedSize,
+                    uncompressedSize / double(compressedSize));
+#if defined(MESSAGE_SIZE_STATS)
+                auto &stat = JITServer::CommunicationStream::_msgCompressionRatioStats[i];
+                j9tty_printf(PORTLIB, "\t%f\t%f", stat.maxVal(), stat.minVal());
+#endif /* defined(MESSAGE_SIZE_STATS) */
+                j9tty_printf(PORTLIB, "\t\t%s\n", JITServer::messageNames[i]);
+            }
+        }
+    }
+
     uint32_t numCompilations = 0;
     uint32_t numDeserializedMethods = 0;
     if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT) {
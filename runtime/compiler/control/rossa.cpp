@@ -2014,6 +2014,14 @@ extern "C" int32_t aboutToBootstrap(J9JavaVM *javaVM, J9JITConfig *jitConfig)
         }
 #endif /* defined(J9VM_OPT_CRIU_SUPPORT) */
 
+        // AOT code has instance field offsets baked in, and -XX:+HotFieldLayout can change them between runs
+        if (J9_ARE_ALL_BITS_SET(javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT)) {
+            javaVM->sharedClassConfig->runtimeFlags &= ~J9SHR_RUNTIMEFLAG_ENABLE_AOT;
+            TR::Options::getAOTCmdLineOptions()->setOption(TR_NoLoadAOT);
+            TR::Options::getAOTCmdLineOptions()->setOption(TR_NoStoreAOT);
+            TR_J9SharedCache::setSharedCacheDisabledReason(TR_J9SharedCache::AOT_DISABLED);
+        }
+
         if (javaVM->sharedClassConfig->runtimeFlags & J9SHR_RUNTIMEFLAG_ENABLE_READONLY) {
             TR::Options::getAOTCmdLineOptions()->setOption(TR_NoStoreAOT);
             TR_J9SharedCache::setSharedCacheDisabledReason(TR_J9SharedCache::AOT_DISABLED);
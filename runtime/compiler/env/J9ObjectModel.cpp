@@ -177,7 +177,10 @@ bool J9::ObjectModel::isHotReferenceFieldRequired()
         return vmInfo->_isHotReferenceFieldRequired;
     }
 #endif /* defined(J9VM_OPT_JITSERVER) */
-    return TR::Compiler->javaVM->memoryManagerFunctions->j9gc_hot_reference_field_required(TR::Compiler->javaVM);
+    J9JavaVM *javaVM = TR::Compiler->javaVM;
+    // -XX:+HotFieldLayout records the hot fields in the shared classes cache to lay out classes in later runs
+    return javaVM->memoryManagerFunctions->j9gc_hot_reference_field_required(javaVM)
+        || J9_ARE_ALL_BITS_SET(javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT);
 }
 
 bool J9::ObjectModel::isOffHeapAllocationEnabled()
@@ -22,6 +22,8 @@
 
 #include "infra/J9Monitor.hpp"
 
+#include <chrono>
+#include <string.h>
 #include "j9.h"
 #include "j9cfg.h"
 #include "j9port.h"
@@ -35,9 +37,17 @@ TR::Monitor *J9::Monitor::create(const char *name) { return TR::MonitorTable::ge
 
 void J9::Monitor::destroy(TR::Monitor *monitor) { TR::MonitorTable::get()->removeAndDestroy(monitor); }
 
+static uint64_t holdTimeStatsClockNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
 bool J9::Monitor::init(const char *name)
 {
     setNext(0);
+    _holdTimeStats = NULL;
     if (j9thread_monitor_init_with_name((J9ThreadMonitor **)&_monitor, 0, name))
         return false;
     else
@@ -47,6 +57,7 @@ bool J9::Monitor::init(const char *name)
 bool J9::Monitor::initFromVMMutex(void *mutex)
 {
     _monitor = (J9ThreadMonitor *)mutex;
+    _holdTimeStats = NULL;
     return true;
 }
 
@@ -54,26 +65,124 @@ void J9::Monitor::enter()
 {
     TR_ASSERT(_monitor != TR::MonitorTable::get()->getClassTableMutex()->getVMMonitor(),
         "Use TR::ClassTableCriticalSection instead");
-    j9thread_monitor_enter(_monitor);
+    if (!_holdTimeStats) {
+        j9thread_monitor_enter(_monitor);
+        return;
+    }
+
+    // A failed try_enter means that another thread owns the monitor
+    if (j9thread_monitor_try_enter(_monitor) != 0) {
+        uint64_t blockStartTime = holdTimeStatsClockNs();
+        j9thread_monitor_enter(_monitor);
+        _holdTimeStats->_numContendedAcquires++;
+        _holdTimeStats->_totalBlockedTimeNs += holdTimeStatsClockNs() - blockStartTime;
+    }
+    startHolding();
 }
 
 void J9::Monitor::destroy() { j9thread_monitor_destroy(_monitor); }
 
-void J9::Monitor::wait() { j9thread_monitor_wait(_monitor); }
+void J9::Monitor::wait()
+{
+    if (!_holdTimeStats) {
+        j9thread_monitor_wait(_monitor);
+        return;
+    }
+
+    // The monitor is fully released while waiting, so the time spent waiting is not hold time
+    uint32_t recursionCount = _holdTimeStats->_recursionCount;
+    if (recursionCount > 0) {
+        _holdTimeStats->_recursionCount = 1;
+        stopHolding();
+    }
+    j9thread_monitor_wait(_monitor);
+    _holdTimeStats->_recursionCount = recursionCount;
+    _holdTimeStats->_holdStartTimeNs = holdTimeStatsClockNs();
+}
 
 intptr_t J9::Monitor::wait_timed(int64_t millis, int32_t nanos)
 {
-    return j9thread_monitor_wait_timed(_monitor, millis, nanos);
+    if (!_holdTimeStats)
+        return j9thread_monitor_wait_timed(_monitor, millis, nanos);
+
+    uint32_t recursionCount = _holdTimeStats->_recursionCount;
+    if (recursionCount > 0) {
+        _holdTimeStats->_recursionCount = 1;
+        stopHolding();
+    }
+    intptr_t rc = j9thread_monitor_wait_timed(_monitor, millis, nanos);
+    _holdTimeStats->_recursionCount = recursionCount;
+    _holdTimeStats->_holdStartTimeNs = holdTimeStatsClockNs();
+    return rc;
 }
 
 void J9::Monitor::notify() { j9thread_monitor_notify(_monitor); }
 
 void J9::Monitor::notifyAll() { j9thread_monitor_notify_all(_monitor); }
 
-int32_t J9::Monitor::exit() { return (int32_t)j9thread_monitor_exit(_monitor); }
+int32_t J9::Monitor::exit()
+{
+    if (_holdTimeStats)
+        stopHolding();
+    return (int32_t)j9thread_monitor_exit(_monitor);
+}
 
-int32_t J9::Monitor::try_enter() { return (int32_t)j9thread_monitor_try_enter(_monitor); }
+int32_t J9::Monitor::try_enter()
+{
+    int32_t rc = (int32_t)j9thread_monitor_try_enter(_monitor);
+    if (_holdTimeStats && rc == 0)
+        startHolding();
+    return rc;
+}
 
 int32_t J9::Monitor::num_waiting() { return (int32_t)j9thread_monitor_num_waiting(_monitor); }
 
 int32_t J9::Monitor::owned_by_self() { return (int32_t)j9thread_monitor_owned_by_self(_monitor); }
+
+bool J9::Monitor::enableHoldTimeStats()
+{
+    if (!_holdTimeStats) {
+        void *stats = TR_Memory::jitPersistentAlloc(sizeof(MonitorHoldTimeStats));
+        if (!stats)
+            return false;
+        memset(stats, 0, sizeof(MonitorHoldTimeStats));
+        _holdTimeStats = (MonitorHoldTimeStats *)stats;
+    }
+    return true;
+}
+
+// Must be called by the owner of the monitor after each successful enter
+void J9::Monitor::startHolding()
+{
+    if (_holdTimeStats->_recursionCount++ == 0) {
+        _holdTimeStats->_numAcquires++;
+        _holdTimeStats->_holdStartTimeNs = holdTimeStatsClockNs();
+    }
+}
+
+// Must be called by the owner of the monitor before each exit
+void J9::Monitor::stopHolding()
+{
+    // The count can be 0 if the monitor was already held when the statistics were enabled
+    if (_holdTimeStats->_recursionCount > 0 && --_holdTimeStats->_recursionCount == 0) {
+        uint64_t holdTime = holdTimeStatsClockNs() - _holdTimeStats->_holdStartTimeNs;
+        _holdTimeStats->_totalHoldTimeNs += holdTime;
+        if (holdTime > _holdTimeStats->_maxHoldTimeNs)
+            _holdTimeStats->_maxHoldTimeNs = holdTime;
+    }
+}
+
+void J9::Monitor::printHoldTimeStats(FILE *file, const char *name) const
+{
+    if (!_holdTimeStats)
+        return;
+
+    uint64_t numAcquires = _holdTimeStats->_numAcquires;
+    fprintf(file, "%s: acquires=%llu contended=%llu blockedTime=%llu us holdTime=%llu us avgHoldTime=%.2f us "
+        "maxHoldTime=%llu us\n",
+        name, (unsigned long long)numAcquires, (unsigned long long)_holdTimeStats->_numContendedAcquires,
+        (unsigned long long)(_holdTimeStats->_totalBlockedTimeNs / 1000),
+        (unsigned long long)(_holdTimeStats->_totalHoldTimeNs / 1000),
+        numAcquires ? _holdTimeStats->_totalHoldTimeNs / 1000.0 / numAcquires : 0.0,
+        (unsigned long long)(_holdTimeStats->_maxHoldTimeNs / 1000));
+}
@@ -32,6 +32,8 @@ typedef J9::Monitor MonitorConnector;
 } // namespace J9
 #endif
 
+#include <stdint.h>
+#include <stdio.h>
 #include "env/TRMemory.hpp"
 #include "infra/Link.hpp"
 
@@ -51,6 +53,22 @@ class MonitorTable;
 
 namespace J9 {
 
+/**
+ * @brief Statistics on how long a monitor is held and how often threads block on it
+ *
+ * The fields are only updated by the thread that owns the monitor, so they need no
+ * synchronization of their own. Readers may see slightly stale values.
+ */
+struct MonitorHoldTimeStats {
+    uint64_t _numAcquires; // Outermost enters only
+    uint64_t _numContendedAcquires; // Enters that found the monitor owned by another thread
+    uint64_t _totalBlockedTimeNs; // Time spent in contended enters
+    uint64_t _totalHoldTimeNs; // Time between the outermost enter and the matching exit, excluding waits
+    uint64_t _maxHoldTimeNs;
+    uint64_t _holdStartTimeNs;
+    uint32_t _recursionCount;
+};
+
 class Monitor : public TR_Link0<TR::Monitor> {
 public:
     static TR::Monitor *create(const char *name);
@@ -76,6 +94,13 @@ public:
 
     int32_t owned_by_self(); // returns 1 if current thread owns the monitor, 0 otherwise
 
+    // Start collecting hold time statistics; must be called while no thread uses the monitor
+    bool enableHoldTimeStats();
+
+    const MonitorHoldTimeStats *getHoldTimeStats() const { return _holdTimeStats; }
+
+    void printHoldTimeStats(FILE *file, const char *name) const;
+
     // Dangerous: do not use this routine, except for thread exit
     void *getVMMonitor() { return (void *)_monitor; }
 
@@ -92,7 +117,11 @@ private:
 
     bool initFromVMMutex(void *mutex);
 
+    void startHolding();
+    void stopHolding();
+
     J9ThreadMonitor *_monitor;
+    MonitorHoldTimeStats *_holdTimeStats;
 };
 
 } // namespace J9
@@ -78,8 +78,13 @@ public:
     template<typename... T> void buildCompileRequest(T... args)
     {
         if (getVersionCheckStatus() == NOT_DONE) {
-            _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
-            write(MessageType::compilationRequest, args...);
+            // The negotiable flags are sent after the arguments, where a server that
+            // does not know about them ignores them, rather than in the compared version
+            _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS & ~JITServerNegotiableFlagsMask);
+            _cMsg.setType(MessageType::compilationRequest);
+            setArgsRaw<T...>(_cMsg, args...);
+            _cMsg.appendCapabilities(CONFIGURATION_FLAGS & JITServerNegotiableFlagsMask);
+            writeMessage(_cMsg);
             _cMsg.clearFullVersion();
         } else // getVersionCheckStatus() == PASSED
         {
@@ -112,6 +117,9 @@ public:
     MessageType read()
     {
         readMessage(_sMsg);
+        // The server reports the negotiable flags it accepted in every message
+        if ((_sMsg.negotiatedFlags() & JITServerMsgCompressionMask) != _compressionFlags)
+            negotiateCompression(_sMsg.negotiatedFlags());
         return _sMsg.type();
     }
 
@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include <algorithm>
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
@@ -36,6 +37,13 @@ uint32_t CommunicationStream::_numConsecutiveReadErrorsOfSameType = 0;
 #if defined(MESSAGE_SIZE_STATS)
 TR_Stats CommunicationStream::_msgSizeStats[];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+uint32_t CommunicationStream::_msgCompressedCount[] = { 0 };
+uint64_t CommunicationStream::_msgUncompressedSize[] = { 0 };
+uint64_t CommunicationStream::_msgCompressedSize[] = { 0 };
+uint64_t CommunicationStream::_totalWireMsgSize = 0;
+#if defined(MESSAGE_SIZE_STATS)
+TR_Stats CommunicationStream::_msgCompressionRatioStats[];
+#endif /* defined(MESSAGE_SIZE_STATS) */
 
 void CommunicationStream::initConfigurationFlags()
 {
@@ -43,6 +51,31 @@ void CommunicationStream::initConfigurationFlags()
         CONFIGURATION_FLAGS |= JITServerCompressedRef;
     }
     CONFIGURATION_FLAGS |= JAVA_SPEC_VERSION & JITServerJavaVersionMask;
+
+    // Message compression is only advertised; it is used on a connection
+    // only if the peer advertises it as well
+    if (TR::Options::_jitserverMsgCompressionLevel > 0) {
+        if (TR::Options::_jitserverMsgCompressionLevel > Z_BEST_COMPRESSION)
+            TR::Options::_jitserverMsgCompressionLevel = Z_BEST_COMPRESSION;
+        CONFIGURATION_FLAGS |= JITServerMsgCompressionZlib;
+    }
+}
+
+uint32_t CommunicationStream::negotiateCompression(uint32_t peerFlags)
+{
+    _compressionFlags = peerFlags & CONFIGURATION_FLAGS & JITServerMsgCompressionZlib;
+    if (_compressionFlags && TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Negotiated zlib compression for messages on socket %d",
+            _connfd);
+    return _compressionFlags;
+}
+
+StreamCompressor *CommunicationStream::getCompressor()
+{
+    if (!_compressor)
+        _compressor = new (TR::Compiler->rawAllocator)
+            StreamCompressor(std::max(TR::Options::_jitserverMsgCompressionLevel, (int32_t)Z_BEST_SPEED));
+    return _compressor;
 }
 
 bool CommunicationStream::useSSL()
@@ -78,18 +111,21 @@ void CommunicationStream::readMessage(Message &msg)
     }
 
     // bytesRead >= sizeof(uint32_t)
-    uint32_t serializedSize = ((uint32_t *)buffer)[0];
-    if (bytesRead > serializedSize) {
+    // For compressed messages the size read here is the size of the whole frame
+    uint32_t frameSize = ((uint32_t *)buffer)[0];
+    bool isCompressed = (frameSize & StreamCompressor::COMPRESSED_FRAME_FLAG) != 0;
+    frameSize &= ~StreamCompressor::COMPRESSED_FRAME_FLAG;
+    if (bytesRead > frameSize) {
         throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
     }
 
-    // serializedSize >= bytesRead
-    uint32_t bytesLeftToRead = serializedSize - bytesRead;
+    // frameSize >= bytesRead
+    uint32_t bytesLeftToRead = frameSize - bytesRead;
 
     if (bytesLeftToRead > 0) {
-        if (serializedSize > bufferCapacity) {
+        if (frameSize > bufferCapacity) {
             // bytesRead could be less than the buffer capacity.
-            msg.expandBuffer(serializedSize, bytesRead);
+            msg.expandBuffer(frameSize, bytesRead);
 
             // The buffer storage will change after the buffer is expanded.
             buffer = msg.getBufferStartForRead();
@@ -98,6 +134,10 @@ void CommunicationStream::readMessage(Message &msg)
         readBlocking(buffer + bytesRead, bytesLeftToRead);
     }
 
+    // The peer only sends compressed messages after compression has been negotiated,
+    // so the decompression state can be created on demand
+    uint32_t serializedSize = isCompressed ? getCompressor()->decompress(msg, frameSize) : frameSize;
+
     msg.setSerializedSize(serializedSize);
 
     // rebuild the message
@@ -109,13 +149,31 @@ void CommunicationStream::readMessage(Message &msg)
 #if defined(MESSAGE_SIZE_STATS)
     _msgSizeStats[msg.type()].update(serializedSize);
 #endif /* defined(MESSAGE_SIZE_STATS) */
+    if (isCompressed) {
+        _msgCompressedCount[msg.type()] += 1;
+        _msgUncompressedSize[msg.type()] += serializedSize;
+        _msgCompressedSize[msg.type()] += frameSize;
+        _totalWireMsgSize += frameSize;
+#if defined(MESSAGE_SIZE_STATS)
+        _msgCompressionRatioStats[msg.type()].update((double)serializedSize / frameSize);
+#endif /* defined(MESSAGE_SIZE_STATS) */
+    } else {
+        _totalWireMsgSize += serializedSize;
+    }
 }
 
 void CommunicationStream::writeMessage(Message &msg)
 {
     char *serialMsg = msg.serialize();
-    // write serialized message to the socket
-    writeBlocking(serialMsg, msg.serializedSize());
+    uint32_t serializedSize = msg.serializedSize();
+    // write serialized message to the socket, compressing it first if it is large enough
+    if (_compressionFlags && (serializedSize >= (uint32_t)TR::Options::_jitserverMsgCompressionThreshold)) {
+        uint32_t frameSize = 0;
+        const char *frame = getCompressor()->compress(serialMsg, serializedSize, frameSize);
+        writeBlocking(frame, frameSize);
+    } else {
+        writeBlocking(serialMsg, serializedSize);
+    }
     msg.clearForWrite();
 }
 
@@ -27,6 +27,7 @@
 #include "infra/Statistics.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/Message.hpp"
+#include "net/StreamCompressor.hpp"
 #include "net/StreamExceptions.hpp"
 #include "env/VerboseLog.hpp"
 #include "control/MethodToBeCompiled.hpp"
@@ -34,9 +35,18 @@
 namespace JITServer {
 // When adding another compatibility mask/flag, also add a new message in
 // CommunicationStream::showFullVersionIncompatibility that handles the new enum value.
+// Flags covered by JITServerNegotiableFlagsMask advertise optional capabilities; they
+// do not need to match between client and server and are never part of the full version.
+// The client appends them after the arguments of its first compilation request, where a
+// server that does not know about them ignores them, and the server echoes the ones it
+// accepted in the metadata of its replies. A capability is used on a connection only once
+// both peers have advertised it.
 enum JITServerCompatibilityFlags {
     JITServerJavaVersionMask = 0x00000FFF,
     JITServerCompressedRef = 0x00001000,
+    JITServerNegotiableFlagsMask = 0x00FF0000,
+    JITServerMsgCompressionZlib = 0x00010000,
+    JITServerMsgCompressionMask = 0x000F0000, // Room for other codecs; at most one of them is used on a connection
 };
 
 class CommunicationStream {
@@ -54,6 +64,14 @@ public:
 #if defined(MESSAGE_SIZE_STATS)
     static TR_Stats _msgSizeStats[MessageType::MessageType_MAXTYPE];
 #endif /* defined(MESSAGE_SIZE_STATS) */
+    // Statistics for received messages that were compressed on the wire
+    static uint32_t _msgCompressedCount[MessageType::MessageType_MAXTYPE];
+    static uint64_t _msgUncompressedSize[MessageType::MessageType_MAXTYPE];
+    static uint64_t _msgCompressedSize[MessageType::MessageType_MAXTYPE];
+    static uint64_t _totalWireMsgSize; // Bytes actually received, after compression
+#if defined(MESSAGE_SIZE_STATS)
+    static TR_Stats _msgCompressionRatioStats[MessageType::MessageType_MAXTYPE];
+#endif /* defined(MESSAGE_SIZE_STATS) */
 
     static void initConfigurationFlags();
 
@@ -71,7 +89,16 @@ public:
 
     static uint64_t getJITServerFullVersion()
     {
-        return Message::buildFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
+        return Message::buildFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS & ~JITServerNegotiableFlagsMask);
+    }
+
+    /**
+       @brief Remove the negotiable capability flags from a full version, so
+       that it can be compared with getJITServerFullVersion()
+    */
+    static uint64_t stripNegotiableFlags(uint64_t fullVersion)
+    {
+        return fullVersion & ~(((uint64_t)JITServerNegotiableFlagsMask) << 32);
     }
 
     static std::string showFullVersionIncompatibility(uint64_t serverFullVersion, uint64_t clientFullVersion);
@@ -89,6 +116,8 @@ protected:
     CommunicationStream()
         : _ssl(NULL)
         , _connfd(-1)
+        , _compressionFlags(0)
+        , _compressor(NULL)
     {}
 
     virtual ~CommunicationStream()
@@ -97,6 +126,10 @@ protected:
             (*OBIO_free_all)(_ssl);
         if (_connfd != -1)
             close(_connfd);
+        if (_compressor) {
+            _compressor->~StreamCompressor();
+            TR::Compiler->rawAllocator.deallocate(_compressor);
+        }
     }
 
     void initStream(int connfd, BIO *ssl)
@@ -112,8 +145,19 @@ protected:
 
     int getConnFD() const { return _connfd; }
 
+    /**
+       @brief Select the compression codec for outgoing messages on this connection
+
+       @param peerFlags negotiable flags advertised by the peer
+
+       @return the codec flag selected, or 0 if outgoing messages will not be compressed
+    */
+    uint32_t negotiateCompression(uint32_t peerFlags);
+
     BIO *_ssl; // SSL connection, null if not using SSL
     int _connfd;
+    uint32_t _compressionFlags; // Negotiated JITServerMsgCompression* flag, 0 if compression is off
+    StreamCompressor *_compressor; // Allocated when the first compressed message is sent or received
     ServerMessage _sMsg;
     ClientMessage _cMsg;
 
@@ -133,6 +177,8 @@ protected:
     static uint32_t CONFIGURATION_FLAGS;
 
 private:
+    StreamCompressor *getCompressor();
+
     void readBlocking(char *data, size_t size)
     {
         size_t totalBytesRead = 0;
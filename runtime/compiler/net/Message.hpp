@@ -355,6 +355,14 @@ public:
 
     uint32_t getBufferCapacity() const { return _buffer.getCapacity(); }
 
+    /**
+       @brief Exchange the storage of the internal buffer with another buffer
+
+       This is used to install the contents of a decompressed message
+       without copying them.
+    */
+    void swapBuffer(MessageBuffer &other) { _buffer.swap(other); }
+
     /**
        @brief Get the pointer to the start of the buffer.
 
@@ -385,7 +393,18 @@ protected:
     MessageBuffer _buffer; // Buffer used for send/receive operations
 };
 
-class ServerMessage : public Message {};
+class ServerMessage : public Message {
+public:
+    /**
+       @brief Get the negotiable capability flags accepted by the server for this connection
+
+       The server reuses the _config field of the metadata to tell the
+       client which of the negotiable flags it advertised are in use.
+    */
+    uint32_t negotiatedFlags() const { return getMetaData()->_config; }
+
+    void setNegotiatedFlags(uint32_t flags) { getMetaData()->_config = flags; }
+};
 
 class ClientMessage : public Message {
 public:
@@ -408,6 +427,31 @@ public:
         metaData->_version = 0;
         metaData->_config = 0;
     }
+
+    /**
+       @brief Append the negotiable capability flags of the client after the data points
+
+       The flags are not part of the full version, which the server compares
+       for equality. A server that does not know about them only reads the
+       number of data points given in the metadata, and ignores the rest of
+       the message. Must be called after the data points have been written.
+    */
+    void appendCapabilities(uint32_t flags) { _buffer.writeValue(flags); }
+
+    /**
+       @brief Read the capability flags appended after the data points
+
+       Must be called after the message has been deserialized.
+
+       @return The flags appended by the client, or 0 if there are none
+    */
+    uint32_t readCapabilities()
+    {
+        uint32_t serializedSize = *_buffer.getValueAtOffset<uint32_t>(0);
+        if (serializedSize < _buffer.size() + sizeof(uint32_t))
+            return 0;
+        return *_buffer.getValueAtOffset<uint32_t>(_buffer.readValue<uint32_t>());
+    }
 };
 }; // namespace JITServer
 #endif
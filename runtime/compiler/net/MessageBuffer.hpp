@@ -23,6 +23,7 @@
 #ifndef MESSAGE_BUFFER_H
 #define MESSAGE_BUFFER_H
 
+#include <utility>
 #include "env/jittypes.h"
 #include "env/TRMemory.hpp"
 #include "OMR/Bytes.hpp" // for alignNoCheck
@@ -191,6 +192,21 @@ public:
 
     uint32_t getCapacity() const { return _capacity; }
 
+    /**
+       @brief Exchange the underlying storage with another buffer.
+
+       Both buffers must have been allocated with the same allocator,
+       which is always the case for buffers created in the same process.
+
+       @param other the buffer whose storage is exchanged with this one
+    */
+    void swap(MessageBuffer &other)
+    {
+        std::swap(_capacity, other._capacity);
+        std::swap(_storage, other._storage);
+        std::swap(_curPtr, other._curPtr);
+    }
+
     // Must be called before any client-server communication takes place
     static void initTotalBuffersMonitor()
     {
@@ -21,19 +21,61 @@
  *******************************************************************************/
 
 #include "ServerStream.hpp"
+#include "AtomicSupport.hpp"
+#include "env/CompilerEnv.hpp"
+#include "runtime/MetricsHistogram.hpp"
 
 namespace JITServer {
 int ServerStream::_numConnectionsOpened = 0;
 int ServerStream::_numConnectionsClosed = 0;
+MetricsHistogram *ServerStream::_msgLatencyHistograms = NULL;
+MetricsHistogram *ServerStream::_msgSizeHistograms = NULL;
 
 ServerStream::ServerStream(int connfd, BIO *ssl)
     : CommunicationStream()
+    , _msgStartTime(0)
 {
     initStream(connfd, ssl);
     _numConnectionsOpened++;
     _pClientSessionData = NULL;
 }
 
+bool ServerStream::enableMessageMetrics()
+{
+    if (!_msgLatencyHistograms) {
+        MetricsHistogram *sizeHistograms = MetricsHistogram::allocateArray(MessageType_MAXTYPE);
+        MetricsHistogram *latencyHistograms = MetricsHistogram::allocateArray(MessageType_MAXTYPE);
+        if (!sizeHistograms || !latencyHistograms) {
+            if (sizeHistograms)
+                TR_Memory::jitPersistentFree(sizeHistograms);
+            if (latencyHistograms)
+                TR_Memory::jitPersistentFree(latencyHistograms);
+            return false;
+        }
+        // Streams test the latency histograms first, so they must be published last
+        _msgSizeHistograms = sizeHistograms;
+        VM_AtomicSupport::writeBarrier();
+        _msgLatencyHistograms = latencyHistograms;
+    }
+    return true;
+}
+
+void ServerStream::startMessageTimer()
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+    _msgStartTime = omrtime_nano_time();
+}
+
+void ServerStream::recordMessageMetrics()
+{
+    OMRPORT_ACCESS_FROM_OMRPORT(TR::Compiler->omrPortLib);
+    uint64_t latencyUs = (omrtime_nano_time() - _msgStartTime) / 1000;
+    MessageType type = _cMsg.type();
+    uint32_t threadIndex = TR::compInfoPT->getCompThreadId();
+    _msgLatencyHistograms[type].record(latencyUs, threadIndex);
+    _msgSizeHistograms[type].record(_cMsg.serializedSize(), threadIndex);
+}
+
 static bool handleCreateSSLContextError(SSL_CTX *&ctx, const char *errMsg)
 {
     perror(errMsg);
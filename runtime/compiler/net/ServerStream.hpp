@@ -30,6 +30,8 @@
 #include "control/Options.hpp"
 #include "runtime/JITClientSession.hpp"
 
+class MetricsHistogram;
+
 namespace JITServer {
 
 /**
@@ -92,7 +94,10 @@ public:
         }
 
         _sMsg.setType(type);
+        _sMsg.setNegotiatedFlags(_compressionFlags);
         setArgsRaw<Args...>(_sMsg, args...);
+        if (_msgLatencyHistograms)
+            startMessageTimer();
         writeMessage(_sMsg);
     }
 
@@ -128,6 +133,8 @@ public:
                     throw StreamMessageTypeMismatch(_sMsg.type(), _cMsg.type());
             }
         }
+        if (_msgLatencyHistograms)
+            recordMessageMetrics();
         return getArgsRaw<T...>(_cMsg);
     }
 
@@ -149,9 +156,14 @@ public:
     template<typename... T> MessageType readCompileRequest(std::tuple<T...> &req, std::string &cacheName)
     {
         readMessage(_cMsg);
-        if (_cMsg.fullVersion() != 0 && _cMsg.fullVersion() != getJITServerFullVersion()) {
-            throw StreamVersionIncompatible(
-                showFullVersionIncompatibility(getJITServerFullVersion(), _cMsg.fullVersion()));
+        if (_cMsg.fullVersion() != 0) {
+            uint64_t clientFullVersion = stripNegotiableFlags(_cMsg.fullVersion());
+            if (clientFullVersion != getJITServerFullVersion()) {
+                throw StreamVersionIncompatible(
+                    showFullVersionIncompatibility(getJITServerFullVersion(), clientFullVersion));
+            }
+            // Optional capabilities advertised by the client follow the arguments of the first request
+            negotiateCompression(_cMsg.readCapabilities());
         }
 
         switch (_cMsg.type()) {
@@ -230,6 +242,10 @@ public:
         }
     }
 
+    int getConnectionFD() const { return getConnFD(); }
+
+    BIO *getSSLBIO() const { return _ssl; }
+
     void setClientId(uint64_t clientId) { _clientId = clientId; }
 
     uint64_t getClientId() const { return _clientId; }
@@ -251,6 +267,17 @@ public:
 
     static int getNumConnectionsClosed() { return _numConnectionsClosed; }
 
+    /**
+       @brief Start collecting round-trip latency (usec) and reply size (bytes) histograms
+       for the queries that the server sends to its clients, one histogram per MessageType
+       @return true if the histograms are allocated
+    */
+    static bool enableMessageMetrics();
+
+    static const MetricsHistogram *getMessageLatencyHistograms() { return _msgLatencyHistograms; }
+
+    static const MetricsHistogram *getMessageSizeHistograms() { return _msgSizeHistograms; }
+
     /**
        @brief Create an SSL_CTX suitable for a server
     */
@@ -259,10 +286,16 @@ public:
         const std::string &sslRootCerts);
 
 private:
+    void startMessageTimer();
+    void recordMessageMetrics();
+
     static int _numConnectionsOpened;
     static int _numConnectionsClosed;
+    static MetricsHistogram *_msgLatencyHistograms; // NULL unless the MetricsServer is enabled
+    static MetricsHistogram *_msgSizeHistograms;
     uint64_t _clientId; // UID of client connected to this communication stream
     ClientSessionData *_pClientSessionData;
+    uint64_t _msgStartTime; // ns; when the last query was sent to the client
 };
 
 } // namespace JITServer
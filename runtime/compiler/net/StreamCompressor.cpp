@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <cstring>
+#include "env/CompilerEnv.hpp"
+#include "net/Message.hpp"
+#include "net/StreamCompressor.hpp"
+#include "net/StreamExceptions.hpp"
+
+namespace JITServer {
+
+static voidpf compressorAlloc(voidpf opaque, uInt items, uInt size)
+{
+    return TR::Compiler->rawAllocator.allocate((size_t)items * size, std::nothrow);
+}
+
+static void compressorFree(voidpf opaque, voidpf address)
+{
+    TR::Compiler->rawAllocator.deallocate(address);
+}
+
+StreamCompressor::StreamCompressor(int32_t level)
+{
+    memset(&_deflateStream, 0, sizeof(_deflateStream));
+    memset(&_inflateStream, 0, sizeof(_inflateStream));
+    _deflateStream.zalloc = compressorAlloc;
+    _deflateStream.zfree = compressorFree;
+    _inflateStream.zalloc = compressorAlloc;
+    _inflateStream.zfree = compressorFree;
+
+    if (deflateInit(&_deflateStream, level) != Z_OK)
+        throw std::bad_alloc();
+    if (inflateInit(&_inflateStream) != Z_OK) {
+        deflateEnd(&_deflateStream);
+        throw std::bad_alloc();
+    }
+}
+
+StreamCompressor::~StreamCompressor()
+{
+    deflateEnd(&_deflateStream);
+    inflateEnd(&_inflateStream);
+}
+
+const char *StreamCompressor::compress(const char *serialMsg, uint32_t serializedSize, uint32_t &frameSize)
+{
+    TR_ASSERT_FATAL(!(serializedSize & COMPRESSED_FRAME_FLAG), "Message of size %u is too large to be compressed",
+        serializedSize);
+
+    uint32_t payloadSize = serializedSize - sizeof(uint32_t);
+    _compressBuffer.clear();
+    // A sync flush adds a few bytes on top of the deflate bound
+    _compressBuffer.expandIfNeeded(FRAME_HEADER_SIZE + deflateBound(&_deflateStream, payloadSize) + 16);
+
+    _deflateStream.next_in = (Bytef *)(serialMsg + sizeof(uint32_t));
+    _deflateStream.avail_in = payloadSize;
+    uint32_t compressedSize = FRAME_HEADER_SIZE;
+    while (true) {
+        uint32_t capacity = _compressBuffer.getCapacity();
+        _deflateStream.next_out = (Bytef *)(_compressBuffer.getBufferStart() + compressedSize);
+        _deflateStream.avail_out = capacity - compressedSize;
+        int ret = deflate(&_deflateStream, Z_SYNC_FLUSH);
+        if ((ret != Z_OK) && (ret != Z_BUF_ERROR))
+            throw JITServer::StreamFailure("JITServer I/O error: message compression failed");
+        compressedSize = capacity - _deflateStream.avail_out;
+
+        // The flush is complete only if deflate did not fill the whole output buffer
+        if (_deflateStream.avail_out != 0)
+            break;
+        _compressBuffer.expand(capacity + 1, compressedSize);
+    }
+
+    uint32_t *header = reinterpret_cast<uint32_t *>(_compressBuffer.getBufferStart());
+    header[0] = compressedSize | COMPRESSED_FRAME_FLAG;
+    header[1] = serializedSize;
+    frameSize = compressedSize;
+    return _compressBuffer.getBufferStart();
+}
+
+uint32_t StreamCompressor::decompress(Message &msg, uint32_t frameSize)
+{
+    if (frameSize < FRAME_HEADER_SIZE)
+        throw JITServer::StreamFailure("JITServer I/O error: compressed message is too small");
+
+    char *frame = msg.getBufferStartForRead();
+    uint32_t serializedSize = reinterpret_cast<uint32_t *>(frame)[1];
+    if ((serializedSize < sizeof(uint32_t)) || (serializedSize & COMPRESSED_FRAME_FLAG))
+        throw JITServer::StreamFailure("JITServer I/O error: invalid size of compressed message");
+
+    // One extra byte of output space lets inflate consume the trailing empty block
+    // written by the sync flush even when the message data fills the buffer exactly
+    uint32_t payloadSize = serializedSize - sizeof(uint32_t);
+    _inflateBuffer.clear();
+    _inflateBuffer.expandIfNeeded(serializedSize + 1);
+
+    _inflateStream.next_in = (Bytef *)(frame + FRAME_HEADER_SIZE);
+    _inflateStream.avail_in = frameSize - FRAME_HEADER_SIZE;
+    _inflateStream.next_out = (Bytef *)(_inflateBuffer.getBufferStart() + sizeof(uint32_t));
+    _inflateStream.avail_out = payloadSize + 1;
+    int ret = inflate(&_inflateStream, Z_SYNC_FLUSH);
+    if (((ret != Z_OK) && (ret != Z_BUF_ERROR)) || (_inflateStream.avail_in != 0)
+        || (_inflateStream.avail_out != 1))
+        throw JITServer::StreamFailure("JITServer I/O error: message decompression failed");
+
+    // The message takes over the storage holding the uncompressed data,
+    // while the old message storage is kept around for the next frame
+    msg.swapBuffer(_inflateBuffer);
+    return serializedSize;
+}
+}; // namespace JITServer
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef STREAM_COMPRESSOR_H
+#define STREAM_COMPRESSOR_H
+
+#include "zlib.h"
+#include "net/MessageBuffer.hpp"
+
+namespace JITServer {
+class Message;
+
+/**
+   @class StreamCompressor
+   @brief Compression state of one JITServer connection.
+
+   A compressed message is sent as a frame with the following layout:
+   ------------------------------------------------------------------------------
+   | frameSize | COMPRESSED_FRAME_FLAG | serializedSize | compressed message data |
+   ------------------------------------------------------------------------------
+   where frameSize includes the two header words, serializedSize is the size of the
+   original message and the compressed data covers the original message without its
+   leading size word. Uncompressed messages keep their regular format, so the two
+   kinds of messages can be freely mixed on the same connection.
+
+   Each direction of a connection uses its own zlib stream, which is flushed (but not
+   finished) at the end of every compressed message. This way the dictionary built
+   from earlier messages is reused when compressing later ones, which matters for the
+   many small, repetitive messages exchanged during a compilation.
+*/
+class StreamCompressor {
+public:
+    static const uint32_t COMPRESSED_FRAME_FLAG = 0x80000000;
+    static const uint32_t FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+    /**
+       @brief Constructor
+
+       @param level zlib compression level used for outgoing messages
+
+       Throws std::bad_alloc if the zlib streams cannot be initialized.
+    */
+    explicit StreamCompressor(int32_t level);
+    ~StreamCompressor();
+
+    /**
+       @brief Compress a serialized message into a frame.
+
+       @param [in] serialMsg pointer to the serialized message, starting with its size
+       @param [in] serializedSize size of the serialized message
+       @param [out] frameSize size of the resulting frame
+
+       @return pointer to the frame; valid until the next call to compress()
+    */
+    const char *compress(const char *serialMsg, uint32_t serializedSize, uint32_t &frameSize);
+
+    /**
+       @brief Decompress a frame that has been read into the buffer of a message.
+
+       On return the message buffer holds the uncompressed message, ready for
+       Message::setSerializedSize() and Message::deserialize().
+
+       @param msg message whose buffer contains the whole compressed frame
+       @param frameSize size of the compressed frame
+
+       @return size of the uncompressed message
+    */
+    uint32_t decompress(Message &msg, uint32_t frameSize);
+
+private:
+    z_stream _deflateStream;
+    z_stream _inflateStream;
+    MessageBuffer _compressBuffer; // Holds the last compressed frame sent
+    MessageBuffer _inflateBuffer; // Storage exchanged with the message buffer after decompression
+};
+}; // namespace JITServer
+
+#endif // STREAM_COMPRESSOR_H
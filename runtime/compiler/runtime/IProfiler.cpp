@@ -546,6 +546,11 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
     , _iprofilerMonitor(NULL)
     , _crtProfilingBuffer(NULL)
     , _iprofilerNumRecords(0)
+    , _numSamplesAggregated(0)
+    , _numBuffersProcessedByIProfilerThread(0)
+    , _totalBufferQueueTime(0)
+    , _maxBufferQueueTime(0)
+    , _totalBufferProcessingTime(0)
     , _numMethodHashEntries(0)
     , _iprofilerThreadLifetimeState(TR_IprofilerThreadLifetimeStates::IPROF_THR_NOT_CREATED)
 {
@@ -1475,6 +1480,68 @@ TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSample(uintptr_t pc, uintptr
     return entry;
 }
 
+// Number of slots in the table used by parseBuffer to merge identical samples; must be a power of 2.
+// A default size buffer holds fewer samples than this.
+static const uint32_t IP_AGGREGATION_TABLE_SIZE = 128;
+static const uint32_t IP_AGGREGATION_MAX_PROBES = 4;
+
+void TR_IProfiler::aggregateSample(TR_IPAggregatedSample *table, uintptr_t pc, uintptr_t data, uint32_t order)
+{
+    uint32_t firstSlot = (uint32_t)(((pc ^ (data >> 3)) * 2654435761u) >> 8) & (IP_AGGREGATION_TABLE_SIZE - 1);
+    uint32_t slot = firstSlot;
+    for (uint32_t probe = 0; probe < IP_AGGREGATION_MAX_PROBES; probe++) {
+        TR_IPAggregatedSample &sample = table[slot];
+        if (sample._count == 0) {
+            sample._pc = pc;
+            sample._data = data;
+            sample._count = 1;
+            sample._order = order;
+            return;
+        }
+        if (sample._pc == pc && sample._data == data) {
+            sample._count++;
+            return;
+        }
+        slot = (slot + 1) & (IP_AGGREGATION_TABLE_SIZE - 1);
+    }
+
+    // No room nearby; make room by adding the samples from the first slot to the hash table
+    TR_IPAggregatedSample &victim = table[firstSlot];
+    addAggregatedSample(victim);
+    victim._pc = pc;
+    victim._data = data;
+    victim._count = 1;
+    victim._order = order;
+}
+
+void TR_IProfiler::addAggregatedSample(const TR_IPAggregatedSample &sample)
+{
+    // Only the first sample needs to look up the entry in the hash table
+    TR_IPBytecodeHashTableEntry *entry = profilingSample(sample._pc, sample._data, true);
+    for (uint32_t i = 1; entry && i < sample._count; i++)
+        addSampleData(entry, sample._data);
+    _numSamplesAggregated += sample._count - 1;
+}
+
+void TR_IProfiler::flushAggregatedSamples(TR_IPAggregatedSample *table)
+{
+    // Compact the used slots and add them in PC order, so that the samples
+    // of the same method touch the bytecodes and hash table entries together.
+    // Samples with the same PC keep the order in which they were first seen,
+    // which is the order in which the unaggregated path would have added them.
+    uint32_t numSamples = 0;
+    for (uint32_t i = 0; i < IP_AGGREGATION_TABLE_SIZE; i++) {
+        if (table[i]._count)
+            table[numSamples++] = table[i];
+    }
+    std::sort(table, table + numSamples,
+        [](const TR_IPAggregatedSample &a, const TR_IPAggregatedSample &b) { return a._order < b._order; });
+    std::stable_sort(table, table + numSamples,
+        [](const TR_IPAggregatedSample &a, const TR_IPAggregatedSample &b) { return a._pc < b._pc; });
+    for (uint32_t i = 0; i < numSamples; i++)
+        addAggregatedSample(table[i]);
+}
+
 TR_IPBytecodeHashTableEntry *TR_IProfiler::profilingSampleRI(uintptr_t pc, uintptr_t data, bool addIt, uint32_t freq)
 {
     return profilingSample(pc, data, addIt, true, freq);
@@ -2298,7 +2365,22 @@ void TR_IProfiler::outputStats()
         fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n",
             _numRequestsHandedToIProfilerThread);
     }
+    if (options && !options->getOption(TR_DisableIProfilerThread)) {
+        if (_numRequests)
+            fprintf(stderr, "IProfiler: Percentage of buffers dropped or discarded  =%.2f%%\n",
+                100.0 * (_numRequestsDropped + _numRequestsSkipped) / _numRequests);
+        if (_numBuffersProcessedByIProfilerThread) {
+            fprintf(stderr,
+                "IProfiler: Average time in working queue (usec)        =%" OMR_PRIu64 " max=%" OMR_PRIu64 "\n",
+                _totalBufferQueueTime / _numBuffersProcessedByIProfilerThread, _maxBufferQueueTime);
+            fprintf(stderr, "IProfiler: Average buffer processing time (usec)       =%" OMR_PRIu64 "\n",
+                _totalBufferProcessingTime / _numBuffersProcessedByIProfilerThread);
+        }
+    }
     fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
+    if (TR::Options::_iprofilerAggregateSamples)
+        fprintf(stderr, "IProfiler: Number of records merged before insertion=%" OMR_PRIu64 "\n",
+            _numSamplesAggregated);
     fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
     fprintf(stderr, "IProfiler: Number of methodHash entries=%u\n", _numMethodHashEntries);
     checkMethodHashTable();
@@ -3454,6 +3536,7 @@ bool TR_IProfiler::postIprofilingBufferToWorkingQueue(J9VMThread *vmThread, cons
     freeBuffer->setBuffer((U_8 *)dataStart);
     freeBuffer->setSize(size);
     freeBuffer->setIsInvalidated(false); // reset while holding VM access
+    freeBuffer->setPostTime(j9time_usec_clock());
     _workingBufferList.insertAfter(_workingBufferTail, freeBuffer);
     _workingBufferTail = freeBuffer;
 
@@ -3550,6 +3633,9 @@ void TR_IProfiler::processWorkingQueue()
             TR_ASSERT_FATAL(_crtProfilingBuffer->getSize() > 0, "size of _crtProfilingBuffer (%p) <= 0",
                 _crtProfilingBuffer);
 
+            uint64_t startTime = j9time_usec_clock();
+            uint64_t queueTime = startTime - _crtProfilingBuffer->getPostTime();
+
             // process the buffer after acquiring VM access
             acquireVMAccessNoSuspend(_iprofilerThread); // blocking. Will wait for the entire GC
             // Check to see if GC has invalidated this buffer
@@ -3558,6 +3644,13 @@ void TR_IProfiler::processWorkingQueue()
             }
             releaseVMAccess(_iprofilerThread);
 
+            // Statistics are only updated by the IProfiler thread
+            _numBuffersProcessedByIProfilerThread++;
+            _totalBufferQueueTime += queueTime;
+            if (queueTime > _maxBufferQueueTime)
+                _maxBufferQueueTime = queueTime;
+            _totalBufferProcessingTime += j9time_usec_clock() - startTime;
+
             // attach the buffer to the buffer pool
             _iprofilerMonitor->enter();
             _freeBufferList.add(_crtProfilingBuffer);
@@ -3689,6 +3782,13 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDAT
 
     bool isClassLoadPhase = _compInfo->getPersistentInfo()->isClassLoadingPhase();
 
+    // Identical samples (same PC and data) can be merged and added to the hash table
+    // with a single lookup, instead of one lookup per sample
+    bool aggregateSamples = TR::Options::_iprofilerAggregateSamples && !verboseReparse;
+    TR_IPAggregatedSample aggregationTable[IP_AGGREGATION_TABLE_SIZE];
+    if (aggregateSamples)
+        memset(aggregationTable, 0, sizeof(aggregationTable));
+
     int32_t skipCountMain = 20 + (rand() % 10); // TODO: Use the main TR_RandomGenerator from jitconfig?
     int32_t skipCount = skipCountMain;
     bool profileFlag = true;
@@ -3869,11 +3969,17 @@ UDATA TR_IProfiler::parseBuffer(J9VMThread *vmThread, const U_8 *dataStart, UDAT
         }
 
         if (addSample && !verboseReparse) {
-            profilingSample((uintptr_t)pc, (uintptr_t)data, true);
+            if (aggregateSamples)
+                aggregateSample(aggregationTable, (uintptr_t)pc, (uintptr_t)data, (uint32_t)records);
+            else
+                profilingSample((uintptr_t)pc, (uintptr_t)data, true);
             records++;
         }
     }
 
+    if (aggregateSamples)
+        flushAggregatedSamples(aggregationTable);
+
     if (cursor != dataStart + size) {
         TR_ASSERT(false, "Iprofiler parser overran buffer");
         return 0;
@@ -744,12 +744,25 @@ public:
 
     void setIsInvalidated(bool b) { _isInvalidated = b; }
 
+    uint64_t getPostTime() const { return _postTime; }
+
+    void setPostTime(uint64_t t) { _postTime = t; }
+
 private:
     U_8 *_buffer;
     UDATA _size;
+    uint64_t _postTime; // usec; when the buffer was posted to the working queue
     volatile bool _isInvalidated;
 };
 
+// Samples from one IProfiler buffer that have the same PC and data
+struct TR_IPAggregatedSample {
+    uintptr_t _pc;
+    uintptr_t _data;
+    uint32_t _count;
+    uint32_t _order; // index in the buffer of the first of these samples
+};
+
 class TR_ReadSampleRequestsStats {
     friend class TR_ReadSampleRequestsHistory;
 
@@ -1074,6 +1087,9 @@ private:
     TR_IPBCDataAllocation *findOrCreateAllocEntry(int32_t bucket, uintptr_t pc, bool addIt);
     TR_OpaqueMethodBlock *getMethodFromNode(TR::Node *node, TR::Compilation *comp);
     bool addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data, bool isRIData = false, uint32_t freq = 1);
+    void aggregateSample(TR_IPAggregatedSample *table, uintptr_t pc, uintptr_t data, uint32_t order);
+    void addAggregatedSample(const TR_IPAggregatedSample &sample);
+    void flushAggregatedSamples(TR_IPAggregatedSample *table);
     TR_AbstractInfo *createIProfilingValueInfo(TR::Node *node, TR::Compilation *comp);
 
     bool branchHasSameDirection(TR::ILOpCodes nodeOpCode, TR::Node *node, TR::Compilation *comp);
@@ -1156,6 +1172,11 @@ private:
     uint64_t _numRequestsSkipped;
     uint64_t _numRequestsHandedToIProfilerThread;
     uint64_t _iprofilerNumRecords; // info stats only
+    uint64_t _numSamplesAggregated; // samples merged into an identical sample of the same buffer; info stats only
+    uint64_t _numBuffersProcessedByIProfilerThread;
+    uint64_t _totalBufferQueueTime; // usec spent by buffers in the working queue
+    uint64_t _maxBufferQueueTime; // usec
+    uint64_t _totalBufferProcessingTime; // usec spent by the IProfiler thread to process buffers
 
     TR_IPMethodHashTableEntry **_methodHashTable;
     uint32_t _numMethodHashEntries;
@@ -73,6 +73,7 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
     , _aotCacheKnownIds(decltype(_aotCacheKnownIds)::allocator_type(persistentMemory->_persistentAllocator.get()))
     , _sharedProfileCache(NULL)
     , _classRecordMap(decltype(_classRecordMap)::allocator_type(persistentMemory->_persistentAllocator.get()))
+    , _queueWaitHistogram()
     , _numSharedProfileCacheMethodLoads(0)
     , _numSharedProfileCacheMethodLoadsFailed(0)
     , _numSharedProfileCacheMethodStores(0)
@@ -690,16 +691,19 @@ ProfiledMethodEntry *ClientSessionData::getSharedProfileCacheForMethod(J9Method
 {
     // Convert from J9method to AOTCacheMethodRecord.
     const AOTCacheMethodRecord *methodRecord = NULL;
+    J9MethodInfo *methodInfo = NULL;
     {
         OMR::CriticalSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method);
         TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
+        methodInfo = &it->second;
         methodRecord = getMethodRecord(it->second, method);
     }
     ProfiledMethodEntry *methodProfile = NULL; // Populate later with info from shared profile cache (if any)
     if (methodRecord) {
         OMR::CriticalSection cs(_sharedProfileCache->monitor());
-        methodProfile = _sharedProfileCache->getProfileForMethod(methodRecord);
+        methodProfile = _sharedProfileCache->getProfileForMethod(methodRecord, methodInfo->_romMethod,
+            methodInfo->definingROMClass());
     }
     return methodProfile;
 }
@@ -715,15 +719,18 @@ BytecodeProfileSummary ClientSessionData::getSharedBytecodeProfileSummary(J9Meth
 {
     // Convert from J9method to AOTCacheMethodRecord.
     const AOTCacheMethodRecord *methodRecord = NULL;
+    J9MethodInfo *methodInfo = NULL;
     {
         OMR::CriticalSection cs(getROMMapMonitor());
         auto it = getJ9MethodMap().find(method);
         TR_ASSERT_FATAL(it != getJ9MethodMap().end(), "Method %p must be already cached", method);
+        methodInfo = &it->second;
         methodRecord = getMethodRecord(it->second, method);
     }
     if (methodRecord) {
         OMR::CriticalSection cs(_sharedProfileCache->monitor());
-        ProfiledMethodEntry *methodProfile = _sharedProfileCache->getProfileForMethod(methodRecord);
+        ProfiledMethodEntry *methodProfile = _sharedProfileCache->getProfileForMethod(methodRecord,
+            methodInfo->_romMethod, methodInfo->definingROMClass());
         if (methodProfile)
             return methodProfile->getBytecodeProfileSummary();
     }
@@ -777,7 +784,8 @@ bool ClientSessionData::loadBytecodeDataFromSharedProfileCache(J9Method *method,
 
     {
         OMR::CriticalSection cs(_sharedProfileCache->monitor());
-        ProfiledMethodEntry *methodEntry = _sharedProfileCache->getProfileForMethod(methodRecord);
+        ProfiledMethodEntry *methodEntry = _sharedProfileCache->getProfileForMethod(methodRecord,
+            methodInfo->_romMethod, methodInfo->definingROMClass());
         if (methodEntry) {
             // Get profiling entries from shared profile repo and populate 'newEntries' and 'cgEntries'
             methodEntry->cloneBytecodeData(trMemory, stable, newEntries, cgEntries);
@@ -30,6 +30,7 @@
 #include "env/VMJ9.h" // for TR_StaticFinalData
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerProfileCache.hpp"
+#include "runtime/MetricsHistogram.hpp"
 #include "runtime/SymbolValidationManager.hpp"
 
 class J9ROMClass;
@@ -668,6 +669,8 @@ public:
         return _sharedProfileCache;
     }
 
+    MetricsHistogram &getQueueWaitHistogram() { return _queueWaitHistogram; }
+
     void printSharedProfileCacheStats() const;
     void printIProfilerCacheStats();
     void dumpAllBytecodeProfilingData();
@@ -796,6 +799,8 @@ private:
     // It is used for the sharedProfileCache.
     // NOTE: This map is synchronized with _romMapMonitor
     PersistentUnorderedMap<const AOTCacheClassRecord *, TR_OpaqueClassBlock *> _classRecordMap;
+    // Time (usec) spent by the compilation requests of this client in the compilation queue
+    MetricsHistogram _queueWaitHistogram;
     // Statistics per client regarding the sharedProfileCache
 public:
     uint32_t _numSharedProfileCacheMethodLoads;
@@ -834,6 +839,12 @@ public:
 
     uint32_t size() const { return _clientSessionMap.size(); }
 
+    // The caller must hold the compilation monitor while iterating over the returned map
+    const PersistentUnorderedMap<uint64_t, ClientSessionData *> &getClientSessionMap() const
+    {
+        return _clientSessionMap;
+    }
+
 private:
     PersistentUnorderedMap<uint64_t, ClientSessionData *> _clientSessionMap;
 
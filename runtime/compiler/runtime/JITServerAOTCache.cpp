@@ -23,6 +23,10 @@
 #include <string.h>
 #include <string>
 #include <cstdio> // for rename()
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "AtomicSupport.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "env/J9SegmentProvider.hpp"
 #include "env/StackMemoryRegion.hpp"
@@ -33,18 +37,6 @@
 #include "runtime/JITServerSharedROMClassCache.hpp"
 #include "net/CommunicationStream.hpp"
 
-struct JITServerAOTCacheReadContext {
-    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header, TR::StackMemoryRegion &stackMemoryRegion);
-
-    Vector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
-    Vector<AOTCacheClassRecord *> _classRecords;
-    Vector<AOTCacheMethodRecord *> _methodRecords;
-    Vector<AOTCacheClassChainRecord *> _classChainRecords;
-    Vector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
-    Vector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
-    Vector<AOTCacheThunkRecord *> _thunkRecords;
-};
-
 size_t JITServerAOTCacheMap::_cacheMaxBytes = 300 * 1024 * 1024;
 bool JITServerAOTCacheMap::_cacheIsFull = false;
 
@@ -58,38 +50,27 @@ void *AOTCacheRecord::allocate(size_t size)
 
 void AOTCacheRecord::free(void *ptr) { TR::Compiler->persistentGlobalMemory()->freePersistentMemory(ptr); }
 
-// Read a single AOT cache record R from a cache file
-template<class R> R *AOTCacheRecord::readRecord(FILE *f, const JITServerAOTCacheReadContext &context)
+bool JITServerAOTCacheReader::read(void *dst, size_t size)
 {
-    typename R::SerializationRecord header;
-    if (1 != fread(&header, sizeof(header), 1, f)) {
-        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Could not read %s record header",
-                R::getRecordName());
-        return NULL;
-    }
+    if (size > (size_t)(_end - _cursor))
+        return false;
+    memcpy(dst, _cursor, size);
+    _cursor += size;
+    return true;
+}
 
-    if (!header.isValidHeader(context)) {
+template<class R>
+R *AOTCacheRecord::mapRecord(const AOTSerializationRecord *data, const JITServerAOTCacheReadContext &context)
+{
+    auto header = (const typename R::SerializationRecord *)data;
+    if ((data->size() < sizeof(*header)) || !header->isValidHeader(context) || (data->size() != R::dataSize(*header))) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Header for %s record is invalid",
                 R::getRecordName());
         return NULL;
     }
 
-    R *record = new (AOTCacheRecord::allocate(R::size(header))) R(context, header);
-    memcpy((void *)record->dataAddr(), &header, sizeof(header));
-
-    size_t variableDataBytes = record->dataAddr()->size() - sizeof(header);
-    if (0 != variableDataBytes) {
-        if (1 != fread((uint8_t *)record->dataAddr() + sizeof(header), variableDataBytes, 1, f)) {
-            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                    "AOT cache: Unable to read variable part of %s record", R::getRecordName());
-            AOTCacheRecord::free(record);
-            return NULL;
-        }
-    }
-
+    R *record = new (AOTCacheRecord::allocate(R::mappedSize(*header))) R(context, header);
     if (!record->setSubrecordPointers(context)) {
         AOTCacheRecord::free(record);
         return NULL;
@@ -116,7 +97,7 @@ ClassLoaderSerializationRecord::ClassLoaderSerializationRecord(uintptr_t id, con
 }
 
 AOTCacheClassLoaderRecord::AOTCacheClassLoaderRecord(uintptr_t id, const uint8_t *name, size_t nameLength)
-    : _data(id, name, nameLength)
+    : _data(new (this + 1) ClassLoaderSerializationRecord(id, name, nameLength))
 {}
 
 AOTCacheClassLoaderRecord *AOTCacheClassLoaderRecord::create(uintptr_t id, const uint8_t *name, size_t nameLength)
@@ -156,13 +137,14 @@ AOTCacheClassRecord::AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoader
     const JITServerROMClassHash &hash, uint32_t romClassSize, bool generated, const J9ROMClass *romClass,
     const J9ROMClass *baseComponent, uint32_t numDimensions, uint32_t nameLength)
     : _classLoaderRecord(classLoaderRecord)
-    , _data(id, classLoaderRecord->data().id(), hash, romClassSize, generated, romClass, baseComponent, numDimensions,
-          nameLength)
+    , _data(new (this + 1) ClassSerializationRecord(id, classLoaderRecord->data().id(), hash, romClassSize, generated,
+          romClass, baseComponent, numDimensions, nameLength))
 {}
 
 AOTCacheClassRecord::AOTCacheClassRecord(const JITServerAOTCacheReadContext &context,
-    const ClassSerializationRecord &header)
-    : _classLoaderRecord(context._classLoaderRecords[header.classLoaderId()])
+    const ClassSerializationRecord *data)
+    : _classLoaderRecord(context._classLoaderRecords[data->classLoaderId()])
+    , _data(data)
 {}
 
 AOTCacheClassRecord *AOTCacheClassRecord::create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
@@ -200,18 +182,19 @@ bool MethodSerializationRecord::isValidHeader(const JITServerAOTCacheReadContext
 
 AOTCacheMethodRecord::AOTCacheMethodRecord(uintptr_t id, const AOTCacheClassRecord *definingClassRecord, uint32_t index)
     : _definingClassRecord(definingClassRecord)
-    , _data(id, definingClassRecord->data().id(), index)
+    , _data(new (this + 1) MethodSerializationRecord(id, definingClassRecord->data().id(), index))
 {}
 
 AOTCacheMethodRecord::AOTCacheMethodRecord(const JITServerAOTCacheReadContext &context,
-    const MethodSerializationRecord &header)
-    : _definingClassRecord(context._classRecords[header.definingClassId()])
+    const MethodSerializationRecord *data)
+    : _definingClassRecord(context._classRecords[data->definingClassId()])
+    , _data(data)
 {}
 
 AOTCacheMethodRecord *AOTCacheMethodRecord::create(uintptr_t id, const AOTCacheClassRecord *definingClassRecord,
     uint32_t index)
 {
-    void *ptr = AOTCacheRecord::allocate(sizeof(AOTCacheMethodRecord));
+    void *ptr = AOTCacheRecord::allocate(size());
     return new (ptr) AOTCacheMethodRecord(id, definingClassRecord, index);
 }
 
@@ -246,7 +229,7 @@ static void listClassSubRecordsDo(const D &data, const R * const *subRecords,
 // array of an already-allocated record of that type by copying the matching R pointers from cacheRecords into
 // subRecords using the given serialization record data.
 template<class D, class R>
-static bool listClassSetSubrecordPointers(const D &data, R **subRecords, const Vector<R *> &cacheRecords,
+static bool listClassSetSubrecordPointers(const D &data, R **subRecords, const PersistentVector<R *> &cacheRecords,
     const char *recordName, const char *subrecordName)
 {
     for (size_t i = 0; i < data.list().length(); ++i) {
@@ -274,9 +257,9 @@ ClassChainSerializationRecord::ClassChainSerializationRecord()
 
 AOTCacheClassChainRecord::AOTCacheClassChainRecord(uintptr_t id, const AOTCacheClassRecord * const *records,
     size_t length)
-    : _data(id, length)
+    : _data(new (inlineData(this, length)) ClassChainSerializationRecord(id, length))
 {
-    listClassCopyRecords(_data.list().ids(), (void *)this->records(), id, records, length);
+    listClassCopyRecords(inlineData(this, length)->list().ids(), (void *)this->records(), id, records, length);
 }
 
 void AOTCacheClassChainRecord::subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const
@@ -311,9 +294,9 @@ WellKnownClassesSerializationRecord::WellKnownClassesSerializationRecord()
 
 AOTCacheWellKnownClassesRecord::AOTCacheWellKnownClassesRecord(uintptr_t id,
     const AOTCacheClassChainRecord * const *records, size_t length, uintptr_t includedClasses)
-    : _data(id, length, includedClasses)
+    : _data(new (inlineData(this, length)) WellKnownClassesSerializationRecord(id, length, includedClasses))
 {
-    listClassCopyRecords(_data.list().ids(), (void *)this->records(), id, records, length);
+    listClassCopyRecords(inlineData(this, length)->list().ids(), (void *)this->records(), id, records, length);
 }
 
 void AOTCacheWellKnownClassesRecord::subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const
@@ -345,12 +328,12 @@ AOTHeaderSerializationRecord::AOTHeaderSerializationRecord()
 {}
 
 AOTCacheAOTHeaderRecord::AOTCacheAOTHeaderRecord(uintptr_t id, const TR_AOTHeader *header)
-    : _data(id, header)
+    : _data(new (this + 1) AOTHeaderSerializationRecord(id, header))
 {}
 
 AOTCacheAOTHeaderRecord *AOTCacheAOTHeaderRecord::create(uintptr_t id, const TR_AOTHeader *header)
 {
-    void *ptr = AOTCacheRecord::allocate(sizeof(AOTCacheAOTHeaderRecord));
+    void *ptr = AOTCacheRecord::allocate(size());
     return new (ptr) AOTCacheAOTHeaderRecord(id, header);
 }
 
@@ -372,7 +355,7 @@ ThunkSerializationRecord::ThunkSerializationRecord()
 
 AOTCacheThunkRecord::AOTCacheThunkRecord(uintptr_t id, const uint8_t *signature, uint32_t signatureSize,
     const uint8_t *thunkStart, uint32_t thunkSize)
-    : _data(id, signature, signatureSize, thunkStart, thunkSize)
+    : _data(new (this + 1) ThunkSerializationRecord(id, signature, signatureSize, thunkStart, thunkSize))
 {}
 
 AOTCacheThunkRecord *AOTCacheThunkRecord::create(uintptr_t id, const uint8_t *signature, uint32_t signatureSize,
@@ -427,14 +410,19 @@ CachedAOTMethod::CachedAOTMethod(const AOTCacheClassChainRecord *definingClassCh
     const UnorderedMap<uintptr_t, bool> &dependencies, const void *code, size_t codeSize, const void *data,
     size_t dataSize, const char *signature, size_t signatureSize)
     : _nextRecord(NULL)
-    , _data(definingClassChainRecord->data().id(), index, optLevel, aotHeaderRecord->data().id(), records.size(),
-          dependencies.size(), code, codeSize, data, dataSize, signature, signatureSize)
     , _definingClassChainRecord(definingClassChainRecord)
-{
+    , _data(new (inlineData(this, records.size(), dependencies.size())) SerializedAOTMethod(
+          definingClassChainRecord->data().id(), index, optLevel, aotHeaderRecord->data().id(), records.size(),
+          dependencies.size(), code, codeSize, data, dataSize, signature, signatureSize))
+    , _serializedSize(_data->size())
+    , _subRecords((AOTCacheRecord **)(this + 1))
+    , _state(Resolved)
+{
+    SerializedAOTMethod *serializedMethod = inlineData(this, records.size(), dependencies.size());
     for (size_t i = 0; i < records.size(); ++i) {
         const AOTSerializationRecord *record = records[i].first->dataAddr();
-        new (&_data.offsets()[i]) SerializedSCCOffset(record->id(), record->type(), records[i].second);
-        ((const AOTCacheRecord **)this->records())[i] = records[i].first;
+        new (&serializedMethod->offsets()[i]) SerializedSCCOffset(record->id(), record->type(), records[i].second);
+        _subRecords[i] = (AOTCacheRecord *)records[i].first;
     }
 
     size_t i = 0;
@@ -442,14 +430,19 @@ CachedAOTMethod::CachedAOTMethod(const AOTCacheClassChainRecord *definingClassCh
         AOTCacheRecord *r = (AOTCacheRecord *)it->first;
         bool ensureClassInitialized = it->second;
         const AOTSerializationRecord *record = r->dataAddr();
-        new (&_data.deps()[i]) SerializedAOTDependency(record->id(), record->type(), ensureClassInitialized);
-        ((const AOTCacheRecord **)this->deps())[i] = r;
+        new (&serializedMethod->deps()[i]) SerializedAOTDependency(record->id(), record->type(), ensureClassInitialized);
+        _subRecords[records.size() + i] = r;
     }
 }
 
-CachedAOTMethod::CachedAOTMethod(const JITServerAOTCacheReadContext &context, const SerializedAOTMethod &header)
+CachedAOTMethod::CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord,
+    const SerializedAOTMethod *data, size_t size)
     : _nextRecord(NULL)
-    , _definingClassChainRecord(context._classChainRecords[header.definingClassChainId()])
+    , _definingClassChainRecord(definingClassChainRecord)
+    , _data(data)
+    , _serializedSize(size)
+    , _subRecords(NULL)
+    , _state(Unresolved)
 {}
 
 CachedAOTMethod *CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index,
@@ -464,6 +457,70 @@ CachedAOTMethod *CachedAOTMethod::create(const AOTCacheClassChainRecord *definin
         code, codeSize, data, dataSize, signature, signatureSize);
 }
 
+CachedAOTMethod *CachedAOTMethod::map(const AOTCacheClassChainRecord *definingClassChainRecord,
+    const SerializedAOTMethod *data, size_t size)
+{
+    void *ptr = AOTCacheRecord::allocate(sizeof(CachedAOTMethod));
+    return new (ptr) CachedAOTMethod(definingClassChainRecord, data, size);
+}
+
+void CachedAOTMethod::free(CachedAOTMethod *method)
+{
+    if (method->_subRecords && (method->_subRecords != (AOTCacheRecord **)(method + 1)))
+        AOTCacheRecord::free(method->_subRecords);
+    AOTCacheRecord::free(method);
+}
+
+// Check that the variable-sized parts of a serialized method from a snapshot add up to its size,
+// which must be the size in its index entry. Each part is bounded first so that the sum cannot overflow.
+bool CachedAOTMethod::hasValidSize() const
+{
+    if (_data->size() != _serializedSize)
+        return false;
+
+    size_t size = _data->size();
+    return (_data->numRecords() <= size / sizeof(SerializedSCCOffset))
+        && (_data->numDependencies() <= size / sizeof(SerializedAOTDependency)) && (_data->codeSize() <= size)
+        && (_data->dataSize() <= size) && (_data->signatureSize() <= size)
+        && (size
+            == SerializedAOTMethod::size(_data->numRecords(), _data->numDependencies(), _data->codeSize(),
+                _data->dataSize(), _data->signatureSize()));
+}
+
+bool CachedAOTMethod::resolve(const JITServerAOTCacheReadContext &context, uint32_t index, TR_Hotness optLevel,
+    const AOTCacheAOTHeaderRecord *aotHeaderRecord)
+{
+    if (Unresolved != _state)
+        return Resolved == _state;
+
+    // The index entry the method was keyed by is only trusted for the size of the method
+    const SerializedAOTMethod &data = *_data;
+    if (!hasValidSize() || !data.isValidHeader(context)
+        || (data.definingClassChainId() != _definingClassChainRecord->data().id()) || (data.index() != index)
+        || (data.optLevel() != optLevel) || (data.aotHeaderId() != aotHeaderRecord->data().id())) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "AOT cache: Header for %s record is invalid or does not match its index entry", getRecordName());
+        _state = Invalid;
+        return false;
+    }
+
+    size_t numSubRecords = data.numRecords() + data.numDependencies();
+    if (numSubRecords)
+        _subRecords = (AOTCacheRecord **)AOTCacheRecord::allocate(numSubRecords * sizeof(AOTCacheRecord *));
+
+    if (!setSubrecordPointers(context)) {
+        if (_subRecords)
+            AOTCacheRecord::free(_subRecords);
+        _subRecords = NULL;
+        _state = Invalid;
+        return false;
+    }
+
+    _state = Resolved;
+    return true;
+}
+
 bool CachedAOTMethod::setSubrecordPointers(const JITServerAOTCacheReadContext &context)
 {
     const char *invalidSubrecordName = "";
@@ -481,28 +538,28 @@ bool CachedAOTMethod::setSubrecordPointers(const JITServerAOTCacheReadContext &c
                     invalidSubrecordName = AOTCacheClassLoaderRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._classLoaderRecords[subrecordId];
+                _subRecords[i] = context._classLoaderRecords[subrecordId];
                 break;
             case AOTSerializationRecordType::Class:
                 if ((subrecordId >= context._classRecords.size()) || !context._classRecords[subrecordId]) {
                     invalidSubrecordName = AOTCacheClassRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._classRecords[subrecordId];
+                _subRecords[i] = context._classRecords[subrecordId];
                 break;
             case AOTSerializationRecordType::Method:
                 if ((subrecordId >= context._methodRecords.size()) || !context._methodRecords[subrecordId]) {
                     invalidSubrecordName = AOTCacheMethodRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._methodRecords[subrecordId];
+                _subRecords[i] = context._methodRecords[subrecordId];
                 break;
             case AOTSerializationRecordType::ClassChain:
                 if ((subrecordId >= context._classChainRecords.size()) || !context._classChainRecords[subrecordId]) {
                     invalidSubrecordName = AOTCacheClassChainRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._classChainRecords[subrecordId];
+                _subRecords[i] = context._classChainRecords[subrecordId];
                 break;
             case AOTSerializationRecordType::WellKnownClasses:
                 if ((subrecordId >= context._wellKnownClassesRecords.size())
@@ -510,7 +567,7 @@ bool CachedAOTMethod::setSubrecordPointers(const JITServerAOTCacheReadContext &c
                     invalidSubrecordName = AOTCacheWellKnownClassesRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._wellKnownClassesRecords[subrecordId];
+                _subRecords[i] = context._wellKnownClassesRecords[subrecordId];
                 break;
             case AOTSerializationRecordType::AOTHeader: // never associated with an SCC offset
                 invalidSubrecordName = AOTCacheAOTHeaderRecord::getRecordName();
@@ -520,7 +577,7 @@ bool CachedAOTMethod::setSubrecordPointers(const JITServerAOTCacheReadContext &c
                     invalidSubrecordName = AOTCacheThunkRecord::getRecordName();
                     goto error;
                 }
-                records()[i] = context._thunkRecords[subrecordId];
+                _subRecords[i] = context._thunkRecords[subrecordId];
                 break;
             default:
                 invalidSubrecordName = "invalid";
@@ -528,6 +585,17 @@ bool CachedAOTMethod::setSubrecordPointers(const JITServerAOTCacheReadContext &c
         }
     }
 
+    for (size_t i = 0; i < data().numDependencies(); ++i) {
+        const SerializedAOTDependency &dependency = data().deps()[i];
+        subrecordId = dependency.recordId();
+        if ((dependency.recordType() != AOTSerializationRecordType::Class)
+            || (subrecordId >= context._classRecords.size()) || !context._classRecords[subrecordId]) {
+            invalidSubrecordName = "dependency";
+            goto error;
+        }
+        _subRecords[data().numRecords() + i] = context._classRecords[subrecordId];
+    }
+
     return true;
 
 error:
@@ -655,9 +723,11 @@ template<typename K, typename V, typename H> static void freeMapValues(const Per
         AOTCacheRecord::free(kv.second);
 }
 
-JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
+JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM, JITServerAOTCacheSnapshot *snapshot)
     : _name(name)
     , _sharedProfileCache(new(TR::Compiler->persistentGlobalMemory()) JITServerSharedProfileCache(this, javaVM))
+    , _snapshot(snapshot)
+    , _snapshotMonitor(TR::Monitor::create("JIT-JITServerAOTCacheSnapshotMonitor"))
     , _classLoaderMap(decltype(_classLoaderMap)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
     , _classLoaderHead(NULL)
     , _classLoaderTail(NULL)
@@ -717,7 +787,7 @@ JITServerAOTCache::JITServerAOTCache(const std::string &name, J9JavaVM *javaVM)
     , _numGeneratedClasses(0)
 {
     bool allMonitors = _classLoaderMonitor && _classMonitor && _methodMonitor && _classChainMonitor
-        && _wellKnownClassesMonitor && _aotHeaderMonitor && _cachedMethodMonitor;
+        && _wellKnownClassesMonitor && _aotHeaderMonitor && _cachedMethodMonitor && _snapshotMonitor;
     if (!allMonitors)
         throw std::bad_alloc();
 }
@@ -734,7 +804,14 @@ JITServerAOTCache::~JITServerAOTCache()
     freeMapValues(_wellKnownClassesMap);
     freeMapValues(_aotHeaderMap);
     freeMapValues(_thunkMap);
-    freeMapValues(_cachedMethodMap);
+    for (auto &kv : _cachedMethodMap)
+        CachedAOTMethod::free(kv.second);
+
+    // The records loaded from the snapshot point into it
+    if (_snapshot) {
+        _snapshot->~JITServerAOTCacheSnapshot();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(_snapshot);
+    }
 
     TR::Monitor::destroy(_classMonitor);
     TR::Monitor::destroy(_classLoaderMonitor);
@@ -744,22 +821,30 @@ JITServerAOTCache::~JITServerAOTCache()
     TR::Monitor::destroy(_aotHeaderMonitor);
     TR::Monitor::destroy(_thunkMonitor);
     TR::Monitor::destroy(_cachedMethodMonitor);
-}
-
-JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header,
-    TR::StackMemoryRegion &stackMemoryRegion)
-    : _classLoaderRecords(header._nextClassLoaderId, NULL, stackMemoryRegion)
-    , _classRecords(header._nextClassId, NULL, stackMemoryRegion)
-    , _methodRecords(header._nextMethodId, NULL, stackMemoryRegion)
-    , _classChainRecords(header._nextClassChainId, NULL, stackMemoryRegion)
-    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL, stackMemoryRegion)
-    , _aotHeaderRecords(header._nextAOTHeaderId, NULL, stackMemoryRegion)
-    , _thunkRecords(header._nextThunkId, NULL, stackMemoryRegion)
+    TR::Monitor::destroy(_snapshotMonitor);
+}
+
+JITServerAOTCacheReadContext::JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header)
+    : _classLoaderRecords(header._nextClassLoaderId, NULL,
+          decltype(_classLoaderRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _classRecords(header._nextClassId, NULL,
+          decltype(_classRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _methodRecords(header._nextMethodId, NULL,
+          decltype(_methodRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _classChainRecords(header._nextClassChainId, NULL,
+          decltype(_classChainRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _wellKnownClassesRecords(header._nextWellKnownClassesId, NULL,
+          decltype(_wellKnownClassesRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _aotHeaderRecords(header._nextAOTHeaderId, NULL,
+          decltype(_aotHeaderRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _thunkRecords(header._nextThunkId, NULL,
+          decltype(_thunkRecords)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
 {}
 
 const AOTCacheClassLoaderRecord *JITServerAOTCache::getClassLoaderRecord(const uint8_t *name, size_t nameLength)
 {
     TR_ASSERT(nameLength, "Empty class loader identifying name");
+    loadSnapshotSection(ClassLoaderSection);
     OMR::CriticalSection cs(_classLoaderMonitor);
 
     auto it = _classLoaderMap.find({ name, nameLength });
@@ -831,6 +916,7 @@ const AOTCacheClassRecord *JITServerAOTCache::getClassRecord(const AOTCacheClass
         hash = JITServerROMClassHash(hash, baseHash, numDimensions);
     }
 
+    loadSnapshotSection(ClassSection);
     OMR::CriticalSection cs(_classMonitor);
 
     auto it = _classMap.find({ classLoaderRecord, &hash });
@@ -865,6 +951,7 @@ const AOTCacheClassRecord *JITServerAOTCache::getClassRecord(const AOTCacheClass
 const AOTCacheMethodRecord *JITServerAOTCache::getMethodRecord(const AOTCacheClassRecord *definingClassRecord,
     uint32_t index, const J9ROMMethod *romMethod)
 {
+    loadSnapshotSection(MethodSection);
     OMR::CriticalSection cs(_methodMonitor);
 
     auto it = _methodMap.find({ definingClassRecord, index });
@@ -892,6 +979,7 @@ const AOTCacheMethodRecord *JITServerAOTCache::getMethodRecord(const AOTCacheCla
 const AOTCacheClassChainRecord *JITServerAOTCache::getClassChainRecord(const AOTCacheClassRecord * const *classRecords,
     size_t length)
 {
+    loadSnapshotSection(ClassChainSection);
     OMR::CriticalSection cs(_classChainMonitor);
 
     auto it = _classChainMap.find({ classRecords, length });
@@ -919,6 +1007,7 @@ const AOTCacheClassChainRecord *JITServerAOTCache::getClassChainRecord(const AOT
 const AOTCacheWellKnownClassesRecord *JITServerAOTCache::getWellKnownClassesRecord(
     const AOTCacheClassChainRecord * const *chainRecords, size_t length, uintptr_t includedClasses)
 {
+    loadSnapshotSection(WellKnownClassesSection);
     OMR::CriticalSection cs(_wellKnownClassesMonitor);
 
     auto it = _wellKnownClassesMap.find({ chainRecords, length, includedClasses });
@@ -944,6 +1033,7 @@ const AOTCacheWellKnownClassesRecord *JITServerAOTCache::getWellKnownClassesReco
 
 const AOTCacheAOTHeaderRecord *JITServerAOTCache::getAOTHeaderRecord(const TR_AOTHeader *header, uint64_t clientUID)
 {
+    loadSnapshotSection(AOTHeaderSection);
     OMR::CriticalSection cs(_aotHeaderMonitor);
 
     auto it = _aotHeaderMap.find({ header });
@@ -972,6 +1062,7 @@ const AOTCacheAOTHeaderRecord *JITServerAOTCache::getAOTHeaderRecord(const TR_AO
 
 const AOTCacheThunkRecord *JITServerAOTCache::getThunkRecord(const uint8_t *signature, uint32_t signatureSize)
 {
+    loadSnapshotSection(ThunkSection);
     OMR::CriticalSection cs(_thunkMonitor);
 
     auto it = _thunkMap.find({ signature, signatureSize });
@@ -984,6 +1075,7 @@ const AOTCacheThunkRecord *JITServerAOTCache::getThunkRecord(const uint8_t *sign
 const AOTCacheThunkRecord *JITServerAOTCache::createAndStoreThunk(const uint8_t *signature, uint32_t signatureSize,
     const uint8_t *thunkStart, uint32_t thunkSize)
 {
+    loadSnapshotSection(ThunkSection);
     OMR::CriticalSection cs(_thunkMonitor);
 
     auto it = _thunkMap.find({ signature, signatureSize });
@@ -1014,6 +1106,7 @@ bool JITServerAOTCache::storeMethod(const AOTCacheClassChainRecord *definingClas
     const char *levelName = TR::Compilation::getHotnessName(optLevel);
 
     CachedMethodKey key(definingClassChainRecord, index, optLevel, aotHeaderRecord);
+    loadSnapshotSection(CachedMethodSection);
     OMR::CriticalSection cs(_cachedMethodMonitor);
 
     if (!JITServerAOTCacheMap::cacheHasSpace()) {
@@ -1056,10 +1149,14 @@ const CachedAOTMethod *JITServerAOTCache::findMethod(const AOTCacheClassChainRec
     uint32_t index, TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord)
 {
     CachedMethodKey key(definingClassChainRecord, index, optLevel, aotHeaderRecord);
+    loadSnapshotSection(CachedMethodSection);
     OMR::CriticalSection cs(_cachedMethodMonitor);
 
     auto it = _cachedMethodMap.find(key);
-    if (it == _cachedMethodMap.end()) {
+    // A method from the snapshot is checked the first time it is found; an invalid one is never sent
+    if ((it == _cachedMethodMap.end())
+        || (!it->second->isResolved()
+            && !it->second->resolve(_snapshot->context(), index, optLevel, aotHeaderRecord))) {
         ++_numCacheMisses;
         return NULL;
     }
@@ -1146,14 +1243,17 @@ void JITServerAOTCache::printStats(FILE *f) const
         "\tcache misses: %zu\n"
         "\tdeserialized methods: %zu\n"
         "\tdeserialization failures: %zu\n",
-        _name.c_str(), _cachedMethodMap.size(), _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
+        _name.c_str(), getNumCachedMethods(), _classLoaderMap.size(), _classMap.size(), _numGeneratedClasses,
         _methodMap.size(), _classChainMap.size(), _wellKnownClassesMap.size(), _aotHeaderMap.size(), _numCacheBypasses,
         _numCacheHits, _numCacheMisses, _numDeserializedMethods, _numDeserializationFailures);
 }
 
-// Write at most numRecordsToWrite to the given stream from the linked list starting at head.
-static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecordsToWrite)
+// Write at most numRecordsToWrite to the given stream from the linked list starting at head, and set the
+// bounds of the section they make up. offset is the current position in the stream, and is advanced.
+static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecordsToWrite,
+    JITServerAOTCacheSectionBounds &bounds, uint64_t &offset)
 {
+    bounds._offset = offset;
     const AOTCacheRecord *current = head;
     size_t recordsWritten = 0;
     while (current && (recordsWritten < numRecordsToWrite)) {
@@ -1163,31 +1263,69 @@ static bool writeRecordList(FILE *f, const AOTCacheRecord *head, size_t numRecor
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write record to cache file");
             return false;
         }
+        offset += record->size();
         ++recordsWritten;
         current = current->getNextRecord();
     }
     TR_ASSERT(recordsWritten == numRecordsToWrite, "Expected to write %zu records, wrote %zu", numRecordsToWrite,
         recordsWritten);
+    bounds._size = offset - bounds._offset;
 
     return true;
 }
 
-static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t numRecordsToWrite)
+static bool writeCachedMethodList(FILE *f, const CachedAOTMethod *head, size_t numRecordsToWrite,
+    JITServerAOTCacheSectionBounds &bounds, uint64_t &offset)
 {
+    bounds._offset = offset;
     const CachedAOTMethod *current = head;
     size_t recordsWritten = 0;
     while (current && (recordsWritten < numRecordsToWrite)) {
-        const SerializedAOTMethod *record = &current->data();
-        if (1 != fwrite(record, record->size(), 1, f)) {
+        if (1 != fwrite(&current->data(), current->serializedSize(), 1, f)) {
             if (TR::Options::getVerboseOption(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write record to cache file");
             return false;
         }
+        offset += current->serializedSize();
         ++recordsWritten;
         current = current->getNextRecord();
     }
     TR_ASSERT(recordsWritten == numRecordsToWrite, "Expected to write %zu records, wrote %zu", numRecordsToWrite,
         recordsWritten);
+    bounds._size = offset - bounds._offset;
+
+    return true;
+}
+
+// Write the index entries for the methods written by writeCachedMethodList(), in the same order.
+static bool writeCachedMethodIndex(FILE *f, const CachedAOTMethod *head, size_t numRecordsToWrite,
+    JITServerAOTCacheSectionBounds &bounds, uint64_t &offset)
+{
+    bounds._offset = offset;
+    const CachedAOTMethod *current = head;
+    uint64_t methodOffset = 0;
+    size_t recordsWritten = 0;
+    while (current && (recordsWritten < numRecordsToWrite)) {
+        const SerializedAOTMethod &method = current->data();
+        JITServerAOTCacheMethodIndexEntry entry = { 0 };
+        entry._offset = methodOffset;
+        entry._size = current->serializedSize();
+        entry._definingClassChainId = current->definingClassChainRecord()->data().id();
+        entry._aotHeaderId = method.aotHeaderId();
+        entry._index = method.index();
+        entry._optLevel = method.optLevel();
+        if (1 != fwrite(&entry, sizeof(entry), 1, f)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "AOT cache: Unable to write method index to cache file");
+            return false;
+        }
+        methodOffset += entry._size;
+        offset += sizeof(entry);
+        ++recordsWritten;
+        current = current->getNextRecord();
+    }
+    bounds._size = offset - bounds._offset;
 
     return true;
 }
@@ -1203,11 +1341,16 @@ static void getCurrentAOTCacheVersion(JITServerAOTCacheVersion &version)
 // AOTSerializationRecord or SerializedAOTMethod data (depending on record type) in each
 // record traversal is written directly to the stream in sections, since the full AOT record
 // can be reconstructed from only this information. These sections are ordered so that, when
-// reading the snapshot, the dependencies of each record will already have been read by the
-// time we get to that record.
+// loading the snapshot, the dependencies of each record will already have been loaded by the
+// time we get to that record. The cached methods are followed by an index of their keys, so
+// that they can be found without reading them, and then by the shared profiles. The header,
+// which holds the bounds of every section, is written again once they are known.
 // Return the number of AOT methods written to the snapshot or 0 on failure.
-size_t JITServerAOTCache::writeCache(FILE *f) const
+size_t JITServerAOTCache::writeCache(FILE *f)
 {
+    // Records of this cache that are still only in the snapshot it was loaded from must be written as well
+    loadSnapshot();
+
     JITServerAOTCacheHeader header = { 0 };
     getCurrentAOTCacheVersion(header._version);
     header._serverUID = TR::CompilationInfo::get()->getPersistentInfo()->getServerUID();
@@ -1259,28 +1402,62 @@ size_t JITServerAOTCache::writeCache(FILE *f) const
         header._nextClassLoaderId = _nextClassLoaderId;
     }
 
+    // The shared profiles are serialized last so that the records they refer to are
+    // normally already part of the snapshot; profiles that refer to newer records are
+    // skipped when the snapshot is read
+    std::string profileData;
+    try {
+        header._numProfiledMethods = _sharedProfileCache->serializeProfiles(profileData);
+    } catch (const std::bad_alloc &) {
+        header._numProfiledMethods = 0;
+        profileData.clear();
+    }
+
+    // The section bounds are not known yet; the header is rewritten at the end
     if (1 != fwrite(&header, sizeof(JITServerAOTCacheHeader), 1, f)) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write cache file header");
         return 0;
     }
+    uint64_t offset = sizeof(JITServerAOTCacheHeader);
 
-    if (!writeRecordList(f, _classLoaderHead, header._numClassLoaderRecords))
+    if (!writeRecordList(f, _classLoaderHead, header._numClassLoaderRecords, header._sections[ClassLoaderSection],
+            offset))
+        return 0;
+    if (!writeRecordList(f, _classHead, header._numClassRecords, header._sections[ClassSection], offset))
+        return 0;
+    if (!writeRecordList(f, _methodHead, header._numMethodRecords, header._sections[MethodSection], offset))
         return 0;
-    if (!writeRecordList(f, _classHead, header._numClassRecords))
+    if (!writeRecordList(f, _classChainHead, header._numClassChainRecords, header._sections[ClassChainSection],
+            offset))
         return 0;
-    if (!writeRecordList(f, _methodHead, header._numMethodRecords))
+    if (!writeRecordList(f, _wellKnownClassesHead, header._numWellKnownClassesRecords,
+            header._sections[WellKnownClassesSection], offset))
         return 0;
-    if (!writeRecordList(f, _classChainHead, header._numClassChainRecords))
+    if (!writeRecordList(f, _aotHeaderHead, header._numAOTHeaderRecords, header._sections[AOTHeaderSection], offset))
         return 0;
-    if (!writeRecordList(f, _wellKnownClassesHead, header._numWellKnownClassesRecords))
+    if (!writeRecordList(f, _thunkHead, header._numThunkRecords, header._sections[ThunkSection], offset))
         return 0;
-    if (!writeRecordList(f, _aotHeaderHead, header._numAOTHeaderRecords))
+    if (!writeCachedMethodList(f, _cachedMethodHead, header._numCachedAOTMethods,
+            header._sections[CachedMethodSection], offset))
         return 0;
-    if (!writeRecordList(f, _thunkHead, header._numThunkRecords))
+    if (!writeCachedMethodIndex(f, _cachedMethodHead, header._numCachedAOTMethods,
+            header._sections[CachedMethodIndexSection], offset))
+        return 0;
+
+    header._sections[ProfileSection]._offset = offset;
+    header._sections[ProfileSection]._size = profileData.size();
+    if (!profileData.empty() && (1 != fwrite(profileData.data(), profileData.size(), 1, f))) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write shared profiles");
         return 0;
-    if (!writeCachedMethodList(f, _cachedMethodHead, header._numCachedAOTMethods))
+    }
+
+    if ((0 != fseek(f, 0, SEEK_SET)) || (1 != fwrite(&header, sizeof(JITServerAOTCacheHeader), 1, f))) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to write cache file header");
         return 0;
+    }
 
     return header._numCachedAOTMethods;
 }
@@ -1296,31 +1473,154 @@ static bool isCompatibleSnapshotVersion(const JITServerAOTCacheVersion &version)
         && (version._jitserverVersion == currentVersion._jitserverVersion);
 }
 
-// Read an AOT cache snapshot, returning NULL if the cache is ill-formed or
-// incompatible with the running server.
-JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name, TR_Memory &trMemory)
+// Tests whether the sections and record counts in the header of a compatible snapshot of the given size are
+// consistent with it. The records themselves are checked as they are loaded.
+static bool isValidSnapshotHeader(const JITServerAOTCacheHeader &header, size_t size)
 {
-    if (!JITServerAOTCacheMap::cacheHasSpace())
-        return NULL;
+    for (size_t i = 0; i < JITServerAOTCacheSection_MAX; ++i) {
+        const JITServerAOTCacheSectionBounds &bounds = header._sections[i];
+        if ((bounds._offset < sizeof(header)) || (bounds._offset > size) || (bounds._size > size - bounds._offset)
+            || (bounds._offset % sizeof(size_t)))
+            return false;
+    }
 
-    JITServerAOTCacheHeader header = { 0 };
-    if (1 != fread(&header, sizeof(JITServerAOTCacheHeader), 1, f)) {
+    // The next IDs size the tables of the read context, so they are bounded by the size of the file
+    return (header._nextClassLoaderId > header._numClassLoaderRecords) && (header._nextClassLoaderId <= size)
+        && (header._nextClassId > header._numClassRecords) && (header._nextClassId <= size)
+        && (header._nextMethodId > header._numMethodRecords) && (header._nextMethodId <= size)
+        && (header._nextClassChainId > header._numClassChainRecords) && (header._nextClassChainId <= size)
+        && (header._nextWellKnownClassesId > header._numWellKnownClassesRecords)
+        && (header._nextWellKnownClassesId <= size) && (header._nextAOTHeaderId > header._numAOTHeaderRecords)
+        && (header._nextAOTHeaderId <= size) && (header._nextThunkId > header._numThunkRecords)
+        && (header._nextThunkId <= size)
+        && (header._numCachedAOTMethods <= size / sizeof(JITServerAOTCacheMethodIndexEntry))
+        && (header._sections[CachedMethodIndexSection]._size
+            == header._numCachedAOTMethods * sizeof(JITServerAOTCacheMethodIndexEntry));
+}
+
+JITServerAOTCacheSnapshot *JITServerAOTCacheSnapshot::open(FILE *f)
+{
+    struct stat fileStat;
+    if ((0 != fstat(fileno(f), &fileStat)) || (fileStat.st_size < (off_t)sizeof(JITServerAOTCacheHeader))) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to read cache file header");
         return NULL;
     }
+    size_t size = fileStat.st_size;
 
+    bool isMapped = true;
+    const uint8_t *start = (const uint8_t *)mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(f), 0);
+    if ((const uint8_t *)MAP_FAILED == start) {
+        // Fall back to a private copy, which counts towards the cache size limit
+        isMapped = false;
+        if (!JITServerAOTCacheMap::cacheHasSpace())
+            return NULL;
+        uint8_t *buffer = (uint8_t *)AOTCacheRecord::allocate(size);
+        if ((0 != fseek(f, 0, SEEK_SET)) || (1 != fread(buffer, size, 1, f))) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to read cache file");
+            AOTCacheRecord::free(buffer);
+            return NULL;
+        }
+        start = buffer;
+    }
+
+    const JITServerAOTCacheHeader &header = *(const JITServerAOTCacheHeader *)start;
     if (!isCompatibleSnapshotVersion(header._version)) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                 "AOT cache: Cache file header incompatible with running server");
+        release(start, size, isMapped);
+        return NULL;
+    }
+    if (!isValidSnapshotHeader(header, size)) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Cache file header is invalid");
+        release(start, size, isMapped);
+        return NULL;
+    }
+
+    if (isMapped) {
+        // Cached methods are read as clients request them, in no particular order
+        uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+        uintptr_t methodsStart = (uintptr_t)start + header._sections[CachedMethodSection]._offset;
+        uintptr_t methodsEnd = methodsStart + header._sections[CachedMethodSection]._size;
+        uintptr_t adviceStart = methodsStart & ~(pageSize - 1);
+        if (methodsEnd > adviceStart)
+            madvise((void *)adviceStart, methodsEnd - adviceStart, MADV_RANDOM);
+    }
+
+    JITServerAOTCacheSnapshot *snapshot = NULL;
+    try {
+        snapshot = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCacheSnapshot(start, size, isMapped);
+    } catch (...) {
+        release(start, size, isMapped);
+        throw;
+    }
+    if (!snapshot)
+        release(start, size, isMapped);
+    return snapshot;
+}
+
+JITServerAOTCacheSnapshot::JITServerAOTCacheSnapshot(const uint8_t *start, size_t size, bool isMapped)
+    : _start(start)
+    , _size(size)
+    , _isMapped(isMapped)
+    , _context(header())
+{
+    for (size_t i = 0; i < JITServerAOTCacheSection_MAX; ++i)
+        _loaded[i] = false;
+}
+
+JITServerAOTCacheSnapshot::~JITServerAOTCacheSnapshot() { release(_start, _size, _isMapped); }
+
+void JITServerAOTCacheSnapshot::release(const uint8_t *start, size_t size, bool isMapped)
+{
+    if (isMapped)
+        munmap((void *)start, size);
+    else
+        AOTCacheRecord::free((void *)start);
+}
+
+bool JITServerAOTCacheSnapshot::isLoaded(JITServerAOTCacheSection section) const
+{
+    bool loaded = _loaded[section];
+    // Pairs with the write barrier in setLoaded(), so that the loaded records are seen
+    VM_AtomicSupport::readBarrier();
+    return loaded;
+}
+
+void JITServerAOTCacheSnapshot::setLoaded(JITServerAOTCacheSection section)
+{
+    VM_AtomicSupport::writeBarrier();
+    _loaded[section] = true;
+}
+
+// Open an AOT cache snapshot, returning NULL if the cache is ill-formed or
+// incompatible with the running server. The records of the snapshot are
+// entered into the new cache as they are first looked up.
+JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name)
+{
+    if (!JITServerAOTCacheMap::cacheHasSpace())
         return NULL;
+
+    JITServerAOTCacheSnapshot *snapshot = NULL;
+    try {
+        snapshot = JITServerAOTCacheSnapshot::open(f);
+    } catch (const std::exception &e) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache reading failed with exception: %s", e.what());
+        }
     }
 
+    if (!snapshot)
+        return NULL;
+
     TR::CompilationInfo *compInfo = TR::CompilationInfo::get();
     JITServerAOTCache *cache = NULL;
     try {
-        cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name, compInfo->getJITConfig()->javaVM);
+        cache = new (TR::Compiler->persistentGlobalMemory())
+            JITServerAOTCache(name, compInfo->getJITConfig()->javaVM, snapshot);
     } catch (const std::exception &e) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache allocation failed with exception: %s",
@@ -1331,121 +1631,211 @@ JITServerAOTCache *JITServerAOTCache::readCache(FILE *f, const std::string &name
     if (!cache) {
         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
             TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache: Unable to allocate new cache for reading");
+        snapshot->~JITServerAOTCacheSnapshot();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(snapshot);
         return NULL;
     }
 
-    bool readSuccess = false;
-    try {
-        readSuccess = cache->readCache(f, header, trMemory);
-    } catch (const std::exception &e) {
-        if (TR::Options::getVerboseOption(TR_VerboseJITServer)) {
-            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache reading failed with exception: %s", e.what());
-        }
-    }
-
-    if (!readSuccess) {
-        cache->~JITServerAOTCache();
-        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
-        cache = NULL;
-    }
+    // New records get IDs after those of the snapshot, whether or not its records are loaded yet
+    const JITServerAOTCacheHeader &header = snapshot->header();
+    cache->_nextClassLoaderId = header._nextClassLoaderId;
+    cache->_nextClassId = header._nextClassId;
+    cache->_nextMethodId = header._nextMethodId;
+    cache->_nextClassChainId = header._nextClassChainId;
+    cache->_nextWellKnownClassesId = header._nextWellKnownClassesId;
+    cache->_nextAOTHeaderId = header._nextAOTHeaderId;
+    cache->_nextThunkId = header._nextThunkId;
 
     return cache;
 }
 
-// Read numRecordsToRead records of an AOTSerializationRecord subclass V from a stream, also
-// updating the map, record traversal, and scratch Vector associated with V.
+// Enter the numRecords records of an AOTSerializationRecord subclass V in a section of the snapshot
+// into the map, record traversal and read context table associated with V. Invalid records are skipped.
 template<typename K, typename V, typename H>
-bool JITServerAOTCache::readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-    PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records)
-{
-    for (size_t i = 0; i < numRecordsToRead; ++i) {
+void JITServerAOTCache::mapRecords(JITServerAOTCacheSection section, size_t numRecords,
+    PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, PersistentVector<V *> &records)
+{
+    const uint8_t *current = _snapshot->sectionStart(section);
+    const uint8_t *end = current + _snapshot->sectionSize(section);
+    size_t numMapped = 0;
+    map.reserve(map.size() + numRecords);
+
+    for (size_t i = 0; i < numRecords; ++i) {
+        // The size of a record locates the next one, so the rest of the section cannot be used if it is wrong
+        auto data = (const AOTSerializationRecord *)current;
+        if ((sizeof(*data) > (size_t)(end - current)) || (data->size() < sizeof(*data))
+            || (data->size() > (size_t)(end - current)) || (data->size() % sizeof(size_t))) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "AOT cache %s: Snapshot section of %s records is truncated after %zu records", _name.c_str(),
+                    V::getRecordName(), i);
+            break;
+        }
+        current += data->size();
+
         if (!JITServerAOTCacheMap::cacheHasSpace())
-            return false;
+            break;
 
-        V *record = AOTCacheRecord::readRecord<V>(f, context);
+        V *record = AOTCacheRecord::mapRecord<V>(data, _snapshot->context());
         if (!record)
-            return false;
+            continue;
 
-        if ((record->data().id() >= records.size() || records[record->data().id()])
+        uintptr_t id = record->data().id();
+        if ((id >= records.size()) || records[id]
             || !addToMap(map, traversalHead, traversalTail, getRecordKey(record), record)) {
             if (TR::Options::getVerboseOption(TR_VerboseJITServer))
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
-                    "AOT cache: Record of type %s has invalid or overlapping ID %zu", V::getRecordName(),
-                    record->data().id());
+                    "AOT cache: Record of type %s has invalid or overlapping ID %zu", V::getRecordName(), id);
             AOTCacheRecord::free(record);
-            return false;
+            continue;
         }
 
-        records[record->data().id()] = record;
+        records[id] = record;
+        ++numMapped;
     }
 
-    return true;
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: loaded %zu of %zu %s records from snapshot",
+            _name.c_str(), numMapped, numRecords, V::getRecordName());
 }
 
-bool JITServerAOTCache::readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory)
+// Enter the cached methods of the snapshot into the cached method map using only the method index.
+// Each method is checked and its subrecords are resolved the first time it is found.
+void JITServerAOTCache::mapCachedMethods()
 {
-    _classLoaderMap.reserve(header._numClassLoaderRecords);
-    _classMap.reserve(header._numClassRecords);
-    _methodMap.reserve(header._numMethodRecords);
-    _classChainMap.reserve(header._numClassChainRecords);
-    _wellKnownClassesMap.reserve(header._numWellKnownClassesRecords);
-    _aotHeaderMap.reserve(header._numAOTHeaderRecords);
-    _thunkMap.reserve(header._numThunkRecords);
-    _cachedMethodMap.reserve(header._numCachedAOTMethods);
-
-    _nextClassLoaderId = header._nextClassLoaderId;
-    _nextClassId = header._nextClassId;
-    _nextMethodId = header._nextMethodId;
-    _nextClassChainId = header._nextClassChainId;
-    _nextWellKnownClassesId = header._nextWellKnownClassesId;
-    _nextAOTHeaderId = header._nextAOTHeaderId;
-    _nextThunkId = header._nextThunkId;
-
-    TR::StackMemoryRegion stackMemoryRegion(trMemory);
-    JITServerAOTCacheReadContext context(header, stackMemoryRegion);
-
-    if (!readRecords(f, context, header._numClassLoaderRecords, _classLoaderMap, _classLoaderHead, _classLoaderTail,
-            context._classLoaderRecords))
-        return false;
-    if (!readRecords(f, context, header._numClassRecords, _classMap, _classHead, _classTail, context._classRecords))
-        return false;
-    if (!readRecords(f, context, header._numMethodRecords, _methodMap, _methodHead, _methodTail,
-            context._methodRecords))
-        return false;
-    if (!readRecords(f, context, header._numClassChainRecords, _classChainMap, _classChainHead, _classChainTail,
-            context._classChainRecords))
-        return false;
-    if (!readRecords(f, context, header._numWellKnownClassesRecords, _wellKnownClassesMap, _wellKnownClassesHead,
-            _wellKnownClassesTail, context._wellKnownClassesRecords))
-        return false;
-    if (!readRecords(f, context, header._numAOTHeaderRecords, _aotHeaderMap, _aotHeaderHead, _aotHeaderTail,
-            context._aotHeaderRecords))
-        return false;
-    if (!readRecords(f, context, header._numThunkRecords, _thunkMap, _thunkHead, _thunkTail, context._thunkRecords))
-        return false;
+    const JITServerAOTCacheHeader &header = _snapshot->header();
+    const JITServerAOTCacheReadContext &context = _snapshot->context();
+    auto entries = (const JITServerAOTCacheMethodIndexEntry *)_snapshot->sectionStart(CachedMethodIndexSection);
+    const uint8_t *methods = _snapshot->sectionStart(CachedMethodSection);
+    size_t methodsSize = _snapshot->sectionSize(CachedMethodSection);
+    size_t numMapped = 0;
+    _cachedMethodMap.reserve(_cachedMethodMap.size() + header._numCachedAOTMethods);
 
     for (size_t i = 0; i < header._numCachedAOTMethods; ++i) {
+        const JITServerAOTCacheMethodIndexEntry &entry = entries[i];
+        if ((entry._offset > methodsSize) || (entry._size > methodsSize - entry._offset)
+            || (entry._size < sizeof(SerializedAOTMethod)) || (entry._offset % sizeof(size_t))
+            || (entry._optLevel >= TR_Hotness::numHotnessLevels)
+            || (entry._definingClassChainId >= context._classChainRecords.size())
+            || !context._classChainRecords[entry._definingClassChainId]
+            || (entry._aotHeaderId >= context._aotHeaderRecords.size())
+            || !context._aotHeaderRecords[entry._aotHeaderId]) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: Method index entry %zu is invalid",
+                    _name.c_str(), i);
+            continue;
+        }
+
         if (!JITServerAOTCacheMap::cacheHasSpace())
-            return false;
+            break;
+
+        const AOTCacheClassChainRecord *definingClassChainRecord
+            = context._classChainRecords[entry._definingClassChainId];
+        auto method = CachedAOTMethod::map(definingClassChainRecord,
+            (const SerializedAOTMethod *)(methods + entry._offset), entry._size);
+        CachedMethodKey key(definingClassChainRecord, entry._index, (TR_Hotness)entry._optLevel,
+            context._aotHeaderRecords[entry._aotHeaderId]);
+        if (!addToMap(_cachedMethodMap, _cachedMethodHead, _cachedMethodTail, key, method)) {
+            CachedAOTMethod::free(method);
+            continue;
+        }
+        ++numMapped;
+    }
 
-        auto record = AOTCacheRecord::readRecord<CachedAOTMethod>(f, context);
-        if (!record)
-            return false;
+    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+        TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: loaded %zu of %zu methods from snapshot",
+            _name.c_str(), numMapped, header._numCachedAOTMethods);
+}
 
-        CachedMethodKey key(record->definingClassChainRecord(), record->data().index(), record->data().optLevel(),
-            context._aotHeaderRecords[record->data().aotHeaderId()]);
+void JITServerAOTCache::loadSnapshotSection(JITServerAOTCacheSection section)
+{
+    if (!_snapshot || _snapshot->isLoaded(section))
+        return;
 
-        if (!addToMap(_cachedMethodMap, _cachedMethodHead, _cachedMethodTail, key, record)) {
-            AOTCacheRecord::free(record);
-            return false;
+    // The monitor is reentrant, so the sections a section refers to are loaded while holding it
+    OMR::CriticalSection snapshotCS(_snapshotMonitor);
+    if (_snapshot->isLoaded(section))
+        return;
+
+    const JITServerAOTCacheHeader &header = _snapshot->header();
+    JITServerAOTCacheReadContext &context = _snapshot->context();
+    switch (section) {
+        case ClassLoaderSection: {
+            OMR::CriticalSection cs(_classLoaderMonitor);
+            mapRecords(section, header._numClassLoaderRecords, _classLoaderMap, _classLoaderHead, _classLoaderTail,
+                context._classLoaderRecords);
+            break;
         }
+        case ClassSection: {
+            loadSnapshotSection(ClassLoaderSection);
+            OMR::CriticalSection cs(_classMonitor);
+            mapRecords(section, header._numClassRecords, _classMap, _classHead, _classTail, context._classRecords);
+            break;
+        }
+        case MethodSection: {
+            loadSnapshotSection(ClassSection);
+            {
+                OMR::CriticalSection cs(_methodMonitor);
+                mapRecords(section, header._numMethodRecords, _methodMap, _methodHead, _methodTail,
+                    context._methodRecords);
+            }
+            // The shared profiles are keyed by method records. They are copied out of the snapshot,
+            // since the profile cache updates them in place.
+            JITServerAOTCacheReader reader(_snapshot->sectionStart(ProfileSection),
+                _snapshot->sectionSize(ProfileSection));
+            if (!_sharedProfileCache->readProfiles(reader, header._numProfiledMethods, context._methodRecords,
+                    context._classRecords)
+                && TR::Options::getVerboseOption(TR_VerboseJITServer))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "AOT cache %s: Unable to read the shared profiles from snapshot", _name.c_str());
+            break;
+        }
+        case ClassChainSection: {
+            loadSnapshotSection(ClassSection);
+            OMR::CriticalSection cs(_classChainMonitor);
+            mapRecords(section, header._numClassChainRecords, _classChainMap, _classChainHead, _classChainTail,
+                context._classChainRecords);
+            break;
+        }
+        case WellKnownClassesSection: {
+            loadSnapshotSection(ClassChainSection);
+            OMR::CriticalSection cs(_wellKnownClassesMonitor);
+            mapRecords(section, header._numWellKnownClassesRecords, _wellKnownClassesMap, _wellKnownClassesHead,
+                _wellKnownClassesTail, context._wellKnownClassesRecords);
+            break;
+        }
+        case AOTHeaderSection: {
+            OMR::CriticalSection cs(_aotHeaderMonitor);
+            mapRecords(section, header._numAOTHeaderRecords, _aotHeaderMap, _aotHeaderHead, _aotHeaderTail,
+                context._aotHeaderRecords);
+            break;
+        }
+        case ThunkSection: {
+            OMR::CriticalSection cs(_thunkMonitor);
+            mapRecords(section, header._numThunkRecords, _thunkMap, _thunkHead, _thunkTail, context._thunkRecords);
+            break;
+        }
+        case CachedMethodSection: {
+            // Cached methods can refer to records of any other type
+            for (int s = ClassLoaderSection; s < CachedMethodSection; ++s)
+                loadSnapshotSection((JITServerAOTCacheSection)s);
+            OMR::CriticalSection cs(_cachedMethodMonitor);
+            mapCachedMethods();
+            break;
+        }
+        default:
+            TR_ASSERT_FATAL(false, "Invalid AOT cache snapshot section %d", section);
     }
 
-    return true;
+    _snapshot->setLoaded(section);
 }
 
 size_t JITServerAOTCache::getNumCachedMethods() const
 {
+    // The methods of a snapshot are entered into the empty map before any others are stored
+    if (_snapshot && !_snapshot->isLoaded(CachedMethodSection))
+        return _snapshot->header()._numCachedAOTMethods;
+
     OMR::CriticalSection cs(_cachedMethodMonitor);
     return _cachedMethodMap.size();
 }
@@ -1751,7 +2141,7 @@ bool JITServerAOTCacheMap::saveNextQueuedAOTCacheToFile()
     return success;
 }
 
-void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider)
+void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile()
 {
     std::string cacheName;
     {
@@ -1781,16 +2171,8 @@ void JITServerAOTCacheMap::loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider
                 TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
                     "AOT cache: t=%llu Opened file %s to load cache '%s' from file",
                     compInfo->getPersistentInfo()->getElapsedTime(), cacheFileName.c_str(), cacheName.c_str());
-            size_t segmentSize = scratchSegmentProvider.getPreferredSegmentSize();
-            if (!segmentSize)
-                segmentSize = 1 << 24 /*16 MB*/;
-            TR::RawAllocator rawAllocator(compInfo->getJITConfig()->javaVM);
-            J9::SystemSegmentProvider segmentProvider(1 << 16 /*64 KB*/, segmentSize,
-                TR::Options::getScratchSpaceLimit(), scratchSegmentProvider, rawAllocator);
-            TR::Region region(segmentProvider, rawAllocator);
-            TR_Memory trMemory(*compInfo->persistentMemory(), region);
-
-            cache = JITServerAOTCache::readCache(cacheFile, cacheName, trMemory); // This should not throw
+            // The snapshot stays mapped after the file is closed
+            cache = JITServerAOTCache::readCache(cacheFile, cacheName); // This should not throw
             fclose(cacheFile); // filestream not needed anymore
             cacheFile = NULL;
 
@@ -1921,6 +2303,24 @@ size_t JITServerAOTCacheMap::getNumDeserializedMethods() const
     return result;
 }
 
+size_t JITServerAOTCacheMap::getNumCacheHits() const
+{
+    size_t result = 0;
+    OMR::CriticalSection cs(_monitor);
+    for (auto &it : _map)
+        result += it.second->getNumCacheHits();
+    return result;
+}
+
+size_t JITServerAOTCacheMap::getNumCacheMisses() const
+{
+    size_t result = 0;
+    OMR::CriticalSection cs(_monitor);
+    for (auto &it : _map)
+        result += it.second->getNumCacheMisses();
+    return result;
+}
+
 void JITServerAOTCacheMap::printStats(FILE *f) const
 {
     OMR::CriticalSection cs(_monitor);
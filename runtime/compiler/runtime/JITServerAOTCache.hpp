@@ -32,7 +32,7 @@
 
 class JITServerSharedProfileCache;
 
-static const uint32_t JITSERVER_AOTCACHE_VERSION = 1;
+static const uint32_t JITSERVER_AOTCACHE_VERSION = 3;
 static const char JITSERVER_AOTCACHE_EYECATCHER[] = "AOTCACHE";
 // the eye-catcher is not null-terminated in the snapshot files
 static const size_t JITSERVER_AOTCACHE_EYECATCHER_LENGTH = sizeof(JITSERVER_AOTCACHE_EYECATCHER) - 1;
@@ -53,6 +53,31 @@ struct JITServerAOTCacheVersion {
     uint64_t _jitserverVersion;
 };
 
+// The sections of an AOT cache snapshot, in the order they are written. The records in each
+// section only refer to records in the sections before it.
+enum JITServerAOTCacheSection {
+    ClassLoaderSection,
+    ClassSection,
+    MethodSection,
+    ClassChainSection,
+    WellKnownClassesSection,
+    AOTHeaderSection,
+    ThunkSection,
+    CachedMethodSection,
+    // A JITServerAOTCacheMethodIndexEntry for each method in the CachedMethodSection
+    CachedMethodIndexSection,
+    // The shared profiles, as serialized by JITServerSharedProfileCache::serializeProfiles()
+    ProfileSection,
+
+    JITServerAOTCacheSection_MAX
+};
+
+// Location of a section in a snapshot, relative to the start of the file.
+struct JITServerAOTCacheSectionBounds {
+    uint64_t _offset;
+    uint64_t _size;
+};
+
 // The header information for an AOT cache snapshot.
 struct JITServerAOTCacheHeader {
     JITServerAOTCacheVersion _version;
@@ -65,6 +90,7 @@ struct JITServerAOTCacheHeader {
     size_t _numAOTHeaderRecords;
     size_t _numThunkRecords;
     size_t _numCachedAOTMethods;
+    size_t _numProfiledMethods; // shared profile cache entries saved after the cached AOT methods
     size_t _nextClassLoaderId;
     size_t _nextClassId;
     size_t _nextMethodId;
@@ -72,6 +98,18 @@ struct JITServerAOTCacheHeader {
     size_t _nextWellKnownClassesId;
     size_t _nextAOTHeaderId;
     size_t _nextThunkId;
+    JITServerAOTCacheSectionBounds _sections[JITServerAOTCacheSection_MAX];
+};
+
+// The key and location of a cached AOT method in a snapshot. The index lets the cached method map
+// be populated without reading the methods themselves.
+struct JITServerAOTCacheMethodIndexEntry {
+    uint64_t _offset; // relative to the start of the CachedMethodSection
+    uint64_t _size;
+    uintptr_t _definingClassChainId;
+    uintptr_t _aotHeaderId;
+    uint32_t _index;
+    uint32_t _optLevel;
 };
 
 struct AOTCacheClassLoaderRecord;
@@ -80,6 +118,84 @@ struct AOTCacheMethodRecord;
 struct AOTCacheClassChainRecord;
 struct AOTCacheWellKnownClassesRecord;
 struct AOTCacheAOTHeaderRecord;
+struct AOTCacheThunkRecord;
+
+// The records loaded from a snapshot so far, indexed by ID. Used to resolve the IDs that
+// records in the snapshot refer to each other by.
+struct JITServerAOTCacheReadContext {
+    JITServerAOTCacheReadContext(const JITServerAOTCacheHeader &header);
+
+    PersistentVector<AOTCacheClassLoaderRecord *> _classLoaderRecords;
+    PersistentVector<AOTCacheClassRecord *> _classRecords;
+    PersistentVector<AOTCacheMethodRecord *> _methodRecords;
+    PersistentVector<AOTCacheClassChainRecord *> _classChainRecords;
+    PersistentVector<AOTCacheWellKnownClassesRecord *> _wellKnownClassesRecords;
+    PersistentVector<AOTCacheAOTHeaderRecord *> _aotHeaderRecords;
+    PersistentVector<AOTCacheThunkRecord *> _thunkRecords;
+};
+
+// Sequential reader for a section of a snapshot that is copied out of it rather than used in place.
+class JITServerAOTCacheReader {
+public:
+    JITServerAOTCacheReader(const uint8_t *start, size_t size)
+        : _cursor(start)
+        , _end(start + size)
+    {}
+
+    // Copy the next size bytes of the section into dst; return false if there is not enough data
+    bool read(void *dst, size_t size);
+
+private:
+    const uint8_t *_cursor;
+    const uint8_t * const _end;
+};
+
+// An AOT cache snapshot file loaded into memory.
+//
+// The file is mapped shared and read-only, so that the servers on a node which load the same
+// snapshot share its pages. Snapshots are replaced by renaming a new file over the old one,
+// so a mapped file is never modified. If the file cannot be mapped, it is read into persistent
+// memory instead.
+//
+// Only the header is checked when a snapshot is opened. The records are used in place: the
+// cache allocates a wrapper for each record, pointing to its serialization record in the
+// snapshot, when the records of its type are first looked up.
+class JITServerAOTCacheSnapshot {
+public:
+    TR_PERSISTENT_ALLOC(TR_Memory::JITServerAOTCache)
+
+    // Returns NULL if the file is not a well-formed snapshot compatible with the running server
+    static JITServerAOTCacheSnapshot *open(FILE *f);
+    ~JITServerAOTCacheSnapshot();
+
+    const JITServerAOTCacheHeader &header() const { return *(const JITServerAOTCacheHeader *)_start; }
+
+    const uint8_t *sectionStart(JITServerAOTCacheSection section) const
+    {
+        return _start + header()._sections[section]._offset;
+    }
+
+    size_t sectionSize(JITServerAOTCacheSection section) const { return header()._sections[section]._size; }
+
+    JITServerAOTCacheReadContext &context() { return _context; }
+
+    bool isMapped() const { return _isMapped; }
+
+    // Whether the records of a section have been entered into the maps of the cache
+    bool isLoaded(JITServerAOTCacheSection section) const;
+    void setLoaded(JITServerAOTCacheSection section);
+
+private:
+    JITServerAOTCacheSnapshot(const uint8_t *start, size_t size, bool isMapped);
+
+    static void release(const uint8_t *start, size_t size, bool isMapped);
+
+    const uint8_t * const _start;
+    const size_t _size;
+    const bool _isMapped;
+    JITServerAOTCacheReadContext _context;
+    volatile bool _loaded[JITServerAOTCacheSection_MAX];
+};
 
 #define LOAD_AOTCACHE_REQUEST (JITServer::ServerStream *)0x1
 #define SAVE_AOTCACHE_REQUEST (JITServer::ServerStream *)0x3 // pointers cannot have the last bit set
@@ -99,8 +215,10 @@ struct AOTCacheAOTHeaderRecord;
 //
 // Each AOTCacheRecord is a single contiguous object (variable-sized for most
 // record types) in order to simplify memory management and exception handling.
-// The subclasses store their underlying serialization record data inline
-// (as well as variable-length arrays of subrecord pointers in some cases).
+// The subclasses point to their underlying serialization record data, which is
+// stored inline after the wrapper (and after its variable-length array of
+// subrecord pointers in some cases) for records created by the server, and is
+// left in place in the snapshot for records loaded from one.
 //
 // Each AOTCacheRecord also stores a _nextRecord pointer that points to the next record in
 // a traversal of all of the records of a particular subclass (used for cache persistence).
@@ -119,7 +237,10 @@ public:
     static void *allocate(size_t size);
     static void free(void *ptr);
 
-    template<class R> static R *readRecord(FILE *f, const JITServerAOTCacheReadContext &context);
+    // Create the wrapper for a record R of a snapshot, using its serialization record in place.
+    // The caller must have checked that data->size() bytes of the snapshot are available at data.
+    template<class R>
+    static R *mapRecord(const AOTSerializationRecord *data, const JITServerAOTCacheReadContext &context);
 
     AOTCacheRecord *getNextRecord() const { return _nextRecord; }
 
@@ -140,9 +261,9 @@ private:
 
 class AOTCacheClassLoaderRecord final : public AOTCacheRecord {
 public:
-    const ClassLoaderSerializationRecord &data() const { return _data; }
+    const ClassLoaderSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
     static const char *getRecordName() { return "class loader"; }
 
@@ -151,31 +272,38 @@ public:
 private:
     using SerializationRecord = ClassLoaderSerializationRecord;
 
-    friend AOTCacheClassLoaderRecord *AOTCacheRecord::readRecord<>(FILE *f,
+    friend AOTCacheClassLoaderRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
         const JITServerAOTCacheReadContext &context);
 
     AOTCacheClassLoaderRecord(uintptr_t id, const uint8_t *name, size_t nameLength);
 
-    AOTCacheClassLoaderRecord(const JITServerAOTCacheReadContext &context, const ClassLoaderSerializationRecord &header)
+    AOTCacheClassLoaderRecord(const JITServerAOTCacheReadContext &context, const ClassLoaderSerializationRecord *data)
+        : _data(data)
     {}
 
     static size_t size(size_t nameLength)
     {
-        return offsetof(AOTCacheClassLoaderRecord, _data) + ClassLoaderSerializationRecord::size(nameLength);
+        return sizeof(AOTCacheClassLoaderRecord) + ClassLoaderSerializationRecord::size(nameLength);
     }
 
-    static size_t size(const ClassLoaderSerializationRecord &header) { return size(header.nameLength()); }
+    static size_t mappedSize(const ClassLoaderSerializationRecord &data) { return sizeof(AOTCacheClassLoaderRecord); }
 
-    const ClassLoaderSerializationRecord _data;
+    // Expected size of the serialization record, or 0 if its header is inconsistent with its size
+    static size_t dataSize(const ClassLoaderSerializationRecord &data)
+    {
+        return (data.nameLength() > data.size()) ? 0 : ClassLoaderSerializationRecord::size(data.nameLength());
+    }
+
+    const ClassLoaderSerializationRecord * const _data;
 };
 
 class AOTCacheClassRecord final : public AOTCacheRecord {
 public:
     const AOTCacheClassLoaderRecord *classLoaderRecord() const { return _classLoaderRecord; }
 
-    const ClassSerializationRecord &data() const { return _data; }
+    const ClassSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
     static const char *getRecordName() { return "class"; }
 
@@ -188,31 +316,37 @@ public:
 private:
     using SerializationRecord = ClassSerializationRecord;
 
-    friend AOTCacheClassRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheClassRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
         const JITServerROMClassHash &hash, uint32_t romClassSize, bool generated, const J9ROMClass *romClass,
         const J9ROMClass *baseComponent, uint32_t numDimensions, uint32_t nameLength);
-    AOTCacheClassRecord(const JITServerAOTCacheReadContext &context, const ClassSerializationRecord &header);
+    AOTCacheClassRecord(const JITServerAOTCacheReadContext &context, const ClassSerializationRecord *data);
 
     static size_t size(uint32_t nameLength)
     {
-        return offsetof(AOTCacheClassRecord, _data) + ClassSerializationRecord::size(nameLength);
+        return sizeof(AOTCacheClassRecord) + ClassSerializationRecord::size(nameLength);
     }
 
-    static size_t size(const ClassSerializationRecord &header) { return size(header.nameLength()); }
+    static size_t mappedSize(const ClassSerializationRecord &data) { return sizeof(AOTCacheClassRecord); }
+
+    static size_t dataSize(const ClassSerializationRecord &data)
+    {
+        return ClassSerializationRecord::size(data.nameLength());
+    }
 
     const AOTCacheClassLoaderRecord * const _classLoaderRecord;
-    const ClassSerializationRecord _data;
+    const ClassSerializationRecord * const _data;
 };
 
 class AOTCacheMethodRecord final : public AOTCacheRecord {
 public:
     const AOTCacheClassRecord *definingClassRecord() const { return _definingClassRecord; }
 
-    const MethodSerializationRecord &data() const { return _data; }
+    const MethodSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
     static const char *getRecordName() { return "method"; }
 
@@ -222,28 +356,32 @@ public:
 private:
     using SerializationRecord = MethodSerializationRecord;
 
-    friend AOTCacheMethodRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheMethodRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheMethodRecord(uintptr_t id, const AOTCacheClassRecord *definingClassRecord, uint32_t index);
-    AOTCacheMethodRecord(const JITServerAOTCacheReadContext &context, const MethodSerializationRecord &header);
+    AOTCacheMethodRecord(const JITServerAOTCacheReadContext &context, const MethodSerializationRecord *data);
+
+    static size_t size() { return sizeof(AOTCacheMethodRecord) + sizeof(MethodSerializationRecord); }
 
-    static size_t size(const MethodSerializationRecord &header) { return sizeof(AOTCacheMethodRecord); }
+    static size_t mappedSize(const MethodSerializationRecord &data) { return sizeof(AOTCacheMethodRecord); }
+
+    static size_t dataSize(const MethodSerializationRecord &data) { return sizeof(MethodSerializationRecord); }
 
     const AOTCacheClassRecord * const _definingClassRecord;
-    const MethodSerializationRecord _data;
+    const MethodSerializationRecord * const _data;
 };
 
 class AOTCacheClassChainRecord final : public AOTCacheRecord {
 public:
-    const ClassChainSerializationRecord &data() const { return _data; }
+    const ClassChainSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
-    // Array of record pointers is stored inline after the array of IDs that is stored inline
-    // after struct ClassChainSerializationRecord header
-    const AOTCacheClassRecord * const *records() const { return (const AOTCacheClassRecord * const *)_data.end(); }
+    // Array of record pointers is stored inline after this record
+    const AOTCacheClassRecord * const *records() const { return (const AOTCacheClassRecord * const *)(this + 1); }
 
-    AOTCacheClassRecord **records() { return (AOTCacheClassRecord **)_data.end(); }
+    AOTCacheClassRecord **records() { return (AOTCacheClassRecord **)(this + 1); }
 
     void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
@@ -258,42 +396,52 @@ public:
 private:
     AOTCacheClassChainRecord(uintptr_t id, const AOTCacheClassRecord * const *records, size_t length);
 
-    AOTCacheClassChainRecord(const JITServerAOTCacheReadContext &context, const ClassChainSerializationRecord &header)
+    AOTCacheClassChainRecord(const JITServerAOTCacheReadContext &context, const ClassChainSerializationRecord *data)
+        : _data(data)
     {}
 
-    static size_t size(size_t length)
+    static size_t mappedSize(size_t length)
     {
-        return offsetof(AOTCacheClassChainRecord, _data) + ClassChainSerializationRecord::size(length)
-            + length * sizeof(AOTCacheClassRecord *);
+        return sizeof(AOTCacheClassChainRecord) + length * sizeof(AOTCacheClassRecord *);
     }
 
-    static size_t size(const ClassChainSerializationRecord &header) { return size(header.list().length()); }
+    static size_t size(size_t length) { return mappedSize(length) + ClassChainSerializationRecord::size(length); }
+
+    static size_t mappedSize(const ClassChainSerializationRecord &data) { return mappedSize(data.list().length()); }
+
+    static size_t dataSize(const ClassChainSerializationRecord &data)
+    {
+        size_t length = data.list().length();
+        return (length > data.size() / sizeof(uintptr_t)) ? 0 : ClassChainSerializationRecord::size(length);
+    }
+
+    static ClassChainSerializationRecord *inlineData(void *record, size_t length)
+    {
+        return (ClassChainSerializationRecord *)((uint8_t *)record + mappedSize(length));
+    }
 
     using SerializationRecord = ClassChainSerializationRecord;
 
-    friend AOTCacheClassChainRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheClassChainRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
+        const JITServerAOTCacheReadContext &context);
 
     virtual bool setSubrecordPointers(const JITServerAOTCacheReadContext &context) override;
 
-    // Layout: struct ClassChainSerializationRecord header, uintptr_t ids[length], const AOTCacheClassRecord
-    // *records[length]
-    ClassChainSerializationRecord _data;
+    // Layout after this record: const AOTCacheClassRecord *records[length], followed by the serialization
+    // record (struct ClassChainSerializationRecord header, uintptr_t ids[length]) unless it is in a snapshot
+    const ClassChainSerializationRecord * const _data;
 };
 
 class AOTCacheWellKnownClassesRecord final : public AOTCacheRecord {
 public:
-    const WellKnownClassesSerializationRecord &data() const { return _data; }
+    const WellKnownClassesSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
-    // Array of record pointers is stored inline after the array of IDs that is stored inline
-    // after struct WellKnownClassesSerializationRecord header
-    const AOTCacheClassChainRecord * const *records() const
-    {
-        return (const AOTCacheClassChainRecord * const *)_data.end();
-    }
+    // Array of record pointers is stored inline after this record
+    const AOTCacheClassChainRecord * const *records() const { return (const AOTCacheClassChainRecord * const *)(this + 1); }
 
-    AOTCacheClassChainRecord **records() { return (AOTCacheClassChainRecord **)_data.end(); }
+    AOTCacheClassChainRecord **records() { return (AOTCacheClassChainRecord **)(this + 1); }
 
     void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
@@ -307,34 +455,53 @@ private:
         uintptr_t includedClasses);
 
     AOTCacheWellKnownClassesRecord(const JITServerAOTCacheReadContext &context,
-        const WellKnownClassesSerializationRecord &header)
+        const WellKnownClassesSerializationRecord *data)
+        : _data(data)
     {}
 
+    static size_t mappedSize(size_t length)
+    {
+        return sizeof(AOTCacheWellKnownClassesRecord) + length * sizeof(AOTCacheClassChainRecord *);
+    }
+
     static size_t size(size_t length)
     {
-        return offsetof(AOTCacheWellKnownClassesRecord, _data) + WellKnownClassesSerializationRecord::size(length)
-            + length * sizeof(AOTCacheClassChainRecord *);
+        return mappedSize(length) + WellKnownClassesSerializationRecord::size(length);
+    }
+
+    static size_t mappedSize(const WellKnownClassesSerializationRecord &data)
+    {
+        return mappedSize(data.list().length());
+    }
+
+    static size_t dataSize(const WellKnownClassesSerializationRecord &data)
+    {
+        size_t length = data.list().length();
+        return (length > data.size() / sizeof(uintptr_t)) ? 0 : WellKnownClassesSerializationRecord::size(length);
     }
 
-    static size_t size(const WellKnownClassesSerializationRecord &header) { return size(header.list().length()); }
+    static WellKnownClassesSerializationRecord *inlineData(void *record, size_t length)
+    {
+        return (WellKnownClassesSerializationRecord *)((uint8_t *)record + mappedSize(length));
+    }
 
     using SerializationRecord = WellKnownClassesSerializationRecord;
 
-    friend AOTCacheWellKnownClassesRecord *AOTCacheRecord::readRecord<>(FILE *f,
+    friend AOTCacheWellKnownClassesRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
         const JITServerAOTCacheReadContext &context);
 
     virtual bool setSubrecordPointers(const JITServerAOTCacheReadContext &context) override;
 
-    // Layout: struct WellKnownClassesSerializationRecord header, uintptr_t ids[length], const AOTCacheClassChainRecord
-    // *records[length]
-    WellKnownClassesSerializationRecord _data;
+    // Layout after this record: const AOTCacheClassChainRecord *records[length], followed by the serialization
+    // record (struct WellKnownClassesSerializationRecord header, uintptr_t ids[length]) unless it is in a snapshot
+    const WellKnownClassesSerializationRecord * const _data;
 };
 
 class AOTCacheAOTHeaderRecord final : public AOTCacheRecord {
 public:
-    const AOTHeaderSerializationRecord &data() const { return _data; }
+    const AOTHeaderSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
     static const char *getRecordName() { return "AOT header"; }
 
@@ -343,22 +510,29 @@ public:
 private:
     using SerializationRecord = AOTHeaderSerializationRecord;
 
-    friend AOTCacheAOTHeaderRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheAOTHeaderRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheAOTHeaderRecord(uintptr_t id, const TR_AOTHeader *header);
 
-    AOTCacheAOTHeaderRecord(const JITServerAOTCacheReadContext &context, const AOTHeaderSerializationRecord &header) {}
+    AOTCacheAOTHeaderRecord(const JITServerAOTCacheReadContext &context, const AOTHeaderSerializationRecord *data)
+        : _data(data)
+    {}
+
+    static size_t size() { return sizeof(AOTCacheAOTHeaderRecord) + sizeof(AOTHeaderSerializationRecord); }
+
+    static size_t mappedSize(const AOTHeaderSerializationRecord &data) { return sizeof(AOTCacheAOTHeaderRecord); }
 
-    static size_t size(const AOTHeaderSerializationRecord &header) { return sizeof(AOTHeaderSerializationRecord); }
+    static size_t dataSize(const AOTHeaderSerializationRecord &data) { return sizeof(AOTHeaderSerializationRecord); }
 
-    const AOTHeaderSerializationRecord _data;
+    const AOTHeaderSerializationRecord * const _data;
 };
 
 class AOTCacheThunkRecord final : public AOTCacheRecord {
 public:
-    const ThunkSerializationRecord &data() const { return _data; }
+    const ThunkSerializationRecord &data() const { return *_data; }
 
-    const AOTSerializationRecord *dataAddr() const override { return &_data; }
+    const AOTSerializationRecord *dataAddr() const override { return _data; }
 
     static const char *getRecordName() { return "thunk"; }
 
@@ -368,28 +542,37 @@ public:
 private:
     using SerializationRecord = ThunkSerializationRecord;
 
-    friend AOTCacheThunkRecord *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    friend AOTCacheThunkRecord *AOTCacheRecord::mapRecord<>(const AOTSerializationRecord *data,
+        const JITServerAOTCacheReadContext &context);
 
     AOTCacheThunkRecord(uintptr_t id, const uint8_t *signature, uint32_t signatureSize, const uint8_t *thunkStart,
         uint32_t thunkSize);
 
-    AOTCacheThunkRecord(const JITServerAOTCacheReadContext &context, const ThunkSerializationRecord &header) {}
+    AOTCacheThunkRecord(const JITServerAOTCacheReadContext &context, const ThunkSerializationRecord *data)
+        : _data(data)
+    {}
 
     static size_t size(uint32_t signatureSize, uint32_t thunkSize)
     {
-        return offsetof(AOTCacheThunkRecord, _data) + ThunkSerializationRecord::size(signatureSize, thunkSize);
+        return sizeof(AOTCacheThunkRecord) + ThunkSerializationRecord::size(signatureSize, thunkSize);
     }
 
-    static size_t size(const ThunkSerializationRecord &header)
+    static size_t mappedSize(const ThunkSerializationRecord &data) { return sizeof(AOTCacheThunkRecord); }
+
+    static size_t dataSize(const ThunkSerializationRecord &data)
     {
-        return size(header.signatureSize(), header.thunkSize());
+        return ThunkSerializationRecord::size(data.signatureSize(), data.thunkSize());
     }
 
-    const ThunkSerializationRecord _data;
+    const ThunkSerializationRecord * const _data;
 };
 
 // Wrapper class for serialized AOT methods stored in the cache at the server.
 // Serves the same purpose as AOTCacheRecord (serialization record wrappers).
+//
+// A method loaded from a snapshot is entered into the cache from its index entry alone, and its
+// serialized data stays in the snapshot. It is only checked, and its subrecord pointers set, by
+// resolve() when the method is first found.
 class CachedAOTMethod {
 public:
     // Disable copying since instances are variable-sized
@@ -400,17 +583,22 @@ public:
 
     const AOTCacheClassRecord *definingClassRecord() const { return _definingClassChainRecord->records()[0]; }
 
-    const SerializedAOTMethod &data() const { return _data; }
+    const SerializedAOTMethod &data() const { return *_data; }
 
-    SerializedAOTMethod &data() { return _data; }
+    // Size of the serialized method. For a method from a snapshot that is not resolved yet,
+    // this is the size in its index entry, which data().size() has not been checked against.
+    size_t serializedSize() const { return _serializedSize; }
 
-    const AOTCacheRecord * const *records() const { return (const AOTCacheRecord * const *)_data.end(); }
+    // Only valid once the method is resolved
+    const AOTCacheRecord * const *records() const { return _subRecords; }
 
-    AOTCacheRecord **records() { return (AOTCacheRecord **)_data.end(); }
+    const AOTCacheRecord * const *deps() const { return _subRecords + _data->numRecords(); }
 
-    const AOTCacheRecord * const *deps() const { return records() + _data.numRecords(); }
+    bool isResolved() const { return Resolved == _state; }
 
-    AOTCacheRecord **deps() { return (AOTCacheRecord **)(records() + _data.numRecords()); }
+    // Whether the variable-sized parts of the serialized method lie within serializedSize().
+    // Must be checked before those parts of a method that is not resolved are read.
+    bool hasValidSize() const;
 
     static const char *getRecordName() { return "cached AOT method"; }
 
@@ -420,44 +608,61 @@ public:
         const UnorderedMap<uintptr_t, bool> &dependencies, const void *code, size_t codeSize, const void *data,
         size_t dataSize, const char *signature);
 
+    // Create the wrapper for a method of a snapshot; data must have at least size bytes of the snapshot after it
+    static CachedAOTMethod *map(const AOTCacheClassChainRecord *definingClassChainRecord,
+        const SerializedAOTMethod *data, size_t size);
+
+    // Check a method from a snapshot against the key it was found with, and set its subrecord pointers.
+    // Returns false if the method is invalid, now or in an earlier call.
+    bool resolve(const JITServerAOTCacheReadContext &context, uint32_t index, TR_Hotness optLevel,
+        const AOTCacheAOTHeaderRecord *aotHeaderRecord);
+
+    // Free a method allocated by create() or map()
+    static void free(CachedAOTMethod *method);
+
     CachedAOTMethod *getNextRecord() const { return _nextRecord; }
 
     void setNextRecord(CachedAOTMethod *record) { _nextRecord = record; }
 
 private:
-    using SerializationRecord = SerializedAOTMethod;
-
-    friend CachedAOTMethod *AOTCacheRecord::readRecord<>(FILE *f, const JITServerAOTCacheReadContext &context);
+    enum State {
+        Resolved,
+        Unresolved,
+        Invalid
+    };
 
     CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index, TR_Hotness optLevel,
         const AOTCacheAOTHeaderRecord *aotHeaderRecord,
         const Vector<std::pair<const AOTCacheRecord *, uintptr_t> > &records,
         const UnorderedMap<uintptr_t, bool> &dependencies, const void *code, size_t codeSize, const void *data,
         size_t dataSize, const char *signature, size_t signatureSize);
-    CachedAOTMethod(const JITServerAOTCacheReadContext &context, const SerializedAOTMethod &header);
-
-    SerializedAOTMethod *dataAddr() { return &_data; }
+    CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, const SerializedAOTMethod *data,
+        size_t size);
 
     static size_t size(size_t numRecords, size_t numDependencies, size_t codeSize, size_t dataSize,
         size_t signatureSize)
     {
-        return offsetof(CachedAOTMethod, _data)
-            + SerializedAOTMethod::size(numRecords, numDependencies, codeSize, dataSize, signatureSize)
-            + numRecords * sizeof(AOTCacheRecord *) + numDependencies * sizeof(AOTCacheRecord *);
+        return sizeof(CachedAOTMethod) + (numRecords + numDependencies) * sizeof(AOTCacheRecord *)
+            + SerializedAOTMethod::size(numRecords, numDependencies, codeSize, dataSize, signatureSize);
     }
 
-    static size_t size(const SerializedAOTMethod &header)
+    static SerializedAOTMethod *inlineData(void *method, size_t numRecords, size_t numDependencies)
     {
-        return size(header.numRecords(), header.numDependencies(), header.codeSize(), header.dataSize(),
-            header.signatureSize());
+        return (SerializedAOTMethod *)((uint8_t *)method + sizeof(CachedAOTMethod)
+            + (numRecords + numDependencies) * sizeof(AOTCacheRecord *));
     }
 
     bool setSubrecordPointers(const JITServerAOTCacheReadContext &context);
 
     CachedAOTMethod *_nextRecord;
     const AOTCacheClassChainRecord * const _definingClassChainRecord;
-    SerializedAOTMethod _data;
-    // Array of record pointers is stored inline after serialized AOT method data
+    const SerializedAOTMethod * const _data;
+    const size_t _serializedSize;
+    // Layout: AOTCacheRecord *records[numRecords], AOTCacheRecord *deps[numDependencies]. Stored inline
+    // after this object, followed by the serialized method, for methods created by the server, and
+    // allocated by resolve() for methods from a snapshot.
+    AOTCacheRecord **_subRecords;
+    State _state;
 };
 
 // This class implements the storage of serialized AOT methods and their
@@ -468,7 +673,8 @@ class JITServerAOTCache {
 public:
     TR_PERSISTENT_ALLOC(TR_Memory::JITServerAOTCache)
 
-    JITServerAOTCache(const std::string &name, J9JavaVM *javaVM);
+    // A cache loaded from a snapshot takes ownership of it
+    JITServerAOTCache(const std::string &name, J9JavaVM *javaVM, JITServerAOTCacheSnapshot *snapshot = NULL);
     ~JITServerAOTCache();
 
     const std::string &name() const { return _name; }
@@ -531,6 +737,10 @@ public:
 
     void incNumCacheMisses() { ++_numCacheMisses; }
 
+    size_t getNumCacheHits() const { return _numCacheHits; }
+
+    size_t getNumCacheMisses() const { return _numCacheMisses; }
+
     size_t getNumDeserializedMethods() const { return _numDeserializedMethods; }
 
     void incNumDeserializedMethods() { ++_numDeserializedMethods; }
@@ -539,10 +749,14 @@ public:
 
     void printStats(FILE *f) const;
 
-    size_t writeCache(FILE *f) const;
-    static JITServerAOTCache *readCache(FILE *f, const std::string &name, TR_Memory &trMemory);
+    size_t writeCache(FILE *f);
+    static JITServerAOTCache *readCache(FILE *f, const std::string &name);
     size_t getNumCachedMethods() const;
 
+    // Enter all the records of the snapshot this cache was loaded from into the maps, if that is not done
+    // yet. Must be called before traversing the cached methods, without holding any of the cache monitors.
+    void loadSnapshot() { loadSnapshotSection(CachedMethodSection); }
+
     void setMinNumAOTMethodsToSave(size_t num) { _minNumAOTMethodsToSave = num; }
 
     /**
@@ -674,16 +888,24 @@ private:
     // Helper method used in getSerializationRecords()
     void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
         UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
-    // Read a cache snapshot into an empty cache
-    bool readCache(FILE *f, const JITServerAOTCacheHeader &header, TR_Memory &trMemory);
+
+    // Enter the records of a snapshot section, and of the sections they refer to, into the maps. This is
+    // done when a record of the section's type is first looked up; the caller must not hold any of the
+    // record monitors.
+    void loadSnapshotSection(JITServerAOTCacheSection section);
 
     template<typename K, typename V, typename H>
-    static bool readRecords(FILE *f, JITServerAOTCacheReadContext &context, size_t numRecordsToRead,
-        PersistentUnorderedMap<K, V *, H> &map, V *&traversalHead, V *&traversalTail, Vector<V *> &records);
+    void mapRecords(JITServerAOTCacheSection section, size_t numRecords, PersistentUnorderedMap<K, V *, H> &map,
+        V *&traversalHead, V *&traversalTail, PersistentVector<V *> &records);
+    void mapCachedMethods();
 
     const std::string _name;
     JITServerSharedProfileCache * const _sharedProfileCache;
 
+    // The snapshot this cache was loaded from, if any, and the monitor serializing the loading of its sections
+    JITServerAOTCacheSnapshot * const _snapshot;
+    TR::Monitor * const _snapshotMonitor;
+
     // Along with each map we also store pointers to the start and end points of a traversal of all the records.
     // The _nextRecord in each record points to the next record in this traversal.
     PersistentUnorderedMap<StringKey, AOTCacheClassLoaderRecord *> _classLoaderMap;
@@ -774,7 +996,7 @@ public:
        Any exceptions thrown by this method are caught and logged.
        This method acquires the AOTCacheMap monitor.
     */
-    void loadNextQueuedAOTCacheFromFile(J9::J9SegmentProvider &scratchSegmentProvider);
+    void loadNextQueuedAOTCacheFromFile();
 
     /**
        @brief Obtain a pointer to a named AOT cache. If it doesn't exist, attempt to create one.
@@ -791,6 +1013,9 @@ public:
     */
     JITServerAOTCache *get(const std::string &name, uint64_t clientUID, bool &pending);
     size_t getNumDeserializedMethods() const;
+    // Totals across all the caches in the map
+    size_t getNumCacheHits() const;
+    size_t getNumCacheMisses() const;
 
     static void setCacheMaxBytes(size_t bytes) { _cacheMaxBytes = bytes; }
 
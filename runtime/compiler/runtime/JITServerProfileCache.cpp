@@ -19,11 +19,116 @@
  *
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
+#include <algorithm>
 #include "control/CompilationRuntime.hpp"
+#include "runtime/IProfiler.hpp"
 #include "runtime/JITServerAOTCache.hpp"
 #include "runtime/JITServerProfileCache.hpp"
 #include "runtime/JITServerSharedROMClassCache.hpp"
 
+// The bytecodes of a method are limited to 64K, and a method has at most one profiling entry per bytecode
+#define MAX_PROFILED_BYTECODES_PER_METHOD 65535
+
+/**
+ * @brief Return the size of the storage structure used to serialize a bytecode
+ *        profiling entry of the given type, or 0 if the type is unknown
+ */
+static size_t bytecodeStorageSize(uint32_t entryType)
+{
+    switch (entryType) {
+        case TR_IPBCD_FOUR_BYTES:
+            return sizeof(TR_IPBCDataFourBytesStorage);
+        case TR_IPBCD_EIGHT_WORDS:
+            return sizeof(TR_IPBCDataEightWordsStorage);
+        case TR_IPBCD_CALL_GRAPH:
+            return sizeof(TR_IPBCDataCallGraphStorage);
+        case TR_IPBCD_DIRECT_CALL:
+            return sizeof(TR_IPBCDataDirectCallStorage);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Check that the header of a persisted profile describes a plausible amount of bytecode data,
+ *        before memory is allocated for it. A method has at most one entry per bytecode, and each
+ *        entry is no larger than the largest bytecode storage type.
+ * @param header The header read from an AOT cache snapshot
+ * @return 'true' if the header is consistent, 'false' otherwise
+ */
+static bool isValidProfileHeader(const ProfiledMethodSerializationRecord &header)
+{
+    static const size_t maxStorageSize = std::max(std::max(sizeof(TR_IPBCDataFourBytesStorage),
+                                                            sizeof(TR_IPBCDataEightWordsStorage)),
+        std::max(sizeof(TR_IPBCDataCallGraphStorage), sizeof(TR_IPBCDataDirectCallStorage)));
+
+    return (header._numBytecodeEntries <= MAX_PROFILED_BYTECODES_PER_METHOD)
+        && (header._bytecodeDataSize <= header._numBytecodeEntries * maxStorageSize)
+        && (header._bytecodeDataSize >= header._numBytecodeEntries * sizeof(TR_IPBCDataStorageHeader));
+}
+
+/**
+ * @brief Create a bytecode profiling entry allocated with global persistent memory
+ *        from its serialized form
+ * @param storage Serialized entry
+ * @param pc Absolute bytecode address the entry refers to
+ * @return The new entry, or NULL if the entry type is unknown
+ * @note Throws std::bad_alloc if the allocation fails
+ */
+static TR_IPBytecodeHashTableEntry *restoreBytecodeEntry(TR_IPBCDataStorageHeader *storage, uintptr_t pc)
+{
+    // Deserialize into a temporary and clone it, which allocates an entry of the right type
+    switch (storage->ID) {
+        case TR_IPBCD_FOUR_BYTES: {
+            TR_IPBCDataFourBytes entry(pc);
+            entry.deserialize(storage);
+            return entry.clone(TR::Compiler->persistentGlobalMemory(), TR_Memory::JITServerProfileCache);
+        }
+        case TR_IPBCD_EIGHT_WORDS: {
+            TR_IPBCDataEightWords entry(pc);
+            entry.deserialize(storage);
+            return entry.clone(TR::Compiler->persistentGlobalMemory(), TR_Memory::JITServerProfileCache);
+        }
+        case TR_IPBCD_CALL_GRAPH: {
+            TR_IPBCDataCallGraph entry(pc);
+            entry.deserialize(storage);
+            return entry.clone(TR::Compiler->persistentGlobalMemory(), TR_Memory::JITServerProfileCache);
+        }
+        case TR_IPBCD_DIRECT_CALL: {
+            TR_IPBCDataDirectCall entry(pc);
+            entry.deserialize(storage);
+            return entry.clone(TR::Compiler->persistentGlobalMemory(), TR_Memory::JITServerProfileCache);
+        }
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief Append a serialized profile to a snapshot buffer, replacing the class record
+ *        pointers in call graph entries with class record IDs
+ * @param buffer Snapshot buffer
+ * @param record Serialized profile whose call graph slots hold AOTCacheClassRecord pointers
+ */
+static void appendPersistedProfile(std::string &buffer, const ProfiledMethodSerializationRecord &record)
+{
+    size_t recordOffset = buffer.size();
+    buffer.append((const char *)&record, record.size());
+
+    uint8_t *data = (uint8_t *)&buffer[recordOffset + sizeof(record)];
+    for (uint32_t i = 0; i < record._numBytecodeEntries; ++i) {
+        auto storage = (TR_IPBCDataStorageHeader *)data;
+        if (storage->ID == TR_IPBCD_CALL_GRAPH) {
+            CallSiteProfileInfo &csInfo = ((TR_IPBCDataCallGraphStorage *)storage)->_csInfo;
+            for (int32_t j = 0; j < NUM_CS_SLOTS; ++j) {
+                if (auto classRecord = (const AOTCacheClassRecord *)csInfo.getClazz(j))
+                    csInfo.setClazz(j, classRecord->data().id());
+            }
+        }
+        data += storage->left;
+    }
+}
+
 ProfiledMethodEntry::BytecodeProfile::BytecodeProfile()
     : _numSamples(0)
     , _data(decltype(_data)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
@@ -81,6 +186,37 @@ void ProfiledMethodEntry::BytecodeProfile::addBytecodeData(const Vector<TR_IPByt
     _stable = isStable;
 }
 
+/**
+ * @brief Populate this bytecode profile with the entries of a profile loaded from an AOT cache snapshot
+ *
+ * @param record Serialized profile; call graph slots must already hold AOTCacheClassRecord pointers
+ * @param romMethod ROMMethod that the bytecode PCs of the entries are relative to
+ * @return 'true' on success, 'false' if an entry does not fit the bytecodes of romMethod
+ * @note Throws std::bad_alloc if an allocation fails
+ */
+bool ProfiledMethodEntry::BytecodeProfile::restoreBytecodeData(const ProfiledMethodSerializationRecord &record,
+    const J9ROMMethod *romMethod)
+{
+    uintptr_t methodStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+    uintptr_t methodSize = (uintptr_t)J9_BYTECODE_END_FROM_ROM_METHOD(romMethod) - methodStart;
+
+    _data.reserve(record._numBytecodeEntries);
+    const uint8_t *data = record.bytecodeData();
+    for (uint32_t i = 0; i < record._numBytecodeEntries; ++i) {
+        auto storage = (TR_IPBCDataStorageHeader *)data;
+        if (storage->pc >= methodSize)
+            return false;
+        TR_IPBytecodeHashTableEntry *newEntry = restoreBytecodeEntry(storage, methodStart + storage->pc);
+        if (!newEntry)
+            return false;
+        _data.push_back(newEntry);
+        data += storage->left;
+    }
+    _numSamples = record._numSamples;
+    _stable = record._stable;
+    return true;
+}
+
 ProfiledMethodEntry::ProfiledMethodEntry(const AOTCacheMethodRecord *methodRecord, const J9ROMMethod *romMethod,
     J9ROMClass *romClass)
     : _methodRecord(methodRecord)
@@ -197,6 +333,86 @@ void ProfiledMethodEntry::cloneBytecodeData(TR_Memory &trMemory, bool stable,
     } // end for
 }
 
+/**
+ * @brief Append the serialized form of this entry to a snapshot buffer.
+ *        Bytecode PCs are made relative to the start of the method bytecodes
+ *        and call graph entries refer to classes by AOT cache class record ID.
+ * @param buffer Snapshot buffer
+ * @note JITServerSharedProfileCache monitor must be held.
+ */
+void ProfiledMethodEntry::serialize(std::string &buffer) const
+{
+    ProfiledMethodSerializationRecord record = {};
+    record._methodRecordId = _methodRecord->data().id();
+    record._faninNumSamples = _faninProfile.getNumSamples();
+    record._faninNumSamplesOtherBucket = _faninProfile.getNumSamplesOtherBucket();
+    record._faninNumCallers = _faninProfile.getNumCallers();
+
+    size_t recordOffset = buffer.size();
+    buffer.append((const char *)&record, sizeof(record));
+    if (_bytecodeProfile) {
+        uintptr_t methodStart = (uintptr_t)J9_BYTECODE_START_FROM_ROM_METHOD(_romMethod);
+        TR::PersistentInfo *persistentInfo = TR::CompilationInfo::get()->getPersistentInfo();
+
+        record._hasBytecodeProfile = true;
+        record._stable = _bytecodeProfile->isStable();
+        record._numSamples = _bytecodeProfile->getNumSamples();
+        for (const auto &entry : _bytecodeProfile->getData()) {
+            uint32_t bytes = entry->getBytesFootprint();
+            size_t entryOffset = buffer.size();
+            buffer.resize(entryOffset + bytes);
+
+            auto storage = (TR_IPBCDataStorageHeader *)&buffer[entryOffset];
+            entry->serialize(methodStart, storage, persistentInfo);
+            storage->left = bytes;
+            if (storage->ID == TR_IPBCD_CALL_GRAPH) {
+                CallSiteProfileInfo &csInfo = ((TR_IPBCDataCallGraphStorage *)storage)->_csInfo;
+                for (int32_t j = 0; j < NUM_CS_SLOTS; ++j) {
+                    if (auto classRecord = (const AOTCacheClassRecord *)csInfo.getClazz(j))
+                        csInfo.setClazz(j, classRecord->data().id());
+                }
+            }
+            record._numBytecodeEntries++;
+        }
+        record._bytecodeDataSize = buffer.size() - recordOffset - sizeof(record);
+    }
+    memcpy(&buffer[recordOffset], &record, sizeof(record));
+}
+
+/**
+ * @brief Populate this entry with a profile loaded from an AOT cache snapshot.
+ *        The fanin profile is always restored; the bytecode profile is dropped
+ *        if it does not match the bytecodes of the method.
+ * @param record Serialized profile; call graph slots must already hold AOTCacheClassRecord pointers
+ * @return 'true' if the bytecode profile (if any) was restored as well
+ * @note JITServerSharedProfileCache monitor must be held.
+ */
+bool ProfiledMethodEntry::restore(const ProfiledMethodSerializationRecord &record)
+{
+    addFanInData(record._faninNumSamples, record._faninNumSamplesOtherBucket, record._faninNumCallers);
+    if (!record._hasBytecodeProfile)
+        return true;
+
+    BytecodeProfile *newBytecodeProfile = NULL;
+    try {
+        newBytecodeProfile = new (TR::Compiler->persistentGlobalAllocator()) BytecodeProfile();
+        if (newBytecodeProfile->restoreBytecodeData(record, _romMethod)) {
+            deleteBytecodeData();
+            _bytecodeProfile = newBytecodeProfile;
+            return true;
+        }
+    } catch (const std::bad_alloc &allocationFailure) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfile))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "WARNING: Allocation failure while restoring persisted profile data: %s", allocationFailure.what());
+    }
+    if (newBytecodeProfile) {
+        newBytecodeProfile->~BytecodeProfile();
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(newBytecodeProfile);
+    }
+    return false;
+}
+
 /**
  * @brief Constructor for JITServerSharedProfileCache
  * @todo Consider using a dedicated persistent allocator rather than the global one
@@ -204,9 +420,12 @@ void ProfiledMethodEntry::cloneBytecodeData(TR_Memory &trMemory, bool stable,
 JITServerSharedProfileCache::JITServerSharedProfileCache(JITServerAOTCache *aotCache, J9JavaVM *javaVM)
     : _aotCache(aotCache)
     , _methodProfileMap(decltype(_methodProfileMap)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
+    , _persistedProfileMap(
+          decltype(_persistedProfileMap)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
     , _monitor(TR::Monitor::create("JIT-SharedProfileCacheMonitor"))
     , _numStores(0)
     , _numOverwrites(0)
+    , _numRestoredProfiles(0)
 //,_rawAllocator(javaVM), _segmentAllocator(MEMORY_TYPE_JIT_SCRATCH_SPACE | MEMORY_TYPE_VIRTUAL, *javaVM),
 // TODO: configurable scratch memory limit
 //_segmentProvider(64 * 1024, 16 * 1024 * 1024, 16 * 1024 * 1024, _segmentAllocator, _rawAllocator),
@@ -216,23 +435,165 @@ JITServerSharedProfileCache::JITServerSharedProfileCache(JITServerAOTCache *aotC
         throw std::bad_alloc();
 }
 
-JITServerSharedProfileCache::~JITServerSharedProfileCache() { TR::Monitor::destroy(_monitor); }
+JITServerSharedProfileCache::~JITServerSharedProfileCache()
+{
+    for (auto &it : _persistedProfileMap)
+        TR::Compiler->persistentGlobalMemory()->freePersistentMemory(it.second);
+    TR::Monitor::destroy(_monitor);
+}
 
 /**
  * @brief Find the profiling info specific to the method of interest and return a pointer to it
  * @note Must hold the JITServerSharedProfileCache monitor
  * @param methodRecord: the method for which we are looking for profiling data
+ * @param romMethod ROMMethod corresponding to methodRecord
+ * @param romClass ROMClass of the romMethod
  * @return Pointer to the shared profiling data for the method of interest
  */
-ProfiledMethodEntry *JITServerSharedProfileCache::getProfileForMethod(const AOTCacheMethodRecord *methodRecord)
+ProfiledMethodEntry *JITServerSharedProfileCache::getProfileForMethod(const AOTCacheMethodRecord *methodRecord,
+    const J9ROMMethod *romMethod, J9ROMClass *romClass)
 {
     TR_ASSERT(_monitor->owned_by_self(), "Must hold monitor");
+    return findOrRestoreProfile(methodRecord, romMethod, romClass);
+}
 
+/**
+ * @brief Find the profiling info for a method. If there is none, but a profile for the
+ *        method was loaded from an AOT cache snapshot, turn it into a ProfiledMethodEntry.
+ * @note Must hold the JITServerSharedProfileCache monitor
+ * @return Pointer to the shared profiling data for the method of interest or NULL
+ */
+ProfiledMethodEntry *JITServerSharedProfileCache::findOrRestoreProfile(const AOTCacheMethodRecord *methodRecord,
+    const J9ROMMethod *romMethod, J9ROMClass *romClass)
+{
     auto it = _methodProfileMap.find(methodRecord);
     if (it != _methodProfileMap.end())
         return &it->second;
 
-    return NULL;
+    auto p_it = _persistedProfileMap.find(methodRecord);
+    if (p_it == _persistedProfileMap.end())
+        return NULL;
+
+    ProfiledMethodSerializationRecord *record = p_it->second;
+    _persistedProfileMap.erase(p_it);
+
+    ProfiledMethodEntry *methodEntry = NULL;
+    try {
+        it = _methodProfileMap.emplace_hint(it, std::piecewise_construct, std::forward_as_tuple(methodRecord),
+            std::forward_as_tuple(methodRecord, romMethod, romClass));
+        methodEntry = &it->second;
+        if (methodEntry->restore(*record)) {
+            _numRestoredProfiles++;
+        } else if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfile)) {
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                "WARNING: Discarded persisted bytecode profile for method record ID %zu", record->_methodRecordId);
+        }
+    } catch (const std::bad_alloc &) {
+        // The persisted profile is lost, but clients can still provide fresh profiling data
+    }
+    TR::Compiler->persistentGlobalMemory()->freePersistentMemory(record);
+    return methodEntry;
+}
+
+/**
+ * @brief Serialize all the profiles in this cache, including the ones loaded from a
+ *        snapshot that were never requested, so that they can be saved with the AOT cache.
+ * @param buffer OUT Serialized profiles, as a sequence of ProfiledMethodSerializationRecords
+ * @return The number of serialized profiles
+ * @note Acquires the shared profile monitor
+ */
+size_t JITServerSharedProfileCache::serializeProfiles(std::string &buffer)
+{
+    OMR::CriticalSection cs(monitor());
+    for (const auto &it : _methodProfileMap)
+        it.second.serialize(buffer);
+    for (const auto &it : _persistedProfileMap)
+        appendPersistedProfile(buffer, *it.second);
+    return _methodProfileMap.size() + _persistedProfileMap.size();
+}
+
+/**
+ * @brief Read profiles saved by serializeProfiles() from an AOT cache snapshot.
+ *        Profiles that refer to records missing from the snapshot are skipped.
+ *        The profiles are kept in serialized form until a client asks for them.
+ *
+ * @param reader Reader over the profile section of the snapshot
+ * @param numProfiles Number of profiles in the snapshot
+ * @param methodRecords Method records loaded from the snapshot, indexed by ID
+ * @param classRecords Class records loaded from the snapshot, indexed by ID
+ * @return 'false' if the snapshot is ill-formed or memory ran out, 'true' otherwise
+ */
+bool JITServerSharedProfileCache::readProfiles(JITServerAOTCacheReader &reader, size_t numProfiles,
+    const PersistentVector<AOTCacheMethodRecord *> &methodRecords,
+    const PersistentVector<AOTCacheClassRecord *> &classRecords)
+{
+    OMR::CriticalSection cs(monitor());
+    for (size_t i = 0; i < numProfiles; ++i) {
+        if (!JITServerAOTCacheMap::cacheHasSpace())
+            return false;
+
+        ProfiledMethodSerializationRecord header;
+        if (!reader.read(&header, sizeof(header)))
+            return false;
+        if (!isValidProfileHeader(header)) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfile))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "WARNING: Header for persisted profile of method record ID %zu is invalid", header._methodRecordId);
+            return false;
+        }
+
+        auto record = (ProfiledMethodSerializationRecord *)TR::Compiler->persistentGlobalMemory()
+                          ->allocatePersistentMemory(header.size(), TR_Memory::JITServerProfileCache);
+        if (!record)
+            return false;
+        memcpy(record, &header, sizeof(header));
+        if (!reader.read(record->bytecodeData(), record->_bytecodeDataSize)) {
+            TR::Compiler->persistentGlobalMemory()->freePersistentMemory(record);
+            return false;
+        }
+
+        // Validate the entries and convert class record IDs into class record pointers
+        bool valid = (record->_methodRecordId < methodRecords.size()) && methodRecords[record->_methodRecordId];
+        uint8_t *data = record->bytecodeData();
+        const uint8_t *dataEnd = data + record->_bytecodeDataSize;
+        for (uint32_t j = 0; valid && (j < record->_numBytecodeEntries); ++j) {
+            auto storage = (TR_IPBCDataStorageHeader *)data;
+            if (sizeof(*storage) > (size_t)(dataEnd - data)) {
+                valid = false;
+                break;
+            }
+            size_t storageSize = bytecodeStorageSize(storage->ID);
+            if (!storageSize || (storage->left != storageSize) || (storageSize > (size_t)(dataEnd - data))) {
+                valid = false;
+                break;
+            }
+            if (storage->ID == TR_IPBCD_CALL_GRAPH) {
+                CallSiteProfileInfo &csInfo = ((TR_IPBCDataCallGraphStorage *)storage)->_csInfo;
+                for (int32_t k = 0; k < NUM_CS_SLOTS; ++k) {
+                    uintptr_t id = csInfo.getClazz(k);
+                    if (!id)
+                        continue;
+                    if ((id >= classRecords.size()) || !classRecords[id]) {
+                        valid = false;
+                        break;
+                    }
+                    csInfo.setClazz(k, (uintptr_t)classRecords[id]);
+                }
+            }
+            data += storageSize;
+        }
+        // The entries must account for all the bytecode data read for the profile
+        if (data != dataEnd)
+            valid = false;
+
+        if (!valid || !_persistedProfileMap.insert({ methodRecords[record->_methodRecordId], record }).second) {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServerSharedProfile))
+                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                    "WARNING: Skipping invalid persisted profile for method record ID %zu", record->_methodRecordId);
+            TR::Compiler->persistentGlobalMemory()->freePersistentMemory(record);
+        }
+    }
+    return true;
 }
 
 /**
@@ -254,6 +615,8 @@ bool JITServerSharedProfileCache::addBytecodeData(const Vector<TR_IPBytecodeHash
 {
     TR_ASSERT_FATAL(methodRecord, "methodRecord must exist");
     OMR::CriticalSection cs(monitor());
+    // A profile loaded from a snapshot must compete with the new data like any other stored profile
+    findOrRestoreProfile(methodRecord, romMethod, romClass);
     auto it = _methodProfileMap.find(methodRecord);
     if (it == _methodProfileMap.end()) {
         // At the moment there is no data for the method in question. Create an empty map.
@@ -304,6 +667,8 @@ bool JITServerSharedProfileCache::addFaninData(const TR_ContiguousIPMethodHashTa
     const AOTCacheMethodRecord *methodRecord, const J9ROMMethod *romMethod, J9ROMClass *romClass)
 {
     OMR::CriticalSection cs(monitor());
+    // A profile loaded from a snapshot must compete with the new data like any other stored profile
+    findOrRestoreProfile(methodRecord, romMethod, romClass);
     auto it = _methodProfileMap.find(methodRecord);
     if (it == _methodProfileMap.end()) {
         // At the moment there is no data for the method in question. Create an empty map.
@@ -373,6 +738,7 @@ void JITServerSharedProfileCache::printStats(FILE *f) const
     fprintf(f, "Stats about JITServer shared profile cache:\n");
     fprintf(f, "\tNum store operations: %zu\n", _numStores);
     fprintf(f, "\tNum overwrite operations: %zu\n", _numOverwrites);
+    fprintf(f, "\tNum profiles restored from snapshot: %zu\n", _numRestoredProfiles);
 }
 
 /**
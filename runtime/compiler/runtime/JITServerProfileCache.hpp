@@ -23,12 +23,15 @@
 #define JITSERVER_PROFILE_CACHE_H
 #include <stdint.h>
 #include <stddef.h>
+#include <string>
 #include "env/PersistentCollections.hpp"
 #include "env/TRMemory.hpp"
 
 class TR_IPBytecodeHashTableEntry;
 class TR_IPBCDataCallGraph;
 class AOTCacheMethodRecord;
+class AOTCacheClassRecord;
+class JITServerAOTCacheReader;
 class TR_ContiguousIPMethodHashTableEntry;
 class TR_FaninSummaryInfo;
 
@@ -63,6 +66,30 @@ struct FaninProfileSummary {
     // Other fields could be added here if they are useful to comparing the quality of two sources
 };
 
+// Serialized form of a ProfiledMethodEntry, as stored in an AOT cache snapshot.
+// The record is followed by _bytecodeDataSize bytes holding _numBytecodeEntries
+// TR_IPBC*Storage structures, with pc fields relative to the start of the method
+// bytecodes and header.left set to the size of each structure. In a snapshot file,
+// call graph slots hold AOT cache class record IDs; once loaded, they hold pointers
+// to the corresponding AOTCacheClassRecords, like the live shared profile entries.
+struct ProfiledMethodSerializationRecord {
+    uintptr_t _methodRecordId;
+    uint64_t _numSamples;
+    uint64_t _faninNumSamples;
+    uint64_t _faninNumSamplesOtherBucket;
+    uint32_t _faninNumCallers;
+    uint32_t _numBytecodeEntries;
+    uint32_t _bytecodeDataSize;
+    bool _hasBytecodeProfile;
+    bool _stable;
+
+    const uint8_t *bytecodeData() const { return (const uint8_t *)(this + 1); }
+
+    uint8_t *bytecodeData() { return (uint8_t *)(this + 1); }
+
+    size_t size() const { return sizeof(*this) + _bytecodeDataSize; }
+};
+
 // Profiling information at the server is kept on a per-method basis.
 // Each ProfiledMethodEntry will keep profiling information related to
 // (1) various method bytecodes and related to (2) method fan-in.
@@ -85,9 +112,12 @@ public:
 
         BytecodeProfileSummary getSummary() const;
 
+        bool isStable() const { return _stable; }
+
         const PersistentVector<TR_IPBytecodeHashTableEntry *> &getData() const { return _data; }
 
         void addBytecodeData(const Vector<TR_IPBytecodeHashTableEntry *> &entries, uint64_t numSamples, bool isStable);
+        bool restoreBytecodeData(const ProfiledMethodSerializationRecord &record, const J9ROMMethod *romMethod);
         void clear();
 
     private:
@@ -160,6 +190,9 @@ public:
         _faninProfile.setNumCallers(numCallers);
     }
 
+    void serialize(std::string &buffer) const;
+    bool restore(const ProfiledMethodSerializationRecord &record);
+
 private:
     void deleteBytecodeData();
 
@@ -186,7 +219,8 @@ public:
 
     TR::Monitor *monitor() const { return _monitor; }
 
-    ProfiledMethodEntry *getProfileForMethod(const AOTCacheMethodRecord *);
+    ProfiledMethodEntry *getProfileForMethod(const AOTCacheMethodRecord *methodRecord, const J9ROMMethod *romMethod,
+        J9ROMClass *romClass);
     bool addBytecodeData(const Vector<TR_IPBytecodeHashTableEntry *> &entries, const AOTCacheMethodRecord *methodRecord,
         const J9ROMMethod *romMethod, J9ROMClass *romClass, uint64_t numSamples, bool isStable);
     // Returns NULL with 'present' set to true if data for method is cached but empty
@@ -196,22 +230,38 @@ public:
         const J9ROMMethod *romMethod, J9ROMClass *romClass);
     TR_FaninSummaryInfo *getFaninData(const AOTCacheMethodRecord *methodRecord, TR_Memory *trMemory);
 
+    // Snapshot persistence; the profiles are saved and loaded together with the AOT cache
+    size_t serializeProfiles(std::string &buffer);
+    bool readProfiles(JITServerAOTCacheReader &reader, size_t numProfiles,
+        const PersistentVector<AOTCacheMethodRecord *> &methodRecords,
+        const PersistentVector<AOTCacheClassRecord *> &classRecords);
+
     size_t getNumStores() const { return _numStores; }
 
     size_t getNumOverwrites() const { return _numOverwrites; }
 
+    size_t getNumRestoredProfiles() const { return _numRestoredProfiles; }
+
     void printStats(FILE *f) const;
     static int compareBytecodeProfiles(const BytecodeProfileSummary &profile1, const BytecodeProfileSummary &profile2);
     static int compareFaninProfiles(const FaninProfileSummary &profile1, const FaninProfileSummary &profile2);
 
 private:
+    ProfiledMethodEntry *findOrRestoreProfile(const AOTCacheMethodRecord *methodRecord, const J9ROMMethod *romMethod,
+        J9ROMClass *romClass);
+
     PersistentUnorderedMap<const AOTCacheMethodRecord *, ProfiledMethodEntry> _methodProfileMap;
+    // Profiles loaded from an AOT cache snapshot that have not been requested by any client yet.
+    // They cannot be turned into ProfiledMethodEntries until a client provides the ROMMethod
+    // that the bytecode PCs are relative to.
+    PersistentUnorderedMap<const AOTCacheMethodRecord *, ProfiledMethodSerializationRecord *> _persistedProfileMap;
     TR::Monitor * const _monitor;
     // The aotCache that is associated with this sharedProfileCache
     JITServerAOTCache * const _aotCache;
     // Statistics
     size_t _numStores;
     size_t _numOverwrites; // part of the store operations
+    size_t _numRestoredProfiles; // profiles loaded from a snapshot and later handed to a ProfiledMethodEntry
 
     // TR::RawAllocator _rawAllocator;
     // J9::SegmentAllocator _segmentAllocator;
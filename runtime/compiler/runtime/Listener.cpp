@@ -28,6 +28,7 @@
 #include <netinet/tcp.h> /* for TCP_NODELAY option */
 #include <openssl/err.h>
 #include <poll.h>
+#include <sys/epoll.h>
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/un.h>
@@ -38,6 +39,7 @@
 #include "env/TRMemory.hpp"
 #include "env/VMJ9.h"
 #include "env/VerboseLog.hpp"
+#include "infra/CriticalSection.hpp"
 #include "net/CommunicationStream.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include "net/ServerStream.hpp"
@@ -173,8 +175,41 @@ TR_Listener::TR_Listener()
     , _listenerOSThread(NULL)
     , _listenerThreadAttachAttempted(false)
     , _listenerThreadExitFlag(false)
+    , _epollfd(-1)
+    , _parkedConnectionsMonitor(TR::Monitor::create("JITServer-ParkedConnectionsMonitor"))
+    , _parkedConnections(decltype(_parkedConnections)::allocator_type(TR::Compiler->persistentAllocator()))
 {}
 
+bool TR_Listener::parkConnection(JITServer::ServerStream *stream)
+{
+    if (!isEventDriven())
+        return false;
+
+    // Data already decrypted and buffered by OpenSSL would never be signaled by epoll
+    BIO *bio = stream->getSSLBIO();
+    if (bio && ((*OBIO_ctrl)(bio, BIO_CTRL_PENDING, 0, NULL) > 0))
+        return false;
+
+    OMR::CriticalSection parkingConnection(_parkedConnectionsMonitor);
+    // The listener may have shut down and closed the epoll set since the check above
+    if (_epollfd < 0)
+        return false;
+
+    // The connection was registered at accept time; EPOLLONESHOT disabled it when it
+    // was handed to a compilation thread, so it only needs to be re-armed
+    struct epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+    event.data.ptr = stream;
+    if (epoll_ctl(_epollfd, EPOLL_CTL_MOD, stream->getConnectionFD(), &event) < 0) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Error re-arming connection on socket %d: errno=%d: %s",
+                stream->getConnectionFD(), errno, strerror(errno));
+        return false;
+    }
+    _parkedConnections.insert(stream);
+    return true;
+}
+
 void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler)
 {
     TR::CompilationInfo *compInfo = getCompilationInfo(jitConfig);
@@ -224,14 +259,35 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
         }
     }
 
-    // The following array accomodates two descriptors: healthSockfd and sockfd.
-    // The first one is used for readiness/liveness probes, the second one is used for compilation requests.
+    // Create the epoll set that holds the client connections waiting for their next request.
+    // The epoll descriptor becomes readable when any of the connections in the set is ready.
+    int epollfd = -1;
+    if (TR::Options::_jitserverUseEpollListener) {
+        epollfd = epoll_create1(EPOLL_CLOEXEC);
+        if (epollfd < 0) {
+            perror("can't create epoll instance for client connections");
+            exit(1);
+        }
+        OMR::CriticalSection publishingEpollSet(_parkedConnectionsMonitor);
+        _epollfd = epollfd;
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "t=%lu Using event-driven listener",
+                (unsigned long)compInfo->getPersistentInfo()->getElapsedTime());
+    }
+    struct epoll_event readyEvents[OPENJ9_LISTENER_MAX_EPOLL_EVENTS];
+
+    // The following array accomodates three descriptors: healthSockfd, sockfd and epollfd.
+    // The first one is used for readiness/liveness probes, the second one is used for compilation requests
+    // and the third one signals client connections with pending requests.
     // If we don't want to use readiness/liveness probes, healthSockfd will be -1 and will be ignored by poll().
-    struct pollfd pfd[2] = {
+    // Similarly, epollfd is -1 unless the event-driven listener is used.
+    struct pollfd pfd[3] = {
         { .fd = healthSockfd, .events = POLLIN, .revents = 0 },
-        {       .fd = sockfd, .events = POLLIN, .revents = 0 }
+        {       .fd = sockfd, .events = POLLIN, .revents = 0 },
+        {      .fd = epollfd, .events = POLLIN, .revents = 0 }
     };
     static const size_t numFds = sizeof(pfd) / sizeof(pfd[0]);
+    static const size_t epollFdIndex = 2;
 
     while (!getListenerThreadExitFlag()) {
         int32_t rc = 0;
@@ -262,9 +318,27 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
             TR_ASSERT_FATAL(pfd[fdIndex].revents == POLLIN,
                 "Unexpected event occurred during poll for new connection: socketIndex=%zu revents=%d\n", fdIndex,
                 pfd[fdIndex].revents);
+            pfd[fdIndex].revents = 0; // Reset the event for the next poll operation
+
+            if (fdIndex == epollFdIndex) {
+                // Some parked connections have data (or an error) available. Hand them over to the
+                // compilation handler; EPOLLONESHOT keeps them disarmed until they are parked again.
+                int numReady = epoll_wait(epollfd, readyEvents, OPENJ9_LISTENER_MAX_EPOLL_EVENTS, 0);
+                if ((numReady < 0) && (EINTR != errno)) {
+                    perror("error waiting for client connections");
+                    exit(1);
+                }
+                {
+                    OMR::CriticalSection dispatchingConnections(_parkedConnectionsMonitor);
+                    for (int i = 0; i < numReady; ++i)
+                        _parkedConnections.erase((JITServer::ServerStream *)readyEvents[i].data.ptr);
+                }
+                for (int i = 0; i < numReady; ++i)
+                    compiler->compile((JITServer::ServerStream *)readyEvents[i].data.ptr);
+                continue;
+            }
 
             // At this stage we should have a valid request for a new connection
-            pfd[fdIndex].revents = 0; // Reset the event for the next poll operation
             do {
                 connfd = accept(pfd[fdIndex].fd, (struct sockaddr *)&cli_addr, &clilen);
                 if (connfd < 0) {
@@ -300,6 +374,21 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
 
                         JITServer::ServerStream *stream
                             = new (TR::Compiler->persistentGlobalAllocator()) JITServer::ServerStream(connfd, bio);
+                        if (epollfd >= 0) {
+                            // Wait for the first request before occupying a compilation thread
+                            struct epoll_event event;
+                            event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+                            event.data.ptr = stream;
+                            OMR::CriticalSection registeringConnection(_parkedConnectionsMonitor);
+                            if (epoll_ctl(epollfd, EPOLL_CTL_ADD, connfd, &event) == 0) {
+                                _parkedConnections.insert(stream);
+                                continue;
+                            }
+                            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+                                TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                                    "Error registering connection on socket %d: errno=%d: %s", connfd, errno,
+                                    strerror(errno));
+                        }
                         compiler->compile(stream);
                     }
                 }
@@ -308,6 +397,22 @@ void TR_Listener::serveRemoteCompilationRequests(BaseCompileDispatcher *compiler
     } //  while (!getListenerThreadExitFlag())
 
     // The following piece of code will be executed only if the server shuts down properly
+    if (epollfd >= 0) {
+        {
+            // From here on parkConnection() leaves the connections with the compilation threads.
+            // The connections still parked are owned by the listener, so they are closed here.
+            OMR::CriticalSection closingEpollSet(_parkedConnectionsMonitor);
+            _epollfd = -1;
+            for (auto it = _parkedConnections.begin(); it != _parkedConnections.end(); ++it) {
+                JITServer::ServerStream *stream = *it;
+                epoll_ctl(epollfd, EPOLL_CTL_DEL, stream->getConnectionFD(), NULL);
+                stream->~ServerStream();
+                TR::Compiler->persistentGlobalAllocator().deallocate(stream);
+            }
+            _parkedConnections.clear();
+        }
+        close(epollfd);
+    }
     close(sockfd);
     if (sslCtx) {
         (*OSSL_CTX_free)(sslCtx);
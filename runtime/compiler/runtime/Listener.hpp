@@ -24,6 +24,7 @@
 #define LISTENER_HPP
 
 #include "j9.h"
+#include "env/PersistentCollections.hpp"
 #include "infra/Monitor.hpp" // TR::Monitor
 #include "net/ServerStream.hpp"
 
@@ -38,6 +39,7 @@
 */
 
 #define OPENJ9_LISTENER_POLL_TIMEOUT 100 // in milliseconds
+#define OPENJ9_LISTENER_MAX_EPOLL_EVENTS 64 // number of ready connections dispatched per epoll_wait()
 
 class BaseCompileDispatcher;
 
@@ -61,9 +63,33 @@ public:
        returns immediately so that other connection requests can be accepted.
        Note: it must be executed on a separate thread as it needs to keep listening for new connections.
 
+       With -Xjit:jitserverUseEpollListener, accepted connections are instead registered in an
+       epoll set owned by the listener. A connection is handed to the compilation handler only
+       when data from the client is available, and it returns to the epoll set (see
+       parkConnection()) once its request has been served. This way idle clients do not
+       occupy compilation threads waiting for their next request.
+
        @param [in] compiler Object that defines the behavior when a new connection is accepted
     */
     void serveRemoteCompilationRequests(BaseCompileDispatcher *compiler);
+
+    /**
+       @brief Return a persistent connection to the epoll set of the listener
+
+       The connection will be handed to the compilation handler again when
+       the client sends its next request. Must not be called while any other
+       thread can read from the stream.
+
+       @param [in] stream The connection whose request has just been served
+
+       @return true if the connection is now owned by the listener; false if
+               the event-driven listener is not in use or has shut down, or the
+               connection could not be registered, in which case the caller
+               remains the owner
+    */
+    bool parkConnection(JITServer::ServerStream *stream);
+
+    bool isEventDriven() const { return _epollfd >= 0; }
     int32_t waitForListenerThreadExit(J9JavaVM *javaVM);
 
     void setAttachAttempted(bool b) { _listenerThreadAttachAttempted = b; }
@@ -88,6 +114,9 @@ private:
     j9thread_t _listenerOSThread;
     volatile bool _listenerThreadAttachAttempted;
     volatile bool _listenerThreadExitFlag;
+    volatile int _epollfd; // epoll set of client connections, -1 if connections are handed over at accept time
+    TR::Monitor *_parkedConnectionsMonitor; // serializes parking connections with their dispatch and the shutdown of the epoll set
+    PersistentUnorderedSet<JITServer::ServerStream *> _parkedConnections; // connections in the epoll set, owned by the listener
 };
 
 /**
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include "AtomicSupport.hpp"
+#include "env/TRMemory.hpp"
+#include "runtime/MetricsHistogram.hpp"
+
+MetricsHistogram *MetricsHistogram::allocateArray(size_t count)
+{
+    void *mem = TR_Memory::jitPersistentAlloc(count * sizeof(MetricsHistogram));
+    if (mem)
+        memset(mem, 0, count * sizeof(MetricsHistogram));
+    return (MetricsHistogram *)mem;
+}
+
+void MetricsHistogram::record(uint64_t value, uint32_t threadIndex)
+{
+    size_t bucket = 0;
+    if (value) {
+        // Number of significant bits, i.e. the index of the smallest power of two larger than value
+        bucket = 64 - __builtin_clzll(value);
+        if (bucket >= NUM_BUCKETS)
+            bucket = NUM_BUCKETS - 1;
+    }
+    Shard &shard = _shards[threadIndex % NUM_SHARDS];
+    VM_AtomicSupport::add(&shard._buckets[bucket], 1);
+    VM_AtomicSupport::add(&shard._sum, (uintptr_t)value);
+}
+
+uint64_t MetricsHistogram::snapshot(uint64_t (&buckets)[NUM_BUCKETS], uint64_t &sum) const
+{
+    uint64_t count = 0;
+    sum = 0;
+    for (size_t b = 0; b < NUM_BUCKETS; ++b) {
+        buckets[b] = 0;
+        for (size_t s = 0; s < NUM_SHARDS; ++s)
+            buckets[b] += _shards[s]._buckets[b];
+        count += buckets[b];
+    }
+    for (size_t s = 0; s < NUM_SHARDS; ++s)
+        sum += _shards[s]._sum;
+    return count;
+}
+
+std::string MetricsHistogram::serialize(const std::string &name, const std::string &labels) const
+{
+    uint64_t buckets[NUM_BUCKETS];
+    uint64_t sum = 0;
+    snapshot(buckets, sum);
+    return serializeSnapshot(name, labels, buckets, sum);
+}
+
+std::string MetricsHistogram::serializeSnapshot(const std::string &name, const std::string &labels,
+    const uint64_t (&buckets)[NUM_BUCKETS], uint64_t sum)
+{
+    uint64_t count = 0;
+    for (size_t b = 0; b < NUM_BUCKETS; ++b)
+        count += buckets[b];
+    if (!count)
+        return std::string();
+
+    // Prometheus buckets are cumulative and their upper bounds are inclusive
+    std::string prefix = labels.empty() ? "{" : "{" + labels + ",";
+    std::string output;
+    uint64_t cumulativeCount = 0;
+    for (size_t b = 0; b < NUM_BUCKETS - 1; ++b) {
+        cumulativeCount += buckets[b];
+        uint64_t upperBound = ((uint64_t)1 << b) - 1;
+        output += name + "_bucket" + prefix + "le=\"" + std::to_string(upperBound) + "\"} "
+            + std::to_string(cumulativeCount) + "\n";
+    }
+    output += name + "_bucket" + prefix + "le=\"+Inf\"} " + std::to_string(count) + "\n";
+
+    std::string suffix = labels.empty() ? " " : "{" + labels + "} ";
+    output += name + "_sum" + suffix + std::to_string(sum) + "\n";
+    output += name + "_count" + suffix + std::to_string(count) + "\n";
+    return output;
+}
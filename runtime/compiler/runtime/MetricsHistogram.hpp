@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#ifndef METRICSHISTOGRAM_HPP
+#define METRICSHISTOGRAM_HPP
+
+#include <stdint.h>
+#include <string>
+
+/**
+   @class MetricsHistogram
+   @brief Histogram of non-negative integer samples with power-of-two buckets
+
+   Bucket 0 counts zero samples and bucket i > 0 counts samples in [2^(i-1), 2^i - 1].
+   The last bucket also absorbs all larger samples.
+   Recording must be cheap because it happens on the compilation hot path. The counters
+   are therefore split into shards and each thread updates the shard selected by its own
+   index (e.g. the compilation thread ID), so that threads do not normally share cache lines.
+   Updates are still atomic, so threads that map onto the same shard do not lose samples.
+   Readers add up the shards without synchronization and may miss samples that are being
+   recorded concurrently, which is acceptable for monitoring purposes.
+   The class has no constructor: zero-initialized memory is a valid empty histogram.
+ */
+class MetricsHistogram {
+public:
+    static const size_t NUM_BUCKETS = 31; // Together with the sum, a shard fills 4 cache lines
+    static const size_t NUM_SHARDS = 8;
+
+    /**
+       @brief Allocate and zero-initialize an array of histograms with persistent memory
+       @return Pointer to the first histogram, or NULL if the allocation failed
+    */
+    static MetricsHistogram *allocateArray(size_t count);
+
+    void record(uint64_t value, uint32_t threadIndex);
+
+    /**
+       @brief Add up the shards of this histogram
+       @param buckets OUT Non-cumulative count of samples in each bucket
+       @param sum OUT Sum of all samples
+       @return The total number of samples
+    */
+    uint64_t snapshot(uint64_t (&buckets)[NUM_BUCKETS], uint64_t &sum) const;
+
+    /**
+       @brief Build the text that encodes this histogram as a Prometheus histogram series
+       @param name Name of the metric
+       @param labels Labels that identify the series, e.g. `type="foo"`; may be empty
+       @return The _bucket, _sum and _count lines of the series; empty if there are no samples
+    */
+    std::string serialize(const std::string &name, const std::string &labels) const;
+
+    /**
+       @brief Build the text that encodes a snapshot of one or more histograms as a Prometheus histogram series
+       @param buckets Non-cumulative count of samples in each bucket, as returned by snapshot()
+       @param sum Sum of all samples
+       @return The _bucket, _sum and _count lines of the series; empty if there are no samples
+    */
+    static std::string serializeSnapshot(const std::string &name, const std::string &labels,
+        const uint64_t (&buckets)[NUM_BUCKETS], uint64_t sum);
+
+private:
+    struct Shard {
+        volatile uintptr_t _buckets[NUM_BUCKETS];
+        volatile uintptr_t _sum;
+    };
+
+    Shard _shards[NUM_SHARDS];
+}; // class MetricsHistogram
+
+#endif // #ifndef METRICSHISTOGRAM_HPP
@@ -39,7 +39,11 @@
 #include "env/PersistentInfo.hpp"
 #include "env/VerboseLog.hpp"
 #include "env/VMJ9.h"
+#include "infra/CriticalSection.hpp"
 #include "net/ServerStream.hpp"
+#include "runtime/JITClientSession.hpp"
+#include "runtime/JITServerAOTCache.hpp"
+#include "runtime/MetricsHistogram.hpp"
 #include "runtime/MetricsServer.hpp"
 
 bool MetricsServer::useSSL(TR::CompilationInfo *compInfo)
@@ -132,6 +136,121 @@ double ActiveThreadsMetric::computeValue(TR::CompilationInfo *compInfo)
     return getValue();
 }
 
+double AOTCacheHitsMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    if (auto aotCacheMap = compInfo->getJITServerAOTCacheMap())
+        setValue(aotCacheMap->getNumCacheHits());
+    return getValue();
+}
+
+double AOTCacheMissesMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    if (auto aotCacheMap = compInfo->getJITServerAOTCacheMap())
+        setValue(aotCacheMap->getNumCacheMisses());
+    return getValue();
+}
+
+static uint64_t totalNumSamples(const MetricsHistogram *histograms)
+{
+    uint64_t total = 0;
+    if (histograms) {
+        uint64_t buckets[MetricsHistogram::NUM_BUCKETS];
+        uint64_t sum = 0;
+        for (int i = 0; i < JITServer::MessageType_MAXTYPE; i++)
+            total += histograms[i].snapshot(buckets, sum);
+    }
+    return total;
+}
+
+static std::string serializeMessageHistograms(const MetricsHistogram *histograms, const std::string &name)
+{
+    std::string output;
+    if (histograms) {
+        for (int i = 0; i < JITServer::MessageType_MAXTYPE; i++)
+            output.append(histograms[i].serialize(name, "type=\"" + std::string(JITServer::messageNames[i]) + "\""));
+    }
+    return output;
+}
+
+double MessageLatencyMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(totalNumSamples(JITServer::ServerStream::getMessageLatencyHistograms()));
+    return getValue();
+}
+
+std::string MessageLatencyMetric::serialize()
+{
+    return serializeHeader()
+        + serializeMessageHistograms(JITServer::ServerStream::getMessageLatencyHistograms(), getName());
+}
+
+double MessageSizeMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    setValue(totalNumSamples(JITServer::ServerStream::getMessageSizeHistograms()));
+    return getValue();
+}
+
+std::string MessageSizeMetric::serialize()
+{
+    return serializeHeader()
+        + serializeMessageHistograms(JITServer::ServerStream::getMessageSizeHistograms(), getName());
+}
+
+struct ClientQueueWaitSnapshot {
+    uint64_t clientUID;
+    uint64_t buckets[MetricsHistogram::NUM_BUCKETS];
+    uint64_t sum;
+};
+
+static void addQueueWaitSnapshot(ClientQueueWaitSnapshot &total, const ClientQueueWaitSnapshot &snapshot)
+{
+    for (size_t b = 0; b < MetricsHistogram::NUM_BUCKETS; ++b)
+        total.buckets[b] += snapshot.buckets[b];
+    total.sum += snapshot.sum;
+}
+
+double ClientQueueWaitMetric::computeValue(TR::CompilationInfo *compInfo)
+{
+    // Sorted by client ID; the clients that do not fit are added to other
+    ClientQueueWaitSnapshot clients[MAX_CLIENT_SERIES];
+    ClientQueueWaitSnapshot other = {};
+    size_t numSeries = 0;
+    size_t numClients = 0;
+    {
+        OMR::CriticalSection cs(compInfo->getCompilationMonitor());
+        for (auto &it : compInfo->getClientSessionHT()->getClientSessionMap()) {
+            ClientQueueWaitSnapshot snapshot;
+            snapshot.clientUID = it.first;
+            it.second->getQueueWaitHistogram().snapshot(snapshot.buckets, snapshot.sum);
+            numClients++;
+
+            size_t i = numSeries;
+            if (numSeries < MAX_CLIENT_SERIES) {
+                numSeries++;
+            } else if (snapshot.clientUID < clients[numSeries - 1].clientUID) {
+                addQueueWaitSnapshot(other, clients[numSeries - 1]);
+                i = numSeries - 1;
+            } else {
+                addQueueWaitSnapshot(other, snapshot);
+                continue;
+            }
+            for (; (i > 0) && (clients[i - 1].clientUID > snapshot.clientUID); i--)
+                clients[i] = clients[i - 1];
+            clients[i] = snapshot;
+        }
+    }
+
+    _serializedValue = serializeHeader();
+    for (size_t i = 0; i < numSeries; i++) {
+        _serializedValue.append(MetricsHistogram::serializeSnapshot(getName(),
+            "client=\"" + std::to_string(clients[i].clientUID) + "\"", clients[i].buckets, clients[i].sum));
+    }
+    _serializedValue.append(
+        MetricsHistogram::serializeSnapshot(getName(), "client=\"other\"", other.buckets, other.sum));
+    setValue(numClients);
+    return getValue();
+}
+
 MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     : _compInfo(compInfo)
 {
@@ -139,7 +258,12 @@ MetricsDatabase::MetricsDatabase(TR::CompilationInfo *compInfo)
     _metrics[1] = new (PERSISTENT_NEW) AvailableMemoryMetric();
     _metrics[2] = new (PERSISTENT_NEW) ConnectedClientsMetric();
     _metrics[3] = new (PERSISTENT_NEW) ActiveThreadsMetric();
-    static_assert(3 == MAX_METRICS - 1, "Unsupported number of metrics");
+    _metrics[4] = new (PERSISTENT_NEW) AOTCacheHitsMetric();
+    _metrics[5] = new (PERSISTENT_NEW) AOTCacheMissesMetric();
+    _metrics[6] = new (PERSISTENT_NEW) MessageLatencyMetric();
+    _metrics[7] = new (PERSISTENT_NEW) MessageSizeMetric();
+    _metrics[8] = new (PERSISTENT_NEW) ClientQueueWaitMetric();
+    static_assert(8 == MAX_METRICS - 1, "Unsupported number of metrics");
 }
 
 MetricsDatabase::~MetricsDatabase()
@@ -355,6 +479,11 @@ MetricsServer::MetricsServer()
 MetricsServer *MetricsServer::allocate()
 {
     MetricsServer *metricsServer = new (PERSISTENT_NEW) MetricsServer();
+    // Message histograms are only maintained when there is someone to scrape them
+    if (metricsServer && !JITServer::ServerStream::enableMessageMetrics()) {
+        if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "MetricsServer: Could not allocate message histograms");
+    }
     return metricsServer;
 }
 
@@ -38,13 +38,16 @@ class CompilationInfo;
 
    PrometheusMetric is an abstract class and concrete classes need to be derived from it.
    Derived classes need to implement the `computeValue()` function and possibly the
-   destructor, if they allocate memory dynamically.
+   destructor, if they allocate memory dynamically. Metrics that are not a single value
+   (e.g. histograms) also need to override `serialize()`.
  */
 class PrometheusMetric {
 public:
-    PrometheusMetric(const std::string &name, const std::string &help)
+    PrometheusMetric(const std::string &name, const std::string &help, const char *type = "gauge")
         : _name(name)
         , _help(help)
+        , _type(type)
+        , _value(0)
     {}
 
     virtual ~PrometheusMetric() {}
@@ -68,15 +71,17 @@ public:
        @brief Build a std::string that encodes the value of the metric in a format understood by Prometheus
        @return Serialized value of the metric (as a std::string)
     */
-    std::string serialize()
+    virtual std::string serialize() { return serializeHeader() + getName() + " " + std::to_string(getValue()) + "\n"; }
+
+protected:
+    std::string serializeHeader() const
     {
-        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " gauge\n" + getName() + " "
-            + std::to_string(getValue()) + "\n";
+        return "# HELP " + getName() + " " + getHelp() + "\n# TYPE " + getName() + " " + _type + "\n";
     }
 
-protected:
     const std::string _name;
     const std::string _help;
+    const char * const _type; // gauge, counter or histogram
     double _value;
 }; // class PrometheusMetric
 
@@ -129,6 +134,93 @@ public:
     virtual double computeValue(TR::CompilationInfo *compInfo);
 }; // class ActiveThreadsMetric
 
+/**
+   @brief Class used to serialize the number of AOT cache hits across all JITServer AOT caches, as a counter
+   understood by Prometheus
+ */
+class AOTCacheHitsMetric : public PrometheusMetric {
+public:
+    AOTCacheHitsMetric()
+        : PrometheusMetric("jitserver_aot_cache_hits_total", "Number of methods served from the JITServer AOT cache",
+              "counter")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class AOTCacheHitsMetric
+
+/**
+   @brief Class used to serialize the number of AOT cache misses across all JITServer AOT caches, as a counter
+   understood by Prometheus
+ */
+class AOTCacheMissesMetric : public PrometheusMetric {
+public:
+    AOTCacheMissesMetric()
+        : PrometheusMetric("jitserver_aot_cache_misses_total",
+              "Number of AOT compilation requests not found in the JITServer AOT cache", "counter")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+}; // class AOTCacheMissesMetric
+
+/**
+   @brief Class used to serialize the histograms of JITServer message latencies, one series per message type
+
+   The latency of a message is the time between the server sending a query to the client and
+   receiving the reply. The value of the metric is the total number of messages.
+ */
+class MessageLatencyMetric : public PrometheusMetric {
+public:
+    MessageLatencyMetric()
+        : PrometheusMetric("jitserver_message_latency_microseconds",
+              "Round-trip latency of JITServer messages sent to clients", "histogram")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+    virtual std::string serialize();
+}; // class MessageLatencyMetric
+
+/**
+   @brief Class used to serialize the histograms of JITServer message sizes, one series per message type
+
+   The size of a message is the size of the reply received from the client.
+ */
+class MessageSizeMetric : public PrometheusMetric {
+public:
+    MessageSizeMetric()
+        : PrometheusMetric("jitserver_message_size_bytes", "Size of replies received from clients", "histogram")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+    virtual std::string serialize();
+}; // class MessageSizeMetric
+
+/**
+   @brief Class used to serialize the histograms of the time spent by compilation requests in the queue,
+   one series per connected client
+
+   Only the MAX_CLIENT_SERIES clients with the lowest IDs get their own series, so that the same clients
+   keep their series between scrapes. The other clients are aggregated into the client="other" series,
+   which bounds the number of series of a server with many clients.
+ */
+class ClientQueueWaitMetric : public PrometheusMetric {
+public:
+    static const size_t MAX_CLIENT_SERIES = 16;
+
+    ClientQueueWaitMetric()
+        : PrometheusMetric("jitserver_client_queue_wait_microseconds",
+              "Time spent by compilation requests in the JITServer compilation queue", "histogram")
+    {}
+
+    virtual double computeValue(TR::CompilationInfo *compInfo);
+    virtual std::string serialize() { return _serializedValue; }
+
+private:
+    // Client sessions can only be accessed under the compilation monitor, so computeValue(),
+    // which is given access to CompilationInfo, copies their histograms under the monitor
+    // and then builds the text without holding it
+    std::string _serializedValue;
+}; // class ClientQueueWaitMetric
+
 /**
    @class MetricsDatabase
    @brief Collection of metrics that need to be sent to Prometheus on demand
@@ -140,7 +232,7 @@ public:
  */
 class MetricsDatabase {
 public:
-    static const size_t MAX_METRICS = 4; // Maximum number of metrics our database can hold
+    static const size_t MAX_METRICS = 9; // Maximum number of metrics our database can hold
     MetricsDatabase(TR::CompilationInfo *compInfo);
     ~MetricsDatabase();
 
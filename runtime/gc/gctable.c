@@ -113,6 +113,7 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_ext_check_is_valid_heap_object,
 #if defined(J9VM_GC_FINALIZATION)
 	j9gc_get_objects_pending_finalization_count,
+	j9gc_finalizer_statistics_do,
 #endif /* J9VM_GC_FINALIZATION */
 	j9gc_set_softmx,
 	j9gc_get_softmx,
@@ -287,6 +288,12 @@ J9MemoryManagerFunctions MemoryManagerFunctions = {
 	j9gc_get_cumulative_class_unloading_stats,
 	j9mm_iterate_all_ownable_synchronizer_objects,
 	j9mm_iterate_all_continuation_objects,
+	j9mm_parallel_iteration_thread_count,
+	j9mm_iterate_all_objects_parallel,
+	j9mm_start_work_units,
+	j9mm_next_work_unit,
+	j9mm_end_work_units,
+	j9mm_iterate_work_unit_objects,
 	continuationObjectCreated,
 	continuationObjectStarted,
 	continuationObjectFinished,
@@ -28,6 +28,8 @@
 #include "ModronAssertions.h"
 
 #include "ArrayletLeafIterator.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapIteratorAPIRootIterator.hpp"
 #include "HeapIteratorAPIBufferedIterator.hpp"
@@ -42,6 +44,8 @@
 #include "MixedObjectIterator.hpp"
 #include "ObjectAccessBarrier.hpp"
 #include "OwnableSynchronizerObjectList.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
 #include "ContinuationObjectList.hpp"
 #include "PointerArrayIterator.hpp"
 #include "SlotObject.hpp"
@@ -85,6 +89,14 @@ iterateRegionObjects(
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData),
 	void *userData);
 
+static bool
+initializeIteratedObjectDescriptor(
+	J9JavaVM *vm,
+	J9MM_IterateRegionDescriptor *region,
+	UDATA flags,
+	J9Object *object,
+	J9MM_IterateObjectDescriptor *objectDescriptor);
+
 extern "C" {
 
 /* used by j9mm_iterate_all_objects */
@@ -92,6 +104,14 @@ static jvmtiIterationControl internalIterateHeaps(J9JavaVM *vm, J9MM_IterateHeap
 static jvmtiIterationControl internalIterateSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
 static jvmtiIterationControl internalIterateRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
 
+/* used by j9mm_start_work_units */
+static jvmtiIterationControl prepareParallelHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData);
+static jvmtiIterationControl prepareParallelSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData);
+static jvmtiIterationControl prepareParallelRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData);
+
+/* used by j9mm_iterate_all_objects_parallel */
+static jvmtiIterationControl serialIterateObjects(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
+
 typedef struct J9MM_CallbackDataHolderPrivate{
 	jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData);
 	void *userData;
@@ -100,6 +120,37 @@ typedef struct J9MM_CallbackDataHolderPrivate{
 } J9MM_CallbackDataHolderPrivate;
 
 
+/* the objects of a region are walked by several GC worker threads in ranges of about this size */
+#define HEAPITERATORAPI_PARALLEL_WORK_UNIT_SIZE ((UDATA)4 * 1024 * 1024)
+
+/**
+ * The state of a walk of the heap split in work units. The regions are collected when the walk
+ * starts, and split as their work units are claimed.
+ */
+struct J9MM_WorkUnitIterator {
+	J9JavaVM *javaVM;
+	J9PortLibrary *portLibrary;
+	MM_Forge *forge;
+	omrthread_monitor_t mutex; /**< serializes the claims of work units */
+	J9MM_IterateRegionDescriptor *regions;
+	UDATA regionCount;
+	UDATA regionCapacity;
+	UDATA workUnitSize;
+	BOOLEAN (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, j9object_t object, void *userData);
+	void *userData;
+	UDATA nextRegion; /**< index of the region holding the next work unit */
+	void *nextBase; /**< start of the next work unit, or NULL if it starts the region */
+	UDATA nextIndex; /**< index of the next work unit */
+	bool splitting; /**< false once the split of the region holding the next work unit stopped */
+	bool result; /**< false if a region could not be collected */
+};
+
+typedef struct J9MM_SerialCallbackDataHolderPrivate {
+	jvmtiIterationControl (*func)(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData);
+	void *userData;
+	J9VMThread *vmThread;
+} J9MM_SerialCallbackDataHolderPrivate;
+
 typedef enum J9MM_RegionType{
 	j9mm_region_type_region = 0
 } J9MM_RegionType;
@@ -563,6 +614,348 @@ j9mm_iterate_all_continuation_objects(J9VMThread *vmThread, J9PortLibrary *portL
 	return returnCode;
 }
 
+/**
+ * Walks the work units of j9mm_iterate_all_objects_parallel on the GC worker threads.
+ */
+class MM_HeapIteratorAPIParallelTask : public MM_ParallelTask
+{
+private:
+	J9JavaVM *_javaVM;
+	J9MM_WorkUnitIterator *_workUnits;
+	UDATA _flags;
+	jvmtiIterationControl (*_func)(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData);
+	void *_userData;
+	UDATA _vmState;
+	volatile bool _abort; /**< set once a callback returned JVMTI_ITERATION_ABORT */
+
+	/**
+	 * The user data of the walk of a work unit on one worker thread.
+	 */
+	struct WorkerData {
+		MM_HeapIteratorAPIParallelTask *task;
+		J9VMThread *workerThread;
+		UDATA workerID;
+	};
+
+	static jvmtiIterationControl
+	iterateObject(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+	{
+		WorkerData *data = (WorkerData *)userData;
+		MM_HeapIteratorAPIParallelTask *task = data->task;
+
+		if (!task->_abort && (JVMTI_ITERATION_ABORT == task->_func(data->workerThread, object, data->workerID, task->_userData))) {
+			task->_abort = true;
+		}
+		return task->_abort ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+	}
+
+public:
+	virtual UDATA getVMStateID() { return _vmState; }
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		PORT_ACCESS_FROM_JAVAVM(_javaVM);
+		WorkerData data;
+		data.task = this;
+		data.workerThread = (J9VMThread *)env->getLanguageVMThread();
+		data.workerID = env->getWorkerID();
+
+		/* the work units are claimed as the threads get to them, so no thread waits for the regions to be split */
+		J9MM_IterateWorkUnitDescriptor workUnit;
+		while (!_abort && j9mm_next_work_unit(_workUnits, &workUnit)) {
+			j9mm_iterate_work_unit_objects(_javaVM, PORTLIB, &workUnit, _flags, iterateObject, &data);
+		}
+	}
+
+	bool wasAborted() { return _abort; }
+
+	MM_HeapIteratorAPIParallelTask(
+		MM_EnvironmentBase *env,
+		MM_ParallelDispatcher *dispatcher,
+		J9MM_WorkUnitIterator *workUnits,
+		UDATA flags,
+		jvmtiIterationControl (*func)(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData),
+		void *userData)
+		: MM_ParallelTask(env, dispatcher)
+		, _javaVM((J9JavaVM *)env->getLanguageVM())
+		, _workUnits(workUnits)
+		, _flags(flags)
+		, _func(func)
+		, _userData(userData)
+		, _vmState(env->getOmrVMThread()->vmState)
+		, _abort(false)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Answer whether the GC worker threads can be dispatched from the thread of the given environment.
+ */
+static bool
+canIterateInParallel(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+
+	/* Tasks can not be nested, and metronome only dispatches incremental tasks */
+	return (NULL != dispatcher)
+		&& (1 < dispatcher->threadCountMaximum())
+		&& (NULL == env->_currentTask)
+		&& !extensions->isMetronomeGC()
+		&& !extensions->isConcurrentScavengerInProgress();
+}
+
+/**
+ * Answer the number of threads j9mm_iterate_all_objects_parallel may call back on. The workerID
+ * passed to the callback is lower than this count.
+ */
+UDATA
+j9mm_parallel_iteration_thread_count(J9VMThread *vmThread)
+{
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	UDATA threadCount = 1;
+
+	if (canIterateInParallel(env)) {
+		threadCount = MM_GCExtensions::getExtensions(env)->dispatcher->threadCountMaximum();
+	}
+	return threadCount;
+}
+
+/**
+ * Walk all objects of the heap on the GC worker threads, call user provided function.
+ * The regions are split in ranges that the worker threads walk concurrently, so the function must
+ * be thread safe and the objects are not reported in address order. The walk is done on the calling
+ * thread when the worker threads can not be used. The caller must hold exclusive VM access.
+ *
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor, with the thread it runs on and its workerID.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if a call of the function returned JVMTI_ITERATION_ABORT, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(vmThread->omrVMThread);
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+	bool walked = false;
+
+	if (canIterateInParallel(env)) {
+		J9MM_WorkUnitIterator *workUnits = j9mm_start_work_units(vm, portLibrary, HEAPITERATORAPI_PARALLEL_WORK_UNIT_SIZE, NULL, NULL);
+		if (NULL != workUnits) {
+			MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+			MM_HeapIteratorAPIParallelTask task(env, extensions->dispatcher, workUnits, flags, func, userData);
+			extensions->dispatcher->run(env, &task);
+			if (task.wasAborted()) {
+				returnCode = JVMTI_ITERATION_ABORT;
+			}
+			walked = true;
+			j9mm_end_work_units(workUnits);
+		}
+	}
+
+	if (!walked) {
+		J9MM_SerialCallbackDataHolderPrivate data;
+		data.func = func;
+		data.userData = userData;
+		data.vmThread = vmThread;
+		returnCode = j9mm_iterate_all_objects(vm, portLibrary, flags, serialIterateObjects, &data);
+	}
+
+	return returnCode;
+}
+
+/**
+ * Start a walk of the heap split in work units. Only the regions are collected here, as the
+ * region manager is locked while they are reported; the threads of the walk split them as they
+ * claim their work units.
+ */
+J9MM_WorkUnitIterator *
+j9mm_start_work_units(J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA workUnitSize, BOOLEAN (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, j9object_t object, void *userData), void *userData)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(vm)->getForge();
+	J9MM_WorkUnitIterator *iterator = (J9MM_WorkUnitIterator *)forge->allocate(sizeof(J9MM_WorkUnitIterator), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+
+	if (NULL != iterator) {
+		memset(iterator, 0, sizeof(J9MM_WorkUnitIterator));
+		iterator->javaVM = vm;
+		iterator->portLibrary = portLibrary;
+		iterator->forge = forge;
+		iterator->workUnitSize = workUnitSize;
+		iterator->func = func;
+		iterator->userData = userData;
+		iterator->splitting = true;
+		iterator->result = true;
+
+		if (0 != omrthread_monitor_init_with_name(&iterator->mutex, 0, "HeapIteratorAPI work units")) {
+			iterator->mutex = NULL;
+			iterator->result = false;
+		} else {
+			j9mm_iterate_heaps(vm, portLibrary, 0, prepareParallelHeaps, iterator);
+		}
+
+		if (!iterator->result) {
+			j9mm_end_work_units(iterator);
+			iterator = NULL;
+		}
+	}
+
+	return iterator;
+}
+
+/**
+ * Find the end of the work unit starting at base: the first object found past workUnitSize bytes,
+ * or the top of the region. Called with the mutex of the walk held.
+ */
+static void *
+splitRegion(J9MM_WorkUnitIterator *iterator, J9MM_IterateRegionDescriptor *region, MM_HeapRegionDescriptor *heapRegion, void *base, void *top)
+{
+	HeapIteratorAPI_BufferedIterator objectHeapIterator(iterator->javaVM, iterator->portLibrary, heapRegion, base, top, true);
+	UDATA split = (UDATA)base + iterator->workUnitSize;
+	J9Object *object = NULL;
+
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		if ((NULL != iterator->func) && !iterator->func(iterator->javaVM, region, object, iterator->userData)) {
+			/* the rest of the region can not be walked safely to find the splits */
+			iterator->splitting = false;
+			break;
+		}
+		if ((UDATA)object >= split) {
+			return object;
+		}
+	}
+	return top;
+}
+
+/**
+ * Claim the next work unit of a walk. Only the objects of the work unit claimed are stepped over
+ * to find its end, so the walk of the heap to split the regions is shared between the threads,
+ * one work unit at a time.
+ */
+BOOLEAN
+j9mm_next_work_unit(J9MM_WorkUnitIterator *iterator, J9MM_IterateWorkUnitDescriptor *workUnit)
+{
+	BOOLEAN result = FALSE;
+
+	omrthread_monitor_enter(iterator->mutex);
+	if (iterator->nextRegion < iterator->regionCount) {
+		J9MM_IterateRegionDescriptor *region = &iterator->regions[iterator->nextRegion];
+		MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)region->id;
+		void *base = (NULL == iterator->nextBase) ? heapRegion->getLowAddress() : iterator->nextBase;
+		void *regionTop = heapRegion->getHighAddress();
+		void *top = regionTop;
+
+		if (iterator->splitting && (0 != region->objectAlignment) && (((UDATA)regionTop - (UDATA)base) > iterator->workUnitSize)) {
+			top = splitRegion(iterator, region, heapRegion, base, regionTop);
+		}
+
+		workUnit->regionDesc = *region;
+		workUnit->base = base;
+		workUnit->top = top;
+		workUnit->index = iterator->nextIndex;
+		iterator->nextIndex += 1;
+
+		if (top == regionTop) {
+			iterator->nextRegion += 1;
+			iterator->nextBase = NULL;
+			iterator->splitting = true;
+		} else {
+			iterator->nextBase = top;
+		}
+		result = TRUE;
+	}
+	omrthread_monitor_exit(iterator->mutex);
+
+	return result;
+}
+
+void
+j9mm_end_work_units(J9MM_WorkUnitIterator *iterator)
+{
+	if (NULL != iterator->mutex) {
+		omrthread_monitor_destroy(iterator->mutex);
+	}
+	if (NULL != iterator->regions) {
+		iterator->forge->free(iterator->regions);
+	}
+	iterator->forge->free(iterator);
+}
+
+/**
+ * Walk all objects of a work unit, call user provided function.
+ */
+jvmtiIterationControl
+j9mm_iterate_work_unit_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateWorkUnitDescriptor *workUnit, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData)
+{
+	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
+	MM_HeapRegionDescriptor *heapRegion = (MM_HeapRegionDescriptor *)workUnit->regionDesc.id;
+	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, portLibrary, heapRegion, workUnit->base, workUnit->top, true);
+	J9Object *object = NULL;
+
+	while (NULL != (object = objectHeapIterator.nextObject())) {
+		J9MM_IterateObjectDescriptor objectDescriptor;
+		if (initializeIteratedObjectDescriptor(vm, &workUnit->regionDesc, flags, object, &objectDescriptor)) {
+			returnCode = func(vm, &objectDescriptor, userData);
+			if (JVMTI_ITERATION_ABORT == returnCode) {
+				break;
+			}
+		}
+	}
+
+	return returnCode;
+}
+
+/* used by j9mm_start_work_units */
+static jvmtiIterationControl
+prepareParallelHeaps(J9JavaVM *vm, J9MM_IterateHeapDescriptor *heap, void *userData)
+{
+	J9MM_WorkUnitIterator *iterator = (J9MM_WorkUnitIterator *)userData;
+	j9mm_iterate_spaces(vm, iterator->portLibrary, heap, 0, prepareParallelSpaces, userData);
+	return iterator->result ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+static jvmtiIterationControl
+prepareParallelSpaces(J9JavaVM *vm, J9MM_IterateSpaceDescriptor *space, void *userData)
+{
+	J9MM_WorkUnitIterator *iterator = (J9MM_WorkUnitIterator *)userData;
+	j9mm_iterate_regions(vm, iterator->portLibrary, space, 0, prepareParallelRegions, userData);
+	return iterator->result ? JVMTI_ITERATION_CONTINUE : JVMTI_ITERATION_ABORT;
+}
+
+static jvmtiIterationControl
+prepareParallelRegions(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, void *userData)
+{
+	J9MM_WorkUnitIterator *iterator = (J9MM_WorkUnitIterator *)userData;
+
+	if (iterator->regionCount == iterator->regionCapacity) {
+		UDATA newCapacity = (0 == iterator->regionCapacity) ? 64 : (iterator->regionCapacity * 2);
+		J9MM_IterateRegionDescriptor *newRegions = (J9MM_IterateRegionDescriptor *)iterator->forge->allocate(newCapacity * sizeof(J9MM_IterateRegionDescriptor), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newRegions) {
+			iterator->result = false;
+			return JVMTI_ITERATION_ABORT;
+		}
+		if (NULL != iterator->regions) {
+			memcpy(newRegions, iterator->regions, iterator->regionCount * sizeof(J9MM_IterateRegionDescriptor));
+			iterator->forge->free(iterator->regions);
+		}
+		iterator->regions = newRegions;
+		iterator->regionCapacity = newCapacity;
+	}
+
+	iterator->regions[iterator->regionCount] = *region;
+	iterator->regionCount += 1;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static jvmtiIterationControl
+serialIterateObjects(J9JavaVM *vm, J9MM_IterateObjectDescriptor *object, void *userData)
+{
+	J9MM_SerialCallbackDataHolderPrivate *data = (J9MM_SerialCallbackDataHolderPrivate *)userData;
+	return data->func(data->vmThread, object, 0, data->userData);
+}
+
 } /* extern "C" */
 
 /**
@@ -724,6 +1117,35 @@ iterateRegions(
 	return returnCode;
 }
 
+/**
+ * Initialize the descriptor of an object found by walking a region. Dead objects, and objects
+ * whose class is being unloaded, are reported as holes.
+ *
+ * @return false if the object is a hole and holes are not to be reported
+ */
+static bool
+initializeIteratedObjectDescriptor(J9JavaVM *vm, J9MM_IterateRegionDescriptor *region, UDATA flags, J9Object *object, J9MM_IterateObjectDescriptor *objectDescriptor)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
+	if ((extensions->objectModel.isDeadObject(object)) || (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ_VM(object, vm)) & J9AccClassDying))) {
+		if (0 == (flags & j9mm_iterator_flag_include_holes)) {
+			return false;
+		}
+		if (extensions->objectModel.isDeadObject(object)) {
+			objectDescriptor->id = (UDATA)object;
+			objectDescriptor->object = object;
+			objectDescriptor->size = extensions->objectModel.getSizeInBytesDeadObject(object);
+		} else {
+			/* this object is not marked as a hole, but its class has been partially unloaded so it's treated like a hole here */
+			j9mm_initialize_object_descriptor(vm, objectDescriptor, object);
+		}
+		objectDescriptor->isObject = FALSE;
+	} else {
+		initializeObjectDescriptor(vm, objectDescriptor, region, object);
+	}
+	return true;
+}
+
 static jvmtiIterationControl
 iterateRegionObjects(
 	J9JavaVM *vm,
@@ -736,29 +1158,11 @@ iterateRegionObjects(
 	jvmtiIterationControl returnCode = JVMTI_ITERATION_CONTINUE;
 	/* Iterate over live and dead objects */
 	MM_HeapRegionDescriptor* heapRegion = (MM_HeapRegionDescriptor*)region->id;
-	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(vm->omrVM);
 	HeapIteratorAPI_BufferedIterator objectHeapIterator(vm, PORTLIB, heapRegion, true);
 	J9Object* object = NULL;
 	while (NULL != (object = objectHeapIterator.nextObject())) {
 		J9MM_IterateObjectDescriptor objectDescriptor;
-		if ((extensions->objectModel.isDeadObject(object)) || (0 != (J9CLASS_FLAGS(J9GC_J9OBJECT_CLAZZ_VM(object, vm)) & J9AccClassDying))) {
-			if (0 != (flags & j9mm_iterator_flag_include_holes)) {
-				if (extensions->objectModel.isDeadObject(object)) {
-					objectDescriptor.id = (UDATA)object;
-					objectDescriptor.object = object;
-					objectDescriptor.size = extensions->objectModel.getSizeInBytesDeadObject(object);
-				} else {
-					/* this object is not marked as a hole, but its class has been partially unloaded so it's treated like a hole here */
-					j9mm_initialize_object_descriptor(vm, &objectDescriptor, object);
-				}
-				objectDescriptor.isObject = FALSE;
-				returnCode = func(vm, &objectDescriptor, userData);
-				if (JVMTI_ITERATION_ABORT == returnCode) {
-					break;
-				}
-			}
-		} else {
-			initializeObjectDescriptor(vm, &objectDescriptor, region, object);
+		if (initializeIteratedObjectDescriptor(vm, region, flags, object, &objectDescriptor)) {
 			returnCode = func(vm, &objectDescriptor, userData);
 			if (JVMTI_ITERATION_ABORT == returnCode) {
 				break;
@@ -568,9 +568,11 @@ MM_HeapRootScanner::scanJVMTIObjectTagTables()
 	if (NULL != jvmtiData) {
 		GC_JVMTIObjectTagTableListIterator objectTagTableList( jvmtiData->environments);
 		while (NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while (NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+			for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTables[shard]);
+				while (NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+				}
 			}
 		}
 	}
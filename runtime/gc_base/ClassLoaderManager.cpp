@@ -37,6 +37,9 @@
 #include "ClassUnloadStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "FinalizableClassLoaderBuffer.hpp"
+#if defined(J9VM_GC_FINALIZATION)
+#include "FinalizeListManager.hpp"
+#endif /* J9VM_GC_FINALIZATION */
 #include "GCExtensions.hpp"
 #include "GlobalCollector.hpp"
 #include "HeapMap.hpp"
@@ -351,6 +354,9 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 		/* Call classes unload hook */
 		Trc_MM_cleanUpClassLoadersStart_triggerClassesUnload(env->getLanguageVMThread(), classUnloadCount);
 		TRIGGER_J9HOOK_VM_CLASSES_UNLOAD(_javaVM->hookInterface, vmThread, classUnloadCount, classUnloadList);
+#if defined(J9VM_GC_FINALIZATION)
+		_extensions->finalizeListManager->removeFinalizerStatistics(classUnloadList);
+#endif /* J9VM_GC_FINALIZATION */
 	}
 
 	if (0 != anonymousClassUnloadCount) {
@@ -24,6 +24,7 @@
 #include "j9.h"
 #include "j9cfg.h"
 #include "j9port.h"
+#include "hashtable_api.h"
 #include "ModronAssertions.h"
 
 #if defined(J9VM_GC_FINALIZATION)
@@ -89,10 +90,28 @@ GC_FinalizeListManager::kill(MM_EnvironmentBase *env)
 bool
 GC_FinalizeListManager::initialize()
 {
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+
 	if (omrthread_monitor_init_with_name(&_mutex, 0, "FinalizeListManager")) {
 		_mutex = NULL;
 		return false;
 	}
+
+	_finalizerStatistics = hashTableNew(
+			OMRPORTLIB,
+			J9_GET_CALLSITE(),
+			0,
+			sizeof(GC_FinalizerStatistics),
+			0,
+			0,
+			OMRMEM_CATEGORY_MM,
+			finalizerStatisticsHash,
+			finalizerStatisticsEquals,
+			NULL,
+			NULL);
+	if (NULL == _finalizerStatistics) {
+		return false;
+	}
 	
 	return true;
 }
@@ -103,12 +122,106 @@ GC_FinalizeListManager::initialize()
 void
 GC_FinalizeListManager::tearDown()
 {
+	if (NULL != _finalizerStatistics) {
+		hashTableFree(_finalizerStatistics);
+		_finalizerStatistics = NULL;
+	}
 	if(NULL != _mutex) {
 		omrthread_monitor_destroy(_mutex);
 		_mutex = NULL;
 	}
 }
 
+UDATA
+GC_FinalizeListManager::finalizerStatisticsHash(void *entry, void *userData)
+{
+	return (UDATA)((GC_FinalizerStatistics *)entry)->clazz;
+}
+
+UDATA
+GC_FinalizeListManager::finalizerStatisticsEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((GC_FinalizerStatistics *)leftEntry)->clazz == ((GC_FinalizerStatistics *)rightEntry)->clazz;
+}
+
+void
+GC_FinalizeListManager::countFinalizerRun(J9VMThread *vmThread, j9object_t object)
+{
+	GC_FinalizerStatistics query = {J9OBJECT_CLAZZ(vmThread, object), 0, 0};
+	/* an existing entry is returned, a failed add only loses the count */
+	GC_FinalizerStatistics *statistics = (GC_FinalizerStatistics *)hashTableAdd(_finalizerStatistics, &query);
+	if (NULL != statistics) {
+		statistics->finalizersRun += 1;
+	}
+}
+
+void
+GC_FinalizeListManager::countFinalizableObjects(J9VMThread *vmThread, j9object_t list)
+{
+	MM_ObjectAccessBarrier *barrier = _extensions->accessBarrier;
+	j9object_t object = list;
+
+	while (NULL != object) {
+		GC_FinalizerStatistics query = {J9OBJECT_CLAZZ(vmThread, object), 0, 0};
+		GC_FinalizerStatistics *statistics = (GC_FinalizerStatistics *)hashTableAdd(_finalizerStatistics, &query);
+		if (NULL != statistics) {
+			statistics->objects += 1;
+		}
+		object = barrier->getFinalizeLink(object);
+	}
+}
+
+void
+GC_FinalizeListManager::finalizerStatisticsDo(J9VMThread *vmThread, GC_FinalizerStatisticsFunction function, void *userData)
+{
+	J9HashTableState walkState;
+
+	lock();
+
+	countFinalizableObjects(vmThread, _defaultFinalizableObjects);
+	countFinalizableObjects(vmThread, _systemFinalizableObjects);
+
+	GC_FinalizerStatistics *statistics = (GC_FinalizerStatistics *)hashTableStartDo(_finalizerStatistics, &walkState);
+	while (NULL != statistics) {
+		function(vmThread, statistics->clazz, statistics->objects, statistics->finalizersRun, userData);
+		statistics->objects = 0;
+		statistics = (GC_FinalizerStatistics *)hashTableNextDo(&walkState);
+	}
+
+	unlock();
+}
+
+void
+GC_FinalizeListManager::removeFinalizerStatistics(J9Class *classUnloadList)
+{
+	lock();
+
+	if (0 != hashTableGetCount(_finalizerStatistics)) {
+		J9Class *clazz = classUnloadList;
+		while (NULL != clazz) {
+			GC_FinalizerStatistics query = {clazz, 0, 0};
+			hashTableRemove(_finalizerStatistics, &query);
+			clazz = clazz->gcLink;
+		}
+	}
+
+	unlock();
+}
+
+void
+GC_FinalizeListManager::jobsAdded()
+{
+	if (0 == _queuedSince) {
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_queuedSince = omrtime_hires_clock();
+	}
+	if (1 < _extensions->finalizeWorkerThreads) {
+		/* the new objects may not be claimed, let the blocked threads look at them */
+		_claimGeneration += 1;
+		omrthread_monitor_notify_all(_mutex);
+	}
+}
+
 void
 GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t tail, UDATA objectCount)
 {
@@ -117,6 +230,7 @@ GC_FinalizeListManager::addSystemFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _systemFinalizableObjects);
 	_systemFinalizableObjects = head;
 	_systemFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -142,6 +256,7 @@ GC_FinalizeListManager::addDefaultFinalizableObjects(j9object_t head, j9object_t
 	_extensions->accessBarrier->setFinalizeLink(tail, _defaultFinalizableObjects);
 	_defaultFinalizableObjects = head;
 	_defaultFinalizableObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -167,6 +282,7 @@ GC_FinalizeListManager::addReferenceObjects(j9object_t head, j9object_t tail, UD
 	_extensions->accessBarrier->setReferenceLink(tail, _referenceObjects);
 	_referenceObjects = head;
 	_referenceObjectCount += objectCount;
+	jobsAdded();
 
 	unlock();
 }
@@ -192,6 +308,7 @@ GC_FinalizeListManager::addClassLoaders(J9ClassLoader *head, J9ClassLoader *tail
 	tail->unloadLink = _classLoaders;
 	_classLoaders = head;
 	_classLoaderCount += count;
+	jobsAdded();
 
 	unlock();
 }
@@ -236,12 +353,108 @@ GC_FinalizeListManager::popRequiredClassLoaderForForcedClassLoaderUnload()
 }
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
+j9object_t
+GC_FinalizeListManager::popUnclaimedFinalizableObject(J9VMThread *vmThread, j9object_t *list, UDATA *count, J9ClassLoader **claimed, UDATA claimedCount, bool *blocked)
+{
+	MM_ObjectAccessBarrier *barrier = _extensions->accessBarrier;
+	j9object_t previousObject = NULL;
+	j9object_t object = *list;
+	UDATA scanned = 0;
+
+	while ((NULL != object) && (scanned < FINALIZE_CLAIM_SCAN_LIMIT)) {
+		J9ClassLoader *classLoader = J9OBJECT_CLAZZ(vmThread, object)->classLoader;
+		bool isClaimed = false;
+		for (UDATA i = 0; i < claimedCount; i++) {
+			if (classLoader == claimed[i]) {
+				isClaimed = true;
+				break;
+			}
+		}
+
+		if (!isClaimed) {
+			j9object_t next = barrier->getFinalizeLink(object);
+			if (NULL == previousObject) {
+				*list = next;
+			} else {
+				barrier->setFinalizeLink(previousObject, next);
+			}
+			*count -= 1;
+			return object;
+		}
+
+		*blocked = true;
+		previousObject = object;
+		object = barrier->getFinalizeLink(object);
+		scanned += 1;
+	}
+
+	if (NULL != object) {
+		/* objects remain past the scan limit, they may become available once a claim is released */
+		*blocked = true;
+	}
+
+	return NULL;
+}
+
+void
+GC_FinalizeListManager::claim(J9VMThread *vmThread, J9ClassLoader *classLoader, U_64 now)
+{
+	UDATA freeSlot = FINALIZE_WORKER_THREADS_MAX;
+	for (UDATA i = 0; i < FINALIZE_WORKER_THREADS_MAX; i++) {
+		if (vmThread == _claims[i].owner) {
+			freeSlot = i;
+			break;
+		}
+		if ((NULL == _claims[i].owner) && (FINALIZE_WORKER_THREADS_MAX == freeSlot)) {
+			freeSlot = i;
+		}
+	}
+
+	/* every slot is only taken by abandoned threads when there is no free one, the object is then finalized unordered */
+	if (FINALIZE_WORKER_THREADS_MAX != freeSlot) {
+		_claims[freeSlot].owner = vmThread;
+		_claims[freeSlot].classLoader = classLoader;
+		_claims[freeSlot].claimedAt = now;
+	}
+}
+
+void
+GC_FinalizeListManager::releaseClaim(J9VMThread *vmThread)
+{
+	if (1 < _extensions->finalizeWorkerThreads) {
+		lock();
+		for (UDATA i = 0; i < FINALIZE_WORKER_THREADS_MAX; i++) {
+			if (vmThread == _claims[i].owner) {
+				_claims[i].owner = NULL;
+				_claims[i].classLoader = NULL;
+			}
+		}
+		_claimGeneration += 1;
+		omrthread_monitor_notify_all(_mutex);
+		unlock();
+	}
+}
+
+void
+GC_FinalizeListManager::waitForClaimRelease(UDATA claimGeneration, I_64 millis)
+{
+	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
+	/* the timeout lets the caller notice claims held for longer than finalizeCycleLimit */
+	while (claimGeneration == _claimGeneration) {
+		if (J9THREAD_TIMED_OUT == omrthread_monitor_wait_timed(_mutex, millis, 0)) {
+			break;
+		}
+	}
+}
+
 GC_FinalizeJob *
-GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
+GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, bool *blocked)
 {
 	Assert_MM_true(J9_PUBLIC_FLAGS_VM_ACCESS == (vmThread->publicFlags & J9_PUBLIC_FLAGS_VM_ACCESS));
 	Assert_MM_true(1 == omrthread_monitor_owned_by_self(_mutex)); /* caller must be holding _mutex */
-	
+
+	*blocked = false;
+
 	{
 		j9object_t referenceObject = popReferenceObject();
 		if (NULL != referenceObject) {
@@ -262,24 +475,72 @@ GC_FinalizeListManager::consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job)
 		}
 	}
 
-	{
-		j9object_t defaultObject = popDefaultFinalizableObject();
-		if (NULL != defaultObject) {
+	if (1 < _extensions->finalizeWorkerThreads) {
+		/* several threads are draining the lists, only hand out objects whose class loader no other thread is finalizing */
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		U_64 now = omrtime_hires_clock();
+		J9ClassLoader *claimed[FINALIZE_WORKER_THREADS_MAX];
+		UDATA claimedCount = 0;
+		for (UDATA i = 0; i < FINALIZE_WORKER_THREADS_MAX; i++) {
+			if ((NULL != _claims[i].owner) && (vmThread != _claims[i].owner)) {
+				if ((0 == _extensions->finalizeCycleLimit)
+					|| (omrtime_hires_delta(_claims[i].claimedAt, now, OMRPORT_TIME_DELTA_IN_MILLISECONDS) < (U_64)_extensions->finalizeCycleLimit)
+				) {
+					claimed[claimedCount] = _claims[i].classLoader;
+					claimedCount += 1;
+				}
+			}
+		}
+
+		j9object_t object = popUnclaimedFinalizableObject(vmThread, &_defaultFinalizableObjects, &_defaultFinalizableObjectCount, claimed, claimedCount, blocked);
+		if (NULL == object) {
+			object = popUnclaimedFinalizableObject(vmThread, &_systemFinalizableObjects, &_systemFinalizableObjectCount, claimed, claimedCount, blocked);
+		}
+		if (NULL != object) {
+			claim(vmThread, J9OBJECT_CLAZZ(vmThread, object)->classLoader, now);
+			countFinalizerRun(vmThread, object);
 			job->type = FINALIZE_JOB_TYPE_OBJECT;
-			job->object = defaultObject;
+			job->object = object;
 
 			return job;
 		}
-	}
 
-	{
-		j9object_t systemObject = popSystemFinalizableObject();
-		if (NULL != systemObject) {
-			job->type = FINALIZE_JOB_TYPE_OBJECT;
-			job->object = systemObject;
+		if (0 != claimedCount) {
+			/* the lists are empty but other threads are still finalizing, the drain is not complete until they are done */
+			*blocked = true;
+		}
+	} else {
+		{
+			j9object_t defaultObject = popDefaultFinalizableObject();
+			if (NULL != defaultObject) {
+				countFinalizerRun(vmThread, defaultObject);
+				job->type = FINALIZE_JOB_TYPE_OBJECT;
+				job->object = defaultObject;
+
+				return job;
+			}
+		}
 
-			return job;
+		{
+			j9object_t systemObject = popSystemFinalizableObject();
+			if (NULL != systemObject) {
+				countFinalizerRun(vmThread, systemObject);
+				job->type = FINALIZE_JOB_TYPE_OBJECT;
+				job->object = systemObject;
+
+				return job;
+			}
+		}
+	}
+
+	if (!*blocked && (0 != _queuedSince)) {
+		/* the lists are drained, record how long it took since they became non-empty */
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		_lastDrainTime = omrtime_hires_delta(_queuedSince, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (_lastDrainTime > _maxDrainTime) {
+			_maxDrainTime = _lastDrainTime;
 		}
+		_queuedSince = 0;
 	}
 
 	return NULL;
@@ -47,6 +47,24 @@ typedef enum GC_FinalizeJobType {
 	FINALIZE_JOB_TYPE_REFERENCE = 2,
 	FINALIZE_JOB_TYPE_CLASSLOADER = 4
 } GC_FinalizeJobType;
+
+/* the number of objects a finalize worker thread looks at for one whose class loader is not claimed */
+#define FINALIZE_CLAIM_SCAN_LIMIT 16
+
+typedef struct GC_FinalizeClaim {
+	J9VMThread *owner; /**< the finalizer thread finalizing an object of the class loader, or NULL if the claim is free */
+	J9ClassLoader *classLoader;
+	U_64 claimedAt; /**< hires clock when the claim was taken */
+} GC_FinalizeClaim;
+
+typedef struct GC_FinalizerStatistics {
+	J9Class *clazz;
+	U_64 finalizersRun; /**< the number of objects of the class handed to a finalizer thread since startup */
+	UDATA objects; /**< the number of objects of the class on the finalizable lists, only valid while the statistics are walked */
+} GC_FinalizerStatistics;
+
+typedef void (*GC_FinalizerStatisticsFunction)(J9VMThread *vmThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData);
+
 typedef struct GC_FinalizeJob {
 	GC_FinalizeJobType type;
 	union {
@@ -75,6 +93,22 @@ private:
     UDATA _referenceObjectCount; /** count of the reference object */
     J9ClassLoader *_classLoaders; /**< head of the linked list of unloaded classloaders which have open native libraries  */
     UDATA _classLoaderCount; /** count of the class loaders */
+
+    /**
+     * The class loader of the object each finalize worker thread is finalizing. When several threads drain the
+     * lists, an object is only handed out if no other thread is finalizing an object of the same class loader,
+     * so the objects of every class loader are still finalized one at a time in list order, as finalizers
+     * of one application may depend on each other, while objects of different class loaders are finalized in parallel.
+     * A claim held for longer than finalizeCycleLimit belongs to a stuck finalizer and is ignored, the same way
+     * the finalizer main thread abandons a stuck worker.
+     */
+    GC_FinalizeClaim _claims[FINALIZE_WORKER_THREADS_MAX];
+    UDATA _claimGeneration; /**< incremented every time a claim is released or jobs are added, so blocked threads only rescan the lists after a change */
+
+    U_64 _queuedSince; /**< hires clock when the lists last became non-empty, 0 while they are empty */
+    U_64 _lastDrainTime; /**< microseconds from the lists becoming non-empty to them being drained, for the last drain */
+    U_64 _maxDrainTime; /**< longest drain time in microseconds */
+    J9HashTable *_finalizerStatistics; /**< GC_FinalizerStatistics of every class with objects handed to a finalizer thread */
 protected:
 public:
     
@@ -117,6 +151,54 @@ protected:
      */
     J9ClassLoader *popClassLoader();
 
+    /**
+     * Pop the first object of a finalizable list whose class loader is not claimed by another thread,
+     * looking at no more than FINALIZE_CLAIM_SCAN_LIMIT objects.
+     *
+     * @note Must be called while holding this class' _mutex
+     *
+     * @param vmThread[in] the thread that will finalize the object
+     * @param list[in/out] the head of the list
+     * @param count[in/out] the count of objects on the list
+     * @param claimed[in] the class loaders claimed by other threads
+     * @param claimedCount[in] the number of entries in claimed
+     * @param blocked[out] set to true if objects were skipped because their class loader was claimed
+     *
+     * @return the object, or NULL if none could be handed out
+     */
+    j9object_t popUnclaimedFinalizableObject(J9VMThread *vmThread, j9object_t *list, UDATA *count, J9ClassLoader **claimed, UDATA claimedCount, bool *blocked);
+
+    /**
+     * Claim the class loader for the thread
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void claim(J9VMThread *vmThread, J9ClassLoader *classLoader, U_64 now);
+
+    /**
+     * Record that the lists received jobs, starting a drain time measurement if they were empty
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void jobsAdded();
+
+    /**
+     * Count a finalizer run for the class of the object
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void countFinalizerRun(J9VMThread *vmThread, j9object_t object);
+
+    /**
+     * Count the objects on a finalizable list in the statistics of their classes
+     *
+     * @note Must be called while holding this class' _mutex
+     */
+    void countFinalizableObjects(J9VMThread *vmThread, j9object_t list);
+
+    static UDATA finalizerStatisticsHash(void *entry, void *userData);
+    static UDATA finalizerStatisticsEquals(void *leftEntry, void *rightEntry, void *userData);
+
 public:
 	void lock() const;
 	void unlock() const;
@@ -137,6 +219,9 @@ public:
 	virtual UDATA getDefaultCount() {return _defaultFinalizableObjectCount;}
 	MMINLINE UDATA getClassloaderCount() {return _classLoaderCount;}
 	MMINLINE UDATA getReferenceCount() {return _referenceObjectCount;}
+	MMINLINE U_64 getLastDrainTime() {return _lastDrainTime;}
+	MMINLINE U_64 getMaxDrainTime() {return _maxDrainTime;}
+	MMINLINE UDATA getClaimGeneration() {return _claimGeneration;}
 
 	static GC_FinalizeListManager	*newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -326,10 +411,53 @@ public:
 	 * Pop the next job to process
 	 * 
 	 * @note Must be called while holding this class' _mutex
+	 * @note When several finalize worker threads are running, the caller must call releaseClaim()
+	 * once the job is processed.
+	 *
+	 * @param blocked[out] set to true if NULL was returned while finalizable objects remain whose class loader
+	 * is claimed by another finalize worker thread, or while other threads are still finalizing objects
 	 *
 	 * @return the next job or NULL
 	 */
-	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job);
+	virtual GC_FinalizeJob *consumeJob(J9VMThread *vmThread, GC_FinalizeJob * job, bool *blocked);
+
+	/**
+	 * Release the class loader claimed by the thread when it was given a finalizable object,
+	 * and wake up the threads waiting for a claim to be released.
+	 *
+	 * @param vmThread[in] the thread that processed the job
+	 */
+	void releaseClaim(J9VMThread *vmThread);
+
+	/**
+	 * Wait until a finalize worker thread releases its claim or jobs are added, or the timeout expires.
+	 *
+	 * @note Must be called while holding this class' _mutex
+	 *
+	 * @param claimGeneration[in] the value of getClaimGeneration() when the caller last scanned the lists
+	 * @param millis[in] timeout in milliseconds
+	 */
+	void waitForClaimRelease(UDATA claimGeneration, I_64 millis);
+
+	/**
+	 * Call function with the finalizer statistics of every class that had objects finalized since startup
+	 * or has objects on the finalizable lists.
+	 *
+	 * @note Must be called with VM access
+	 *
+	 * @param vmThread[in] the calling thread
+	 * @param function[in] called with the class, the number of its objects on the finalizable lists and
+	 * the number of its objects handed to a finalizer thread since startup
+	 * @param userData[in] passed to function
+	 */
+	void finalizerStatisticsDo(J9VMThread *vmThread, GC_FinalizerStatisticsFunction function, void *userData);
+
+	/**
+	 * Forget the finalizer statistics of classes that are being unloaded.
+	 *
+	 * @param classUnloadList[in] the classes being unloaded, linked through gcLink
+	 */
+	void removeFinalizerStatistics(J9Class *classUnloadList);
 
 
 	/**
@@ -346,8 +474,14 @@ public:
 	    ,_referenceObjectCount(0)
 	    ,_classLoaders(NULL)
 	    ,_classLoaderCount(0)
+	    ,_claimGeneration(0)
+	    ,_queuedSince(0)
+	    ,_lastDrainTime(0)
+	    ,_maxDrainTime(0)
+	    ,_finalizerStatistics(NULL)
 	{
 		_typeId = __FUNCTION__;
+		memset(_claims, 0, sizeof(_claims));
 	};
 
 	/*
@@ -177,10 +177,29 @@ struct finalizeWorkerData {
 	IDATA wakeUp;
 };
 
+/* how long a finalizer thread waits for another one to finish an object of a class loader it claimed */
+#define FINALIZE_CLAIM_WAIT_MILLIS 10
+
+/**
+ * Shared by the finalizer helper threads, which drain the finalize lists alongside the worker thread
+ * when -Xgc:finalizeWorkerThreads is greater than 1. The finalizer main thread waits for every helper
+ * to exit before it frees the structure.
+ */
+struct finalizeHelperData {
+	omrthread_monitor_t monitor;
+	J9JavaVM *vm;
+	UDATA helperCount; /**< number of helper threads started and not yet exited */
+	UDATA drainRequests; /**< incremented every time the helpers are asked to drain the lists */
+	IDATA die;
+};
+
 static int J9THREAD_PROC FinalizeWorkerThread(void *arg);
 IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThreadHandle, struct finalizeWorkerData **indirectWorkerData, IDATA finalizeCycleLimit, IDATA mode);
+static void FinalizeMainWakeHelpers(J9JavaVM *vm, struct finalizeHelperData **indirectHelperData);
+static void FinalizeMainShutdownHelpers(J9JavaVM *vm, struct finalizeHelperData *helperData);
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM);
 static int  J9THREAD_PROC gpProtectedFinalizeWorkerThread(void *entryArg);
+static int  J9THREAD_PROC gpProtectedFinalizeHelperThread(void *entryArg);
 
 static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 {
@@ -188,6 +207,7 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 	omrthread_t workerThreadHandle;
 	int noCycleWait;
 	struct finalizeWorkerData *workerData = NULL;
+	struct finalizeHelperData *helperData = NULL;
 	IDATA finalizeCycleInterval, finalizeCycleLimit, currentWaitTime, finalizableListUsed;
 	IDATA cycleIntervalWaitResult;
 	UDATA workerMode, savedFinalizeMainFlags;
@@ -271,6 +291,11 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 
 		savedFinalizeMainFlags = vm->finalizeMainFlags;
 
+		if ((1 < extensions->finalizeWorkerThreads) && (FINALIZE_WORKER_MODE_NORMAL == workerMode) && (1 < (UDATA)finalizableListUsed)) {
+			/* more than one job is queued - have the helpers drain the lists along with the worker */
+			FinalizeMainWakeHelpers(vm, &helperData);
+		}
+
 		IDATA result = FinalizeMainRunFinalization(vm, &workerThreadHandle, &workerData, finalizeCycleLimit, workerMode);
 		if(result < 0) {
 			/* give up this run and hope next time will be better */
@@ -319,6 +344,12 @@ static int J9THREAD_PROC FinalizeMainThread(void *javaVM)
 		omrthread_monitor_enter((omrthread_monitor_t)vm->finalizeMainMonitor);
 	}
 
+	if (NULL != helperData) {
+		omrthread_monitor_exit((omrthread_monitor_t)vm->finalizeMainMonitor);
+		FinalizeMainShutdownHelpers(vm, helperData);
+		omrthread_monitor_enter((omrthread_monitor_t)vm->finalizeMainMonitor);
+	}
+
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	if(NULL != vm->javaOffloadSwitchOffNoEnvWithReasonFunc) {
 		(*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, vm->finalizeMainThread, J9_JNI_OFFLOAD_SWITCH_GC_FINALIZE_MAIN_THREAD);
@@ -436,6 +467,94 @@ process(J9VMThread *vmThread, const GC_FinalizeJob *finalizeJob, jclass j9VMInte
 	}
 }
 
+/**
+ * Look up the methods which finalize objects and enqueue references, if the class library supports them
+ */
+static void
+lookupFinalizeMethods(J9VMThread *env, jclass *j9VMInternalsClassPtr, jmethodID *runFinalizeMIDPtr, jmethodID *referenceEnqueueImplMIDPtr)
+{
+	J9JavaVM *vm = env->javaVM;
+	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+
+	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
+		/* Only look up finalization methods if the class library supports them */
+		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
+		if (j9VMInternalsClass) {
+			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
+			if (j9VMInternalsClass) {
+				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
+			}
+		}
+		if (!runFinalizeMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	
+		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
+		if (referenceClazz) {
+			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
+		}
+		if (!referenceEnqueueImplMID) {
+			((JNIEnv *)env)->ExceptionClear();
+		}
+	}
+
+	*j9VMInternalsClassPtr = j9VMInternalsClass;
+	*runFinalizeMIDPtr = runFinalizeMID;
+	*referenceEnqueueImplMIDPtr = referenceEnqueueImplMID;
+}
+
+/**
+ * Pop the next job for the thread. While the remaining finalizable objects belong to class loaders other
+ * finalizer threads are finalizing, wait without VM access for them to finish.
+ *
+ * @note Must be called with VM access and holding the finalize list manager lock, returns the same way
+ *
+ * @param die[in] if not NULL, stop waiting and return NULL once it becomes non-zero
+ */
+static GC_FinalizeJob *
+consumeNextJob(J9VMThread *env, GC_FinalizeListManager *finalizeListManager, GC_FinalizeJob *job, volatile IDATA *die)
+{
+	J9InternalVMFunctions *fns = env->javaVM->internalVMFunctions;
+	bool blocked = false;
+	GC_FinalizeJob *finalizeJob = finalizeListManager->consumeJob(env, job, &blocked);
+
+	while ((NULL == finalizeJob) && blocked && ((NULL == die) || (0 == *die))) {
+		UDATA claimGeneration = finalizeListManager->getClaimGeneration();
+		/* keep the lock while releasing VM access so that a claim release can not be missed */
+		fns->internalReleaseVMAccess(env);
+		finalizeListManager->waitForClaimRelease(claimGeneration, FINALIZE_CLAIM_WAIT_MILLIS);
+		finalizeListManager->unlock();
+		fns->internalEnterVMFromJNI(env);
+		finalizeListManager->lock();
+		finalizeJob = finalizeListManager->consumeJob(env, job, &blocked);
+	}
+
+	return finalizeJob;
+}
+
+/**
+ * Notify the threads waiting in Reference.waitForReferenceProcessing() that a job was processed
+ */
+static void
+notifyReferenceProcessingProgress(J9JavaVM *vm, GC_FinalizeListManager *finalizeListManager)
+{
+	if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
+		omrthread_monitor_enter(vm->processReferenceMonitor);
+		if (0 == finalizeListManager->getReferenceCount()) {
+			/* There is no more pending reference. */
+			vm->processReferenceActive = 0;
+		}
+		/*
+		 * Notify any waiters that progress has been made.
+		 * This improves latency for Reference.waitForReferenceProcessing() and try to
+		 * avoid the performance issue if there are many of pending references in the queue.
+		 */
+		omrthread_monitor_notify_all(vm->processReferenceMonitor);
+		omrthread_monitor_exit(vm->processReferenceMonitor);
+	}
+}
+
 /**
  * Worker thread consumes jobs from Finalize List Manager and process them
  */
@@ -445,7 +564,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	J9VMThread *env;
 	const GC_FinalizeJob *finalizeJob;
 	GC_FinalizeJob localJob;
-	jclass referenceClazz, j9VMInternalsClass = NULL;
+	jclass j9VMInternalsClass = NULL;
 	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
 	J9InternalVMFunctions* fns;
 	omrthread_monitor_t monitor;
@@ -482,27 +601,7 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 	/* Remember that the thread was gpProtected -- important for the JIT */
 	env->gpProtected = 1;
 
-	if(vm->jclFlags & J9_JCL_FLAG_FINALIZATION) {
-		/* Only look up finalization methods if the class library supports them */
-		j9VMInternalsClass = ((JNIEnv *)env)->FindClass("java/lang/J9VMInternals");
-		if (j9VMInternalsClass) {
-			j9VMInternalsClass = (jclass)((JNIEnv *)env)->NewGlobalRef(j9VMInternalsClass);
-			if (j9VMInternalsClass) {
-				runFinalizeMID = ((JNIEnv *)env)->GetStaticMethodID(j9VMInternalsClass, "runFinalize", "(Ljava/lang/Object;)V");
-			}
-		}
-		if (!runFinalizeMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	
-		referenceClazz = ((JNIEnv *)env)->FindClass("java/lang/ref/Reference");
-		if (referenceClazz) {
-			referenceEnqueueImplMID  = ((JNIEnv *)env)->GetMethodID(referenceClazz, "enqueueImpl", "()Z");
-		}
-		if (!referenceEnqueueImplMID) {
-			((JNIEnv *)env)->ExceptionClear();
-		}
-	}		
+	lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
 	workerData->vmThread = env;
 
 	/* Notify that the worker has come on line (We should check the result from above) */
@@ -552,11 +651,11 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 
 				finalizeListManager->lock();
 				
-				finalizeJob = finalizeListManager->consumeJob(env, &localJob);
+				finalizeJob = consumeNextJob(env, finalizeListManager, &localJob, NULL);
 				if(finalizeJob == NULL) {
 					if(workerData->mode == FINALIZE_WORKER_MODE_FORCED) {
 						finalizeForcedUnfinalizedToFinalizable(env);
-						finalizeJob = finalizeListManager->consumeJob(env, &localJob);
+						finalizeJob = consumeNextJob(env, finalizeListManager, &localJob, NULL);
 					}
 				}
 
@@ -575,21 +674,9 @@ static int J9THREAD_PROC FinalizeWorkerThread(void *arg)
 
 			/* processing will release/acquire VM access */
 			process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+			finalizeListManager->releaseClaim(env);
 
-			if ((NULL != vm->processReferenceMonitor) && (0 != vm->processReferenceActive)) {
-				omrthread_monitor_enter(vm->processReferenceMonitor);
-				if (0 == finalizeListManager->getReferenceCount()) {
-					/* There is no more pending reference. */
-					vm->processReferenceActive = 0;
-				}
-				/*
-				 * Notify any waiters that progress has been made.
-				 * This improves latency for Reference.waitForReferenceProcessing() and try to
-				 * avoid the performance issue if there are many of pending references in the queue.
-				 */
-				omrthread_monitor_notify_all(vm->processReferenceMonitor);
-				omrthread_monitor_exit(vm->processReferenceMonitor);
-			}
+			notifyReferenceProcessingProgress(vm, finalizeListManager);
 
 			fns->jniResetStackReferences((JNIEnv *)env);
 
@@ -771,6 +858,186 @@ IDATA FinalizeMainRunFinalization(J9JavaVM * vm, omrthread_t * indirectWorkerThr
 	return workerWaitResult;
 }
 
+/**
+ * Helper thread consumes jobs from Finalize List Manager alongside the worker thread every time the
+ * finalizer main thread requests a drain, until the lists are empty
+ */
+static int J9THREAD_PROC FinalizeHelperThread(void *arg)
+{
+	struct finalizeHelperData *helperData = (struct finalizeHelperData *)arg;
+	J9JavaVM *vm = helperData->vm;
+	J9InternalVMFunctions *fns = vm->internalVMFunctions;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	GC_FinalizeListManager *finalizeListManager = extensions->finalizeListManager;
+	J9VMThread *env = NULL;
+	GC_FinalizeJob localJob;
+	jclass j9VMInternalsClass = NULL;
+	jmethodID referenceEnqueueImplMID = NULL, runFinalizeMID = NULL;
+	UDATA drainRequestsSeen = 0;
+
+	if (JNI_OK == fns->attachSystemDaemonThread(vm, &env, "Finalizer helper thread")) {
+		fns->internalEnterVMFromJNI(env);
+		env->privateFlags |= (J9_PRIVATE_FLAGS_FINALIZE_WORKER | J9_PRIVATE_FLAGS_USE_BOOTSTRAP_LOADER);
+		fns->internalReleaseVMAccess(env);
+
+		/* Remember that the thread was gpProtected -- important for the JIT */
+		env->gpProtected = 1;
+
+		lookupFinalizeMethods(env, &j9VMInternalsClass, &runFinalizeMID, &referenceEnqueueImplMID);
+
+		omrthread_monitor_enter(helperData->monitor);
+		while (!helperData->die) {
+			if (drainRequestsSeen == helperData->drainRequests) {
+				omrthread_monitor_wait(helperData->monitor);
+				continue;
+			}
+			drainRequestsSeen = helperData->drainRequests;
+			omrthread_monitor_exit(helperData->monitor);
+
+			fns->internalEnterVMFromJNI(env);
+			do {
+				finalizeListManager->lock();
+				const GC_FinalizeJob *finalizeJob = consumeNextJob(env, finalizeListManager, &localJob, &helperData->die);
+				finalizeListManager->unlock();
+
+				if (NULL == finalizeJob) {
+					break;
+				}
+
+				/* processing will release/acquire VM access */
+				process(env, finalizeJob, j9VMInternalsClass, runFinalizeMID, referenceEnqueueImplMID);
+				finalizeListManager->releaseClaim(env);
+
+				notifyReferenceProcessingProgress(vm, finalizeListManager);
+
+				fns->jniResetStackReferences((JNIEnv *)env);
+			} while (!helperData->die);
+			fns->internalReleaseVMAccess(env);
+
+			omrthread_monitor_enter(helperData->monitor);
+		}
+		omrthread_monitor_exit(helperData->monitor);
+
+		if (j9VMInternalsClass) {
+			((JNIEnv *)env)->DeleteGlobalRef(j9VMInternalsClass);
+		}
+
+		((JavaVM *)vm)->DetachCurrentThread();
+	}
+
+	/* Notify the main thread, which frees the data once every helper is gone */
+	omrthread_monitor_enter(helperData->monitor);
+	helperData->helperCount -= 1;
+	omrthread_monitor_notify_all(helperData->monitor);
+	omrthread_exit(helperData->monitor);		/* exit the monitor, and terminate the thread */
+
+	/* NO EXECUTION GUARANTEE BEYOND THIS POINT */
+
+	return 0;
+}
+
+/*
+ * Ask the helper threads to drain the finalize lists, starting them the first time.
+ *
+ * Preconditions:
+ * 	holds finalizeMainMonitor
+ * Postconditions:
+ * 	holds finalizeMainMonitor
+ */
+static void
+FinalizeMainWakeHelpers(J9JavaVM *vm, struct finalizeHelperData **indirectHelperData)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+	MM_Forge *forge = extensions->getForge();
+	struct finalizeHelperData *helperData = *indirectHelperData;
+
+	if (NULL == helperData) {
+		helperData = (struct finalizeHelperData *)forge->allocate(sizeof(struct finalizeHelperData), MM_AllocationCategory::FINALIZE, J9_GET_CALLSITE());
+		if (NULL == helperData) {
+			/* the worker thread alone drains the lists */
+			return;
+		}
+		helperData->vm = vm;
+		helperData->helperCount = 0;
+		helperData->drainRequests = 0;
+		helperData->die = 0;
+
+		if (0 != omrthread_monitor_init_with_name(&(helperData->monitor), 0, "Finalizer helpers")) {
+			forge->free(helperData);
+			return;
+		}
+		*indirectHelperData = helperData;
+	}
+
+	omrthread_monitor_exit(vm->finalizeMainMonitor);
+	omrthread_monitor_enter(helperData->monitor);
+
+	helperData->drainRequests += 1;
+
+	/* the worker thread is one of the finalizeWorkerThreads, start any helper missing */
+	while ((helperData->helperCount + 1) < extensions->finalizeWorkerThreads) {
+		IDATA result = vm->internalVMFunctions->createThreadWithCategory(
+							NULL,
+							vm->defaultOSStackSize,
+							extensions->finalizeWorkerPriority,
+							0,
+							&gpProtectedFinalizeHelperThread,
+							helperData,
+							J9THREAD_CATEGORY_APPLICATION_THREAD);
+		if (0 != result) {
+			break;
+		}
+		helperData->helperCount += 1;
+	}
+
+	omrthread_monitor_notify_all(helperData->monitor);
+	omrthread_monitor_exit(helperData->monitor);
+	omrthread_monitor_enter(vm->finalizeMainMonitor);
+}
+
+/*
+ * Tell the helper threads to exit once they finish the job they are processing, wait for all of them
+ * to exit and free the data.
+ *
+ * Preconditions:
+ * 	does not hold finalizeMainMonitor
+ */
+static void
+FinalizeMainShutdownHelpers(J9JavaVM *vm, struct finalizeHelperData *helperData)
+{
+	omrthread_monitor_enter(helperData->monitor);
+	helperData->die = 1;
+	omrthread_monitor_notify_all(helperData->monitor);
+	while (0 != helperData->helperCount) {
+		omrthread_monitor_wait(helperData->monitor);
+	}
+	omrthread_monitor_exit(helperData->monitor);
+
+	omrthread_monitor_destroy(helperData->monitor);
+	MM_GCExtensions::getExtensions(vm)->getForge()->free(helperData);
+}
+
+static UDATA
+FinalizeHelperThreadGlue(J9PortLibrary* portLib, void* userData)
+{
+	return FinalizeHelperThread(userData);
+}
+
+static int J9THREAD_PROC
+gpProtectedFinalizeHelperThread(void *entryArg)
+{
+	struct finalizeHelperData *helperData = (struct finalizeHelperData *) entryArg;
+	PORT_ACCESS_FROM_PORT(helperData->vm->portLibrary);
+	UDATA rc;
+
+	j9sig_protect(FinalizeHelperThreadGlue, helperData,
+		helperData->vm->internalVMFunctions->structuredSignalHandlerVM, helperData->vm,
+		J9PORT_SIG_FLAG_SIGALLSYNC | J9PORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+		&rc);
+
+	return 0;
+}
+
 static UDATA
 FinalizeWorkerThreadGlue(J9PortLibrary* portLib, void* userData)
 {
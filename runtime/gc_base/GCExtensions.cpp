@@ -40,6 +40,7 @@
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "StandardAccessBarrier.hpp"
+#include "StringDeduplicator.hpp"
 #include "ObjectModel.hpp"
 #include "ReferenceChainWalkerMarkMap.hpp"
 #include "SublistPool.hpp"
@@ -171,6 +172,11 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 	}
 	numaCommonThreadClassNamePatterns = NULL;
 	
+	if (NULL != stringDeduplicator) {
+		stringDeduplicator->kill(env);
+		stringDeduplicator = NULL;
+	}
+
 	J9HookInterface** tmpHookInterface = getHookInterface();
 	if((NULL != tmpHookInterface) && (NULL != *tmpHookInterface)){
 		(*tmpHookInterface)->J9HookShutdownInterface(tmpHookInterface);
@@ -58,6 +58,7 @@ class MM_MemorySubSpace;
 class MM_ObjectAccessBarrier;
 class MM_OwnableSynchronizerObjectList;
 class MM_ContinuationObjectList;
+class MM_StringDeduplicator;
 class MM_StringTable;
 class MM_UnfinalizedObjectList;
 class MM_Wildcard;
@@ -87,6 +88,10 @@ class MM_IdleGCManager;
 #define J9_MAXIMUM_TLH_SIZE_BATCH_CLEAR (128 * 1024)
 #endif /* defined(J9VM_GC_BATCH_CLEAR_TLH) */
 
+#if defined(J9VM_GC_FINALIZATION)
+#define FINALIZE_WORKER_THREADS_MAX 64
+#endif /* J9VM_GC_FINALIZATION */
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Base
@@ -160,6 +165,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 	uintptr_t finalizeMainPriority; /**< cmd line option to set finalize main thread priority */
 	uintptr_t finalizeWorkerPriority; /**< cmd line option to set finalize worker thread priority */
+	uintptr_t finalizeWorkerThreads; /**< cmd line option to set the number of threads draining the finalize lists */
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
@@ -225,13 +231,28 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	bool memoryPressureHeapRelease; /**< set by -XX:+ReleaseHeapOnMemoryPressure, returns free heap to the OS while the cgroup of the JVM is under memory pressure */
+	uintptr_t memoryPressurePollInterval; /**< milliseconds between samples of the cgroup memory pressure */
+	uintptr_t memoryPressureThreshold; /**< cgroup memory pressure (PSI "some" avg10, in hundredths of a percent) at which free heap is released */
+	uintptr_t memoryHighThreshold; /**< percentage of the cgroup memory.high limit in use at which free heap is released */
 #endif
 
+	bool stringDeduplication; /**< set by -XX:+UseStringDeduplication, enables background deduplication of String value arrays */
+	uintptr_t stringDeduplicationTableSize; /**< maximum number of canonical value arrays tracked by the String deduplicator */
+	MM_StringDeduplicator* stringDeduplicator; /**< background String deduplication support, NULL if not enabled */
+
+	bool verboseJSONFormat; /**< set by -Xgc:verboseFormat=json, verbose GC file logs are written as JSON Lines by the asynchronous writer */
+	bool asyncLogging; /**< set by -Xgc:asyncLogging, verbose GC file logs are written by a background thread */
+	uintptr_t asyncLoggingBufferSize; /**< size of the ring the verbose GC output is copied into for the asynchronous writer */
+	uintptr_t verboseLogFileSize; /**< size at which the asynchronous writer rotates the verbose GC log, 0 for no rotation */
+
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 	uintptr_t minimumFreeSizeForSurvivor; /**< minimum free size can be reused by collector as survivor, for balanced GC only */
 	uintptr_t freeSizeThresholdForSurvivor; /**< if average freeSize(freeSize/freeCount) of the region is smaller than the Threshold, the region would not be reused by collector as survivor, for balanced GC only */
 	bool recycleRemainders; /**< true if need to recycle TLHRemainders at the end of PGC, for balanced GC only */
+	uintptr_t tarokRememberedSetCardListBitmapCount; /**< maximum number of popular regions remembering cards in a dense card bitmap instead of overflowing their card list, for balanced GC only (0 disables) */
+	uintptr_t tarokCopyForwardPrefetchDistance; /**< number of slots of a mixed object whose referents are prefetched ahead of being copied by copy-forward, for balanced GC only (0 disables) */
 
 	bool forceGPFOnHeapInitializationError; /**< if set causes GPF generation on heap initialization error */
 	bool isRegionSizeWithOverrideSpecified; /**< set true if -XXgc:regionSizeWithOverride is specified */
@@ -405,6 +426,7 @@ public:
 #if defined(J9VM_GC_FINALIZATION)
 		, finalizeMainPriority(J9THREAD_PRIORITY_NORMAL)
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
+		, finalizeWorkerThreads(1)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
@@ -423,12 +445,25 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, memoryPressureHeapRelease(false)
+		, memoryPressurePollInterval(1000)
+		, memoryPressureThreshold(10 * 100)
+		, memoryHighThreshold(90)
 #endif
+		, stringDeduplication(false)
+		, stringDeduplicationTableSize(64 * 1024)
+		, stringDeduplicator(NULL)
+		, verboseJSONFormat(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, verboseLogFileSize(0)
 		, maxRAMPercent(-1.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, minimumFreeSizeForSurvivor(DEFAULT_SURVIVOR_MINIMUM_FREESIZE)
 		, freeSizeThresholdForSurvivor(DEFAULT_SURVIVOR_THRESHOLD)
 		, recycleRemainders(true)
+		, tarokRememberedSetCardListBitmapCount(16)
+		, tarokCopyForwardPrefetchDistance(0)
 		, forceGPFOnHeapInitializationError(false)
 		, isRegionSizeWithOverrideSpecified(false)
 		, continuationListOption(enable_continuation_list)
@@ -26,6 +26,10 @@
 #include "j9protos.h"
 #include "j9consts.h"
 #include "vmhook_internal.h"
+#include "mmhook_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
 
 #include "IdleGCManager.hpp"
 #include "EnvironmentBase.hpp"
@@ -34,6 +38,11 @@
 #include "Heap.hpp"
 #include "VMAccess.hpp"
 
+/* Number of samples between two releases of free heap while the memory pressure persists */
+#define MEMORY_PRESSURE_RELEASE_INTERVAL_SAMPLES 10
+/* Percentage points below memoryHighThreshold the cgroup usage must fall to for the pressure to be over */
+#define MEMORY_HIGH_HYSTERESIS 10
+
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase *env)
 {
@@ -62,14 +71,27 @@ MM_IdleGCManager::tearDown(MM_EnvironmentBase *env)
 	if (NULL != hookInterface) {
 		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
 	}
+
+	/* A monitor thread which was never stopped (e.g. on an abnormal shutdown) may still be using the monitor */
+	if ((NULL != _pressureMonitor) && ((THREAD_STATE_INITIAL == _pressureThreadState) || (THREAD_STATE_TERMINATED == _pressureThreadState))) {
+		omrthread_monitor_destroy(_pressureMonitor);
+		_pressureMonitor = NULL;
+	}
 }
 
 bool
 MM_IdleGCManager::initialize(MM_EnvironmentBase *env)
 {
-	J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
-	if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
-		return false;
+	if (_extensions->gcOnIdle) {
+		J9HookInterface **hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+		if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
+			return false;
+		}
+	}
+	if (_extensions->memoryPressureHeapRelease) {
+		if (0 != omrthread_monitor_init_with_name(&_pressureMonitor, 0, "MM_IdleGCManager::pressureMonitor")) {
+			return false;
+		}
 	}
 	return true;
 }
@@ -87,6 +109,248 @@ MM_IdleGCManager::manageFreeHeap(J9VMThread *currentThread)
 	_javaVM->internalVMFunctions->internalReleaseVMAccess(currentThread);
 }
 
+bool
+MM_IdleGCManager::startPressureMonitor(MM_EnvironmentBase *env)
+{
+	bool result = false;
+
+	if ((NULL != _pressureMonitor) && findCgroup(env)) {
+		omrthread_monitor_enter(_pressureMonitor);
+		if (0 == _javaVM->internalVMFunctions->createThreadWithCategory(
+				NULL,
+				_javaVM->defaultOSStackSize,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				pressureMonitorThreadProc,
+				this,
+				J9THREAD_CATEGORY_SYSTEM_GC_THREAD)
+		) {
+			while (THREAD_STATE_INITIAL == _pressureThreadState) {
+				omrthread_monitor_wait(_pressureMonitor);
+			}
+			result = (THREAD_STATE_RUNNING == _pressureThreadState);
+		}
+		omrthread_monitor_exit(_pressureMonitor);
+	}
+
+	return result;
+}
+
+void
+MM_IdleGCManager::stopPressureMonitor(MM_EnvironmentBase *env)
+{
+	if (NULL != _pressureMonitor) {
+		omrthread_monitor_enter(_pressureMonitor);
+		if (THREAD_STATE_RUNNING == _pressureThreadState) {
+			_pressureThreadState = THREAD_STATE_TERMINATE_REQUESTED;
+			omrthread_monitor_notify_all(_pressureMonitor);
+			while (THREAD_STATE_TERMINATED != _pressureThreadState) {
+				omrthread_monitor_wait(_pressureMonitor);
+			}
+		}
+		omrthread_monitor_exit(_pressureMonitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_IdleGCManager::pressureMonitorThreadProc(void *arg)
+{
+	MM_IdleGCManager *idleMgr = (MM_IdleGCManager *)arg;
+	J9JavaVM *javaVM = idleMgr->_javaVM;
+	J9VMThread *vmThread = NULL;
+
+	if (JNI_OK == javaVM->internalVMFunctions->attachSystemDaemonThread(javaVM, &vmThread, "GC memory pressure monitor")) {
+		idleMgr->monitorPressure(vmThread);
+		(*((JavaVM *)javaVM))->DetachCurrentThread((JavaVM *)javaVM);
+	}
+
+	omrthread_monitor_enter(idleMgr->_pressureMonitor);
+	idleMgr->_pressureThreadState = THREAD_STATE_TERMINATED;
+	omrthread_monitor_notify_all(idleMgr->_pressureMonitor);
+	omrthread_exit(idleMgr->_pressureMonitor);
+
+	/* NO RETURN */
+	return 0;
+}
+
+void
+MM_IdleGCManager::monitorPressure(J9VMThread *vmThread)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	uintptr_t const pollInterval = _extensions->memoryPressurePollInterval;
+	uint64_t const releaseInterval = MEMORY_PRESSURE_RELEASE_INTERVAL_SAMPLES * (uint64_t)pollInterval;
+	uintptr_t const pressureThreshold = _extensions->memoryPressureThreshold;
+	uintptr_t const highThreshold = _extensions->memoryHighThreshold;
+	uintptr_t const highClearThreshold = (highThreshold > MEMORY_HIGH_HYSTERESIS) ? (highThreshold - MEMORY_HIGH_HYSTERESIS) : 0;
+
+	omrthread_monitor_enter(_pressureMonitor);
+	_pressureThreadState = THREAD_STATE_RUNNING;
+	omrthread_monitor_notify_all(_pressureMonitor);
+	while (THREAD_STATE_RUNNING == _pressureThreadState) {
+		omrthread_monitor_wait_timed(_pressureMonitor, pollInterval, 0);
+		if (THREAD_STATE_RUNNING != _pressureThreadState) {
+			break;
+		}
+		omrthread_monitor_exit(_pressureMonitor);
+
+		MemoryPressureSample sample;
+		if (sampleMemoryPressure(&sample)) {
+			bool hasHigh = (U_64_MAX != sample.high);
+			bool pressured = (sample.pressure >= pressureThreshold)
+					|| (hasHigh && (sample.current >= ((sample.high / 100) * highThreshold)));
+			if (pressured) {
+				/*
+				 * Release on the rising edge of the pressure, then again at most every releaseInterval while it
+				 * persists, for as long as releasing still returns memory.
+				 */
+				uint64_t now = j9time_current_time_millis();
+				if (((now - _lastReleaseTime) >= releaseInterval) && (!_underPressure || (0 != _lastBytesReturned))) {
+					_underPressure = true;
+					releaseFreeHeap(vmThread, &sample);
+				}
+			} else if (_underPressure
+				&& (sample.pressure < (pressureThreshold / 2))
+				&& (!hasHigh || (sample.current < ((sample.high / 100) * highClearThreshold)))
+			) {
+				_underPressure = false;
+			}
+		}
+
+		omrthread_monitor_enter(_pressureMonitor);
+	}
+	omrthread_monitor_exit(_pressureMonitor);
+}
+
+bool
+MM_IdleGCManager::findCgroup(MM_EnvironmentBase *env)
+{
+	bool result = false;
+#if defined(LINUX)
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	char buffer[4096];
+
+	if (readFile("/proc/self/cgroup", buffer, sizeof(buffer))) {
+		/* The cgroup v2 hierarchy is the line "0::<path>" */
+		char *line = buffer;
+		while (NULL != line) {
+			char *next = strchr(line, '\n');
+			if (NULL != next) {
+				*next = '\0';
+				next += 1;
+			}
+			if (0 == strncmp(line, "0::", 3)) {
+				const char *path = line + 3;
+				uintptr_t pathLength = strlen(path);
+				const char *separator = ((0 != pathLength) && ('/' == path[pathLength - 1])) ? "" : "/";
+				if ((pathLength + sizeof("/sys/fs/cgroup/")) <= sizeof(_cgroupPath)) {
+					MemoryPressureSample sample;
+					j9str_printf(PORTLIB, _cgroupPath, sizeof(_cgroupPath), "/sys/fs/cgroup%s%s", path, separator);
+					result = sampleMemoryPressure(&sample);
+				}
+				break;
+			}
+			line = next;
+		}
+	}
+#endif /* defined(LINUX) */
+	return result;
+}
+
+bool
+MM_IdleGCManager::readFile(const char *path, char *buffer, uintptr_t bufferSize)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	bool result = false;
+	intptr_t fd = j9file_open(path, EsOpenRead, 0);
+
+	if (-1 != fd) {
+		intptr_t bytesRead = j9file_read(fd, buffer, bufferSize - 1);
+		if (bytesRead > 0) {
+			buffer[bytesRead] = '\0';
+			result = true;
+		}
+		j9file_close(fd);
+	}
+	return result;
+}
+
+bool
+MM_IdleGCManager::sampleMemoryPressure(MemoryPressureSample *sample)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	char path[sizeof(_cgroupPath) + 32];
+	char buffer[256];
+
+	/* "some avg10=1.23 avg60=0.50 avg300=0.10 total=12345", averages have two decimals */
+	j9str_printf(PORTLIB, path, sizeof(path), "%smemory.pressure", _cgroupPath);
+	if (!readFile(path, buffer, sizeof(buffer))) {
+		return false;
+	}
+	const char *avg10 = strstr(buffer, "some avg10=");
+	if (NULL == avg10) {
+		return false;
+	}
+	char *cursor = NULL;
+	sample->pressure = (uintptr_t)strtoul(avg10 + strlen("some avg10="), &cursor, 10) * 100;
+	if ('.' == *cursor) {
+		sample->pressure += (uintptr_t)strtoul(cursor + 1, NULL, 10);
+	}
+
+	/* memory.current and memory.high are missing in the root cgroup, which has no limit */
+	sample->current = 0;
+	sample->high = U_64_MAX;
+	j9str_printf(PORTLIB, path, sizeof(path), "%smemory.current", _cgroupPath);
+	if (readFile(path, buffer, sizeof(buffer))) {
+		sample->current = strtoull(buffer, NULL, 10);
+	}
+	j9str_printf(PORTLIB, path, sizeof(path), "%smemory.high", _cgroupPath);
+	if (readFile(path, buffer, sizeof(buffer)) && (0 != strncmp(buffer, "max", 3))) {
+		sample->high = strtoull(buffer, NULL, 10);
+	}
+	return true;
+}
+
+uint64_t
+MM_IdleGCManager::getResidentSetSize()
+{
+	uint64_t residentSetSize = 0;
+	char buffer[2048];
+
+	if (readFile("/proc/self/status", buffer, sizeof(buffer))) {
+		const char *vmRSS = strstr(buffer, "VmRSS:");
+		if (NULL != vmRSS) {
+			residentSetSize = strtoull(vmRSS + strlen("VmRSS:"), NULL, 10) * 1024;
+		}
+	}
+	return residentSetSize;
+}
+
+void
+MM_IdleGCManager::releaseFreeHeap(J9VMThread *currentThread, MemoryPressureSample *sample)
+{
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	uint64_t startTime = j9time_hires_clock();
+	uint64_t residentSetSizeBefore = getResidentSetSize();
+
+	manageFreeHeap(currentThread);
+
+	uint64_t residentSetSizeAfter = getResidentSetSize();
+	uint64_t endTime = j9time_hires_clock();
+	_lastReleaseTime = j9time_current_time_millis();
+	_lastBytesReturned = (residentSetSizeBefore > residentSetSizeAfter) ? (residentSetSizeBefore - residentSetSizeAfter) : 0;
+
+	TRIGGER_J9HOOK_MM_MEMORY_PRESSURE_HEAP_RELEASE(
+		_extensions->hookInterface,
+		currentThread,
+		endTime,
+		J9HOOK_MM_MEMORY_PRESSURE_HEAP_RELEASE,
+		sample->pressure,
+		sample->current,
+		sample->high,
+		_lastBytesReturned,
+		j9time_hires_delta(startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS));
+}
+
 extern "C" {
 void
 idleGCManagerVMStateHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
@@ -44,19 +44,85 @@ void idleGCManagerVMStateHook(J9HookInterface **hook, uintptr_t eventNum, void *
 
 /**
  * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook
+ *
+ * With -XX:+ReleaseHeapOnMemoryPressure, a monitor thread also samples the memory pressure (PSI) and the
+ * memory.high limit of the cgroup v2 the JVM runs in, and frees heap pages while the cgroup is under pressure.
  */
 class MM_IdleGCManager : public MM_BaseNonVirtual
 {
 private:
+	enum {
+		THREAD_STATE_INITIAL = 0,
+		THREAD_STATE_RUNNING,
+		THREAD_STATE_TERMINATE_REQUESTED,
+		THREAD_STATE_TERMINATED
+	};
+
+	/**
+	 * One sample of the cgroup memory state
+	 */
+	struct MemoryPressureSample {
+		uintptr_t pressure; /**< PSI "some" avg10, in hundredths of a percent */
+		uint64_t current; /**< memory.current in bytes */
+		uint64_t high; /**< memory.high in bytes, U_64_MAX if there is no limit */
+	};
+
 	/*
 	 * reference to the language runtime
 	 */
 	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+
+	omrthread_monitor_t _pressureMonitor; /**< guards _pressureThreadState and wakes the pressure monitor thread */
+	volatile uintptr_t _pressureThreadState;
+	char _cgroupPath[512]; /**< cgroup v2 directory of the JVM, including the trailing separator */
+	bool _underPressure; /**< set when heap is released, cleared once the pressure falls well below the thresholds */
+	uint64_t _lastReleaseTime; /**< time of the last release in milliseconds */
+	uint64_t _lastBytesReturned; /**< bytes returned by the last release */
 
 protected:
 public:
 
 private:
+	static int J9THREAD_PROC pressureMonitorThreadProc(void *arg);
+
+	/**
+	 * Body of the pressure monitor thread; returns once termination has been requested.
+	 * @param vmThread[in] the attached monitor thread
+	 */
+	void monitorPressure(J9VMThread *vmThread);
+
+	/**
+	 * Find the cgroup v2 directory of the JVM.
+	 * @return true if the directory has the memory pressure and memory limit files
+	 */
+	bool findCgroup(MM_EnvironmentBase *env);
+
+	/**
+	 * Read a file into a NUL terminated buffer.
+	 * @return true if the file could be read
+	 */
+	bool readFile(const char *path, char *buffer, uintptr_t bufferSize);
+
+	/**
+	 * Sample the memory pressure and usage of the cgroup.
+	 * @param sample[out] the sample
+	 * @return true if the sample is valid
+	 */
+	bool sampleMemoryPressure(MemoryPressureSample *sample);
+
+	/**
+	 * @return the resident set size of the JVM in bytes, 0 if it cannot be read
+	 */
+	uint64_t getResidentSetSize();
+
+	/**
+	 * Collect the heap and release its free pages as manageFreeHeap() does, then report the memory returned.
+	 * @param currentThread[in] the current thread, which must not hold VM access
+	 * @param sample[in] the sample which triggered the release
+	 */
+	void releaseFreeHeap(J9VMThread *currentThread, MemoryPressureSample *sample);
+
 protected:
 	/**
 	 * Initialize the object of this class and registers for Runtime State hook
@@ -80,14 +146,36 @@ public:
 	  */
 	void manageFreeHeap(J9VMThread *currentThread);
 
+	/**
+	 * Start the memory pressure monitor thread if -XX:+ReleaseHeapOnMemoryPressure is enabled
+	 * and the JVM runs in a cgroup v2 with memory pressure information.
+	 * @param env[in] the current thread
+	 * @return true if the thread was started
+	 */
+	bool startPressureMonitor(MM_EnvironmentBase *env);
+
+	/**
+	 * Request termination of the memory pressure monitor thread and wait for it to exit.
+	 * The caller must not hold VM access.
+	 * @param env[in] the current thread
+	 */
+	void stopPressureMonitor(MM_EnvironmentBase *env);
+
 	/**
 	 * construct the object
 	 */
 	MM_IdleGCManager(MM_EnvironmentBase *env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _pressureMonitor(NULL)
+		, _pressureThreadState(THREAD_STATE_INITIAL)
+		, _underPressure(false)
+		, _lastReleaseTime(0)
+		, _lastBytesReturned(0)
 	{
 		_typeId = __FUNCTION__;
+		_cgroupPath[0] = '\0';
 	}
 };
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
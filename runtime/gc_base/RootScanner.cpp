@@ -793,9 +793,30 @@ MM_RootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 			}
 		}
 	}
+	for (uintptr_t tableIndex = 0; tableIndex < _javaVM->monitorTableCount; tableIndex++) {
+		if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			scanMonitorTableShardLookupCache(&_javaVM->monitorTableShards[tableIndex]);
+		}
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
+/**
+ * Scan the lock-free lookup cache of one monitor table shard (only present with -XX:+ShardedMonitorTable).
+ * Like the per-thread caches, the slots refer to monitors in the monitor tables and must be cleared
+ * before scanMonitorReferences destroys any of them.
+ */
+void
+MM_RootScanner::scanMonitorTableShardLookupCache(J9MonitorTableShard *shard)
+{
+	j9objectmonitor_t *lookupCache = shard->lookupCache;
+	if (NULL != lookupCache) {
+		for (uintptr_t cacheIndex = 0; cacheIndex < J9VM_MONITOR_TABLE_SHARD_CACHE_SIZE; cacheIndex++) {
+			doMonitorLookupCacheSlot(&lookupCache[cacheIndex]);
+		}
+	}
+}
+
 /**
  * @todo Provide function documentation
  */
@@ -875,29 +896,32 @@ MM_RootScanner::scanRememberedSet(MM_EnvironmentBase *env)
 void
 MM_RootScanner::scanJVMTIObjectTagTables(MM_EnvironmentBase *env)
 {
-	if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
-		reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
-
-		J9JVMTIData *jvmtiData = J9JVMTI_DATA_FROM_VM(_javaVM);
-		J9JVMTIEnv *jvmtiEnv = NULL;
-		J9Object **slotPtr = NULL;
-		if (NULL != jvmtiData) {
-			/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
-			 * when it is being scanned
-			 */
-			GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
-			while (NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-				if (NULL != jvmtiEnv->objectTagTable) {
-					GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-					while (NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-						doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+	reportScanningStarted(RootScannerEntity_JVMTIObjectTagTables);
+
+	J9JVMTIData *jvmtiData = J9JVMTI_DATA_FROM_VM(_javaVM);
+	if (NULL != jvmtiData) {
+		/* Every tag table shard (across all environments) is a separate work unit */
+		for (uintptr_t shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+			if (_singleThread || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				J9JVMTIEnv *jvmtiEnv = NULL;
+				J9Object **slotPtr = NULL;
+				/* TODO: When JVMTI is supported in RTSJ, this structure needs to be locked
+				 * when it is being scanned
+				 */
+				GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
+				while (NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
+					if (NULL != jvmtiEnv->objectTagTables[shard]) {
+						GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTables[shard]);
+						while (NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+							doJVMTIObjectTagSlot(slotPtr, &objectTagTableIterator);
+						}
 					}
 				}
 			}
 		}
-
-		reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 	}
+
+	reportScanningEnded(RootScannerEntity_JVMTIObjectTagTables);
 }
 #endif /* J9VM_OPT_JVMTI */
 
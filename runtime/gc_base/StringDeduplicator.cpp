@@ -0,0 +1,418 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "j9protos.h"
+#include "hashtable_api.h"
+#include "mmomrhook.h"
+#include "mmprivatehook.h"
+#include "ModronAssertions.h"
+
+#include "StringDeduplicator.hpp"
+
+#include "ArrayObjectModel.hpp"
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensions.hpp"
+
+/* Size of the candidate queue; Strings surviving past it in a single collection are dropped */
+#define STRING_DEDUPLICATOR_CANDIDATE_CAPACITY (64 * 1024)
+/* Number of canonical arrays for which memory is reserved up front */
+#define STRING_DEDUPLICATOR_INITIAL_TABLE_SIZE 1024
+
+MM_StringDeduplicator *
+MM_StringDeduplicator::newInstance(MM_EnvironmentBase *env)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)env->getForge()->allocate(sizeof(MM_StringDeduplicator), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != deduplicator) {
+		new(deduplicator) MM_StringDeduplicator(env);
+		if (!deduplicator->initialize(env)) {
+			deduplicator->kill(env);
+			deduplicator = NULL;
+		}
+	}
+	return deduplicator;
+}
+
+void
+MM_StringDeduplicator::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_StringDeduplicator::initialize(MM_EnvironmentBase *env)
+{
+	J9HookInterface **omrHooks = _extensions->getOmrHookInterface();
+	J9HookInterface **privateHooks = _extensions->getPrivateHookInterface();
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_StringDeduplicator")) {
+		return false;
+	}
+
+	_candidateCapacity = STRING_DEDUPLICATOR_CANDIDATE_CAPACITY;
+	_candidates = (j9object_t *)env->getForge()->allocate(_candidateCapacity * sizeof(j9object_t), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _candidates) {
+		return false;
+	}
+
+	_tableMaxEntries = _extensions->stringDeduplicationTableSize;
+	_table = hashTableNew(
+			OMRPORT_FROM_J9PORT(_javaVM->portLibrary),
+			J9_GET_CALLSITE(),
+			OMR_MIN(_tableMaxEntries, STRING_DEDUPLICATOR_INITIAL_TABLE_SIZE),
+			sizeof(MM_StringDeduplicatorEntry),
+			0,
+			0,
+			OMRMEM_CATEGORY_MM,
+			entryHash,
+			entryEquals,
+			NULL,
+			this);
+	if (NULL == _table) {
+		return false;
+	}
+
+	/* Queued object pointers become stale as soon as objects move again */
+	if ((0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, gcStartHook, OMR_GET_CALLSITE(), this))
+		|| (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, gcStartHook, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, gcStartHook, OMR_GET_CALLSITE(), this))
+	) {
+		return false;
+	}
+	if ((0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, gcEndHook, OMR_GET_CALLSITE(), this))
+		|| (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, gcEndHook, OMR_GET_CALLSITE(), this))
+		|| (0 != (*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, gcEndHook, OMR_GET_CALLSITE(), this))
+	) {
+		return false;
+	}
+
+	return true;
+}
+
+void
+MM_StringDeduplicator::tearDown(MM_EnvironmentBase *env)
+{
+	J9HookInterface **omrHooks = _extensions->getOmrHookInterface();
+	J9HookInterface **privateHooks = _extensions->getPrivateHookInterface();
+
+	if ((NULL != omrHooks) && (NULL != *omrHooks)) {
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, gcStartHook, this);
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, gcStartHook, this);
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, gcEndHook, this);
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, gcEndHook, this);
+	}
+	if ((NULL != privateHooks) && (NULL != *privateHooks)) {
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, gcStartHook, this);
+		(*privateHooks)->J9HookUnregister(privateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, gcEndHook, this);
+	}
+
+	/* A thread which was never stopped (e.g. on an abnormal shutdown) may still reference the table */
+	if ((THREAD_STATE_INITIAL == _threadState) || (THREAD_STATE_TERMINATED == _threadState)) {
+		if (NULL != _table) {
+			hashTableFree(_table);
+			_table = NULL;
+		}
+		if (NULL != _candidates) {
+			env->getForge()->free(_candidates);
+			_candidates = NULL;
+		}
+		if (NULL != _monitor) {
+			omrthread_monitor_destroy(_monitor);
+			_monitor = NULL;
+		}
+	}
+}
+
+bool
+MM_StringDeduplicator::startThread(MM_EnvironmentBase *env)
+{
+	bool result = false;
+
+	omrthread_monitor_enter(_monitor);
+	if (0 == _javaVM->internalVMFunctions->createThreadWithCategory(
+			NULL,
+			_javaVM->defaultOSStackSize,
+			J9THREAD_PRIORITY_MIN,
+			0,
+			threadProc,
+			this,
+			J9THREAD_CATEGORY_SYSTEM_GC_THREAD)
+	) {
+		while (THREAD_STATE_INITIAL == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		result = (THREAD_STATE_RUNNING == _threadState);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_StringDeduplicator::stopThread(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_STATE_RUNNING == _threadState) {
+		_threadState = THREAD_STATE_TERMINATE_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_STATE_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_StringDeduplicator::threadProc(void *arg)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)arg;
+	J9JavaVM *javaVM = deduplicator->_javaVM;
+	J9VMThread *vmThread = NULL;
+
+	if (JNI_OK == javaVM->internalVMFunctions->attachSystemDaemonThread(javaVM, &vmThread, "String deduplication")) {
+		deduplicator->run(vmThread);
+		(*((JavaVM *)javaVM))->DetachCurrentThread((JavaVM *)javaVM);
+	}
+
+	omrthread_monitor_enter(deduplicator->_monitor);
+	deduplicator->_threadState = THREAD_STATE_TERMINATED;
+	omrthread_monitor_notify_all(deduplicator->_monitor);
+	omrthread_exit(deduplicator->_monitor);
+
+	/* NO RETURN */
+	return 0;
+}
+
+void
+MM_StringDeduplicator::run(J9VMThread *vmThread)
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+	while (THREAD_STATE_RUNNING == _threadState) {
+		if (hasPendingWork()) {
+			omrthread_monitor_exit(_monitor);
+			processCandidates(vmThread);
+			omrthread_monitor_enter(_monitor);
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+
+	vmFuncs->internalAcquireVMAccess(vmThread);
+	clearTable(vmThread);
+	vmFuncs->internalReleaseVMAccess(vmThread);
+}
+
+void
+MM_StringDeduplicator::processCandidates(J9VMThread *vmThread)
+{
+	J9InternalVMFunctions *vmFuncs = _javaVM->internalVMFunctions;
+
+	vmFuncs->internalAcquireVMAccess(vmThread);
+	while (hasPendingWork() && (THREAD_STATE_RUNNING == _threadState)) {
+		if (_sweepRequired) {
+			_sweepRequired = false;
+			sweepTable(vmThread);
+		}
+		if (_candidatesProcessed < OMR_MIN(_candidateCount, _candidateCapacity)) {
+			j9object_t string = _candidates[_candidatesProcessed];
+			_candidatesProcessed += 1;
+			deduplicate(vmThread, string);
+		}
+		if (J9_ARE_ANY_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_RELEASE_ACCESS_REQUIRED_MASK)) {
+			/* Let the pending exclusive request proceed; a collection discards the remaining candidates */
+			vmFuncs->internalReleaseVMAccess(vmThread);
+			vmFuncs->internalAcquireVMAccess(vmThread);
+		}
+	}
+	vmFuncs->internalReleaseVMAccess(vmThread);
+}
+
+void
+MM_StringDeduplicator::deduplicate(J9VMThread *vmThread, j9object_t string)
+{
+	GC_ArrayObjectModel *indexableObjectModel = &_extensions->indexableObjectModel;
+	J9IndexableObject *value = (J9IndexableObject *)J9VMJAVALANGSTRING_VALUE(vmThread, string);
+
+	/* Only arrays whose data is contiguous in the heap can be compared cheaply */
+	if ((NULL != value) && indexableObjectModel->isInlineContiguousArraylet(value)) {
+		J9Class *arrayClass = J9OBJECT_CLAZZ(vmThread, value);
+		MM_StringDeduplicatorEntry exemplar;
+		exemplar.sizeInBytes = indexableObjectModel->getSizeInElements(value) * J9ARRAYCLASS_GET_STRIDE(arrayClass);
+		exemplar.arrayClass = arrayClass;
+		exemplar.canonical = NULL;
+		exemplar.data = indexableObjectModel->getDataPointerForContiguous(value);
+		exemplar.hash = 0;
+
+		/* FNV-1a over the array contents */
+		uintptr_t hash = 2166136261U;
+		U_8 *bytes = (U_8 *)exemplar.data;
+		for (uintptr_t i = 0; i < exemplar.sizeInBytes; i++) {
+			hash = (hash ^ bytes[i]) * 16777619U;
+		}
+		exemplar.hash = hash;
+
+		MM_StringDeduplicatorEntry *entry = (MM_StringDeduplicatorEntry *)hashTableFind(_table, &exemplar);
+		if (NULL != entry) {
+			j9object_t canonical = J9_JNI_UNWRAP_REFERENCE(entry->canonical);
+			if ((j9object_t)value != canonical) {
+				J9VMJAVALANGSTRING_SET_VALUE(vmThread, string, canonical);
+				_deduplicated += 1;
+				_bytesSaved += indexableObjectModel->getSizeInBytesWithHeader(value);
+			}
+		} else if (hashTableGetCount(_table) < _tableMaxEntries) {
+			exemplar.canonical = _javaVM->internalVMFunctions->j9jni_createGlobalRef((JNIEnv *)vmThread, (j9object_t)value, JNI_TRUE);
+			exemplar.data = NULL;
+			if ((NULL != exemplar.canonical) && (NULL == hashTableAdd(_table, &exemplar))) {
+				_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)vmThread, exemplar.canonical, JNI_TRUE);
+			}
+		}
+	}
+}
+
+void
+MM_StringDeduplicator::sweepTable(J9VMThread *vmThread)
+{
+	J9HashTableState walkState;
+	MM_StringDeduplicatorEntry *entry = (MM_StringDeduplicatorEntry *)hashTableStartDo(_table, &walkState);
+	while (NULL != entry) {
+		if (NULL == J9_JNI_UNWRAP_REFERENCE(entry->canonical)) {
+			_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)vmThread, entry->canonical, JNI_TRUE);
+			hashTableDoRemove(&walkState);
+		}
+		entry = (MM_StringDeduplicatorEntry *)hashTableNextDo(&walkState);
+	}
+}
+
+void
+MM_StringDeduplicator::clearTable(J9VMThread *vmThread)
+{
+	J9HashTableState walkState;
+	MM_StringDeduplicatorEntry *entry = (MM_StringDeduplicatorEntry *)hashTableStartDo(_table, &walkState);
+	while (NULL != entry) {
+		_javaVM->internalVMFunctions->j9jni_deleteGlobalRef((JNIEnv *)vmThread, entry->canonical, JNI_TRUE);
+		hashTableDoRemove(&walkState);
+		entry = (MM_StringDeduplicatorEntry *)hashTableNextDo(&walkState);
+	}
+}
+
+void
+MM_StringDeduplicator::queueCandidate(MM_EnvironmentBase *env, j9object_t string)
+{
+	uintptr_t index = MM_AtomicOperations::add(&_candidateCount, 1) - 1;
+	if (index < _candidateCapacity) {
+		_candidates[index] = string;
+		MM_AtomicOperations::add(&_queued, 1);
+	} else {
+		MM_AtomicOperations::add(&_dropped, 1);
+	}
+}
+
+void
+MM_StringDeduplicator::discardCandidates(MM_EnvironmentBase *env)
+{
+	uintptr_t available = OMR_MIN(_candidateCount, _candidateCapacity);
+	if (available > _candidatesProcessed) {
+		_dropped += available - _candidatesProcessed;
+	}
+	_candidateCount = 0;
+	_candidatesProcessed = 0;
+}
+
+void
+MM_StringDeduplicator::getStatistics(uintptr_t *queued, uintptr_t *dropped, uintptr_t *deduplicated, uintptr_t *bytesSaved, uintptr_t *tableSize)
+{
+	*queued = _queued;
+	*dropped = _dropped;
+	*deduplicated = _deduplicated;
+	*bytesSaved = _bytesSaved;
+	*tableSize = hashTableGetCount(_table);
+}
+
+void
+MM_StringDeduplicator::gcStartHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+	deduplicator->discardCandidates(NULL);
+}
+
+void
+MM_StringDeduplicator::gcEndHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+
+	omrthread_monitor_enter(deduplicator->_monitor);
+	if (0 != hashTableGetCount(deduplicator->_table)) {
+		deduplicator->_sweepRequired = true;
+	}
+	if (deduplicator->hasPendingWork()) {
+		omrthread_monitor_notify(deduplicator->_monitor);
+	}
+	omrthread_monitor_exit(deduplicator->_monitor);
+}
+
+uintptr_t
+MM_StringDeduplicator::entryHash(void *entry, void *userData)
+{
+	return ((MM_StringDeduplicatorEntry *)entry)->hash;
+}
+
+void *
+MM_StringDeduplicator::entryData(MM_StringDeduplicatorEntry *entry)
+{
+	void *data = entry->data;
+	if (NULL == data) {
+		/* A table entry whose canonical array has been collected matches nothing */
+		j9object_t canonical = J9_JNI_UNWRAP_REFERENCE(entry->canonical);
+		if (NULL != canonical) {
+			data = _extensions->indexableObjectModel.getDataPointerForContiguous((J9IndexableObject *)canonical);
+		}
+	}
+	return data;
+}
+
+uintptr_t
+MM_StringDeduplicator::entryEquals(void *leftEntry, void *rightEntry, void *userData)
+{
+	MM_StringDeduplicatorEntry *left = (MM_StringDeduplicatorEntry *)leftEntry;
+	MM_StringDeduplicatorEntry *right = (MM_StringDeduplicatorEntry *)rightEntry;
+	uintptr_t result = FALSE;
+
+	if ((left->hash == right->hash) && (left->sizeInBytes == right->sizeInBytes) && (left->arrayClass == right->arrayClass)) {
+		MM_StringDeduplicator *deduplicator = (MM_StringDeduplicator *)userData;
+		void *leftData = deduplicator->entryData(left);
+		void *rightData = deduplicator->entryData(right);
+		if ((NULL != leftData) && (NULL != rightData)) {
+			result = (0 == memcmp(leftData, rightData, left->sizeInBytes));
+		}
+	}
+	return result;
+}
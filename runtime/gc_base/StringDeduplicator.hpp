@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(STRINGDEDUPLICATOR_HPP_)
+#define STRINGDEDUPLICATOR_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Canonical value array entry of the deduplication table.
+ * @ingroup GC_Base
+ */
+typedef struct MM_StringDeduplicatorEntry {
+	uintptr_t hash; /**< hash of the array contents */
+	uintptr_t sizeInBytes; /**< length of the array contents in bytes */
+	J9Class *arrayClass; /**< class of the array, values of different element types never match */
+	jobject canonical; /**< weak global reference to the canonical array, NULL in a lookup exemplar */
+	void *data; /**< contents being looked up, only set in a lookup exemplar */
+} MM_StringDeduplicatorEntry;
+
+/**
+ * Deduplicates the value arrays of Strings surviving young collections.
+ *
+ * Strings copied out of the nursery (tenured by a scavenge, or aged out of the nursery by a
+ * copy-forward) are queued by the collector.  A low priority background thread later looks up
+ * the contents of each queued value array in a table of canonical arrays and, on a match, points
+ * the String at the canonical array so the duplicate can be reclaimed by a later collection.
+ *
+ * Queued candidates are raw object pointers, so they are only valid until objects move again;
+ * the queue is discarded at the start of every collection and whenever a collection backs out.
+ * Canonical arrays are held through weak JNI references and therefore never keep an array alive.
+ * @ingroup GC_Base
+ */
+class MM_StringDeduplicator : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	enum {
+		THREAD_STATE_INITIAL = 0,
+		THREAD_STATE_RUNNING,
+		THREAD_STATE_TERMINATE_REQUESTED,
+		THREAD_STATE_TERMINATED
+	};
+
+	J9JavaVM *_javaVM;
+	MM_GCExtensions *_extensions;
+	omrthread_monitor_t _monitor; /**< guards _threadState and wakes the deduplication thread */
+	volatile uintptr_t _threadState;
+	volatile bool _sweepRequired; /**< set after each collection so cleared canonical entries are removed */
+
+	j9object_t *_candidates; /**< Strings queued by the collector, only valid until objects next move */
+	uintptr_t _candidateCapacity;
+	volatile uintptr_t _candidateCount; /**< slots claimed by the collector, may exceed _candidateCapacity */
+	uintptr_t _candidatesProcessed; /**< candidates consumed by the deduplication thread */
+
+	J9HashTable *_table; /**< canonical value arrays, only accessed by the deduplication thread or under exclusive */
+	uintptr_t _tableMaxEntries;
+
+	volatile uintptr_t _queued; /**< total candidates accepted into the queue */
+	volatile uintptr_t _dropped; /**< total candidates lost to queue overflow or discarded before being processed */
+	uintptr_t _deduplicated; /**< total Strings redirected to a canonical value array */
+	uintptr_t _bytesSaved; /**< total size of the value arrays made unreachable by deduplication */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC threadProc(void *arg);
+	static void gcStartHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static void gcEndHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+	static uintptr_t entryHash(void *entry, void *userData);
+	static uintptr_t entryEquals(void *leftEntry, void *rightEntry, void *userData);
+
+	/**
+	 * @param entry[in] a table entry or a lookup exemplar
+	 * @return the array contents of the entry, or NULL if its canonical array has been collected
+	 */
+	void *entryData(MM_StringDeduplicatorEntry *entry);
+
+	/**
+	 * Body of the deduplication thread; returns once termination has been requested.
+	 * @param vmThread[in] the attached deduplication thread
+	 */
+	void run(J9VMThread *vmThread);
+
+	/**
+	 * Process all queued candidates. Acquires and periodically yields VM access.
+	 * @param vmThread[in] the deduplication thread
+	 */
+	void processCandidates(J9VMThread *vmThread);
+
+	/**
+	 * Look up the value array of a String and redirect the String to the canonical copy if one exists.
+	 * @param vmThread[in] the deduplication thread, which must hold VM access
+	 * @param string[in] the String to deduplicate
+	 */
+	void deduplicate(J9VMThread *vmThread, j9object_t string);
+
+	/**
+	 * Remove the entries whose canonical array has been collected.
+	 * @param vmThread[in] the deduplication thread, which must hold VM access
+	 */
+	void sweepTable(J9VMThread *vmThread);
+
+	/**
+	 * Release every canonical reference and empty the table.
+	 * @param vmThread[in] the deduplication thread, which must hold VM access
+	 */
+	void clearTable(J9VMThread *vmThread);
+
+	MMINLINE bool
+	hasPendingWork()
+	{
+		return _sweepRequired || (_candidatesProcessed < OMR_MIN(_candidateCount, _candidateCapacity));
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_StringDeduplicator *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the background deduplication thread. Called once the class library has been initialized.
+	 * @param env[in] the current thread
+	 * @return true if the thread was started
+	 */
+	bool startThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Request termination of the background deduplication thread and wait for it to exit.
+	 * The caller must not hold VM access.
+	 * @param env[in] the current thread
+	 */
+	void stopThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Check whether an object that has just been copied out of the nursery should be queued.
+	 * @param clazz[in] class of the copied object
+	 * @return true if the object is a String and the deduplication thread is running
+	 */
+	MMINLINE bool
+	isCandidateClass(J9Class *clazz)
+	{
+		return (THREAD_STATE_RUNNING == _threadState) && (clazz == J9VMJAVALANGSTRING_OR_NULL(_javaVM));
+	}
+
+	/**
+	 * Queue a String for deduplication. Called by GC threads during a collection; the String must
+	 * already be at its final location for the collection. Candidates that do not fit are dropped.
+	 * @param env[in] the calling GC thread
+	 * @param string[in] the String to queue
+	 */
+	void queueCandidate(MM_EnvironmentBase *env, j9object_t string);
+
+	/**
+	 * Forget every queued candidate. Called under exclusive VM access whenever queued object
+	 * pointers may become stale, i.e. at the start of a collection or when a collection backs out.
+	 * @param env[in] the calling thread
+	 */
+	void discardCandidates(MM_EnvironmentBase *env);
+
+	/**
+	 * Report deduplication statistics. Called under exclusive VM access.
+	 * @param[out] queued total candidates queued
+	 * @param[out] dropped total candidates dropped before being processed
+	 * @param[out] deduplicated total Strings deduplicated
+	 * @param[out] bytesSaved total bytes of value arrays made unreachable
+	 * @param[out] tableSize current number of canonical arrays
+	 */
+	void getStatistics(uintptr_t *queued, uintptr_t *dropped, uintptr_t *deduplicated, uintptr_t *bytesSaved, uintptr_t *tableSize);
+
+	MM_StringDeduplicator(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _extensions(MM_GCExtensions::getExtensions(env))
+		, _monitor(NULL)
+		, _threadState(THREAD_STATE_INITIAL)
+		, _sweepRequired(false)
+		, _candidates(NULL)
+		, _candidateCapacity(0)
+		, _candidateCount(0)
+		, _candidatesProcessed(0)
+		, _table(NULL)
+		, _tableMaxEntries(0)
+		, _queued(0)
+		, _dropped(0)
+		, _deduplicated(0)
+		, _bytesSaved(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* STRINGDEDUPLICATOR_HPP_ */
@@ -178,6 +178,52 @@ MM_StringTable::hashAtPut(UDATA tableIndex, j9object_t string)
 }
 
 
+j9object_t
+MM_StringTable::lookupStringInternCache(J9JavaVM *javaVM, UDATA hash, void *key)
+{
+	/* Cache entries are written without locks and cleared by the GC, so read each one exactly once. */
+	volatile j9object_t *cacheSet = getStringInternCacheSet(hash);
+
+	for (UDATA way = 0; way < cacheWays; way++) {
+		j9object_t candidate = cacheSet[way];
+
+		if ((NULL != candidate) && stringHashEqualFn(&candidate, key, javaVM)) {
+			/*
+			 * This can only be used if the current candidate pointer is live.
+			 * Pass in candidate twice since we only have one string.
+			 */
+			if (checkStringConstantsLive(javaVM, candidate, candidate)) {
+				return candidate;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+void
+MM_StringTable::addToStringInternCache(UDATA hash, j9object_t string)
+{
+	volatile j9object_t *cacheSet = getStringInternCacheSet(hash);
+	/* Use the hash bits above the ones selecting the set to pick the entry to replace */
+	UDATA victim = (hash / (cacheSize / cacheWays)) % cacheWays;
+
+	for (UDATA way = 0; way < cacheWays; way++) {
+		j9object_t candidate = cacheSet[way];
+		if (string == candidate) {
+			return;
+		}
+		if (NULL == candidate) {
+			victim = way;
+			break;
+		}
+	}
+
+	/* Racing publishers may overwrite each other; a lost entry only costs a locked lookup later */
+	MM_AtomicOperations::writeBarrier();
+	cacheSet[victim] = string;
+}
+
 j9object_t
 MM_StringTable::addStringToInternTable(J9VMThread *vmThread, j9object_t string)
 {
@@ -646,11 +692,26 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 			hash = VM_VMHelpers::computeHashForUTF8(data, length);
 		}
 
-		UDATA tableIndex = stringTable->getTableIndex(hash);
+		stringTableUTF8Query query;
+		void *queryPtr = NULL;
+
+		query.utf8Data = data;
+		query.utf8Length = length;
+		query.hash = (U_32)hash;
+		queryPtr = (void *)((UDATA)&query | TYPE_UTF8); /* Least significant bit indicates that this is a pointer to a stringTableUTF8Query */
+
+		result = stringTable->lookupStringInternCache(vm, query.hash, &queryPtr);
+		if (NULL == result) {
+			UDATA tableIndex = stringTable->getTableIndex(hash);
+
+			stringTable->lockTable(tableIndex);
+			result = stringTable->hashAtUTF8(tableIndex, data, length, (U_32)hash);
+			stringTable->unlockTable(tableIndex);
 
-		stringTable->lockTable(tableIndex);
-		result = stringTable->hashAtUTF8(tableIndex, data, length, (U_32)hash);
-		stringTable->unlockTable(tableIndex);
+			if (NULL != result) {
+				stringTable->addToStringInternCache(query.hash, result);
+			}
+		}
 	}
 
 	if (NULL == result) {
@@ -979,23 +1040,15 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm->omrVM);
 	MM_StringTable *stringTable = extensions->getStringTable();
 	j9object_t internedString = NULL;
-	j9object_t *candidatePtr = NULL;
 	j9object_t candidate = NULL;
 
 	UDATA hash = stringHashFn(&sourceString, vm);
 
-	candidatePtr = stringTable->getStringInternCache(hash);
-	candidate = *candidatePtr;
-
-	if ((NULL != candidate) && stringHashEqualFn(&candidate, &sourceString, vm)) {
-		/*
-		 * This can only be used if the current candidate pointer is live.
-		 * Pass in candidate twice since we only have one string.
-		 */
-		if (checkStringConstantsLive(vm, candidate, candidate)) {
-			Trc_MM_stringTableCacheHit(vmThread, candidate);
-			return candidate;
-		}
+	/* Most interns find an existing string, which the lock-free cache usually answers */
+	candidate = stringTable->lookupStringInternCache(vm, hash, &sourceString);
+	if (NULL != candidate) {
+		Trc_MM_stringTableCacheHit(vmThread, candidate);
+		return candidate;
 	}
 
 	UDATA tableIndex = stringTable->getTableIndex(hash);
@@ -1023,7 +1076,9 @@ j9gc_internString(J9VMThread *vmThread, j9object_t sourceString)
 		}
 	}
 
-	*candidatePtr = internedString;
+	if (NULL != internedString) {
+		stringTable->addToStringInternCache(hash, internedString);
+	}
 	Trc_MM_stringTableCacheMiss(vmThread, internedString);
 	return internedString;
 }
@@ -41,8 +41,9 @@ private:
 	J9HashTable **_table;           /**< pointer to an array of hash sub-tables */
 	omrthread_monitor_t *_mutex;    /**< pointer to an array of monitors associated with each hash sub-table */
 
-    ddr_constant(cacheSize, 511);
-	j9object_t _cache[cacheSize];   /**< interned string table cash */
+	ddr_constant(cacheSize, 4096);
+	ddr_constant(cacheWays, 4);
+	j9object_t _cache[cacheSize];   /**< interned string table cache, read without locks; cacheWays consecutive entries form a set */
 public:
 
 private:
@@ -61,9 +62,26 @@ public:
 	j9object_t *getStringInternCache() { return _cache; }
 	/**
 	 * @param hash hash value of the string being cached
-	 * @return the address of an entry into the cache array
+	 * @return the address of the first of the cacheWays entries of the cache set for the hash
 	 */
-	j9object_t *getStringInternCache(UDATA hash) { return &_cache[hash % cacheSize]; }
+	j9object_t *getStringInternCacheSet(UDATA hash) { return &_cache[(hash % (cacheSize / cacheWays)) * cacheWays]; }
+
+	/**
+	 * Look up an interned string in the cache without taking any sub-table lock.
+	 * A miss does not mean the string is not interned; the caller must then search the sub-table.
+	 * @param javaVM pointer to J9JavaVM
+	 * @param hash hash value of the string being looked up
+	 * @param key pointer to a String object or to a low-tagged pointer to a stringTableUTF8Query
+	 * @return pointer to the live interned String object or NULL if it is not cached
+	 */
+	j9object_t lookupStringInternCache(J9JavaVM *javaVM, UDATA hash, void *key);
+
+	/**
+	 * Publish an interned string to the cache so that subsequent lookups can find it without locking.
+	 * @param hash hash value of the string
+	 * @param string the interned String object, which must be live and fully initialized
+	 */
+	void addToStringInternCache(UDATA hash, j9object_t string);
 
 	/**
 	 * @return hash sub-table count
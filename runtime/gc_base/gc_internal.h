@@ -191,6 +191,7 @@ extern J9_CFUNC void j9gc_objaccess_indexableStoreU64Split(J9VMThread *vmThread,
 extern J9_CFUNC void cleanupMutatorModelJava(J9VMThread* vmThread);
 extern J9_CFUNC j9object_t j9gc_objaccess_mixedObjectReadObject(J9VMThread *vmThread, j9object_t srcObject, UDATA offset, UDATA isVolatile);
 extern J9_CFUNC UDATA j9gc_get_objects_pending_finalization_count(J9JavaVM* vm);
+extern J9_CFUNC void j9gc_finalizer_statistics_do(J9VMThread *vmThread, void (*func)(J9VMThread *vmThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData), void *userData);
 extern J9_CFUNC void j9gc_objaccess_indexableStoreU16(J9VMThread *vmThread, J9IndexableObject *destObject, I_32 index, U_32 value, UDATA isVolatile);
 extern J9_CFUNC void j9gc_objaccess_jniDeleteGlobalReference(J9VMThread *vmThread, j9object_t reference);
 extern J9_CFUNC UDATA isObjectInMemorySpace(J9VMThread *vmThread, void *memorySpace, j9object_t objectPtr);
@@ -22,14 +22,17 @@
 
 #include "Check.hpp"
 #include "CheckEngine.hpp"
+#include "CheckParallelTask.hpp"
 
 void
-GC_Check::run(bool shouldCheck, bool shouldPrint)
+GC_Check::run(bool shouldCheck, bool shouldPrint, MM_EnvironmentBase *env)
 {
 	_engine->startNewCheck(this);
 	
 	if(shouldCheck) {
-		check();
+		if ((NULL == env) || !GC_CheckParallelTask::checkInParallel(env, _engine, this)) {
+			check();
+		}
 	}
 
 	if(shouldPrint) {
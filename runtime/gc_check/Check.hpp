@@ -35,6 +35,8 @@
 #include "GCExtensions.hpp"
 
 class GC_CheckEngine;
+class GC_CheckParallelTask;
+class MM_EnvironmentBase;
 
 /**
  * GC_Check - abstract class for defining types of check
@@ -79,9 +81,33 @@ public:
 	void setBitId(UDATA bitId) { _bitId = bitId; }
 	UDATA getBitId() { return _bitId; }
 	
-	void run(bool shouldCheck, bool shouldPrint);   /**< run gc_check on the structure */
+	/**
+	 * Run gc_check on the structure.
+	 * @param env the thread running the cycle if the check can be run on the GC worker threads, NULL otherwise
+	 */
+	void run(bool shouldCheck, bool shouldPrint, MM_EnvironmentBase *env = NULL);
 	virtual const char *getCheckName() = 0; /**< get a string representing this check-type */
 
+	/**
+	 * Split the structure into work units to be checked by the GC worker threads (see GC_CheckParallelTask).
+	 * Called by the thread running the cycle before the worker threads are dispatched.
+	 * @return false if the check has to run on a single thread
+	 */
+	virtual bool prepareWorkUnits(MM_EnvironmentBase *env) { return false; }
+
+	/**
+	 * Check the work units claimed by the calling GC worker thread.
+	 * Every work unit has to be enumerated with GC_CheckParallelTask::handleNextWorkUnit(), in the same order on every thread,
+	 * unless the work units are claimed from a shared source, which numbers them in order (see GC_CheckParallelTask::startWorkUnit()).
+	 * @param engine the engine of the calling thread
+	 */
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine) {}
+
+	/**
+	 * Release the resources acquired by prepareWorkUnits().
+	 */
+	virtual void releaseWorkUnits(MM_EnvironmentBase *env) {}
+
 	GC_Check(J9JavaVM *javaVM, GC_CheckEngine *engine)
 		: MM_Base()
 		, _javaVM(javaVM)
@@ -100,6 +100,7 @@
 #define J9MODRON_GCCHK_MISC_DARKMATTER ((UDATA)0x00008000)
 #define J9MODRON_GCCHK_MISC_MIDSCAVENGE ((UDATA)0x00010000)
 #define J9MODRON_GCCHK_VALID_INDEXABLE_DATA_ADDRESS ((UDATA)0x00040000)
+#define J9MODRON_GCCHK_MISC_SERIAL ((UDATA)0x00080000)
 /** @} */
 
 /**
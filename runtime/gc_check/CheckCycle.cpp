@@ -107,6 +107,7 @@ GC_CheckCycle::printHelp(J9PortLibrary *portLib)
 	j9tty_printf(PORTLIB, "  check\n");
 	j9tty_printf(PORTLIB, "  nocheck\n");
 	j9tty_printf(PORTLIB, "  maxErrors=X\n");
+	j9tty_printf(PORTLIB, "  serial\n");
 
 	j9tty_printf(PORTLIB, "  abort\n");
 	j9tty_printf(PORTLIB, "  noabort\n");
@@ -289,6 +290,11 @@ top:
 							continue;
 						}
 
+						if (try_scan(&scan_start, "serial")) {
+							miscFlags |= J9MODRON_GCCHK_MISC_SERIAL;
+							continue;
+						}
+
 						if (try_scan(&scan_start, "darkmatter")) {
 							miscFlags |= J9MODRON_GCCHK_MISC_DARKMATTER;
 							continue;
@@ -414,7 +420,7 @@ failure:
 }
 
 void
-GC_CheckCycle::run(GCCheckInvokedBy invokedBy, UDATA filterFlags)
+GC_CheckCycle::run(GCCheckInvokedBy invokedBy, UDATA filterFlags, MM_EnvironmentBase *env)
 {
 	UDATA originalMiscFlags = _miscFlags;
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_javaVM);
@@ -427,6 +433,9 @@ GC_CheckCycle::run(GCCheckInvokedBy invokedBy, UDATA filterFlags)
 		_miscFlags &= ~J9MODRON_GCCHK_VERBOSE;
 		_miscFlags |= J9MODRON_GCCHK_MISC_QUIET;
 	}
+	if (_miscFlags & J9MODRON_GCCHK_MISC_SERIAL) {
+		env = NULL;
+	}
 	_invokedBy = invokedBy;
 	_engine->startCheckCycle(_javaVM, this);
 	
@@ -436,7 +445,7 @@ GC_CheckCycle::run(GCCheckInvokedBy invokedBy, UDATA filterFlags)
 		if (mover->getBitId() == (filterFlags & mover->getBitId())) {
 			bool check = (J9MODRON_GCCHK_MISC_CHECK == (_miscFlags & J9MODRON_GCCHK_MISC_CHECK));
 			bool scan = (J9MODRON_GCCHK_MISC_SCAN == (_miscFlags & J9MODRON_GCCHK_MISC_SCAN));
-			mover->run(check, scan);
+			mover->run(check, scan, env);
 		}
 		mover = mover->getNext();
 	}
@@ -37,6 +37,7 @@
 
 class GC_Check;
 class GC_CheckEngine;
+class MM_EnvironmentBase;
 
 class GC_CheckCycle : public MM_Base
 {
@@ -92,8 +93,9 @@ public:
 	 * Iterates over the _checks linked list calling run() on each item in the list.
 	 * @param invokedBy Identifier of the point in the GC the check has been called from
 	 * @param filterFlags Tells which subset of the check list should be used (1bit meaning the checker will be used)
+	 * @param env The GC thread running the checks, which may then be run on the GC worker threads, or NULL
 	 */
-	void run(GCCheckInvokedBy invokedBy, UDATA filterFlags = J9MODRON_GCCHK_SCAN_ALL_SLOTS);
+	void run(GCCheckInvokedBy invokedBy, UDATA filterFlags = J9MODRON_GCCHK_SCAN_ALL_SLOTS, MM_EnvironmentBase *env = NULL);
 	void fixDeadObjects(GCCheckInvokedBy invokedBy);
 	static GC_CheckCycle *newInstance(J9JavaVM *javaVM, GC_CheckEngine *, const char *args, UDATA manualCountInvocation = 0);
 	virtual void kill();
@@ -265,8 +265,7 @@ GC_CheckEngine::checkJ9ObjectPointer(J9JavaVM *javaVM, J9Object *objectPtr, J9Ob
 				*newObjectPtr = forwardedHeader.getForwardedObject();
 				
 				if (_cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
-					PORT_ACCESS_FROM_PORT(_portLibrary);
-					j9tty_printf(PORTLIB, "  <gc check: found forwarded pointer %p -> %p>\n", objectPtr, *newObjectPtr);	
+					_reporter->reportForwardedPointer(objectPtr, *newObjectPtr);
 				}
 				
 				objectPtr = *newObjectPtr;
@@ -688,7 +687,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 	 */
 	result = checkJ9Class(javaVM, clazz, segment, _cycle->getCheckFlags());
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+		GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 		_reporter->report(&error);
 	}
 
@@ -716,7 +715,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 			case classiterator_state_callsites:
 				elementName = "callsite "; break;
 			}
-			GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, elementName, result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, elementName, result, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -725,7 +724,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 			/* If the slot has its old bit OFF, the class's remembered bit should be ON */
 			if (objectPtr && !extensions->isOld(objectPtr)) {
 				if (!extensions->objectModel.isRemembered((J9Object*)clazz->classObject)) {
-					GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, _cycle->nextErrorCount());
+					GC_CheckError error(clazz, (void*)slotPtr, _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, nextErrorCount());
 					_reporter->report(&error);
 					return J9MODRON_SLOT_ITERATOR_OK;
 				}
@@ -742,7 +741,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 	if (NULL != replaced) {
 		/* if class replaces another class the replaced class must have J9AccClassHotSwappedOut flag set */
 		if (0 == (J9CLASS_FLAGS(replaced) & J9AccClassHotSwappedOut)) {
-			GC_CheckError error(clazz, (void*)&(clazz->replacedClass), _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REPLACED_CLASS_HAS_NO_HOTSWAP_FLAG, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, (void*)&(clazz->replacedClass), _cycle, _currentCheck, "Class ", J9MODRON_GCCHK_RC_REPLACED_CLASS_HAS_NO_HOTSWAP_FLAG, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -783,7 +782,7 @@ GC_CheckEngine::checkClassHeap(J9JavaVM *javaVM, J9Class *clazz, J9MemorySegment
 		}
 
 		if (J9MODRON_GCCHK_RC_OK != result) {
-			GC_CheckError error(clazz, &classPtr, _cycle, _currentCheck, elementName, result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, &classPtr, _cycle, _currentCheck, elementName, result, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -809,7 +808,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 		if (J9GC_CLASS_IS_ARRAY(clazz)) {
 			/* j9arrayclass should not be hot swapped */
 			result = J9MODRON_GCCHK_RC_CLASS_HOT_SWAPPED_FOR_ARRAY;
-			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 			_reporter->report(&error);
 			validationRequired = false;
 		}
@@ -868,7 +867,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 					/* an address must be in gc scan range */
 					if (!((address >= sectionStart) && (address < sectionEnd))) {
 						result = J9MODRON_GCCHK_RC_CLASS_STATICS_REFERENCE_IS_NOT_IN_SCANNING_RANGE;
-						GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+						GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 						_reporter->report(&error);
 					}
 
@@ -895,7 +894,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 						if (NULL != classToCast) {
 							if (0 == instanceOfOrCheckCast(J9GC_J9OBJECT_CLAZZ_VM(*address, vm), classToCast)) {
 								result = J9MODRON_GCCHK_RC_CLASS_STATICS_FIELD_POINTS_WRONG_OBJECT;
-								GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+								GC_CheckError error(clazz, address, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 								_reporter->report(&error);
 							}
 						}
@@ -907,7 +906,7 @@ GC_CheckEngine::checkClassStatics(J9JavaVM* vm, J9Class* clazz)
 
 		if (numberOfReferences != romClazz->objectStaticCount) {
 			result = J9MODRON_GCCHK_RC_CLASS_STATICS_WRONG_NUMBER_OF_REFERENCES;
-			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, _cycle->nextErrorCount());
+			GC_CheckError error(clazz, _cycle, _currentCheck, "Class ", result, nextErrorCount());
 			_reporter->report(&error);
 		}
 	}
@@ -960,7 +959,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 	
 	if (J9MODRON_GCCHK_RC_OK != result) {
 		const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, result, _cycle->nextErrorCount());
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -973,7 +972,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 		if (!findRegionForPointer(javaVM, objectPtr, &objectRegion)) {
 			/* should be impossible, since checkObjectIndirect() already verified that the object exists */
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NOT_FOUND, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NOT_FOUND, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -982,7 +981,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 
 		if (objectPtr && (regionType & MEMORY_TYPE_OLD) && (objectRegionType & MEMORY_TYPE_NEW) && !extensions->objectModel.isRemembered(objectIndirectBase)) {
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NEW_POINTER_NOT_REMEMBERED, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_NEW_POINTER_NOT_REMEMBERED, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -990,7 +989,7 @@ GC_CheckEngine::checkSlotObjectHeap(J9JavaVM *javaVM, J9Object *objectPtr, fj9ob
 		/* Old objects that point to objects with old bit OFF should have remembered bit ON */
 		if (objectPtr && (regionType & MEMORY_TYPE_OLD) && !extensions->isOld(objectPtr) && !extensions->objectModel.isRemembered(objectIndirectBase)) {
 			const char *elementName = extensions->objectModel.isIndexable(objectIndirectBase) ? "IObject " : "Object ";
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, _cycle->nextErrorCount());
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, (char *)elementName, J9MODRON_GCCHK_RC_REMEMBERED_SET_OLD_OBJECT, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -1022,7 +1021,7 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	/* Size of hole can not be larger then rest of the region */
 	if (FALSE == objectDesc->isObject) {
 		if ((0 == objectDesc->size) || (objectDesc->size > ((UDATA)regionDesc->regionStart +  regionDesc->regionSize - (UDATA)objectDesc->object))) {
-			GC_CheckError error(objectDesc->object, _cycle, _currentCheck, "Object ", J9MODRON_GCCHK_RC_DEAD_OBJECT_SIZE, _cycle->nextErrorCount());
+			GC_CheckError error(objectDesc->object, _cycle, _currentCheck, "Object ", J9MODRON_GCCHK_RC_DEAD_OBJECT_SIZE, nextErrorCount());
 			_reporter->report(&error);
 			_reporter->reportHeapWalkError(&error, _lastHeapObject1, _lastHeapObject2, _lastHeapObject3);
 			return J9MODRON_SLOT_ITERATOR_UNRECOVERABLE_ERROR;
@@ -1033,7 +1032,7 @@ GC_CheckEngine::checkObjectHeap(J9JavaVM *javaVM, J9MM_IterateObjectDescriptor *
 	result = checkJ9Object(javaVM, objectDesc->object, regionDesc, _cycle->getCheckFlags());
 	if (J9MODRON_GCCHK_RC_OK != result) {
 		const char *elementName = extensions->objectModel.isIndexable(objectDesc->object) ? "IObject " : "Object ";
-		GC_CheckError error(objectDesc->object, _cycle, _currentCheck, (char *)elementName, result, _cycle->nextErrorCount());
+		GC_CheckError error(objectDesc->object, _cycle, _currentCheck, (char *)elementName, result, nextErrorCount());
 		_reporter->report(&error);
 		_reporter->reportHeapWalkError(&error, _lastHeapObject1, _lastHeapObject2, _lastHeapObject3);
 		return J9MODRON_SLOT_ITERATOR_UNRECOVERABLE_ERROR;
@@ -1075,11 +1074,11 @@ GC_CheckEngine::checkSlotVMThread(J9JavaVM *javaVM, J9Object **objectIndirect, v
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_STACK_OBJECT == result) {
 		if (vmthreaditerator_state_monitor_records != vmthreadIterator->getState()) {
-			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), objectType);
+			GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), objectType);
 			_reporter->report(&error);
 		}
 	} else if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), objectType);
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), objectType);
 		_reporter->report(&error);
 	}
 	return J9MODRON_SLOT_ITERATOR_OK;
@@ -1104,7 +1103,7 @@ GC_CheckEngine::checkSlotStack(J9JavaVM *javaVM, J9Object **objectIndirect, J9VM
 		result = checkStackObject(javaVM, objectPtr);
 	}
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(vmThread, objectIndirect, stackLocation, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(vmThread, objectIndirect, stackLocation, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 
 		return J9MODRON_SLOT_ITERATOR_RECOVERABLE_ERROR;
@@ -1130,7 +1129,7 @@ GC_CheckEngine::checkSlotPool(J9JavaVM *javaVM, J9Object **objectIndirect, void
 	J9Object *objectPtr = *objectIndirect;
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount(), check_type_other);
+		GC_CheckError error(objectIndirectBase, objectIndirect, _cycle, _currentCheck, result, nextErrorCount(), check_type_other);
 		_reporter->report(&error);
 	}
 	return J9MODRON_SLOT_ITERATOR_OK;
@@ -1159,7 +1158,7 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 	
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1169,7 +1168,7 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 		J9MM_IterateRegionDescriptor objectRegion;
 		if (!findRegionForPointer(javaVM, objectPtr, &objectRegion)) {
 			/* shouldn't happen, since checkObjectIndirect() already verified this object */
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_NOT_FOUND, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_NOT_FOUND, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
@@ -1178,14 +1177,14 @@ GC_CheckEngine::checkSlotRememberedSet(J9JavaVM *javaVM, J9Object **objectIndire
 		UDATA regionType = ((MM_HeapRegionDescriptor*)objectRegion.id)->getTypeFlags();
 
 		if (regionType & MEMORY_TYPE_NEW) {
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_WRONG_SEGMENT, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_WRONG_SEGMENT, nextErrorCount());
 			_reporter->report(&error);
 			return J9MODRON_SLOT_ITERATOR_OK;
 		}
 
 		/* content of Remembered Set should be Old and Remembered */
 		if (!(extensions->isOld(objectPtr) && extensions->objectModel.isRemembered(objectPtr))) {
-			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_FLAGS, _cycle->nextErrorCount());
+			GC_CheckError error(puddle, objectIndirect, _cycle, _currentCheck, J9MODRON_GCCHK_RC_REMEMBERED_SET_FLAGS, nextErrorCount());
 			_reporter->report(&error);
 			_reporter->reportObjectHeader(&error, objectPtr, NULL);
 			return J9MODRON_SLOT_ITERATOR_OK;
@@ -1210,7 +1209,7 @@ GC_CheckEngine::checkSlotUnfinalizedList(J9JavaVM *javaVM, J9Object **objectIndi
 
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(currentList, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1233,7 +1232,7 @@ GC_CheckEngine::checkSlotFinalizableList(J9JavaVM *javaVM, J9Object **objectIndi
 
 	UDATA result = checkObjectIndirect(javaVM, objectPtr);
 	if (J9MODRON_GCCHK_RC_OK != result) {
-		GC_CheckError error(listManager, objectIndirect, _cycle, _currentCheck, result, _cycle->nextErrorCount());
+		GC_CheckError error(listManager, objectIndirect, _cycle, _currentCheck, result, nextErrorCount());
 		_reporter->report(&error);
 		return J9MODRON_SLOT_ITERATOR_OK;
 	}
@@ -1287,6 +1286,18 @@ GC_CheckEngine::startNewCheck(GC_Check *check)
 	clearPreviousObjects();
 }
 
+void
+GC_CheckEngine::startWorkerCheck(GC_CheckEngine *engine)
+{
+	_cycle = engine->_cycle;
+	_currentCheck = engine->_currentCheck;
+	_isWorkerEngine = true;
+	_workerErrorCount = 0;
+	clearPreviousObjects();
+	clearRegionDescription(&_regionDesc);
+	clearCheckedCache();
+}
+
 /**
  * Ensure the GC internal scope pointers refer to objects within the scope.
  *
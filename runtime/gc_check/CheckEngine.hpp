@@ -72,6 +72,8 @@ private:
 	J9Class *_checkedClassCacheAllowUndead[CLASS_CACHE_SIZE]; /**< A cache of recently checked classes, including checked undead classes */ 
 	enum { OBJECT_CACHE_SIZE = 61 }; /**< The size of the checked object caches (a prime number) */ 
 	J9Object *_checkedObjectCache[OBJECT_CACHE_SIZE]; /**< A cache of recently checked objects */ 
+	bool _isWorkerEngine; /**< true if this engine checks work units on a GC worker thread, see startWorkerCheck() */
+	UDATA _workerErrorCount; /**< Number of errors found by a worker engine in the current check */
 
 protected:
 
@@ -119,6 +121,14 @@ protected:
 
 public:
 	MMINLINE J9JavaVM *getJavaVM() { return _javaVM; };
+	MMINLINE GC_CheckReporter *getReporter() { return _reporter; };
+
+	/**
+	 * Number the next error found. A worker engine numbers its errors locally; they are renumbered
+	 * in the cycle when its reports are merged (see GC_CheckParallelTask).
+	 * @return the number of the error
+	 */
+	MMINLINE UDATA nextErrorCount() { return _isWorkerEngine ? ++_workerErrorCount : _cycle->nextErrorCount(); }
 
 	void clearPreviousObjects();
 	void pushPreviousObject(J9Object *objectPtr);
@@ -143,6 +153,13 @@ public:
 	void startCheckCycle(J9JavaVM *javaVM, GC_CheckCycle *checkCycle);
 	void endCheckCycle(J9JavaVM *javaVM);
 	void startNewCheck(GC_Check *check);	
+
+	/**
+	 * Prepare an engine to check work units of the current check of another engine on a GC worker thread.
+	 * The worker engine shares the cycle and the check of the engine, but has its own caches and reporter.
+	 * @param engine the engine running the check cycle
+	 */
+	void startWorkerCheck(GC_CheckEngine *engine);
 	bool isStackDumpAlwaysDisplayed();
 	void copyRegionDescription(J9MM_IterateRegionDescriptor* from, J9MM_IterateRegionDescriptor* to);
 	void clearRegionDescription(J9MM_IterateRegionDescriptor* toClear);
@@ -164,6 +181,8 @@ public:
 		, _lastHeapObject1()
 		, _lastHeapObject2()
 		, _lastHeapObject3()
+		, _isWorkerEngine(false)
+		, _workerErrorCount(0)
 #if defined(J9VM_GC_MODRON_SCAVENGER)	
 		, _scavengerBackout(false)
 		, _rsOverflowState(false)
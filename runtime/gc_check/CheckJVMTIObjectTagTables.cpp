@@ -59,10 +59,12 @@ GC_CheckJVMTIObjectTagTables::check()
 	if (NULL != jvmtiData) {
 		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
 		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				if (_engine->checkSlotPool(_javaVM, slotPtr, jvmtiEnv->objectTagTable) != J9MODRON_SLOT_ITERATOR_OK ){
-					return;
+			for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTables[shard]);
+				while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					if (_engine->checkSlotPool(_javaVM, slotPtr, jvmtiEnv->objectTagTables[shard]) != J9MODRON_SLOT_ITERATOR_OK ){
+						return;
+					}
 				}
 			}
 		}
@@ -81,9 +83,11 @@ GC_CheckJVMTIObjectTagTables::print()
 
 		GC_JVMTIObjectTagTableListIterator objectTagTableList(jvmtiData->environments);
 		while(NULL != (jvmtiEnv = (J9JVMTIEnv *)objectTagTableList.nextSlot())) {
-			GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTable);
-			while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
-				formatter.entry((void *)*slotPtr);
+			for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+				GC_JVMTIObjectTagTableIterator objectTagTableIterator(jvmtiEnv->objectTagTables[shard]);
+				while(NULL != (slotPtr = (J9Object **)objectTagTableIterator.nextSlot())) {
+					formatter.entry((void *)*slotPtr);
+				}
 			}
 		}
 
@@ -22,11 +22,18 @@
 
 #include "CheckEngine.hpp"
 #include "CheckObjectHeap.hpp"
+#include "CheckParallelTask.hpp"
+#include "EnvironmentBase.hpp"
 #include "MemorySubSpace.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
 #include "HeapIteratorAPI.h"
 
+/**
+ * Regions larger than this are split into several work units for a parallel check.
+ */
+#define CHECK_OBJECT_HEAP_WORK_UNIT_SIZE ((UDATA)4 * 1024 * 1024)
+
 /**
  * Private struct used as the user data for the iterator callbacks. The regionDesc will get set
  * by the region iterator callback.
@@ -44,6 +51,7 @@ static jvmtiIterationControl check_heapIteratorCallback(J9JavaVM* vm, J9MM_Itera
 static jvmtiIterationControl check_spaceIteratorCallback(J9JavaVM* vm, J9MM_IterateSpaceDescriptor* spaceDesc, void* userData);
 static jvmtiIterationControl check_regionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, void* userData);
 static jvmtiIterationControl check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDesc, void* userData);
+static BOOLEAN prepare_splitObjectCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, j9object_t object, void* userData);
 
 GC_Check *
 GC_CheckObjectHeap::newInstance(J9JavaVM *javaVM, GC_CheckEngine *engine)
@@ -75,6 +83,44 @@ GC_CheckObjectHeap::check()
 	_javaVM->memoryManagerFunctions->j9mm_iterate_heaps(_javaVM, _portLibrary, 0, check_heapIteratorCallback, &userData);
 }
 
+bool
+GC_CheckObjectHeap::prepareWorkUnits(MM_EnvironmentBase *env)
+{
+	/* The regions are split as the workers claim their work units, so no thread walks the heap up front */
+	_workUnits = _javaVM->memoryManagerFunctions->j9mm_start_work_units(_javaVM, _portLibrary, CHECK_OBJECT_HEAP_WORK_UNIT_SIZE, prepare_splitObjectCallback, _engine);
+	return NULL != _workUnits;
+}
+
+void
+GC_CheckObjectHeap::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine)
+{
+	J9MM_IterateWorkUnitDescriptor workUnit;
+
+	while (_javaVM->memoryManagerFunctions->j9mm_next_work_unit(_workUnits, &workUnit)) {
+		if (task->startWorkUnit(env, engine, workUnit.index)) {
+			/* the engine may rewrite the region description it is handed, so give it a copy */
+			J9MM_IterateRegionDescriptor regionDesc;
+			engine->copyRegionDescription(&workUnit.regionDesc, &regionDesc);
+
+			ObjectIteratorCallbackUserData userData;
+			userData.engine = engine;
+			userData.portLibrary = _portLibrary;
+			userData.regionDesc = &regionDesc;
+			/* as in the serial check, an error abandons the rest of the work unit */
+			_javaVM->memoryManagerFunctions->j9mm_iterate_work_unit_objects(_javaVM, _portLibrary, &workUnit, j9mm_iterator_flag_include_holes, check_objectIteratorCallback, &userData);
+		}
+	}
+}
+
+void
+GC_CheckObjectHeap::releaseWorkUnits(MM_EnvironmentBase *env)
+{
+	if (NULL != _workUnits) {
+		_javaVM->memoryManagerFunctions->j9mm_end_work_units(_workUnits);
+		_workUnits = NULL;
+	}
+}
+
 void
 GC_CheckObjectHeap::print()
 {
@@ -118,3 +164,22 @@ check_objectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectD
 	castUserData->engine->pushPreviousObject(objectDesc->object);
 	return JVMTI_ITERATION_CONTINUE;
 }
+
+/**
+ * Answer whether a region may be split past an object. Splitting stops at the first object
+ * the walk could not safely step over; the last work unit then covers the rest of the region
+ * and its check reports the problem.
+ */
+static BOOLEAN
+prepare_splitObjectCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDesc, j9object_t object, void* userData)
+{
+	GC_CheckEngine* engine = (GC_CheckEngine*)userData;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vm);
+
+	if (extensions->objectModel.isDeadObject(object)) {
+		UDATA size = extensions->objectModel.getSizeInBytesDeadObject(object);
+		UDATA top = (UDATA)regionDesc->regionStart + regionDesc->regionSize;
+		return (0 != size) && (size <= (top - (UDATA)object));
+	}
+	return J9MODRON_GCCHK_RC_OK == engine->checkJ9ClassPointer(vm, J9GC_J9OBJECT_CLAZZ_VM(object, vm), true);
+}
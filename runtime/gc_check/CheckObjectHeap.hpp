@@ -32,6 +32,7 @@
 #include "j9cfg.h"
 
 #include "Check.hpp"
+#include "HeapIteratorAPI.h"
 
 /**
  * 
@@ -39,6 +40,8 @@
 class GC_CheckObjectHeap : public GC_Check
 {
 private:
+	J9MM_WorkUnitIterator *_workUnits; /**< The work units of a parallel check, split as they are claimed */
+
 	virtual void check(); /**< run the check */
 	virtual void print(); /**< dump the check structure to tty */
 
@@ -48,8 +51,13 @@ public:
 
 	virtual const char *getCheckName() { return "HEAP"; };
 
+	virtual bool prepareWorkUnits(MM_EnvironmentBase *env);
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine);
+	virtual void releaseWorkUnits(MM_EnvironmentBase *env);
+
 	GC_CheckObjectHeap(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
+		, _workUnits(NULL)
 	{}
 };
 
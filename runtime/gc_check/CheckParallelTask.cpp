@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include <string.h>
+
+#include "CheckParallelTask.hpp"
+
+#include "AtomicOperations.hpp"
+#include "Check.hpp"
+#include "CheckEngine.hpp"
+#include "CheckReporterBuffer.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "ParallelDispatcher.hpp"
+
+GC_CheckParallelTask::GC_CheckParallelTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, GC_CheckEngine *engine, GC_Check *check)
+	: MM_ParallelTask(env, dispatcher)
+	, _javaVM(engine->getJavaVM())
+	, _engine(engine)
+	, _check(check)
+	, _vmState(env->getOmrVMThread()->vmState)
+	, _workers(NULL)
+	, _workerCount(dispatcher->threadCountMaximum())
+	, _abortWorkUnit(UDATA_MAX)
+{
+	_typeId = __FUNCTION__;
+}
+
+bool
+GC_CheckParallelTask::initialize(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(env)->getForge();
+	UDATA maxErrorsToReport = _engine->getReporter()->getMaxErrorsToReport();
+
+	_workers = (WorkerState *)forge->allocate(_workerCount * sizeof(WorkerState), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _workers) {
+		return false;
+	}
+	memset(_workers, 0, _workerCount * sizeof(WorkerState));
+	for (UDATA i = 0; i < _workerCount; i++) {
+		_workers[i].buffer = GC_CheckReporterBuffer::newInstance(_javaVM, maxErrorsToReport);
+		if (NULL == _workers[i].buffer) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void
+GC_CheckParallelTask::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _workers) {
+		for (UDATA i = 0; i < _workerCount; i++) {
+			if (NULL != _workers[i].buffer) {
+				_workers[i].buffer->kill();
+			}
+		}
+		MM_GCExtensions::getExtensions(env)->getForge()->free(_workers);
+		_workers = NULL;
+	}
+}
+
+void
+GC_CheckParallelTask::run(MM_EnvironmentBase *env)
+{
+	GC_CheckEngine engine(_javaVM, _workers[env->getWorkerID()].buffer);
+	engine.startWorkerCheck(_engine);
+	_check->checkWorkUnits(env, this, &engine);
+}
+
+bool
+GC_CheckParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env, GC_CheckEngine *engine)
+{
+	WorkerState *worker = &_workers[env->getWorkerID()];
+	UDATA workUnit = worker->nextWorkUnit;
+	worker->nextWorkUnit += 1;
+
+	return J9MODRON_HANDLE_NEXT_WORK_UNIT(env) && startWorkUnit(env, engine, workUnit);
+}
+
+bool
+GC_CheckParallelTask::startWorkUnit(MM_EnvironmentBase *env, GC_CheckEngine *engine, UDATA workUnit)
+{
+	if (workUnit <= _abortWorkUnit) {
+		_workers[env->getWorkerID()].buffer->startWorkUnit(workUnit);
+		/* the previous objects reported with heap walk errors are those of the work unit only */
+		engine->clearPreviousObjects();
+		return true;
+	}
+	return false;
+}
+
+void
+GC_CheckParallelTask::abortCheck(MM_EnvironmentBase *env)
+{
+	GC_CheckReporterBuffer *buffer = _workers[env->getWorkerID()].buffer;
+	UDATA workUnit = buffer->getCurrentWorkUnit();
+	buffer->recordAbort();
+
+	UDATA abortWorkUnit = _abortWorkUnit;
+	while ((workUnit < abortWorkUnit) && (abortWorkUnit != MM_AtomicOperations::lockCompareExchange(&_abortWorkUnit, abortWorkUnit, workUnit))) {
+		abortWorkUnit = _abortWorkUnit;
+	}
+}
+
+void
+GC_CheckParallelTask::dumpStack(MM_EnvironmentBase *env, J9VMThread *walkThread)
+{
+	_workers[env->getWorkerID()].buffer->recordDumpStack(walkThread);
+}
+
+void
+GC_CheckParallelTask::reportErrors(MM_EnvironmentBase *env)
+{
+	GC_CheckReporter *reporter = _engine->getReporter();
+	UDATA droppedEntries = 0;
+
+	for (UDATA i = 0; i < _workerCount; i++) {
+		droppedEntries += _workers[i].buffer->getDroppedEntryCount();
+	}
+
+	for (;;) {
+		/* Every work unit was checked by a single thread; find the thread with the lowest work unit left to replay */
+		WorkerState *worker = NULL;
+		UDATA workUnit = UDATA_MAX;
+		for (UDATA i = 0; i < _workerCount; i++) {
+			WorkerState *candidate = &_workers[i];
+			if (candidate->nextEntry < candidate->buffer->getEntryCount()) {
+				UDATA candidateWorkUnit = candidate->buffer->getEntryWorkUnit(candidate->nextEntry);
+				if (candidateWorkUnit < workUnit) {
+					workUnit = candidateWorkUnit;
+					worker = candidate;
+				}
+			}
+		}
+		if ((NULL == worker) || (workUnit > _abortWorkUnit)) {
+			break;
+		}
+
+		GC_CheckReporterBuffer *buffer = worker->buffer;
+		UDATA workerErrorNumber = 0;
+		UDATA errorNumber = 0;
+		while ((worker->nextEntry < buffer->getEntryCount()) && (workUnit == buffer->getEntryWorkUnit(worker->nextEntry))) {
+			UDATA index = worker->nextEntry;
+			worker->nextEntry += 1;
+			switch (buffer->getEntryType(index)) {
+			case GC_CheckReporterBuffer::entry_dump_stack:
+#if defined(J9VM_INTERP_VERBOSE)
+				if (NULL != _javaVM->verboseStackDump) {
+					_javaVM->verboseStackDump(buffer->getEntryThread(index), "bad object detected on stack");
+				}
+#endif /* J9VM_INTERP_VERBOSE */
+				break;
+			case GC_CheckReporterBuffer::entry_abort:
+				break;
+			case GC_CheckReporterBuffer::entry_forwarded_pointer:
+				buffer->replayEntry(index, 0, reporter);
+				break;
+			default:
+				/* all the entries of an error carry the number the worker gave it */
+				if (buffer->getEntryErrorNumber(index) != workerErrorNumber) {
+					workerErrorNumber = buffer->getEntryErrorNumber(index);
+					errorNumber = _engine->nextErrorCount();
+				}
+				buffer->replayEntry(index, errorNumber, reporter);
+				break;
+			}
+		}
+	}
+
+	if (0 != droppedEntries) {
+		PORT_ACCESS_FROM_JAVAVM(_javaVM);
+		j9tty_printf(PORTLIB, "  <gc check: %zu reports were lost, out of memory>\n", droppedEntries);
+	}
+}
+
+bool
+GC_CheckParallelTask::checkInParallel(MM_EnvironmentBase *env, GC_CheckEngine *engine, GC_Check *check)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_ParallelDispatcher *dispatcher = extensions->dispatcher;
+	bool result = false;
+
+	/* Tasks can not be nested, and metronome only dispatches incremental tasks */
+	if ((NULL != dispatcher)
+		&& (1 < dispatcher->threadCountMaximum())
+		&& (NULL == env->_currentTask)
+		&& !extensions->isMetronomeGC()
+		&& check->prepareWorkUnits(env)
+	) {
+		GC_CheckParallelTask task(env, dispatcher, engine, check);
+		if (task.initialize(env)) {
+			dispatcher->run(env, &task);
+			task.reportErrors(env);
+			result = true;
+		}
+		task.tearDown(env);
+		check->releaseWorkUnits(env);
+	}
+
+	return result;
+}
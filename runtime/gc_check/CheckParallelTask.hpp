@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKPARALLELTASK_HPP_)
+#define CHECKPARALLELTASK_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "ParallelTask.hpp"
+
+class GC_Check;
+class GC_CheckEngine;
+class GC_CheckReporterBuffer;
+class MM_EnvironmentBase;
+class MM_ParallelDispatcher;
+
+/**
+ * Run a check on the GC worker threads.
+ *
+ * The check splits the structure it verifies into work units (see GC_Check::prepareWorkUnits()). Every
+ * worker thread enumerates the work units in the same order and checks the ones it claims with its own
+ * engine, which records the reports in a per-thread buffer. Once all threads are done, the buffers are
+ * merged in work unit order and replayed to the reporter of the cycle, renumbering the errors, so that
+ * the output does not depend on the number of threads or on how the work units were distributed.
+ * @ingroup GC_Check
+ */
+class GC_CheckParallelTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct WorkerState {
+		GC_CheckReporterBuffer *buffer; /**< Reports of the thread */
+		UDATA nextWorkUnit; /**< Index of the next work unit enumerated by the thread */
+		UDATA nextEntry; /**< Next entry of the buffer to replay */
+	};
+
+	J9JavaVM *_javaVM;
+	GC_CheckEngine *_engine; /**< The engine running the check cycle */
+	GC_Check *_check; /**< The check being run */
+	UDATA _vmState; /**< The VM state of the thread running the check cycle */
+	WorkerState *_workers; /**< Per thread state, indexed by worker ID */
+	UDATA _workerCount;
+	volatile UDATA _abortWorkUnit; /**< The lowest work unit in which the check stopped, UDATA_MAX if it did not stop */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Replay the reports of all threads to the reporter of the cycle, in work unit order.
+	 */
+	void reportErrors(MM_EnvironmentBase *env);
+
+protected:
+public:
+	virtual UDATA getVMStateID() { return _vmState; }
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Enumerate the next work unit of the check; must be called by every thread for every work unit, in the same order.
+	 * @param engine the engine of the calling thread, which is reset for the work unit
+	 * @return true if the calling thread has to check the work unit
+	 */
+	bool handleNextWorkUnit(MM_EnvironmentBase *env, GC_CheckEngine *engine);
+
+	/**
+	 * Start a work unit claimed by the calling thread, for checks whose work units are claimed from a shared source
+	 * rather than enumerated with handleNextWorkUnit().
+	 * @param engine the engine of the calling thread, which is reset for the work unit
+	 * @param workUnit the position of the work unit in the order the reports are replayed in
+	 * @return true if the calling thread has to check the work unit, false if the check stopped in an earlier one
+	 */
+	bool startWorkUnit(MM_EnvironmentBase *env, GC_CheckEngine *engine, UDATA workUnit);
+
+	/**
+	 * Stop the check in the current work unit of the calling thread, as the single threaded check stops
+	 * at the first unrecoverable error. Reports of later work units are discarded.
+	 */
+	void abortCheck(MM_EnvironmentBase *env);
+
+	/**
+	 * Dump the stack of a thread once the reports of the current work unit have been replayed.
+	 */
+	void dumpStack(MM_EnvironmentBase *env, J9VMThread *walkThread);
+
+	/**
+	 * Run a check on the GC worker threads.
+	 * @param env the thread running the check cycle, which must be able to dispatch GC tasks
+	 * @param engine the engine running the check cycle
+	 * @param check the check to run
+	 * @return true if the check was run, false if it has to be run on the calling thread instead
+	 */
+	static bool checkInParallel(MM_EnvironmentBase *env, GC_CheckEngine *engine, GC_Check *check);
+
+	GC_CheckParallelTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, GC_CheckEngine *engine, GC_Check *check);
+};
+
+#endif /* CHECKPARALLELTASK_HPP_ */
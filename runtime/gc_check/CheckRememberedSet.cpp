@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "CheckEngine.hpp"
+#include "CheckParallelTask.hpp"
 #include "CheckRememberedSet.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
@@ -69,6 +70,35 @@ GC_CheckRememberedSet::check()
 	}
 }
 
+bool
+GC_CheckRememberedSet::prepareWorkUnits(MM_EnvironmentBase *env)
+{
+	/* no point checking if the scavenger wasn't turned on */
+	return _extensions->scavengerEnabled;
+}
+
+void
+GC_CheckRememberedSet::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine)
+{
+	/* every puddle is a work unit */
+	J9Object **slotPtr;
+	MM_SublistPuddle *puddle;
+	GC_RememberedSetIterator remSetIterator(&_extensions->rememberedSet);
+
+	while((puddle = remSetIterator.nextList()) != NULL) {
+		if (task->handleNextWorkUnit(env, engine)) {
+			GC_RememberedSetSlotIterator remSetSlotIterator(puddle);
+
+			while((slotPtr = (J9Object **)remSetSlotIterator.nextSlot()) != NULL) {
+				if (engine->checkSlotRememberedSet(_javaVM, slotPtr, puddle) != J9MODRON_SLOT_ITERATOR_OK ){
+					task->abortCheck(env);
+					return;
+				}
+			}
+		}
+	}
+}
+
 void
 GC_CheckRememberedSet::print()
 {
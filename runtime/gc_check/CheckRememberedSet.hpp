@@ -50,6 +50,9 @@ public:
 
 	virtual const char *getCheckName() { return "REMEMBERED SET"; };
 
+	virtual bool prepareWorkUnits(MM_EnvironmentBase *env);
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine);
+
 	GC_CheckRememberedSet(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
 	{}
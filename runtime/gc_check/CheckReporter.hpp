@@ -95,6 +95,11 @@ public:
 	 * Report the fact that a fatal error has occurred.
 	 */
 	virtual void reportFatalError(GC_CheckError *error) = 0;
+
+	/**
+	 * Report a forwarded pointer found while checking in the middle of a scavenge.
+	 */
+	virtual void reportForwardedPointer(J9Object *objectPtr, J9Object *forwardedPtr) = 0;
 	
 	/**
 	 * Report the fact that an error has occurred while walking the heap.
@@ -106,6 +111,7 @@ public:
 		GC_CheckElement previousObjectPtr3) = 0;
 
 	void setMaxErrorsToReport(UDATA count) { _maxErrorsToReport = count; }
+	UDATA getMaxErrorsToReport() { return _maxErrorsToReport; }
 	bool shouldReport(GC_CheckError *error) { 
 		return (_maxErrorsToReport == 0) || (error->_errorNumber <= _maxErrorsToReport);
 	}
@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#include <string.h>
+
+#include "CheckReporterBuffer.hpp"
+
+#include "CheckError.hpp"
+#include "GCExtensions.hpp"
+
+/**
+ * Initial number of entries of a buffer, doubled whenever it is full.
+ */
+#define GC_CHECK_REPORTER_BUFFER_INITIAL_ENTRIES 64
+
+/**
+ * Create a new instance of the buffer, reporting at most maxErrorsToReport errors (0 for all errors).
+ */
+GC_CheckReporterBuffer *
+GC_CheckReporterBuffer::newInstance(J9JavaVM *javaVM, UDATA maxErrorsToReport)
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(javaVM)->getForge();
+
+	GC_CheckReporterBuffer *reporter = (GC_CheckReporterBuffer *)forge->allocate(sizeof(GC_CheckReporterBuffer), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != reporter) {
+		reporter = new(reporter) GC_CheckReporterBuffer(javaVM);
+		reporter->setMaxErrorsToReport(maxErrorsToReport);
+	}
+	return reporter;
+}
+
+/**
+ * Destroy the instance of the reporter and its entries.
+ */
+void
+GC_CheckReporterBuffer::kill()
+{
+	MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+	if (NULL != _entries) {
+		forge->free(_entries);
+	}
+	forge->free(this);
+}
+
+/**
+ * Append an entry for the current work unit.
+ * @return the new entry, or NULL if the buffer could not be grown
+ */
+GC_CheckReporterBuffer::Entry *
+GC_CheckReporterBuffer::newEntry(EntryType type, GC_CheckError *error)
+{
+	if (_entryCount == _entryCapacity) {
+		MM_Forge *forge = MM_GCExtensions::getExtensions(_javaVM)->getForge();
+		UDATA newCapacity = (0 == _entryCapacity) ? GC_CHECK_REPORTER_BUFFER_INITIAL_ENTRIES : (_entryCapacity * 2);
+		Entry *newEntries = (Entry *)forge->allocate(newCapacity * sizeof(Entry), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL == newEntries) {
+			_droppedEntries += 1;
+			return NULL;
+		}
+		if (NULL != _entries) {
+			memcpy(newEntries, _entries, _entryCount * sizeof(Entry));
+			forge->free(_entries);
+		}
+		_entries = newEntries;
+		_entryCapacity = newCapacity;
+	}
+
+	Entry *entry = &_entries[_entryCount];
+	_entryCount += 1;
+	memset(entry, 0, sizeof(Entry));
+	entry->type = type;
+	entry->workUnit = _workUnit;
+	if (NULL != error) {
+		entry->object = error->_object;
+		entry->slot = error->_slot;
+		entry->stackLocation = error->_stackLocaition;
+		entry->check = error->_check;
+		entry->cycle = error->_cycle;
+		entry->elementName = error->_elementName;
+		entry->errorCode = error->_errorCode;
+		entry->errorNumber = error->_errorNumber;
+		entry->objectType = error->_objectType;
+	}
+	return entry;
+}
+
+/**
+ * Record an error.
+ * Errors numbered beyond the maximum to report are not recorded: their number in the cycle can only be larger.
+ */
+void
+GC_CheckReporterBuffer::report(GC_CheckError *error)
+{
+	if (shouldReport(error)) {
+		newEntry(entry_report, error);
+	}
+}
+
+void
+GC_CheckReporterBuffer::reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix)
+{
+	if (shouldReport(error)) {
+		Entry *entry = newEntry(entry_object_header, error);
+		if (NULL != entry) {
+			entry->pointer = objectPtr;
+			entry->prefix = prefix;
+		}
+	}
+}
+
+void
+GC_CheckReporterBuffer::reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix)
+{
+	if (shouldReport(error)) {
+		Entry *entry = newEntry(entry_class, error);
+		if (NULL != entry) {
+			entry->pointer = clazz;
+			entry->prefix = prefix;
+		}
+	}
+}
+
+void
+GC_CheckReporterBuffer::reportFatalError(GC_CheckError *error)
+{
+	newEntry(entry_fatal_error, error);
+}
+
+void
+GC_CheckReporterBuffer::reportForwardedPointer(J9Object *objectPtr, J9Object *forwardedPtr)
+{
+	Entry *entry = newEntry(entry_forwarded_pointer, NULL);
+	if (NULL != entry) {
+		entry->pointer = objectPtr;
+		entry->forwardedPointer = forwardedPtr;
+	}
+}
+
+void
+GC_CheckReporterBuffer::reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3)
+{
+	Entry *entry = newEntry(entry_heap_walk_error, error);
+	if (NULL != entry) {
+		entry->previous[0] = previousObjectPtr1;
+		entry->previous[1] = previousObjectPtr2;
+		entry->previous[2] = previousObjectPtr3;
+	}
+}
+
+void
+GC_CheckReporterBuffer::recordDumpStack(J9VMThread *walkThread)
+{
+	Entry *entry = newEntry(entry_dump_stack, NULL);
+	if (NULL != entry) {
+		entry->pointer = walkThread;
+	}
+}
+
+void
+GC_CheckReporterBuffer::recordAbort()
+{
+	newEntry(entry_abort, NULL);
+}
+
+void
+GC_CheckReporterBuffer::replayEntry(UDATA index, UDATA errorNumber, GC_CheckReporter *reporter)
+{
+	Entry *entry = &_entries[index];
+	GC_CheckError error(entry->object, entry->slot, entry->cycle, entry->check, entry->elementName, entry->errorCode, errorNumber, entry->objectType);
+	error._stackLocaition = entry->stackLocation;
+
+	switch (entry->type) {
+	case entry_report:
+		reporter->report(&error);
+		break;
+	case entry_object_header:
+		reporter->reportObjectHeader(&error, (J9Object *)entry->pointer, entry->prefix);
+		break;
+	case entry_class:
+		reporter->reportClass(&error, (J9Class *)entry->pointer, entry->prefix);
+		break;
+	case entry_fatal_error:
+		reporter->reportFatalError(&error);
+		break;
+	case entry_heap_walk_error:
+		reporter->reportHeapWalkError(&error, entry->previous[0], entry->previous[1], entry->previous[2]);
+		break;
+	case entry_forwarded_pointer:
+		reporter->reportForwardedPointer((J9Object *)entry->pointer, (J9Object *)entry->forwardedPointer);
+		break;
+	default:
+		break;
+	}
+}
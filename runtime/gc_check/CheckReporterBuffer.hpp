@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Check
+ */
+
+#if !defined(CHECKREPORTERBUFFER_HPP_)
+#define CHECKREPORTERBUFFER_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "CheckReporter.hpp"
+
+class GC_CheckError;
+
+/**
+ * Record reports in memory.
+ * Used by the GC worker threads of a parallel check: every report is recorded with the work unit
+ * it was found in, so that the reports of all threads can be replayed to the cycle's reporter in
+ * work unit order once the check is complete (see GC_CheckParallelTask).
+ * @ingroup GC_Check
+ */
+class GC_CheckReporterBuffer : public GC_CheckReporter
+{
+public:
+	enum EntryType {
+		entry_report = 0,
+		entry_object_header,
+		entry_class,
+		entry_fatal_error,
+		entry_heap_walk_error,
+		entry_forwarded_pointer,
+		entry_dump_stack, /**< a thread stack has to be dumped, see GC_CheckVMThreadStacks */
+		entry_abort /**< the check stopped in this work unit */
+	};
+
+private:
+	struct Entry {
+		EntryType type;
+		UDATA workUnit; /**< The work unit the entry was recorded in */
+		void *object; /**< The GC_CheckError fields */
+		void *slot;
+		const void *stackLocation;
+		GC_Check *check;
+		GC_CheckCycle *cycle;
+		const char *elementName;
+		UDATA errorCode;
+		UDATA errorNumber; /**< The number of the error in the recording thread */
+		UDATA objectType;
+		void *pointer; /**< The object, class, forwarded object or thread being reported */
+		void *forwardedPointer;
+		const char *prefix;
+		GC_CheckElement previous[3];
+	};
+
+	Entry *_entries;
+	UDATA _entryCount;
+	UDATA _entryCapacity;
+	UDATA _workUnit; /**< The work unit being checked by the recording thread */
+	UDATA _droppedEntries; /**< The number of entries which could not be recorded for lack of memory */
+
+public:
+	static GC_CheckReporterBuffer *newInstance(J9JavaVM *javaVM, UDATA maxErrorsToReport);
+	virtual void kill();
+	virtual void report(GC_CheckError *error);
+	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
+	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
+	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportForwardedPointer(J9Object *objectPtr, J9Object *forwardedPtr);
+	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
+
+	/**
+	 * Record the stack of a thread to be dumped.
+	 */
+	void recordDumpStack(J9VMThread *walkThread);
+
+	/**
+	 * Record that the check stopped in the current work unit.
+	 */
+	void recordAbort();
+
+	/**
+	 * Set the work unit the following entries are recorded in. Work units must be started in increasing order.
+	 */
+	void startWorkUnit(UDATA workUnit) { _workUnit = workUnit; }
+	UDATA getCurrentWorkUnit() { return _workUnit; }
+
+	UDATA getEntryCount() { return _entryCount; }
+	UDATA getDroppedEntryCount() { return _droppedEntries; }
+	EntryType getEntryType(UDATA index) { return _entries[index].type; }
+	UDATA getEntryWorkUnit(UDATA index) { return _entries[index].workUnit; }
+	UDATA getEntryErrorNumber(UDATA index) { return _entries[index].errorNumber; }
+	J9VMThread *getEntryThread(UDATA index) { return (J9VMThread *)_entries[index].pointer; }
+
+	/**
+	 * Replay a recorded report.
+	 * @param index the index of the entry, which must not be an entry_dump_stack or entry_abort entry
+	 * @param errorNumber the number of the error in the cycle
+	 * @param reporter the reporter to replay the entry to
+	 */
+	void replayEntry(UDATA index, UDATA errorNumber, GC_CheckReporter *reporter);
+
+	/**
+	 * Create a new CheckReporterBuffer object
+	 */
+	GC_CheckReporterBuffer(J9JavaVM *javaVM)
+		: GC_CheckReporter(javaVM)
+		, _entries(NULL)
+		, _entryCount(0)
+		, _entryCapacity(0)
+		, _workUnit(0)
+		, _droppedEntries(0)
+	{}
+
+private:
+	Entry *newEntry(EntryType type, GC_CheckError *error);
+};
+
+#endif /* CHECKREPORTERBUFFER_HPP_ */
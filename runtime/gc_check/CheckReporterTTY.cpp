@@ -259,6 +259,17 @@ GC_CheckReporterTTY::reportFatalError(GC_CheckError *error)
 	j9tty_printf(PORTLIB, "  <gc check (%zu): Cannot resolve problem detected on heap, aborting check>\n", error->_errorNumber);
 }
 
+/**
+ * Print a forwarded pointer found in the middle of a scavenge to the terminal.
+ */
+void
+GC_CheckReporterTTY::reportForwardedPointer(J9Object *objectPtr, J9Object *forwardedPtr)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	j9tty_printf(PORTLIB, "  <gc check: found forwarded pointer %p -> %p>\n", objectPtr, forwardedPtr);
+}
+
 /**
  * Print to the terminal that an error has occurred while walking the heap.
  */
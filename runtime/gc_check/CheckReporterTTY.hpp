@@ -52,6 +52,7 @@ public:
 	virtual void reportObjectHeader(GC_CheckError *error, J9Object *objectPtr, const char *prefix);
 	virtual void reportClass(GC_CheckError *error, J9Class *clazz, const char *prefix);
 	virtual void reportFatalError(GC_CheckError *error);
+	virtual void reportForwardedPointer(J9Object *objectPtr, J9Object *forwardedPtr);
 	virtual void reportHeapWalkError(GC_CheckError *error, GC_CheckElement previousObjectPtr1, GC_CheckElement previousObjectPtr2, GC_CheckElement previousObjectPtr3);
 
 	/**
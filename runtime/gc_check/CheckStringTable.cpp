@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "CheckEngine.hpp"
+#include "CheckParallelTask.hpp"
 #include "CheckStringTable.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
@@ -61,6 +62,32 @@ GC_CheckStringTable::check()
 	}
 }
 
+bool
+GC_CheckStringTable::prepareWorkUnits(MM_EnvironmentBase *env)
+{
+	/* every table is a work unit */
+	return MM_GCExtensions::getExtensions(_javaVM)->getStringTable()->getTableCount() > 1;
+}
+
+void
+GC_CheckStringTable::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine)
+{
+	MM_StringTable *stringTable = MM_GCExtensions::getExtensions(_javaVM)->getStringTable();
+	for (UDATA tableIndex = 0; tableIndex < stringTable->getTableCount(); tableIndex++) {
+		if (task->handleNextWorkUnit(env, engine)) {
+			GC_HashTableIterator stringTableIterator(stringTable->getTable(tableIndex));
+			J9Object **slot;
+
+			while((slot = (J9Object **)stringTableIterator.nextSlot()) != NULL) {
+				if (engine->checkSlotPool(_javaVM, slot, stringTable->getTable(tableIndex)) != J9MODRON_SLOT_ITERATOR_OK ){
+					task->abortCheck(env);
+					return;
+				}
+			}
+		}
+	}
+}
+
 void
 GC_CheckStringTable::print()
 {
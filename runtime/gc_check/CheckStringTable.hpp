@@ -48,6 +48,9 @@ public:
 
 	virtual const char *getCheckName() { return "STRING TABLE"; };
 
+	virtual bool prepareWorkUnits(MM_EnvironmentBase *env);
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine);
+
 	GC_CheckStringTable(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
 	{}
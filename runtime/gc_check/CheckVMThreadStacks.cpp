@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "CheckEngine.hpp"
+#include "CheckParallelTask.hpp"
 #include "CheckVMThreadStacks.hpp"
 #include "ModronTypes.hpp"
 #include "ScanFormatter.hpp"
@@ -109,6 +110,31 @@ GC_CheckVMThreadStacks::check()
 	}
 }
 
+void
+GC_CheckVMThreadStacks::checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine)
+{
+	/* every thread is a work unit */
+	GC_VMThreadListIterator vmThreadListIterator(_javaVM);
+	J9VMThread *walkThread;
+#if defined(J9VM_INTERP_VERBOSE)
+	bool doStackDump = engine->isStackDumpAlwaysDisplayed();
+#endif /* J9VM_INTERP_VERBOSE */
+
+	while((walkThread = vmThreadListIterator.nextVMThread()) != NULL) {
+		if (task->handleNextWorkUnit(env, engine)) {
+			checkStackIteratorData localData = { engine, walkThread, 0 };
+			GC_VMThreadStackSlotIterator::scanSlots(walkThread, walkThread, (void *)&localData, checkStackSlotIterator, false, false);
+
+#if defined(J9VM_INTERP_VERBOSE)
+			if (_javaVM->verboseStackDump && (doStackDump || (localData.numberOfErrors > 0))) {
+				/* the dump is deferred so that it follows the reports of this thread */
+				task->dumpStack(env, walkThread);
+			}
+#endif /* J9VM_INTERP_VERBOSE */
+		}
+	}
+}
+
 void
 GC_CheckVMThreadStacks::print()
 {
@@ -65,6 +65,9 @@ public:
 
 	virtual const char *getCheckName() { return "THREAD STACKS"; };
 
+	virtual bool prepareWorkUnits(MM_EnvironmentBase *env) { return true; }
+	virtual void checkWorkUnits(MM_EnvironmentBase *env, GC_CheckParallelTask *task, GC_CheckEngine *engine);
+
 	GC_CheckVMThreadStacks(J9JavaVM *javaVM, GC_CheckEngine *engine) :
 		GC_Check(javaVM, engine)
 	{}
@@ -107,7 +107,8 @@ MM_JNICriticalRegion::releaseAccess(J9VMThread* vmThread, UDATA* accessMask)
 
 		omrthread_monitor_enter(vm->exclusiveAccessMutex);
 
-		U_64 timeNow = VM_VMAccess::updateExclusiveVMAccessStats(vmThread, vm, PORTLIB);
+		UDATA reason = J9_ARE_ANY_BITS_SET(currentAccess, J9_PUBLIC_FLAGS_VM_ACCESS) ? J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE : J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL;
+		U_64 timeNow = VM_VMAccess::updateExclusiveVMAccessStats(vmThread, vm, PORTLIB, reason);
 
 		if(0 != (currentAccess & J9_PUBLIC_FLAGS_VM_ACCESS)) {
 			if (!J9_ARE_ANY_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_NOT_COUNTED_BY_EXCLUSIVE)) {
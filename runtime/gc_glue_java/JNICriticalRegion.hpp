@@ -155,7 +155,7 @@ public:
 					omrthread_monitor_t const exclusiveAccessMutex = vm->exclusiveAccessMutex;
 					omrthread_monitor_enter_using_threadId(exclusiveAccessMutex, osThread);
 					PORT_ACCESS_FROM_JAVAVM(vm);
-					U_64 const timeNow = VM_VMAccess::updateExclusiveVMAccessStats(vmThread, vm, PORTLIB);
+					U_64 const timeNow = VM_VMAccess::updateExclusiveVMAccessStats(vmThread, vm, PORTLIB, J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL);
 					if (--vm->jniCriticalResponseCount == 0) {
 						VM_VMAccess::respondToExclusiveRequest(vmThread, vm, PORTLIB, timeNow, J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL);
 					}
@@ -109,6 +109,7 @@
 #include "StackSlotValidator.hpp"
 #include "StandardAccessBarrier.hpp"
 #include "SublistFragment.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Task.hpp"
 #include "UnfinalizedObjectBuffer.hpp"
@@ -196,6 +197,10 @@ MM_ScavengerDelegate::workerSetupForGC_clearEnvironmentLangStats(MM_EnvironmentB
 void
 MM_ScavengerDelegate::reportScavengeEnd(MM_EnvironmentBase * envBase, bool scavengeSuccessful)
 {
+	if (!scavengeSuccessful && (NULL != _extensions->stringDeduplicator)) {
+		/* Backout returned the queued Strings to new space */
+		_extensions->stringDeduplicator->discardCandidates(envBase);
+	}
 }
 
 void
@@ -393,6 +398,14 @@ MM_ScavengerDelegate::getObjectScanner(MM_EnvironmentStandard *env, omrobjectptr
 	GC_ObjectScanner *objectScanner = NULL;
 	J9Class *clazzPtr = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
 
+	MM_StringDeduplicator *stringDeduplicator = _extensions->stringDeduplicator;
+	if ((NULL != stringDeduplicator) && (SCAN_REASON_SCAVENGE == reason) && GC_ObjectScanner::isHeapScan(flags)) {
+		/* Strings scanned outside of new space have just been tenured by this scavenge */
+		if (stringDeduplicator->isCandidateClass(clazzPtr) && !_extensions->scavenger->isObjectInNewSpace(objectPtr)) {
+			stringDeduplicator->queueCandidate(env, objectPtr);
+		}
+	}
+
 	switch(_extensions->objectModel.getScanType(clazzPtr)) {
 	case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
 		_extensions->scavenger->deepScan(env, objectPtr, clazzPtr->selfReferencingField1, clazzPtr->selfReferencingField2);
@@ -141,6 +141,22 @@ typedef struct J9MM_IterateRegionDescriptor {
 	UDATA regionSize; /**< The size (in bytes) of the region */
 } J9MM_IterateRegionDescriptor;
 
+/**
+ * A range of a region, handed out by j9mm_next_work_unit. The range starts with an object and ends at
+ * the start of the next range of the region, or at the end of the region.
+ */
+typedef struct J9MM_IterateWorkUnitDescriptor {
+	J9MM_IterateRegionDescriptor regionDesc; /**< The region holding the range */
+	void *base; /**< Address of the first object of the range */
+	void *top; /**< Address of the end of the range */
+	UDATA index; /**< Position of the range in the walk, ranges are handed out in address order from 0 */
+} J9MM_IterateWorkUnitDescriptor;
+
+/**
+ * The state of a walk of the heap split in work units, see j9mm_start_work_units.
+ */
+typedef struct J9MM_WorkUnitIterator J9MM_WorkUnitIterator;
+
 typedef struct J9MM_IterateObjectDescriptor {
 	UDATA id; /**< Unique identifier */
 	UDATA size; /**< Size in bytes that the object (or hole) consumes */
@@ -285,6 +301,65 @@ j9mm_iterate_all_ownable_synchronizer_objects(J9VMThread *vmThread, J9PortLibrar
 jvmtiIterationControl
 j9mm_iterate_all_continuation_objects(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9VMThread *vmThread, J9MM_IterateObjectDescriptor *object, void *userData), void *userData);
 
+/**
+ * Answer the number of threads j9mm_iterate_all_objects_parallel may call back on.
+ * The workerID passed to the callback is lower than this count.
+ */
+UDATA
+j9mm_parallel_iteration_thread_count(J9VMThread *vmThread);
+
+/**
+ * Walk all objects for the given VM on the GC worker threads, call user provided function.
+ * The function is called concurrently and the objects are not reported in address order.
+ * Falls back to a walk on the calling thread, with workerID 0, when the worker threads can not be used.
+ * The caller must hold exclusive VM access.
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if a call of the function aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_all_objects_parallel(J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData);
+
+/**
+ * Start a walk of the heap split in work units, which threads claim with j9mm_next_work_unit.
+ * Regions larger than workUnitSize are split on demand as the work units are claimed, so no thread
+ * walks the heap before the work units are handed out. The caller must hold exclusive VM access
+ * until the walk is ended with j9mm_end_work_units.
+ * @param workUnitSize Regions holding objects are split at the first object found past every workUnitSize bytes
+ * @param func Called on every object stepped over while a region is split, with the region holding it, or NULL.
+ * Splitting stops at the first object func returns FALSE for, and the rest of the region is handed out as a single work unit.
+ * @param userData Pointer to storage for userData.
+ * @return the walk, or NULL if it could not be allocated
+ */
+J9MM_WorkUnitIterator *
+j9mm_start_work_units(J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA workUnitSize, BOOLEAN (*func)(J9JavaVM *vm, J9MM_IterateRegionDescriptor *regionDesc, j9object_t object, void *userData), void *userData);
+
+/**
+ * Claim the next work unit of a walk. May be called concurrently by several threads.
+ * @param workUnit Out parameter initialized with the work unit claimed
+ * @return TRUE if a work unit was claimed, FALSE once all work units have been handed out
+ */
+BOOLEAN
+j9mm_next_work_unit(J9MM_WorkUnitIterator *iterator, J9MM_IterateWorkUnitDescriptor *workUnit);
+
+/**
+ * Free the state of a walk started by j9mm_start_work_units.
+ */
+void
+j9mm_end_work_units(J9MM_WorkUnitIterator *iterator);
+
+/**
+ * Walk all objects of a work unit, call user provided function.
+ * @param workUnit The work unit, as handed out by j9mm_next_work_unit
+ * @param flags The flags describing the walk (0 or j9mm_iterator_flag_include_holes)
+ * @param func The function to call on each object descriptor.
+ * @param userData Pointer to storage for userData.
+ * @return JVMTI_ITERATION_ABORT if a call of the function aborted the walk, JVMTI_ITERATION_CONTINUE otherwise
+ */
+jvmtiIterationControl
+j9mm_iterate_work_unit_objects(J9JavaVM *vm, J9PortLibrary *portLibrary, J9MM_IterateWorkUnitDescriptor *workUnit, UDATA flags, jvmtiIterationControl (*func)(J9JavaVM *vm, J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData);
+
 /**
  * Shortcut specific for Segregated heap to find the page the pointer belongs to
  * This is instead of iterating pages, which may be very time consuming.
@@ -243,6 +243,19 @@ j9gc_get_objects_pending_finalization_count(J9JavaVM *javaVM)
 {
 	return MM_GCExtensions::getExtensions(javaVM)->finalizeListManager->getJobCount();
 }
+
+/**
+ * Call func with the finalizer statistics of every class that had objects finalized since startup or has
+ * objects on the finalize queue.  Must be called with VM access.
+ * @param[in] vmThread the calling thread
+ * @param[in] func called with the class, its objects on the finalize queue and its objects finalized since startup
+ * @param[in] userData passed to func
+ */
+void
+j9gc_finalizer_statistics_do(J9VMThread *vmThread, void (*func)(J9VMThread *vmThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData), void *userData)
+{
+	MM_GCExtensions::getExtensions(vmThread->javaVM)->finalizeListManager->finalizerStatisticsDo(vmThread, func, userData);
+}
 #endif /* J9VM_GC_FINALIZATION */
 
 UDATA
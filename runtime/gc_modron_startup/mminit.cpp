@@ -104,6 +104,7 @@
 #include "RememberedSetSATB.hpp"
 #endif /* J9VM_GC_REALTIME */
 #include "Scavenger.hpp"
+#include "StringDeduplicator.hpp"
 #include "StringTable.hpp"
 #include "Validator.hpp"
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
@@ -532,9 +533,21 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+	if (extensions->stringDeduplication) {
+		/* Strings are queued as they are copied out of the nursery, so only the copying young collectors are supported */
+		if ((gc_policy_balanced == extensions->configurationOptions._gcPolicy)
+			|| ((gc_policy_gencon == extensions->configurationOptions._gcPolicy) && !extensions->isConcurrentScavengerEnabled())
+		) {
+			extensions->stringDeduplicator = MM_StringDeduplicator::newInstance(&env);
+			if (NULL == extensions->stringDeduplicator) {
+				goto error_no_memory;
+			}
+		}
+	}
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	if (extensions->gcOnIdle) {
-		/* Enable idle tuning only for gencon policy */
+	if (extensions->gcOnIdle || extensions->memoryPressureHeapRelease) {
+		/* Enable idle tuning and releasing heap on memory pressure only for gencon policy */
 		if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
 			extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
 			if (NULL == extensions->idleGCManager) {
@@ -680,6 +693,20 @@ gcStartupHeapManagement(J9JavaVM *javaVM)
 		result = JNI_ENOMEM;
 	}
 
+	if ((JNI_OK == result) && (NULL != extensions->stringDeduplicator)) {
+		/* Deduplication is an optimization only; without its thread no candidates are queued */
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->stringDeduplicator->startThread(&env);
+	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if ((JNI_OK == result) && (NULL != extensions->idleGCManager)) {
+		/* Releasing heap on memory pressure is an optimization only; it is silently off outside a cgroup v2 */
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->idleGCManager->startPressureMonitor(&env);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	if (JNI_OK != result) {
 		PORT_ACCESS_FROM_JAVAVM(javaVM);
 		extensions->getGlobalCollector()->collectorShutdown(extensions);
@@ -806,6 +833,18 @@ gcShutdownHeapManagement(J9JavaVM *javaVM)
 	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
 	MM_Collector *globalCollector = extensions->getGlobalCollector();
 
+	if (NULL != extensions->stringDeduplicator) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->stringDeduplicator->stopThread(&env);
+	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != extensions->idleGCManager) {
+		MM_EnvironmentBase env(javaVM->omrVM);
+		extensions->idleGCManager->stopPressureMonitor(&env);
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_FINALIZATION)
 	/* wait for finalizer shutdown */
 	j9gc_finalizer_shutdown(javaVM);
@@ -1496,6 +1496,26 @@ gcParseXXArguments(J9JavaVM *vm)
 		}
 	}
 
+	{
+		IDATA useStringDeduplicationIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:+UseStringDeduplication", NULL);
+		IDATA noUseStringDeduplicationIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:-UseStringDeduplication", NULL);
+		if (useStringDeduplicationIndex != noUseStringDeduplicationIndex) {
+			/* At least one option is set. Find the right most one. */
+			extensions->stringDeduplication = (useStringDeduplicationIndex > noUseStringDeduplicationIndex);
+		}
+	}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	{
+		IDATA releaseHeapOnMemoryPressureIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:+ReleaseHeapOnMemoryPressure", NULL);
+		IDATA noReleaseHeapOnMemoryPressureIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:-ReleaseHeapOnMemoryPressure", NULL);
+		if (releaseHeapOnMemoryPressureIndex != noReleaseHeapOnMemoryPressureIndex) {
+			/* At least one option is set. Find the right most one. */
+			extensions->memoryPressureHeapRelease = (releaseHeapOnMemoryPressureIndex > noReleaseHeapOnMemoryPressureIndex);
+		}
+	}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 	{
 		IDATA adaptiveGCThreadingIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:+AdaptiveGCThreading", NULL);
 		IDATA noAdaptiveGCThreadingIndex = FIND_AND_CONSUME_VMARG(EXACT_MATCH, "-XX:-AdaptiveGCThreading", NULL);
@@ -289,6 +289,26 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 		
+		/* parse the number of slots prefetched ahead while copy-forward scans mixed objects */
+		if (try_scan(&scan_start, "tarokCopyForwardPrefetchDistance=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokCopyForwardPrefetchDistance), "tarokCopyForwardPrefetchDistance=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+
+			continue;
+		}
+
+		/* parse the maximum number of RememberedSet Card Lists switching to a card bitmap */
+		if (try_scan(&scan_start, "tarokRememberedSetCardListBitmapCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &(extensions->tarokRememberedSetCardListBitmapCount), "tarokRememberedSetCardListBitmapCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+
+			continue;
+		}
+
 		if (try_scan(&scan_start, "tarokRememberedSetCardListSize=")) {
 			if(!scan_udata_memory_size_helper(vm, &scan_start, &(extensions->tarokRememberedSetCardListSize), "tarokRememberedSetCardListSize=")) {
 				returnValue = JNI_EINVAL;
@@ -1266,6 +1286,46 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->pageFragmentationCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+
+		if (try_scan(&scan_start, "memoryPressurePollInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->memoryPressurePollInterval, "memoryPressurePollInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->memoryPressurePollInterval) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryPressureThreshold=")) {
+			UDATA percentage = 0;
+			if(!scan_udata_helper(vm, &scan_start, &percentage, "memoryPressureThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((0 == percentage) || (percentage > 100)) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->memoryPressureThreshold = percentage * 100;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "memoryHighThreshold=")) {
+			UDATA percentage = 0;
+			if(!scan_udata_helper(vm, &scan_start, &percentage, "memoryHighThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((0 == percentage) || (percentage > 100)) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->memoryHighThreshold = percentage;
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
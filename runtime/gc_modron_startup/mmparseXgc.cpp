@@ -1196,6 +1196,29 @@ j9gc_initialize_parse_gc_colon(J9JavaVM *javaVM, char **scan_start)
 		goto _exit;
 	}
 
+	if (try_scan(scan_start, "asyncLoggingBufferSize=")) {
+		if (!scan_udata_memory_size_helper(javaVM, scan_start, &extensions->asyncLoggingBufferSize, "asyncLoggingBufferSize=")) {
+			goto _error;
+		}
+		if (0 == extensions->asyncLoggingBufferSize) {
+			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_VALUE_MUST_BE_ABOVE, "asyncLoggingBufferSize=", (UDATA)0);
+			goto _error;
+		}
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "asyncLogging")) {
+		extensions->asyncLogging = true;
+		goto _exit;
+	}
+
+	if (try_scan(scan_start, "verboseLogFileSize=")) {
+		if (!scan_udata_memory_size_helper(javaVM, scan_start, &extensions->verboseLogFileSize, "verboseLogFileSize=")) {
+			goto _error;
+		}
+		goto _exit;
+	}
+
 #if defined(J9VM_GC_VLHGC) || defined(J9VM_GC_GENERATIONAL)
 	/* currently only used by VLHGC -- consider promoting if required for other policies */
 	if (try_scan(scan_start, "numa")) {
@@ -1328,6 +1351,18 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "finalizeWorkerThreads=")) {
+			if (!scan_udata_helper(vm, &scan_start, &extensions->finalizeWorkerThreads, "finalizeWorkerThreads=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if ((extensions->finalizeWorkerThreads < 1) || (extensions->finalizeWorkerThreads > FINALIZE_WORKER_THREADS_MAX)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "-Xgc:finalizeWorkerThreads", (UDATA)1, (UDATA)FINALIZE_WORKER_THREADS_MAX);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* J9VM_GC_FINALIZATION */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
@@ -1546,6 +1581,11 @@ gcParseXgcArguments(J9JavaVM *vm, char *optArg)
 				extensions->verboseNewFormat = false;
 				continue;
 			}
+			if (try_scan(&scan_start, "json")) {
+				extensions->verboseNewFormat = true;
+				extensions->verboseJSONFormat = true;
+				continue;
+			}
 			/* verbose format not recognised J9NLS_GC_OPTION_UNKNOWN*/
 			/* j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTION_VERBOSEFORMAT_UNKNOWN_FORMAT, *scan_start); */
 			j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTION_UNKNOWN, error_scan);
@@ -302,6 +302,10 @@ MM_RealtimeRootScanner::scanMonitorLookupCaches(MM_EnvironmentBase *env)
 			}
 		}
 	}
+	/* The shard caches are small and clearing a slot is idempotent, so every thread may clear them */
+	for (UDATA tableIndex = 0; tableIndex < _javaVM->monitorTableCount; tableIndex++) {
+		scanMonitorTableShardLookupCache(&_javaVM->monitorTableShards[tableIndex]);
+	}
 	reportScanningEnded(RootScannerEntity_MonitorLookupCaches);
 }
 
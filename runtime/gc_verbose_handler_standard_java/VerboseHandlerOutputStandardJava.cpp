@@ -25,6 +25,8 @@
 #include "omrgcconsts.h"
 #include "mmhook.h"
 #include "gcutils.h"
+#include "j9cp.h"
+#include "rommeth.h"
 
 #include "CollectionStatisticsStandard.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -36,11 +38,16 @@
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseHandlerJava.hpp"
+#include "VMAccess.hpp"
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+static void verboseHandlerExclusiveAccessSynchronized(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerMemoryPressureHeapRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -91,6 +98,10 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED, verboseHandlerExclusiveAccessSynchronized, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_HEAP_RELEASE, verboseHandlerMemoryPressureHeapRelease, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -103,6 +114,10 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED, verboseHandlerExclusiveAccessSynchronized, NULL);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_MEMORY_PRESSURE_HEAP_RELEASE, verboseHandlerMemoryPressureHeapRelease, NULL);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -199,6 +214,102 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+void
+MM_VerboseHandlerOutputStandardJava::handleExclusiveAccessSynchronized(J9HookInterface **hook, uintptr_t eventNum, void *eventData)
+{
+	J9VMExclusiveAccessSynchronizedEvent *event = (J9VMExclusiveAccessSynchronizedEvent *)eventData;
+	J9VMThread *requester = event->currentThread;
+	uint64_t slowTolerance = _extensions->isMetronomeGC() ? J9_EXCLUSIVE_SLOW_TOLERANCE_REALTIME : J9_EXCLUSIVE_SLOW_TOLERANCE_STANDARD;
+
+	/* Only attribute requests which were slow to synchronize, as reported by the slow exclusive warning */
+	if ((NULL == requester) || (event->syncTime <= (slowTolerance * 1000))) {
+		return;
+	}
+
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(requester->omrVMThread);
+	MM_VerboseManager *manager = getManager();
+	MM_VerboseWriterChain *writer = manager->getWriterChain();
+	J9ExclusiveAccessSyncStats *stats = event->stats;
+	uintptr_t recorded = OMR_MIN(stats->responderCount, J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS);
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), j9time_current_time_millis());
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<exclusive-sync %s type=\"%s\" timems=\"%llu.%03llu\" responders=\"%zu\">",
+			tagTemplate, event->safePoint ? "safepoint" : "exclusive", event->syncTime / 1000, event->syncTime % 1000, stats->responderCount);
+	/* Responses are recorded in the order they arrive, so walk back from the latest one */
+	for (uintptr_t i = 1; i <= recorded; i++) {
+		J9ExclusiveAccessResponder *responder = &stats->responders[(stats->responderCount - i) % J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS];
+		uint64_t responseTime = j9time_hires_delta(0, responder->responseTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		const char *reason = (J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL == responder->reason) ? "JNICritical" : "Exclusive Access";
+		char threadNameBuffer[64];
+		const char *threadName = "exited thread";
+
+		if (NULL != responder->thread) {
+			getThreadName(threadNameBuffer, sizeof(threadNameBuffer), responder->thread->omrVMThread);
+			threadName = threadNameBuffer;
+		}
+		/* The method is only recorded for threads in a bytecode frame, or found from the JIT return address.
+		 * Otherwise the pc is the type of the special frame the thread was in.
+		 */
+		J9Class *methodClass = (NULL == responder->method) ? NULL : J9_CLASS_FROM_METHOD(responder->method);
+		/* Internal methods (such as the JNI call-in method) have no class to name them by */
+		if (NULL == methodClass) {
+			if (NULL == responder->jitPC) {
+				writer->formatAndOutput(env, 1, "<responder threadname=\"%s\" timems=\"%llu.%03llu\" reason=\"%s\" flags=\"0x%zx\" pc=\"%p\" />",
+						threadName, responseTime / 1000, responseTime % 1000, reason, responder->publicFlags, responder->pc);
+			} else {
+				writer->formatAndOutput(env, 1, "<responder threadname=\"%s\" timems=\"%llu.%03llu\" reason=\"%s\" flags=\"0x%zx\" pc=\"%p\" jitpc=\"%p\" />",
+						threadName, responseTime / 1000, responseTime % 1000, reason, responder->publicFlags, responder->pc, responder->jitPC);
+			}
+		} else {
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(responder->method);
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(methodClass->romClass);
+			J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+			writer->formatAndOutput(env, 1, "<responder threadname=\"%s\" timems=\"%llu.%03llu\" reason=\"%s\" flags=\"0x%zx\" method=\"%.*s.%.*s%.*s\" %s=\"%p\" />",
+					threadName, responseTime / 1000, responseTime % 1000, reason, responder->publicFlags,
+					(int)J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+					(int)J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+					(int)J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature),
+					(NULL == responder->jitPC) ? "pc" : "jitpc", (NULL == responder->jitPC) ? (void *)responder->pc : responder->jitPC);
+		}
+	}
+	writer->formatAndOutput(env, 0, "</exclusive-sync>");
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleMemoryPressureHeapRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData)
+{
+	MM_MemoryPressureHeapReleaseEvent *event = (MM_MemoryPressureHeapReleaseEvent *)eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseManager *manager = getManager();
+	MM_VerboseWriterChain *writer = manager->getWriterChain();
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	char tagTemplate[200];
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), j9time_current_time_millis());
+
+	enterAtomicReportingBlock();
+	if (U_64_MAX == event->memoryHigh) {
+		writer->formatAndOutput(env, 0, "<memory-pressure-release %s pressure=\"%zu.%02zu\" memorycurrent=\"%llu\" memoryhigh=\"max\" bytesreturned=\"%llu\" durationms=\"%llu.%03llu\" />",
+			tagTemplate, event->pressure / 100, event->pressure % 100, event->memoryCurrent,
+			event->bytesReturned, event->duration / 1000, event->duration % 1000);
+	} else {
+		writer->formatAndOutput(env, 0, "<memory-pressure-release %s pressure=\"%zu.%02zu\" memorycurrent=\"%llu\" memoryhigh=\"%llu\" bytesreturned=\"%llu\" durationms=\"%llu.%03llu\" />",
+			tagTemplate, event->pressure / 100, event->pressure % 100, event->memoryCurrent, event->memoryHigh,
+			event->bytesReturned, event->duration / 1000, event->duration % 1000);
+	}
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
@@ -256,6 +367,8 @@ MM_VerboseHandlerOutputStandardJava::handleScavengeEndInternal(MM_EnvironmentBas
 		outputReferenceInfo(env, 1, "phantom", &scavengerJavaStats->_phantomReferenceStats, 0, 0);
 
 		outputMonitorReferenceInfo(env, 1, scavengerJavaStats->_monitorReferenceCandidates, scavengerJavaStats->_monitorReferenceCleared);
+
+		MM_VerboseHandlerJava::outputStringDeduplicationInfo(_manager, env, 1);
 	}
 }
 #endif /*defined(J9VM_GC_MODRON_SCAVENGER) */
@@ -339,3 +452,17 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, uintptr_t eventNum, void *ev
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerExclusiveAccessSynchronized(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleExclusiveAccessSynchronized(hook, eventNum, eventData);
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerMemoryPressureHeapRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleMemoryPressureHeapRelease(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
@@ -110,6 +110,24 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleSlowExclusive(J9HookInterface **hook, uintptr_t eventNum, void *eventData);
+
+	/**
+	 * Write the slowest responders of an exclusive or safe point access request which was slow to synchronize.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleExclusiveAccessSynchronized(J9HookInterface **hook, uintptr_t eventNum, void *eventData);
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Report the heap released by the memory pressure monitor.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleMemoryPressureHeapRelease(J9HookInterface **hook, uintptr_t eventNum, void *eventData);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARDJAVA_HPP_ */
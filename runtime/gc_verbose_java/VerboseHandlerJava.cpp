@@ -33,6 +33,7 @@
 #include "VerboseWriterChain.hpp"
 #include "GCExtensions.hpp"
 #include "FinalizeListManager.hpp"
+#include "StringDeduplicator.hpp"
 #include "VerboseBuffer.hpp"
 
 void
@@ -49,6 +50,29 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	if((0 != systemCount) || (0 != defaultCount) || (0 != referenceCount) || (0 != classloaderCount)) {
 		manager->getWriterChain()->formatAndOutput(env, indent, "<pending-finalizers system=\"%zu\" default=\"%zu\" reference=\"%zu\" classloader=\"%zu\" />", systemCount, defaultCount, referenceCount, classloaderCount);
 	}
+
+	/* drain times are in microseconds, from the lists becoming non-empty until the finalizer threads emptied them */
+	UDATA lastDrainTime = (UDATA)finalizeListManager->getLastDrainTime();
+	if (0 != lastDrainTime) {
+		UDATA maxDrainTime = (UDATA)finalizeListManager->getMaxDrainTime();
+		manager->getWriterChain()->formatAndOutput(env, indent, "<finalizer-drain threads=\"%zu\" last=\"%zu\" max=\"%zu\" />", extensions->finalizeWorkerThreads, lastDrainTime, maxDrainTime);
+	}
+}
+
+void
+MM_VerboseHandlerJava::outputStringDeduplicationInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	MM_StringDeduplicator *stringDeduplicator = MM_GCExtensions::getExtensions(env)->stringDeduplicator;
+
+	if (NULL != stringDeduplicator) {
+		UDATA queued = 0;
+		UDATA dropped = 0;
+		UDATA deduplicated = 0;
+		UDATA bytesSaved = 0;
+		UDATA tableSize = 0;
+		stringDeduplicator->getStatistics(&queued, &dropped, &deduplicated, &bytesSaved, &tableSize);
+		manager->getWriterChain()->formatAndOutput(env, indent, "<string-deduplication queued=\"%zu\" dropped=\"%zu\" deduplicated=\"%zu\" bytessaved=\"%zu\" tablesize=\"%zu\" />", queued, dropped, deduplicated, bytesSaved, tableSize);
+	}
 }
 
 bool
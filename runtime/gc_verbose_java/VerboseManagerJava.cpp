@@ -43,6 +43,7 @@
 #endif /* defined(J9VM_GC_VLHGC) */
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
+#include "VerboseWriterFileLoggingAsync.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterHook.hpp"
@@ -123,6 +124,9 @@ MM_VerboseWriter *
 MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, char *filename, UDATA fileCount, UDATA iterations)
 {
 	MM_VerboseWriter *writer = NULL;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	/* JSON Lines are only produced by the asynchronous writer */
+	bool asyncFileLogging = extensions->asyncLogging || extensions->verboseJSONFormat;
 
 	switch(type) {
 	case VERBOSE_WRITER_STANDARD_STREAM:
@@ -138,7 +142,11 @@ MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, ch
 		break;
 
 	case VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS:
-		writer = MM_VerboseWriterFileLoggingSynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (asyncFileLogging) {
+			writer = MM_VerboseWriterFileLoggingAsync::newInstance(env, this, type, filename, fileCount);
+		} else {
+			writer = MM_VerboseWriterFileLoggingSynchronous::newInstance(env, this, filename, fileCount, iterations);
+		}
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
@@ -151,7 +159,11 @@ MM_VerboseManagerJava::createWriter(MM_EnvironmentBase *env, WriterType type, ch
 		break;
 
 	case VERBOSE_WRITER_FILE_LOGGING_BUFFERED:
-		writer = MM_VerboseWriterFileLoggingBuffered::newInstance(env, this, filename, fileCount, iterations);
+		if (asyncFileLogging) {
+			writer = MM_VerboseWriterFileLoggingAsync::newInstance(env, this, type, filename, fileCount);
+		} else {
+			writer = MM_VerboseWriterFileLoggingBuffered::newInstance(env, this, filename, fileCount, iterations);
+		}
 		if (NULL == writer) {
 			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
 			if (NULL != writer) {
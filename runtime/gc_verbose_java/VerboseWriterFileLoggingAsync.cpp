@@ -0,0 +1,876 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "omrport.h"
+
+#include <string.h>
+
+#include "VerboseWriterFileLoggingAsync.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+#include "Math.hpp"
+#include "VerboseManager.hpp"
+
+/** Text output at the start and end of an XML log file */
+#define VERBOSEGC_ASYNC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define VERBOSEGC_ASYNC_FOOTER "</verbosegc>\n"
+
+MM_VerboseWriterFileLoggingAsync::MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type)
+	: MM_VerboseWriter(type)
+	, _manager(manager)
+	, _omrVM(env->getOmrVM())
+	, _filename(NULL)
+	, _fileCount(2)
+	, _maxFileSize(0)
+	, _json(false)
+	, _logFileDescriptor(-1)
+	, _bytesWritten(0)
+	, _fileMutex(NULL)
+	, _ring(NULL)
+	, _ringSize(0)
+	, _reserved(0)
+	, _consumed(0)
+	, _monitor(NULL)
+	, _writerThread(NULL)
+	, _threadState(THREAD_STATE_INITIAL)
+	, _workPending(false)
+	, _producersWaiting(0)
+	, _outputBuffer(NULL)
+	, _outputUsed(0)
+	, _depth(0)
+	, _skippedDepth(0)
+{
+	/* no implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsync instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsync.
+ */
+MM_VerboseWriterFileLoggingAsync *
+MM_VerboseWriterFileLoggingAsync::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type, char *filename, uintptr_t fileCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsync *agent = (MM_VerboseWriterFileLoggingAsync *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsync), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsync(env, manager, type);
+		if (!agent->initialize(env, filename, fileCount)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsync instance, opens the log and starts the writer thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (!MM_VerboseWriter::initialize(env)) {
+		return false;
+	}
+
+	_json = extensions->verboseJSONFormat;
+	_maxFileSize = extensions->verboseLogFileSize;
+	_fileCount = OMR_MAX(fileCount, 2);
+
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "MM_VerboseWriterFileLoggingAsync::_monitor")) {
+		_monitor = NULL;
+		return false;
+	}
+	if (0 != omrthread_monitor_init_with_name(&_fileMutex, 0, "MM_VerboseWriterFileLoggingAsync::_fileMutex")) {
+		_fileMutex = NULL;
+		return false;
+	}
+
+	/* records are located by masking, so the ring size is a power of two */
+	_ringSize = VERBOSE_ASYNC_MINIMUM_RING_SIZE;
+	while ((_ringSize < extensions->asyncLoggingBufferSize) && (0 != (_ringSize << 1))) {
+		_ringSize <<= 1;
+	}
+	_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _ring) {
+		return false;
+	}
+	memset(_ring, 0, _ringSize);
+
+	_outputBuffer = (char *)extensions->getForge()->allocate(VERBOSE_ASYNC_OUTPUT_BUFFER_SIZE, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _outputBuffer) {
+		return false;
+	}
+
+	if (!expandFilename(env, filename)) {
+		return false;
+	}
+
+	if (!openFile(env, _manager->fileOpenMode(env))) {
+		return false;
+	}
+
+	return startWriterThread(env);
+}
+
+/**
+ * Stops the writer thread and frees the resources of the writer.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+
+	if (NULL != _monitor) {
+		stopWriterThread();
+	}
+	closeFile();
+
+	if (NULL != _ring) {
+		extensions->getForge()->free(_ring);
+		_ring = NULL;
+	}
+	if (NULL != _outputBuffer) {
+		extensions->getForge()->free(_outputBuffer);
+		_outputBuffer = NULL;
+	}
+	if (NULL != _filename) {
+		extensions->getForge()->free(_filename);
+		_filename = NULL;
+	}
+	if (NULL != _fileMutex) {
+		omrthread_monitor_destroy(_fileMutex);
+		_fileMutex = NULL;
+	}
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+
+	MM_VerboseWriter::tearDown(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::expandFilename(MM_EnvironmentBase *env, const char *filename)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	bool result = false;
+
+	J9StringTokens *tokens = omrstr_create_tokens(omrtime_current_time_millis());
+	if (NULL != tokens) {
+		uintptr_t length = omrstr_subst_tokens(NULL, 0, filename, tokens);
+		char *expanded = (char *)extensions->getForge()->allocate(length, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+		if (NULL != expanded) {
+			omrstr_subst_tokens(expanded, length, filename, tokens);
+			if (NULL != _filename) {
+				extensions->getForge()->free(_filename);
+			}
+			_filename = expanded;
+			result = true;
+		}
+		omrstr_free_tokens(tokens);
+	}
+
+	return result;
+}
+
+/**
+ * Opens the log file, creating the directories on its path if needed, and prints the header.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsync::openFile(MM_EnvironmentBase *env, int32_t mode)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	_logFileDescriptor = omrfile_open(_filename, EsOpenRead | EsOpenWrite | EsOpenCreate | mode, 0666);
+	if (-1 == _logFileDescriptor) {
+		/* This may have failed due to directories in the path not being available */
+		char *cursor = _filename;
+		while (NULL != (cursor = strchr(++cursor, DIR_SEPARATOR))) {
+			*cursor = '\0';
+			omrfile_mkdir(_filename);
+			*cursor = DIR_SEPARATOR;
+		}
+
+		_logFileDescriptor = omrfile_open(_filename, EsOpenRead | EsOpenWrite | EsOpenCreate | mode, 0666);
+		if (-1 == _logFileDescriptor) {
+			_manager->handleFileOpenError(env, _filename);
+			return false;
+		}
+	}
+
+	_bytesWritten = 0;
+	if (EsOpenAppend == (mode & EsOpenAppend)) {
+		I_64 length = omrfile_seek(_logFileDescriptor, 0, EsSeekEnd);
+		if (length > 0) {
+			_bytesWritten = (uintptr_t)length;
+		}
+	}
+
+	if (!_json) {
+		J9JavaVM *javaVM = (J9JavaVM *)_omrVM->_language_vm;
+		const char *version = javaVM->memoryManagerFunctions->omrgc_get_version(_omrVM);
+		char header[256];
+		uintptr_t length = omrstr_printf(header, sizeof(header), VERBOSEGC_ASYNC_HEADER, version);
+		omrfile_write_text(_logFileDescriptor, header, length);
+		_bytesWritten += length;
+	}
+
+	return true;
+}
+
+/**
+ * Flushes the pending output, prints the footer and closes the log file.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::closeFile()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	if (-1 != _logFileDescriptor) {
+		flushOutput();
+		if (!_json) {
+			omrfile_write_text(_logFileDescriptor, VERBOSEGC_ASYNC_FOOTER, strlen(VERBOSEGC_ASYNC_FOOTER));
+		}
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+/**
+ * Rename the current log to <_filename>.1, shifting the older logs up by one and dropping the
+ * oldest, and start a new log.
+ * @note called by the writer thread while holding _fileMutex, between two top level elements
+ */
+void
+MM_VerboseWriterFileLoggingAsync::rotateFile()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	MM_EnvironmentBase env(_omrVM);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(_omrVM);
+	uintptr_t nameLength = strlen(_filename) + 32;
+
+	closeFile();
+
+	char *from = (char *)extensions->getForge()->allocate(nameLength * 2, MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL != from) {
+		char *to = from + nameLength;
+		omrstr_printf(to, nameLength, "%s.%zu", _filename, _fileCount - 1);
+		omrfile_unlink(to);
+		for (uintptr_t i = _fileCount - 1; i > 1; i--) {
+			omrstr_printf(from, nameLength, "%s.%zu", _filename, i - 1);
+			omrstr_printf(to, nameLength, "%s.%zu", _filename, i);
+			omrfile_move(from, to);
+		}
+		omrstr_printf(to, nameLength, "%s.1", _filename);
+		omrfile_move(_filename, to);
+		extensions->getForge()->free(from);
+	}
+
+	/* if the file can not be renamed it is truncated, so the log still does not grow without limit */
+	openFile(&env, EsOpenTruncate);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations)
+{
+	bool result = false;
+
+	omrthread_monitor_enter(_fileMutex);
+	closeFile();
+	_fileCount = OMR_MAX(fileCount, 2);
+	if (expandFilename(env, filename)) {
+		result = openFile(env, EsOpenTruncate);
+	}
+	omrthread_monitor_exit(_fileMutex);
+
+	if (result && (THREAD_STATE_TERMINATED == _threadState)) {
+		/* the stream was closed before, the writer thread has to be started again */
+		_threadState = THREAD_STATE_INITIAL;
+		result = startWriterThread(env);
+	}
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::endOfCycle(MM_EnvironmentBase *env)
+{
+	wakeWriterThread();
+}
+
+/**
+ * Writes out everything in the ring, stops the writer thread and closes the log.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::closeStream(MM_EnvironmentBase *env)
+{
+	stopWriterThread();
+
+	omrthread_monitor_enter(_fileMutex);
+	closeFile();
+	omrthread_monitor_exit(_fileMutex);
+}
+
+/**
+ * Copy the string into the ring. This is the only work done on the thread producing the output, unless
+ * the string is too large for the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsync::outputString(MM_EnvironmentBase *env, const char *string)
+{
+	uintptr_t length = strlen(string);
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(RingRecord), sizeof(RingRecord) + length);
+	uintptr_t mask = _ringSize - 1;
+	uintptr_t reserved = 0;
+	uintptr_t padding = 0;
+
+	if (recordSize > (_ringSize / 2)) {
+		/* a whole stanza, such as the initialized one with many vmargs, may not fit in the ring */
+		outputStringSynchronously(string, length);
+		return;
+	}
+
+	while (true) {
+		reserved = _reserved;
+		uintptr_t offset = reserved & mask;
+		padding = ((offset + recordSize) > _ringSize) ? (_ringSize - offset) : 0;
+		if ((reserved + padding + recordSize - _consumed) > _ringSize) {
+			/* the ring is full - wait for the writer rather than losing part of an event */
+			if (!waitForRoom()) {
+				return;
+			}
+		} else if (reserved == MM_AtomicOperations::lockCompareExchange(&_reserved, reserved, reserved + padding + recordSize)) {
+			break;
+		}
+	}
+
+	if (0 != padding) {
+		RingRecord *paddingRecord = (RingRecord *)(_ring + (reserved & mask));
+		paddingRecord->size = (uint32_t)padding;
+		paddingRecord->length = 0;
+		MM_AtomicOperations::storeSync();
+		paddingRecord->state = RECORD_PADDING;
+	}
+
+	RingRecord *record = (RingRecord *)(_ring + ((reserved + padding) & mask));
+	record->size = (uint32_t)recordSize;
+	record->length = (uint32_t)length;
+	memcpy(record + 1, string, length);
+	MM_AtomicOperations::storeSync();
+	record->state = RECORD_COMMITTED;
+
+	if ((reserved + padding + recordSize - _consumed) > (_ringSize / 2)) {
+		wakeWriterThread();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::outputStringSynchronously(const char *string, uintptr_t length)
+{
+	uintptr_t reserved = _reserved;
+
+	omrthread_monitor_enter(_fileMutex);
+	/* the records reserved before this string are written first; their producers commit them without blocking */
+	drainRing();
+	while ((intptr_t)(_consumed - reserved) < 0) {
+		omrthread_yield();
+		drainRing();
+	}
+	processRecord(string, length);
+	flushOutput();
+	omrthread_monitor_exit(_fileMutex);
+
+	omrthread_monitor_enter(_monitor);
+	if (0 != _producersWaiting) {
+		omrthread_monitor_notify_all(_monitor);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::wakeWriterThread()
+{
+	omrthread_monitor_enter(_monitor);
+	_workPending = true;
+	omrthread_monitor_notify_all(_monitor);
+	omrthread_monitor_exit(_monitor);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::waitForRoom()
+{
+	bool result = false;
+
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_STATE_RUNNING == _threadState) {
+		_workPending = true;
+		_producersWaiting += 1;
+		omrthread_monitor_notify_all(_monitor);
+		omrthread_monitor_wait_timed(_monitor, 10, 0);
+		_producersWaiting -= 1;
+		result = true;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::startWriterThread(MM_EnvironmentBase *env)
+{
+	J9JavaVM *javaVM = (J9JavaVM *)env->getLanguageVM();
+	bool result = false;
+
+	omrthread_monitor_enter(_monitor);
+	if (0 == omrthread_create(&_writerThread, javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0, writerThreadProc, this)) {
+		while (THREAD_STATE_INITIAL == _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+		result = (THREAD_STATE_RUNNING == _threadState);
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return result;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::stopWriterThread()
+{
+	omrthread_monitor_enter(_monitor);
+	if (THREAD_STATE_RUNNING == _threadState) {
+		_threadState = THREAD_STATE_TERMINATE_REQUESTED;
+		omrthread_monitor_notify_all(_monitor);
+		while (THREAD_STATE_TERMINATED != _threadState) {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsync::writerThreadProc(void *arg)
+{
+	MM_VerboseWriterFileLoggingAsync *writer = (MM_VerboseWriterFileLoggingAsync *)arg;
+
+	omrthread_set_name(omrthread_self(), "GC verbose writer");
+	writer->runWriterThread();
+
+	omrthread_monitor_enter(writer->_monitor);
+	writer->_threadState = THREAD_STATE_TERMINATED;
+	omrthread_monitor_notify_all(writer->_monitor);
+	omrthread_exit(writer->_monitor);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::runWriterThread()
+{
+	omrthread_monitor_enter(_monitor);
+	_threadState = THREAD_STATE_RUNNING;
+	omrthread_monitor_notify_all(_monitor);
+
+	while (true) {
+		if (!_workPending && (THREAD_STATE_RUNNING == _threadState)) {
+			omrthread_monitor_wait_timed(_monitor, VERBOSE_ASYNC_WAKE_INTERVAL_MILLIS, 0);
+		}
+		_workPending = false;
+		bool terminate = (THREAD_STATE_RUNNING != _threadState);
+		omrthread_monitor_exit(_monitor);
+
+		omrthread_monitor_enter(_fileMutex);
+		drainRing();
+		flushOutput();
+		omrthread_monitor_exit(_fileMutex);
+
+		omrthread_monitor_enter(_monitor);
+		if (0 != _producersWaiting) {
+			omrthread_monitor_notify_all(_monitor);
+		}
+		if (terminate) {
+			break;
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::drainRing()
+{
+	uintptr_t mask = _ringSize - 1;
+	uintptr_t consumed = _consumed;
+
+	while (consumed != _reserved) {
+		RingRecord *record = (RingRecord *)(_ring + (consumed & mask));
+		uint32_t state = record->state;
+		if (RECORD_FREE == state) {
+			/* a producer is still copying this record */
+			break;
+		}
+		MM_AtomicOperations::loadSync();
+
+		uintptr_t size = record->size;
+		if (RECORD_COMMITTED == state) {
+			processRecord((const char *)(record + 1), record->length);
+		}
+
+		/* clear the record so that a stale state is never read in its place once the ring wraps */
+		memset(record, 0, size);
+		consumed += size;
+		MM_AtomicOperations::storeSync();
+		_consumed = consumed;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::processRecord(const char *string, uintptr_t length)
+{
+	const char *cursor = string;
+	const char *end = string + length;
+
+	if (!_json) {
+		appendOutput(string, length);
+	}
+
+	/* the elements are tracked in both formats, so that the log is only rotated between top level elements */
+	while (cursor < end) {
+		if ('<' == *cursor) {
+			const char *tagEnd = (const char *)memchr(cursor, '>', end - cursor);
+			if (NULL == tagEnd) {
+				/* tags are never split across strings */
+				break;
+			}
+			processTag(cursor + 1, tagEnd);
+			cursor = tagEnd + 1;
+		} else {
+			const char *textEnd = (const char *)memchr(cursor, '<', end - cursor);
+			if (NULL == textEnd) {
+				textEnd = end;
+			}
+			processText(cursor, textEnd - cursor);
+			cursor = textEnd;
+		}
+	}
+
+	if ((0 == _depth) && (0 == _skippedDepth) && (0 != _maxFileSize) && ((_bytesWritten + _outputUsed) >= _maxFileSize)) {
+		rotateFile();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::processTag(const char *tag, const char *end)
+{
+	if ((tag >= end) || ('?' == *tag) || ('!' == *tag)) {
+		/* declarations and comments */
+		return;
+	}
+
+	if ('/' == *tag) {
+		closeElement();
+		return;
+	}
+
+	bool selfClosing = ('/' == end[-1]);
+	if (selfClosing) {
+		end -= 1;
+	}
+
+	const char *nameEnd = tag;
+	while ((nameEnd < end) && (' ' != *nameEnd) && ('\t' != *nameEnd) && ('\n' != *nameEnd) && ('\r' != *nameEnd)) {
+		nameEnd += 1;
+	}
+
+	openElement(tag, nameEnd - tag, nameEnd, end);
+	if (selfClosing) {
+		closeElement();
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::startChild()
+{
+	if (0 != _depth) {
+		if (_hasChildren[_depth - 1]) {
+			appendOutput(",", 1);
+		} else {
+			appendOutput(",\"children\":[");
+			_hasChildren[_depth - 1] = true;
+		}
+	}
+}
+
+/**
+ * Start the JSON object of an element, {"element":"<name>","<attribute>":<value>,...
+ */
+void
+MM_VerboseWriterFileLoggingAsync::openElement(const char *name, uintptr_t nameLength, const char *attributes, const char *end)
+{
+	if ((0 != _skippedDepth) || (VERBOSE_ASYNC_MAXIMUM_DEPTH == _depth)) {
+		_skippedDepth += 1;
+		return;
+	}
+
+	if (_json) {
+		startChild();
+		appendOutput("{\"element\":");
+		appendJSONString(name, nameLength);
+
+		const char *cursor = attributes;
+		while (cursor < end) {
+			while ((cursor < end) && ((' ' == *cursor) || ('\t' == *cursor) || ('\n' == *cursor) || ('\r' == *cursor))) {
+				cursor += 1;
+			}
+			const char *attributeName = cursor;
+			while ((cursor < end) && ('=' != *cursor) && (' ' != *cursor)) {
+				cursor += 1;
+			}
+			const char *attributeNameEnd = cursor;
+			if (((cursor + 1) >= end) || ('=' != *cursor)) {
+				break;
+			}
+			char quote = cursor[1];
+			if (('"' != quote) && ('\'' != quote)) {
+				break;
+			}
+			const char *value = cursor + 2;
+			const char *valueEnd = (const char *)memchr(value, quote, end - value);
+			if (NULL == valueEnd) {
+				break;
+			}
+			appendOutput(",", 1);
+			appendJSONString(attributeName, attributeNameEnd - attributeName);
+			appendOutput(":", 1);
+			appendJSONValue(value, valueEnd - value);
+			cursor = valueEnd + 1;
+		}
+	}
+
+	_hasChildren[_depth] = false;
+	_depth += 1;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::closeElement()
+{
+	if (0 != _skippedDepth) {
+		_skippedDepth -= 1;
+		return;
+	}
+	if (0 == _depth) {
+		/* the close of an element opened before the log was started */
+		return;
+	}
+
+	_depth -= 1;
+	if (_json) {
+		if (_hasChildren[_depth]) {
+			appendOutput("]", 1);
+		}
+		appendOutput("}", 1);
+		if (0 == _depth) {
+			appendOutput("\n", 1);
+		}
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::processText(const char *text, uintptr_t length)
+{
+	const char *end = text + length;
+
+	while ((text < end) && ((' ' == *text) || ('\t' == *text) || ('\n' == *text) || ('\r' == *text))) {
+		text += 1;
+	}
+	while ((text < end) && ((' ' == end[-1]) || ('\t' == end[-1]) || ('\n' == end[-1]) || ('\r' == end[-1]))) {
+		end -= 1;
+	}
+
+	if (_json && (text < end) && (0 == _skippedDepth)) {
+		startChild();
+		appendOutput("{\"text\":");
+		appendJSONString(text, end - text);
+		appendOutput("}", 1);
+		if (0 == _depth) {
+			appendOutput("\n", 1);
+		}
+	}
+}
+
+/**
+ * Append the string as a JSON string, replacing the XML entities the verbose output escapes
+ */
+void
+MM_VerboseWriterFileLoggingAsync::appendJSONString(const char *string, uintptr_t length)
+{
+	static const struct {
+		const char *entity;
+		uintptr_t length;
+		char character;
+	} entities[] = {
+		{ "amp;", 4, '&' },
+		{ "lt;", 3, '<' },
+		{ "gt;", 3, '>' },
+		{ "quot;", 5, '"' },
+		{ "apos;", 5, '\'' }
+	};
+	static const char hexDigits[] = "0123456789abcdef";
+	const char *end = string + length;
+
+	appendOutput("\"", 1);
+	while (string < end) {
+		char character = *string++;
+		if ('&' == character) {
+			for (uintptr_t i = 0; i < (sizeof(entities) / sizeof(entities[0])); i++) {
+				if (((uintptr_t)(end - string) >= entities[i].length) && (0 == strncmp(string, entities[i].entity, entities[i].length))) {
+					character = entities[i].character;
+					string += entities[i].length;
+					break;
+				}
+			}
+		}
+
+		if (('"' == character) || ('\\' == character)) {
+			char escaped[2] = { '\\', character };
+			appendOutput(escaped, sizeof(escaped));
+		} else if ((unsigned char)character < 0x20) {
+			char escaped[6] = { '\\', 'u', '0', '0', hexDigits[(character >> 4) & 0xF], hexDigits[character & 0xF] };
+			appendOutput(escaped, sizeof(escaped));
+		} else {
+			appendOutput(&character, 1);
+		}
+	}
+	appendOutput("\"", 1);
+}
+
+/**
+ * Append an attribute value, as a JSON number or literal when it is one and as a string otherwise
+ */
+void
+MM_VerboseWriterFileLoggingAsync::appendJSONValue(const char *value, uintptr_t length)
+{
+	if (isJSONNumber(value, length)
+		|| ((4 == length) && (0 == strncmp(value, "true", 4)))
+		|| ((5 == length) && (0 == strncmp(value, "false", 5)))
+	) {
+		appendOutput(value, length);
+	} else {
+		appendJSONString(value, length);
+	}
+}
+
+bool
+MM_VerboseWriterFileLoggingAsync::isJSONNumber(const char *value, uintptr_t length)
+{
+	uintptr_t i = 0;
+
+	if ((i < length) && ('-' == value[i])) {
+		i += 1;
+	}
+	if (i == length) {
+		return false;
+	}
+	if ('0' == value[i]) {
+		/* JSON does not allow leading zeroes */
+		i += 1;
+	} else if (('1' <= value[i]) && ('9' >= value[i])) {
+		while ((i < length) && ('0' <= value[i]) && ('9' >= value[i])) {
+			i += 1;
+		}
+	} else {
+		return false;
+	}
+	if ((i < length) && ('.' == value[i])) {
+		i += 1;
+		uintptr_t digits = i;
+		while ((i < length) && ('0' <= value[i]) && ('9' >= value[i])) {
+			i += 1;
+		}
+		if (digits == i) {
+			return false;
+		}
+	}
+	if ((i < length) && (('e' == value[i]) || ('E' == value[i]))) {
+		i += 1;
+		if ((i < length) && (('+' == value[i]) || ('-' == value[i]))) {
+			i += 1;
+		}
+		uintptr_t digits = i;
+		while ((i < length) && ('0' <= value[i]) && ('9' >= value[i])) {
+			i += 1;
+		}
+		if (digits == i) {
+			return false;
+		}
+	}
+
+	return (i == length);
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::appendOutput(const char *string)
+{
+	appendOutput(string, strlen(string));
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::appendOutput(const char *string, uintptr_t length)
+{
+	if ((_outputUsed + length) > VERBOSE_ASYNC_OUTPUT_BUFFER_SIZE) {
+		flushOutput();
+		if (length > VERBOSE_ASYNC_OUTPUT_BUFFER_SIZE) {
+			OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+			if (-1 != _logFileDescriptor) {
+				omrfile_write_text(_logFileDescriptor, string, length);
+			}
+			_bytesWritten += length;
+			return;
+		}
+	}
+
+	memcpy(_outputBuffer + _outputUsed, string, length);
+	_outputUsed += length;
+}
+
+void
+MM_VerboseWriterFileLoggingAsync::flushOutput()
+{
+	if (0 != _outputUsed) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		if (-1 != _logFileDescriptor) {
+			omrfile_write_text(_logFileDescriptor, _outputBuffer, _outputUsed);
+		}
+		_bytesWritten += _outputUsed;
+		_outputUsed = 0;
+	}
+}
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNC_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNC_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriter.hpp"
+
+#define VERBOSE_ASYNC_MINIMUM_RING_SIZE (64 * 1024)
+#define VERBOSE_ASYNC_OUTPUT_BUFFER_SIZE (64 * 1024)
+#define VERBOSE_ASYNC_MAXIMUM_DEPTH 64
+#define VERBOSE_ASYNC_WAKE_INTERVAL_MILLIS 1000
+
+class MM_EnvironmentBase;
+class MM_VerboseManager;
+
+/**
+ * Output agent which writes verbosegc output to a file from a background thread.
+ *
+ * The thread producing the output only copies each string into a ring, so the cost of formatting and
+ * writing the log is kept out of the GC pause. The writer thread writes the output either as it was
+ * produced, or converted to JSON Lines (one JSON object per top level verbose element) when
+ * -Xgc:verboseFormat=json is specified. The log is rotated once it grows beyond -Xgc:verboseLogFileSize.
+ *
+ * The ring is bounded: when the writer thread can not keep up, the producing thread waits for it
+ * rather than losing part of an event.
+ */
+class MM_VerboseWriterFileLoggingAsync : public MM_VerboseWriter
+{
+	/*
+	 * Data members
+	 */
+private:
+	/**
+	 * Header of a string copied into the ring. Records are a multiple of the header size
+	 * and never wrap around the end of the ring, the gap left at the end is filled by a padding record.
+	 */
+	struct RingRecord {
+		volatile uint32_t state; /**< RECORD_FREE until the producer has copied the string in */
+		uint32_t size; /**< size of the record, including this header */
+		uint32_t length; /**< length of the string following the header */
+		uint32_t reserved;
+	};
+
+	enum RecordState {
+		RECORD_FREE = 0,
+		RECORD_COMMITTED = 1,
+		RECORD_PADDING = 2
+	};
+
+	enum ThreadState {
+		THREAD_STATE_INITIAL = 0,
+		THREAD_STATE_RUNNING,
+		THREAD_STATE_TERMINATE_REQUESTED,
+		THREAD_STATE_TERMINATED
+	};
+
+	MM_VerboseManager *_manager; /**< the manager of this writer */
+	OMR_VM *_omrVM;
+
+	char *_filename; /**< name of the current log file, the rotated files are named <_filename>.1 to <_filename>.<_fileCount - 1> */
+	uintptr_t _fileCount; /**< number of log files kept, including the current one */
+	uintptr_t _maxFileSize; /**< size at which the log is rotated, 0 for no rotation */
+	bool _json; /**< true if the output is converted to JSON Lines */
+	intptr_t _logFileDescriptor; /**< the current log file, -1 if not open */
+	uintptr_t _bytesWritten; /**< bytes written to the current log file */
+	omrthread_monitor_t _fileMutex; /**< held by the writer thread while it writes a batch, and by reconfigure() */
+
+	uint8_t *_ring; /**< records copied by the producers */
+	uintptr_t _ringSize; /**< size of the ring, a power of two */
+	volatile uintptr_t _reserved; /**< total bytes reserved by producers */
+	volatile uintptr_t _consumed; /**< total bytes the writer thread is done with */
+
+	omrthread_monitor_t _monitor; /**< protects the writer thread state, producers wait on it when the ring is full */
+	omrthread_t _writerThread;
+	volatile ThreadState _threadState;
+	bool _workPending; /**< set by producers to wake the writer thread */
+	uintptr_t _producersWaiting; /**< number of producers waiting for room in the ring */
+
+	char *_outputBuffer; /**< text formatted by the writer thread, not yet written to the file */
+	uintptr_t _outputUsed;
+
+	/* state of the writer thread's conversion of the output, kept across records */
+	uintptr_t _depth; /**< number of elements opened and not yet closed */
+	uintptr_t _skippedDepth; /**< number of open elements nested too deeply to be converted */
+	bool _hasChildren[VERBOSE_ASYNC_MAXIMUM_DEPTH]; /**< for each open element, true once its children array was started */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC writerThreadProc(void *arg);
+	void runWriterThread();
+
+	/**
+	 * Process the records copied into the ring since the last call.
+	 * @note called while holding _fileMutex, by the writer thread or by a producer writing synchronously
+	 */
+	void drainRing();
+	void processRecord(const char *string, uintptr_t length);
+
+	/**
+	 * Process a string too large for the ring on the thread producing it, after the records reserved before it
+	 */
+	void outputStringSynchronously(const char *string, uintptr_t length);
+
+	/* conversion of the verbose output, which consists of XML elements */
+	void processTag(const char *tag, const char *end);
+	void openElement(const char *name, uintptr_t nameLength, const char *attributes, const char *end);
+	void closeElement();
+	void processText(const char *text, uintptr_t length);
+	void startChild();
+	void appendJSONString(const char *string, uintptr_t length);
+	void appendJSONValue(const char *value, uintptr_t length);
+	static bool isJSONNumber(const char *value, uintptr_t length);
+
+	void appendOutput(const char *string, uintptr_t length);
+	void appendOutput(const char *string);
+	void flushOutput();
+
+	/**
+	 * Set _filename to filename with the %p, %pid, %Y etc. tokens substituted
+	 */
+	bool expandFilename(MM_EnvironmentBase *env, const char *filename);
+	bool openFile(MM_EnvironmentBase *env, int32_t mode);
+	void closeFile();
+	void rotateFile();
+
+	/**
+	 * Ask the writer thread to process the ring
+	 */
+	void wakeWriterThread();
+
+	/**
+	 * Wait for the writer thread to make room in the ring
+	 * @return false if the writer thread is not running
+	 */
+	bool waitForRoom();
+	bool startWriterThread(MM_EnvironmentBase *env);
+	void stopWriterThread();
+
+protected:
+	MM_VerboseWriterFileLoggingAsync(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type);
+
+	bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	/**
+	 * Create a new MM_VerboseWriterFileLoggingAsync instance.
+	 * @param type the type of file logging writer this writer replaces
+	 * @param fileCount number of log files kept when the log is rotated
+	 * @return Pointer to the new MM_VerboseWriterFileLoggingAsync, or NULL on failure
+	 */
+	static MM_VerboseWriterFileLoggingAsync *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type, char *filename, uintptr_t fileCount);
+
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+
+	virtual void closeStream(MM_EnvironmentBase *env);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char *string);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNC_HPP_ */
@@ -104,6 +104,7 @@
 #include "SparseAddressOrderedFixedSizeDataPool.hpp"
 #endif /* defined(J9VM_GC_SPARSE_HEAP_ALLOCATION) */
 #include "StackSlotValidator.hpp"
+#include "StringDeduplicator.hpp"
 #include "SublistFragment.hpp"
 #include "SublistIterator.hpp"
 #include "SublistPool.hpp"
@@ -152,6 +153,16 @@
 #define AllCompressedCardsInByteSurvivor	U_8_MAX
 #define CompressedCardSurvivor				1
 
+#if defined(__GNUC__) || defined(__clang__)
+/* prefetch for write, since the forwarding word of the referent is about to be updated */
+#define COPYFORWARD_PREFETCH(address)		__builtin_prefetch((const void *)(address), 1)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define COPYFORWARD_PREFETCH(address)		_mm_prefetch((const char *)(address), _MM_HINT_T0)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define COPYFORWARD_PREFETCH(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
 	, _javaVM((J9JavaVM *)env->getLanguageVM())
@@ -187,6 +198,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	, _collectStringConstantsEnabled(false)
 	, _tracingEnabled(false)
+	, _prefetchDistance(OMR_MIN(_extensions->tarokCopyForwardPrefetchDistance, (uintptr_t)COPYFORWARD_PREFETCH_RING_SIZE))
 	, _commonContext(NULL)
 	, _compactGroupBlock(NULL)
 	, _arraySplitSize(0)
@@ -1691,6 +1703,11 @@ MM_CopyForwardScheme::copyForwardCollectionSet(MM_EnvironmentVLHGC *env)
 	MM_CopyForwardSchemeTask copyForwardTask(env, _dispatcher, this, env->_cycleState);
 	_dispatcher->run(env, &copyForwardTask);
 
+	if (abortFlagRaised() && (NULL != _extensions->stringDeduplicator)) {
+		/* Objects left in place by the abort may still be compacted within this increment */
+		_extensions->stringDeduplicator->discardCandidates(env);
+	}
+
 	copyForwardPostProcess(env);
 }
 
@@ -2089,6 +2106,17 @@ MM_CopyForwardScheme::copy(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *
 				copyCache->_lowerAgeBound = OMR_MIN(copyCache->_lowerAgeBound, sourceRegion->getLowerAgeBound());
 				copyCache->_upperAgeBound = OMR_MAX(copyCache->_upperAgeBound, sourceRegion->getUpperAgeBound());
 
+				if (NULL != _extensions->stringDeduplicator) {
+					/* Strings aging out of the nursery with this copy are queued for deduplication */
+					uintptr_t nurseryMaxAge = _extensions->tarokNurseryMaxAge._valueSpecified;
+					if ((MM_CompactGroupManager::getRegionAgeFromGroup(env, destinationCompactGroup) > nurseryMaxAge)
+						&& (MM_CompactGroupManager::getRegionAgeFromGroup(env, sourceCompactGroup) <= nurseryMaxAge)
+						&& _extensions->stringDeduplicator->isCandidateClass(J9GC_J9OBJECT_CLAZZ(destinationObjectPtr, env))
+					) {
+						_extensions->stringDeduplicator->queueCandidate(env, destinationObjectPtr);
+					}
+				}
+
 #if defined(J9VM_GC_LEAF_BITS)
 				if (_extensions->tarokEnableLeafFirstCopying) {
 					copyLeafChildren(env, reservingContext, destinationObjectPtr);
@@ -2446,6 +2474,125 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 	return success;
 }
 
+MMINLINE J9Object *
+MM_CopyForwardScheme::copyOldestPrefetchedSlot(MM_EnvironmentVLHGC *env)
+{
+	MM_CopyForwardPrefetchSlot *entry = &env->_copyForwardPrefetchRing[env->_copyForwardPrefetchHead];
+	GC_SlotObject slotObject(_javaVM->omrVM, entry->slot);
+	J9Object *failedObject = NULL;
+
+	if (!copyAndForward(env, entry->reservingContext, entry->object, &slotObject, entry->leafType)) {
+		/* the object has been pushed to the work stack and will be rescanned in its entirety, so its other slots can be dropped */
+		failedObject = entry->object;
+	}
+
+	do {
+		env->_copyForwardPrefetchHead = (env->_copyForwardPrefetchHead + 1) % COPYFORWARD_PREFETCH_RING_SIZE;
+		env->_copyForwardPrefetchCount -= 1;
+	} while ((NULL != failedObject)
+		&& (0 < env->_copyForwardPrefetchCount)
+		&& (failedObject == env->_copyForwardPrefetchRing[env->_copyForwardPrefetchHead].object));
+
+	return failedObject;
+}
+
+void
+MM_CopyForwardScheme::drainPrefetchedSlots(MM_EnvironmentVLHGC *env)
+{
+	while (0 < env->_copyForwardPrefetchCount) {
+		copyOldestPrefetchedSlot(env);
+	}
+}
+
+MMINLINE bool
+MM_CopyForwardScheme::iterateAndCopyforwardSlotReferencePrefetched(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, bool carry) {
+	bool success = true;
+	fj9object_t *endScanPtr;
+	uintptr_t *descriptionPtr;
+	uintptr_t descriptionBits;
+	uintptr_t descriptionIndex;
+#if defined(J9VM_GC_LEAF_BITS)
+	uintptr_t *leafPtr = (uintptr_t *)J9GC_J9OBJECT_CLAZZ(objectPtr, env)->instanceLeafDescription;
+	uintptr_t leafBits;
+#endif /* J9VM_GC_LEAF_BITS */
+	bool const compressed = env->compressObjectReferences();
+
+	/* Object slots */
+	volatile fj9object_t *scanPtr = _extensions->mixedObjectModel.getHeadlessObject(objectPtr);
+	uintptr_t objectSize = _extensions->mixedObjectModel.getSizeInBytesWithHeader(objectPtr);
+
+	endScanPtr = (fj9object_t*)(((uint8_t *)objectPtr) + objectSize);
+	descriptionPtr = (uintptr_t *)J9GC_J9OBJECT_CLAZZ(objectPtr, env)->instanceDescription;
+
+	if (((uintptr_t)descriptionPtr) & 1) {
+		descriptionBits = ((uintptr_t)descriptionPtr) >> 1;
+#if defined(J9VM_GC_LEAF_BITS)
+		leafBits = ((uintptr_t)leafPtr) >> 1;
+#endif /* J9VM_GC_LEAF_BITS */
+	} else {
+		descriptionBits = *descriptionPtr++;
+#if defined(J9VM_GC_LEAF_BITS)
+		leafBits = *leafPtr++;
+#endif /* J9VM_GC_LEAF_BITS */
+	}
+	descriptionIndex = J9_OBJECT_DESCRIPTION_SIZE - 1;
+
+	while (success && (scanPtr < endScanPtr)) {
+		/* Determine if the slot should be processed */
+		if (descriptionBits & 1) {
+			GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
+			J9Object *value = slotObject.readReferenceFromSlot();
+			/* only referents in evacuate memory will have their forwarding word read and updated */
+			if ((NULL != value) && isObjectInEvacuateMemory(value)) {
+				COPYFORWARD_PREFETCH(value);
+			}
+
+			if (_prefetchDistance == env->_copyForwardPrefetchCount) {
+				/* the ring is full: copy/forward the oldest slot, whose referent should be in the cache by now */
+				success = (objectPtr != copyOldestPrefetchedSlot(env));
+			}
+
+			if (success) {
+				MM_CopyForwardPrefetchSlot *entry = &env->_copyForwardPrefetchRing[(env->_copyForwardPrefetchHead + env->_copyForwardPrefetchCount) % COPYFORWARD_PREFETCH_RING_SIZE];
+				entry->object = objectPtr;
+				entry->reservingContext = reservingContext;
+				entry->slot = (volatile fomrobject_t *)scanPtr;
+#if defined(J9VM_GC_LEAF_BITS)
+				entry->leafType = (1 == (leafBits & 1));
+#else /* J9VM_GC_LEAF_BITS */
+				entry->leafType = false;
+#endif /* J9VM_GC_LEAF_BITS */
+				env->_copyForwardPrefetchCount += 1;
+			}
+		}
+		descriptionBits >>= 1;
+#if defined(J9VM_GC_LEAF_BITS)
+		leafBits >>= 1;
+#endif /* J9VM_GC_LEAF_BITS */
+		if (descriptionIndex-- == 0) {
+			descriptionBits = *descriptionPtr++;
+#if defined(J9VM_GC_LEAF_BITS)
+			leafBits = *leafPtr++;
+#endif /* J9VM_GC_LEAF_BITS */
+			descriptionIndex = J9_OBJECT_DESCRIPTION_SIZE - 1;
+		}
+		scanPtr = GC_SlotObject::addToSlotAddress((fomrobject_t *)scanPtr, 1, compressed);
+	}
+
+	if (!carry) {
+		/* Drain the ring. On failure the object has been pushed to the work stack and its slots remaining
+		 * in the ring have been dropped, as with the slots not reached by the scan.
+		 */
+		while (0 < env->_copyForwardPrefetchCount) {
+			if (objectPtr == copyOldestPrefetchedSlot(env)) {
+				success = false;
+			}
+		}
+	}
+
+	return success;
+}
+
 bool
 MM_CopyForwardScheme::scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason)
 {
@@ -2458,7 +2605,12 @@ MM_CopyForwardScheme::scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_Allocati
 
 	if (success) {
 		/* Iteratoring and copyforwarding  the slot reference with leaf bit */
-		success = iterateAndCopyforwardSlotReference(env, reservingContext, objectPtr);
+		if (0 == _prefetchDistance) {
+			success = iterateAndCopyforwardSlotReference(env, reservingContext, objectPtr);
+		} else {
+			/* the objects of a scan cache share the ring, which completeScanCache() drains once the cache is scanned */
+			success = iterateAndCopyforwardSlotReferencePrefetched(env, reservingContext, objectPtr, SCAN_REASON_COPYSCANCACHE == reason);
+		}
 	}
 
 	updateScanStats(env, objectPtr, reason);
@@ -3105,6 +3257,8 @@ MM_CopyForwardScheme::completeScanCache(MM_EnvironmentVLHGC *env)
 			while((objectPtr = heapChunkIterator.nextObject()) != NULL) {
 				scanObject(env, reservingContext, objectPtr, SCAN_REASON_COPYSCANCACHE);
 			}
+			/* copy the slots still waiting for their prefetched referents, which may extend the cache */
+			drainPrefetchedSlots(env);
 		} while(scanCache->isScanWorkAvailable());
 
 	}
@@ -149,6 +149,7 @@ private:
 	bool _collectStringConstantsEnabled;  /**< Local cached value which determines whether string constants are roots */
 
 	bool _tracingEnabled;  /**< Temporary variable to enable tracing of activity */
+	uintptr_t _prefetchDistance;  /**< Number of slots whose referents are prefetched before being copied while scanning mixed objects (0 if slots are copied as they are read) */
 	MM_AllocationContextTarok *_commonContext;	/**< The common context is used as an opaque token to represent cases where we don't want to relocate objects during NUMA-aware copy-forward since relocating to the common context is currently disabled */
 	MM_CopyForwardCompactGroup *_compactGroupBlock; /**< A block of MM_CopyForwardCompactGroup structs which is subdivided among the GC threads */
 	uintptr_t _arraySplitSize; /**< The number of elements to be scanned in each array chunk (this determines the degree of parallelization) */
@@ -959,6 +960,28 @@ private:
 	 */
 	MMINLINE bool iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr);
 
+	/**
+	 *  Same as iterateAndCopyforwardSlotReference(), but pipelined: slots are buffered in the thread's prefetch ring
+	 *  and the headers of their referents (including the forwarding word) are prefetched _prefetchDistance slots before
+	 *  they are copied, so that the cache misses of several slots overlap instead of stalling the scanning thread one by one.
+	 *  @param carry true if slots may be left in the ring for the caller to drain, so that the pipeline is kept full
+	 *  across the objects of a scan cache, false if the ring must be drained before returning
+	 *  @return false if a slot of the object could not be copied and the object was pushed to the work stack
+	 */
+	MMINLINE bool iterateAndCopyforwardSlotReferencePrefetched(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, bool carry);
+
+	/**
+	 *  Copy/forward the oldest slot of the thread's prefetch ring. If the copy fails, the object holding the slot is
+	 *  pushed to the work stack and its other slots are dropped from the ring.
+	 *  @return the object whose slot could not be copied, or NULL on success
+	 */
+	MMINLINE J9Object *copyOldestPrefetchedSlot(MM_EnvironmentVLHGC *env);
+
+	/**
+	 *  Copy/forward every slot left in the thread's prefetch ring
+	 */
+	void drainPrefetchedSlots(MM_EnvironmentVLHGC *env);
+
 	void verifyObjectsInRange(MM_EnvironmentVLHGC *env, uintptr_t *lowAddress, uintptr_t *highAddress);
 	void verifyChunkSlotsAndMapSlotsInRange(MM_EnvironmentVLHGC *env, uintptr_t *lowAddress, uintptr_t *highAddress);
 	void checkConsistencyGMPMapAndPGCMap(MM_EnvironmentVLHGC *env, MM_HeapRegionDescriptorVLHGC *region, uintptr_t *lowAddress, uintptr_t *highAddress);
@@ -46,6 +46,7 @@
 #include "WorkStack.hpp"
 
 class MM_GCExtensions;
+class MM_AllocationContextTarok;
 class MM_CopyForwardCompactGroup;
 class MM_CopyScanCache;
 class MM_RememberedSetCardList;
@@ -53,6 +54,19 @@ class MM_RememberedSetCardList;
 struct MM_CardBufferControlBlock;
 struct DepthStackTuple;
 
+/* Maximum number of slots buffered for prefetching while scanning mixed objects (-Xgc:tarokCopyForwardPrefetchDistance) */
+#define COPYFORWARD_PREFETCH_RING_SIZE 8
+
+/**
+ * A slot whose referent copy-forward has prefetched, but not copied yet
+ */
+struct MM_CopyForwardPrefetchSlot {
+	J9Object *object; /**< the object holding the slot */
+	MM_AllocationContextTarok *reservingContext; /**< the context the object was scanned for */
+	volatile fomrobject_t *slot; /**< the slot */
+	bool leafType; /**< true if the slot refers to a leaf object */
+};
+
 /**
  * @todo Provide class documentation
  * @ingroup GC_Modron_Env
@@ -76,6 +90,9 @@ public:
 	MM_RememberedSetCardList *_lastOverflowedRsclWithReleasedBuffers; /**< in global list of overflowed RSCL, this is the last RSCL this thread visited */
 
 	MM_CopyForwardStats _copyForwardStats;  /**< GC thread local statistics structure for copy forward collections */
+	MM_CopyForwardPrefetchSlot _copyForwardPrefetchRing[COPYFORWARD_PREFETCH_RING_SIZE]; /**< slots whose referents copy-forward prefetched, carried across the objects of a scan cache */
+	uintptr_t _copyForwardPrefetchHead; /**< index of the oldest slot in _copyForwardPrefetchRing */
+	uintptr_t _copyForwardPrefetchCount; /**< number of slots in _copyForwardPrefetchRing */
 
 	MM_MarkVLHGCStats _markVLHGCStats;
 	MM_SweepVLHGCStats _sweepVLHGCStats;
@@ -68,6 +68,14 @@ MM_InterRegionRememberedSet::MM_InterRegionRememberedSet(MM_HeapRegionManager *h
 	, _cardToRegionDisplacement(0)
 	, _cardTable(NULL)
 	, _rememberedSetCardBucketPool(NULL)
+	, _cardBitmaps(NULL)
+	, _freeCardBitmaps(NULL)
+	, _cardBitmapCount(0)
+	, _reservedCardBitmapCount(0)
+	, _freeCardBitmapCount(0)
+	, _cardBitmapCountMax(0)
+	, _cardBitmapSize(0)
+	, _cardBitmapRegionCount(0)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 	, _compressObjectReferences(false)
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
@@ -296,10 +304,74 @@ MM_InterRegionRememberedSet::initialize(MM_EnvironmentVLHGC *env)
 	}
 	_cardTable = ext->cardTable;
 
+	/* Card bitmaps cover every card of the reserved heap, so they are only worth it for a bounded number of popular regions */
+	_cardBitmapCountMax = OMR_MIN(ext->tarokRememberedSetCardListBitmapCount, _heapRegionManager->getTableRegionCount());
+	if (0 < _cardBitmapCountMax) {
+		UDATA cardCount = (_heapRegionManager->getTableRegionCount() * _regionSize) >> CARD_SIZE_SHIFT;
+		_cardBitmapSize = ((cardCount + BITS_PER_UDATA - 1) / BITS_PER_UDATA) * sizeof(UDATA);
+		_cardBitmaps = (UDATA **)ext->getForge()->allocate(2 * _cardBitmapCountMax * sizeof(UDATA *), MM_AllocationCategory::REMEMBERED_SET, J9_GET_CALLSITE());
+		if (NULL == _cardBitmaps) {
+			return false;
+		}
+		_freeCardBitmaps = _cardBitmaps + _cardBitmapCountMax;
+	}
+
 	return true;
 }
 
 
+UDATA *
+MM_InterRegionRememberedSet::acquireCardBitmap(MM_EnvironmentVLHGC* env)
+{
+	UDATA *cardBitmap = NULL;
+	bool shouldAllocate = false;
+
+	_lock.acquire();
+	if (0 < _freeCardBitmapCount) {
+		_freeCardBitmapCount -= 1;
+		cardBitmap = _freeCardBitmaps[_freeCardBitmapCount];
+	} else if (_reservedCardBitmapCount < _cardBitmapCountMax) {
+		/* reserve a bitmap now, but allocate and clear it outside of the lock */
+		_reservedCardBitmapCount += 1;
+		shouldAllocate = true;
+	}
+	_lock.release();
+
+	if (shouldAllocate) {
+		cardBitmap = (UDATA *)MM_GCExtensions::getExtensions(env)->getForge()->allocate(_cardBitmapSize, MM_AllocationCategory::REMEMBERED_SET, J9_GET_CALLSITE());
+		if (NULL != cardBitmap) {
+			memset(cardBitmap, 0, _cardBitmapSize);
+		}
+
+		_lock.acquire();
+		if (NULL == cardBitmap) {
+			_reservedCardBitmapCount -= 1;
+		} else {
+			_cardBitmaps[_cardBitmapCount] = cardBitmap;
+			_cardBitmapCount += 1;
+		}
+		_lock.release();
+	}
+
+	if (NULL != cardBitmap) {
+		MM_AtomicOperations::add(&_cardBitmapRegionCount, 1);
+	}
+
+	return cardBitmap;
+}
+
+void
+MM_InterRegionRememberedSet::releaseCardBitmap(MM_EnvironmentVLHGC* env, UDATA *cardBitmap)
+{
+	_lock.acquire();
+	Assert_MM_true(_freeCardBitmapCount < _cardBitmapCount);
+	_freeCardBitmaps[_freeCardBitmapCount] = cardBitmap;
+	_freeCardBitmapCount += 1;
+	_lock.release();
+
+	MM_AtomicOperations::subtract(&_cardBitmapRegionCount, 1);
+}
+
 void 
 MM_InterRegionRememberedSet::rememberReferenceInternal(MM_EnvironmentVLHGC* env, J9Object* fromObject, MM_HeapRegionDescriptorVLHGC *toRegion)
 {
@@ -488,6 +560,15 @@ MM_InterRegionRememberedSet::tearDown(MM_EnvironmentBase *env)
 		_rsclBufferControlBlockPool = NULL;
 	}
 
+	if (NULL != _cardBitmaps) {
+		for (UDATA i = 0; i < _cardBitmapCount; i++) {
+			ext->getForge()->free(_cardBitmaps[i]);
+		}
+		ext->getForge()->free(_cardBitmaps);
+		_cardBitmaps = NULL;
+		_freeCardBitmaps = NULL;
+	}
+
 	_lock.tearDown();
 }
 
@@ -86,6 +86,15 @@ public:
 
 	MM_RememberedSetCardBucket *_rememberedSetCardBucketPool; /**< RS bucket pool (for all regions) for Main thread or any other thread that caused GC in absence of Main thread */
 
+	UDATA **_cardBitmaps;									/**< card bitmaps allocated so far (up to _cardBitmapCountMax), kept for teardown */
+	UDATA **_freeCardBitmaps;								/**< stack of allocated card bitmaps not attached to any RSCL */
+	UDATA _cardBitmapCount;									/**< count of entries in _cardBitmaps */
+	UDATA _reservedCardBitmapCount;							/**< count of card bitmaps allocated or being allocated */
+	UDATA _freeCardBitmapCount;								/**< count of entries in _freeCardBitmaps */
+	UDATA _cardBitmapCountMax;								/**< maximum number of card bitmaps (-Xgc:tarokRememberedSetCardListBitmapCount) */
+	UDATA _cardBitmapSize;									/**< size in bytes of a card bitmap, which has one bit for every card of the heap */
+	volatile UDATA _cardBitmapRegionCount;					/**< count of RSCLs currently remembering cards in a bitmap */
+
 protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 	bool _compressObjectReferences;
@@ -317,6 +326,53 @@ public:
 	 */
 	void releaseCardBufferControlBlockLocalPools(MM_EnvironmentVLHGC* env);
 
+	/**
+	 * Hand out a cleared card bitmap to an RSCL that reached its maximum size. Bitmaps are allocated on first use,
+	 * up to tarokRememberedSetCardListBitmapCount of them. Multithreaded safe.
+	 * @return a cleared bitmap of getCardBitmapSlotCount() slots, or NULL if none is available
+	 */
+	UDATA *acquireCardBitmap(MM_EnvironmentVLHGC* env);
+
+	/**
+	 * Return a card bitmap to the pool. The caller must have cleared every bit of the bitmap.
+	 * @param cardBitmap bitmap previously returned by acquireCardBitmap()
+	 */
+	void releaseCardBitmap(MM_EnvironmentVLHGC* env, UDATA *cardBitmap);
+
+	/**
+	 * @return the number of slots in each card bitmap
+	 */
+	MMINLINE UDATA getCardBitmapSlotCount() { return _cardBitmapSize / sizeof(UDATA); }
+
+	/**
+	 * Converts a remembered set card to its bit index in a card bitmap
+	 * @param card the card which we wish to convert
+	 * @return the index of the bit representing the card
+	 */
+	MMINLINE UDATA
+	convertRememberedSetCardToBitmapIndex(UDATA card)
+	{
+		UDATA index = card - _cardToRegionDisplacement;
+		if (!compressObjectReferences()) {
+			index >>= CARD_SIZE_SHIFT;
+		}
+		return index;
+	}
+
+	/**
+	 * Converts a bit index in a card bitmap to the remembered set card it represents
+	 * @param index the index of the bit
+	 * @return the card represented by the bit
+	 */
+	MMINLINE UDATA
+	convertBitmapIndexToRememberedSetCard(UDATA index)
+	{
+		if (!compressObjectReferences()) {
+			index <<= CARD_SIZE_SHIFT;
+		}
+		return index + _cardToRegionDisplacement;
+	}
+
 	/**
 	 * Allocate RSCL Buffer pool local to this region's RSCL (Buffers can still be shared among other regions)
 	 * @param region[in] region being committed
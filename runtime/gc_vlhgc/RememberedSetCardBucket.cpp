@@ -65,7 +65,10 @@ MM_RememberedSetCardBucket::addToNewBuffer(MM_EnvironmentVLHGC *env, UDATA card)
 {
 	Assert_MM_true(_rscl->_bufferCount >= _bufferCount);
 
-	if (!_rscl->_overflowed) {
+	if (!_rscl->_overflowed && (NULL != _rscl->_cardBitmap)) {
+		/* the list passed its maximum size and remembers all further cards in its card bitmap */
+		_rscl->addToCardBitmap(env, card);
+	} else if (!_rscl->_overflowed) {
 		/* the current buffer is full or _current is NULL (no buffers in the bucket yet)
 		 * allocate a new buffer from the buffer pool
 		 * bound the total size of owning list
@@ -76,7 +79,12 @@ MM_RememberedSetCardBucket::addToNewBuffer(MM_EnvironmentVLHGC *env, UDATA card)
 			MM_AtomicOperations::subtract(&_rscl->_bufferCount, 1);
 			_bufferCount -= 1;
 
-			setListAsOverflow(env, _rscl);
+			/* popular region: rather than overflowing the list (forcing a rebuild), keep remembering its cards in a dense bitmap if one is available */
+			if (_rscl->switchToCardBitmap(env)) {
+				_rscl->addToCardBitmap(env, card);
+			} else {
+				setListAsOverflow(env, _rscl);
+			}
 		} else {
 			MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
 
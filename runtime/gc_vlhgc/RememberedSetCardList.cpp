@@ -20,6 +20,7 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
  *******************************************************************************/
 
+#include "AtomicOperations.hpp"
 #include "HeapRegionManager.hpp"
 #include "RememberedSetCardList.hpp"
 #include "VMThreadListIterator.hpp"
@@ -55,7 +56,7 @@ MM_RememberedSetCardList::isEmpty(MM_EnvironmentVLHGC *env)
 	if (TRUE == _overflowed) {
 		empty = false;
 	} else {
-		if (0 != _bufferCount) {
+		if ((0 != _bufferCount) || (0 != _cardBitmapCount)) {
 			empty = false;
 		} else {
 			MM_RememberedSetCardBucket *currentBucket = _bucketListHead;
@@ -91,7 +92,7 @@ MM_RememberedSetCardList::getSize(MM_EnvironmentVLHGC *env)
 
 	Assert_MM_true(_bufferCount == checkBufferCount);
 	
-	return size;
+	return size + _cardBitmapCount;
 }
 
 void
@@ -106,6 +107,8 @@ MM_RememberedSetCardList::releaseBuffers(MM_EnvironmentVLHGC *env)
 	}
 
 	Assert_MM_true(0 == _bufferCount);
+
+	releaseCardBitmap(env);
 }
 
 void
@@ -133,10 +136,66 @@ MM_RememberedSetCardList::add(MM_EnvironmentVLHGC *env, J9Object *object)
 
 }
 
+bool
+MM_RememberedSetCardList::switchToCardBitmap(MM_EnvironmentVLHGC *env)
+{
+	if (NULL == _cardBitmap) {
+		MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+		UDATA *cardBitmap = interRegionRememberedSet->acquireCardBitmap(env);
+		if (NULL != cardBitmap) {
+			if (NULL != MM_AtomicOperations::lockCompareExchange((volatile UDATA *)&_cardBitmap, (UDATA)NULL, (UDATA)cardBitmap)) {
+				/* another thread attached a bitmap first */
+				interRegionRememberedSet->releaseCardBitmap(env, cardBitmap);
+			}
+		}
+	}
+
+	return NULL != _cardBitmap;
+}
+
+void
+MM_RememberedSetCardList::addToCardBitmap(MM_EnvironmentVLHGC *env, UDATA card)
+{
+	UDATA bitIndex = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet->convertRememberedSetCardToBitmapIndex(card);
+	UDATA bit = (UDATA)1 << (bitIndex % BITS_PER_UDATA);
+	volatile UDATA *slot = &_cardBitmap[bitIndex / BITS_PER_UDATA];
+
+	UDATA oldValue = *slot;
+	while (0 == (oldValue & bit)) {
+		UDATA witness = MM_AtomicOperations::lockCompareExchange(slot, oldValue, oldValue | bit);
+		if (witness == oldValue) {
+			MM_AtomicOperations::add(&_cardBitmapCount, 1);
+			break;
+		}
+		oldValue = witness;
+	}
+}
+
+void
+MM_RememberedSetCardList::releaseCardBitmap(MM_EnvironmentVLHGC *env)
+{
+	if (NULL != _cardBitmap) {
+		MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+		if (0 != _cardBitmapCount) {
+			memset(_cardBitmap, 0, interRegionRememberedSet->getCardBitmapSlotCount() * sizeof(UDATA));
+			_cardBitmapCount = 0;
+		}
+		interRegionRememberedSet->releaseCardBitmap(env, _cardBitmap);
+		_cardBitmap = NULL;
+	}
+}
+
 bool
 MM_RememberedSetCardList::isRemembered(MM_EnvironmentVLHGC *env, UDATA card)
 {
 	Assert_MM_true(FALSE == _overflowed);
+
+	if (NULL != _cardBitmap) {
+		UDATA bitIndex = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet->convertRememberedSetCardToBitmapIndex(card);
+		if (0 != (_cardBitmap[bitIndex / BITS_PER_UDATA] & ((UDATA)1 << (bitIndex % BITS_PER_UDATA)))) {
+			return true;
+		}
+	}
 	
 	MM_RememberedSetCardBucket *currentBucket = _bucketListHead;
 	while (NULL != currentBucket) {
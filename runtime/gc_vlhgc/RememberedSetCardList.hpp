@@ -50,6 +50,8 @@ private:
 	bool _stable;											/**< if true, list is overflowed due to region being stable */
 	volatile UDATA _bufferCount;										/**< count of buffers in all buckets' lists */
 	MM_RememberedSetCardList * volatile _nonEmptyOverflowedNext; 		/**< overflowed RSCL found during a GC cycle are linked into a single liked list - this is next pointer */
+	UDATA * volatile _cardBitmap;							/**< dense bitmap (one bit per heap card) remembering cards once the list passed its maximum size, or NULL */
+	volatile UDATA _cardBitmapCount;						/**< count of bits set in _cardBitmap */
 private:
 	/**
 	 * Remove an entry. This just NULLs the entry. Compaction/shifting is to be done later, explicitly.
@@ -64,6 +66,35 @@ private:
 		return &(env->_rememberedSetCardBucketPool[_index]);
 	}
 
+	/**
+	 * Attach a card bitmap to the list, so that cards added past the maximum list size do not overflow it. Multithreaded safe.
+	 * @return true if the list has a card bitmap, false if none was available
+	 */
+	bool switchToCardBitmap(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Set the bit of the card in the attached card bitmap. Multithreaded safe.
+	 * @param card  card to be remembered
+	 */
+	void addToCardBitmap(MM_EnvironmentVLHGC *env, UDATA card);
+
+	/**
+	 * Remove a card from the attached card bitmap. Not thread safe.
+	 * @param bitIndex  index of the bit representing the card
+	 */
+	void removeCardFromBitmap(MM_EnvironmentVLHGC *env, UDATA bitIndex) {
+		UDATA bit = (UDATA)1 << (bitIndex % BITS_PER_UDATA);
+		UDATA *slot = &_cardBitmap[bitIndex / BITS_PER_UDATA];
+		Assert_MM_true(bit == (*slot & bit));
+		*slot &= ~bit;
+		_cardBitmapCount -= 1;
+	}
+
+	/**
+	 * Clear the attached card bitmap (if any) and return it to the pool.
+	 */
+	void releaseCardBitmap(MM_EnvironmentVLHGC *env);
+
 protected:
 public:
 
@@ -153,13 +184,18 @@ public:
 	 */
 	UDATA getBufferCount() { return _bufferCount; }
 
+	/**
+	 * @return true if cards are (also) remembered in a dense card bitmap
+	 */
+	bool hasCardBitmap() { return NULL != _cardBitmap; }
+
 	/**
 	 * Remove NULL entries and compact the list. Not thread safe. Called only for non-overflowed lists.
 	 */
 	void compact(MM_EnvironmentVLHGC *env);
 
 	/**
-	 * Release buffers from all the buckets.
+	 * Release buffers from all the buckets, and the card bitmap if there is one.
 	 */
 	void releaseBuffers(MM_EnvironmentVLHGC *env);
 
@@ -193,6 +229,8 @@ public:
 	  , _stable(false)
 	  , _bufferCount(0)
 	  , _nonEmptyOverflowedNext(NULL)
+	  , _cardBitmap(NULL)
+	  , _cardBitmapCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
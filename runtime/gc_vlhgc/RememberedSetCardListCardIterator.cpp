@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "RememberedSetCardListCardIterator.hpp"
+#include "Bits.hpp"
 #include "InterRegionRememberedSet.hpp"
 
 bool
@@ -72,19 +73,46 @@ GC_RememberedSetCardListCardIterator::nextBucket(MM_EnvironmentBase* env)
 UDATA
 GC_RememberedSetCardListCardIterator::nextReferencingCard(MM_EnvironmentBase *env)
 {
-	bool const compressed = env->compressObjectReferences();
-	do {
+	if (!_bucketsExhausted) {
+		bool const compressed = env->compressObjectReferences();
 		do {
-			/* next card within the buffer */
-			if (_cardIndex < _cardIndexTop) {
-				MM_RememberedSetCard *cardAddress = MM_RememberedSetCard::addToCardAddress(_bufferCardList, _cardIndex, compressed);
-				_cardIndex += 1;
-				return MM_RememberedSetCard::readCard(cardAddress, compressed);
-			}
-		} while (nextBuffer(env, _cardBufferControlBlockNext));
-	} while (nextBucket(env));
-
-	return 0;
+			do {
+				/* next card within the buffer */
+				if (_cardIndex < _cardIndexTop) {
+					MM_RememberedSetCard *cardAddress = MM_RememberedSetCard::addToCardAddress(_bufferCardList, _cardIndex, compressed);
+					_cardIndex += 1;
+					return MM_RememberedSetCard::readCard(cardAddress, compressed);
+				}
+			} while (nextBuffer(env, _cardBufferControlBlockNext));
+		} while (nextBucket(env));
+
+		_bucketsExhausted = true;
+		_bitmapCardsRemaining = _rscl->_cardBitmapCount;
+	}
+
+	return nextBitmapCard(env);
+}
+
+UDATA
+GC_RememberedSetCardListCardIterator::nextBitmapCard(MM_EnvironmentBase *env)
+{
+	if (0 == _bitmapCardsRemaining) {
+		/* no bitmap, or all of its cards have been returned (no need to scan the rest of it) */
+		return 0;
+	}
+
+	UDATA *cardBitmap = _rscl->_cardBitmap;
+	while (0 == _bitmapSlotBits) {
+		_bitmapSlotBits = cardBitmap[_bitmapSlotIndex];
+		_bitmapSlotIndex += 1;
+	}
+
+	UDATA bit = MM_Bits::trailingZeros(_bitmapSlotBits);
+	_bitmapSlotBits &= (_bitmapSlotBits - 1);
+	_bitmapBitIndex = ((_bitmapSlotIndex - 1) * BITS_PER_UDATA) + bit;
+	_bitmapCardsRemaining -= 1;
+
+	return MM_GCExtensions::getExtensions(env)->interRegionRememberedSet->convertBitmapIndexToRememberedSetCard(_bitmapBitIndex);
 }
 
 void *
@@ -40,6 +40,11 @@ private:
 	MM_CardBufferControlBlock *_cardBufferControlBlockNext; /**< next buffer control block */
 	UDATA _cardIndex; 				/**< The card index in the RSCL */
 	UDATA _cardIndexTop;			/**< Top index in the current buffer */
+	bool _bucketsExhausted;			/**< true once all buffers have been iterated and iteration continues in the card bitmap */
+	UDATA _bitmapSlotIndex;			/**< index of the next card bitmap slot to be loaded */
+	UDATA _bitmapSlotBits;			/**< bits of the current card bitmap slot not yet returned */
+	UDATA _bitmapBitIndex;			/**< index of the bit representing the card last returned from the card bitmap */
+	UDATA _bitmapCardsRemaining;	/**< count of set bits not yet returned from the card bitmap */
 private:
 	/**
 	 * Next buffer given a current buffer (control block). Initializes _bufferCardList and resets _cardIndex.
@@ -51,6 +56,11 @@ private:
 	 * @return true if there was a new bucket
 	 */
 	bool nextBucket(MM_EnvironmentBase* env);
+	/**
+	 * Next card remembered in the card bitmap of the list.
+	 * @return the next card, or 0 if there are no more cards
+	 */
+	UDATA nextBitmapCard(MM_EnvironmentBase* env);
 
 protected:
 public:
@@ -67,6 +77,11 @@ public:
 		, _cardBufferControlBlockNext(NULL)
 		, _cardIndex(MM_RememberedSetCardBucket::MAX_BUFFER_SIZE)
 		, _cardIndexTop(MM_RememberedSetCardBucket::MAX_BUFFER_SIZE)
+		, _bucketsExhausted(false)
+		, _bitmapSlotIndex(0)
+		, _bitmapSlotBits(0)
+		, _bitmapBitIndex(0)
+		, _bitmapCardsRemaining(0)
 		{}
 
 	/**
@@ -82,7 +97,9 @@ public:
 	MMINLINE void
 	removeCurrentCard(MM_EnvironmentBase *env)
 	{
-		if (_cardIndex > 0) {
+		if (_bucketsExhausted) {
+			_rscl->removeCardFromBitmap(env, _bitmapBitIndex);
+		} else if (_cardIndex > 0) {
 			_rscl->removeCard(env, _bufferCardList, _cardIndex - 1);
 		}
 	}
@@ -348,7 +348,8 @@ void
 hookGcCycleStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
 	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
-	J9VMThread* vmThread = (J9VMThread*)MM_EnvironmentBase::getEnvironment(event->omrVMThread)->getLanguageVMThread();
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	J9VMThread* vmThread = (J9VMThread*)env->getLanguageVMThread();
 	J9JavaVM *javaVM = vmThread->javaVM;
 	GCCHK_Extensions *extensions = (GCCHK_Extensions *)(MM_GCExtensions::getExtensions(javaVM))->gcchkExtensions;
 	GC_CheckCycle *cycle = (GC_CheckCycle *)extensions->checkCycle;
@@ -364,7 +365,7 @@ hookGcCycleStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void*
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots before global gc (%zu)>\n", extensions->globalGcCount);
 			}
 
-			cycle->run(invocation_global_start);
+			cycle->run(invocation_global_start, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots before global gc (%zu)>\n", extensions->globalGcCount);
@@ -379,7 +380,7 @@ hookGcCycleStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void*
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots before local gc (%zu)>\n", extensions->localGcCount);
 			}
 
-			cycle->run(invocation_local_start);
+			cycle->run(invocation_local_start, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots before local gc (%zu)>\n", extensions->localGcCount);
@@ -394,7 +395,7 @@ hookGcCycleStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void*
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots before default gc (%zu)>\n", extensions->globalGcCount);
 			}
 
-			cycle->run(invocation_global_start);
+			cycle->run(invocation_global_start, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots before default gc (%zu)>\n", extensions->globalGcCount);
@@ -412,7 +413,8 @@ void
 hookGcCycleEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
 	MM_GCCycleEndEvent* event = (MM_GCCycleEndEvent*)eventData;
-	J9VMThread* vmThread = (J9VMThread*)MM_EnvironmentBase::getEnvironment(event->omrVMThread)->getLanguageVMThread();
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	J9VMThread* vmThread = (J9VMThread*)env->getLanguageVMThread();
 	J9JavaVM *javaVM = vmThread->javaVM;
 	GCCHK_Extensions *extensions = (GCCHK_Extensions *)(MM_GCExtensions::getExtensions(javaVM))->gcchkExtensions;
 	GC_CheckCycle *cycle = (GC_CheckCycle *)extensions->checkCycle;
@@ -429,7 +431,7 @@ hookGcCycleEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots after global gc (%zu)>\n", extensions->globalGcCount);
 			}
 
-			cycle->run(invocation_global_end);
+			cycle->run(invocation_global_end, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots after global gc (%zu)>\n", extensions->globalGcCount);
@@ -443,7 +445,7 @@ hookGcCycleEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots after local gc (%zu)>\n", extensions->localGcCount);
 			}
 
-			cycle->run(invocation_local_end);
+			cycle->run(invocation_local_end, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots after local gc (%zu)>\n", extensions->localGcCount);
@@ -457,7 +459,7 @@ hookGcCycleEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 				j9tty_printf(PORTLIB, "<gc check: start verifying slots after default gc (%zu)>\n", extensions->globalGcCount);
 			}
 
-			cycle->run(invocation_global_end);
+			cycle->run(invocation_global_end, J9MODRON_GCCHK_SCAN_ALL_SLOTS, env);
 
 			if (cycle->getMiscFlags() & J9MODRON_GCCHK_VERBOSE) {
 				j9tty_printf(PORTLIB, "<gc check: finished verifying slots after default gc (%zu)>\n", extensions->globalGcCount);
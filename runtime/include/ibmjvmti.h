@@ -79,6 +79,7 @@
 #define COM_IBM_DESTROY_SHARED_CACHE "com.ibm.DestroySharedCache"
 
 #define COM_IBM_REMOVE_ALL_TAGS   "com.ibm.RemoveAllTags"
+#define COM_IBM_SET_HEAP_CALLBACKS_THREAD_SAFE "com.ibm.SetHeapCallbacksThreadSafe"
 
 #define COM_IBM_REGISTER_TRACE_SUBSCRIBER "com.ibm.RegisterTraceSubscriber"
 #define COM_IBM_DEREGISTER_TRACE_SUBSCRIBER "com.ibm.DeregisterTraceSubscriber"
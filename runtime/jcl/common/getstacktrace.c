@@ -32,6 +32,62 @@
 #include "ut_j9jcl.h"
 #include "vmaccess.h"
 
+typedef struct J9GetStackTraceData {
+	J9VMThread *requester;
+	J9StackWalkState *walkState;
+	UDATA skipCount;
+	UDATA rc;
+	BOOLEAN isVirtual;
+	BOOLEAN unmounted;
+} J9GetStackTraceData;
+
+static void walkStackForThread(J9VMThread *currentThread, J9VMThread *targetThread, void *userData);
+
+/**
+ * Walks the stack of targetThread and caches the PCs, either on targetThread itself or
+ * on the requesting thread while targetThread is halted.
+ * @param[in] currentThread the thread running the walk
+ * @param[in] targetThread the thread whose stack is walked
+ * @param[in] userData the J9GetStackTraceData of the request
+ */
+static void
+walkStackForThread(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	J9GetStackTraceData *data = (J9GetStackTraceData *)userData;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9StackWalkState *walkState = data->walkState;
+#if JAVA_SPEC_VERSION >= 19
+	/* The requesting thread is waiting, so the thread object it pushed is stable. */
+	j9object_t threadObject = PEEK_OBJECT_IN_SPECIAL_FRAME(data->requester, 0);
+
+	/* Re-check thread state. */
+	if ((NULL != targetThread->currentContinuation) && (threadObject == targetThread->carrierThreadObject)) {
+		/* If targetThread has a continuation mounted and its threadObject matches its carrierThreadObject,
+		 * then the carrier thread's stacktrace is retrieved through the cached state in the continuation.
+		 */
+		walkState->skipCount = 0;
+		data->rc = vm->internalVMFunctions->walkContinuationStackFrames(currentThread, targetThread->currentContinuation, threadObject, walkState);
+	} else if (data->isVirtual
+	&& ((threadObject != targetThread->threadObject)
+		|| (-1 == J9OBJECT_I64_LOAD(currentThread, threadObject, vm->virtualThreadInspectorCountOffset)))
+	) {
+		/* If the virtual thread object doesn't match the current thread object, it must have unmounted
+		 * from this carrier thread, return NULL and the JCL code will handle the retry.
+		 *
+		 * If inspectorCount is -1, then the virtual thread is in an unsteady state (mounting or unmounting).
+		 * In such cases, NULL should be returned and the JCL code should retry in order to avoid unexpected
+		 * behavior.
+		 */
+		data->unmounted = TRUE;
+	} else
+#endif /* JAVA_SPEC_VERSION >= 19 */
+	{
+		walkState->walkThread = targetThread;
+		walkState->skipCount = data->skipCount;
+		data->rc = vm->walkStackFrames(currentThread, walkState);
+	}
+}
+
 /**
  * Creates a throwable object containing the stacktrace of threadObject.
  * @param[in] currentThread
@@ -47,11 +103,15 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	J9InternalVMFunctions * vmfns = vm->internalVMFunctions;
 	j9object_t throwable = NULL;
 	J9StackWalkState walkState = {0};
-	UDATA rc = J9_STACKWALK_RC_NONE;
+	J9GetStackTraceData data = {0};
 
+	data.requester = currentThread;
+	data.walkState = &walkState;
+	data.skipCount = skipCount;
+	data.rc = J9_STACKWALK_RC_NONE;
 #if JAVA_SPEC_VERSION >= 19
-	BOOLEAN isVirtual = IS_JAVA_LANG_VIRTUALTHREAD(currentThread, threadObject);
-	if (isVirtual) {
+	data.isVirtual = IS_JAVA_LANG_VIRTUALTHREAD(currentThread, threadObject);
+	if (data.isVirtual) {
 		/* Return NULL if a valid CarrierThread object cannot be found through VirtualThread object,
 		 * the caller of getStackTraceImpl will handle whether to retry or get the stack using the unmounted path.
 		 */
@@ -66,45 +126,20 @@ getStackTraceForThread(J9VMThread *currentThread, J9VMThread *targetThread, UDAT
 	}
 	PUSH_OBJECT_IN_SPECIAL_FRAME(currentThread, threadObject);
 #endif /* JAVA_SPEC_VERSION >= 19 */
-	/* Halt the target thread. */
-	vmfns->haltThreadForInspection(currentThread, targetThread);
 
-	/* walk stack and cache PCs. */
+	/* Walk stack and cache PCs at the next safe point of the target thread. */
 	walkState.flags = J9_STACKWALK_CACHE_PCS | J9_STACKWALK_WALK_TRANSLATE_PC | J9_STACKWALK_SKIP_INLINES | J9_STACKWALK_INCLUDE_NATIVES | J9_STACKWALK_VISIBLE_ONLY;
+	vmfns->executeThreadHandshake(currentThread, targetThread, walkStackForThread, &data);
+
 #if JAVA_SPEC_VERSION >= 19
-	threadObject = POP_OBJECT_IN_SPECIAL_FRAME(currentThread);
-	/* Re-check thread state. */
-	if ((NULL != targetThread->currentContinuation) && (threadObject == targetThread->carrierThreadObject)) {
-		/* If targetThread has a continuation mounted and its threadObject matches its carrierThreadObject,
-		 * then the carrier thread's stacktrace is retrieved through the cached state in the continuation.
-		 */
-		walkState.skipCount = 0;
-		rc = vmfns->walkContinuationStackFrames(currentThread, targetThread->currentContinuation, threadObject, &walkState);
-	} else if (isVirtual
-	&& ((threadObject != targetThread->threadObject)
-		|| (-1 == J9OBJECT_I64_LOAD(currentThread, threadObject, vm->virtualThreadInspectorCountOffset)))
-	) {
-		/* If the virtual thread object doesn't match the current thread object, it must have unmounted
-		 * from this carrier thread, return NULL and the JCL code will handle the retry.
-		 *
-		 * If inspectorCount is -1, then the virtual thread is in an unsteady state (mounting or unmounting).
-		 * In such cases, NULL should be returned and the JCL code should retry in order to avoid unexpected
-		 * behavior.
-		 */
-		vmfns->resumeThreadForInspection(currentThread, targetThread);
+	DROP_OBJECT_IN_SPECIAL_FRAME(currentThread);
+	if (data.unmounted) {
 		goto done;
-	} else
-#endif /* JAVA_SPEC_VERSION >= 19 */
-	{
-		walkState.walkThread = targetThread;
-		walkState.skipCount = skipCount;
-		rc = vm->walkStackFrames(currentThread, &walkState);
 	}
-	/* Now that the stack trace has been copied, resume the thread. */
-	vmfns->resumeThreadForInspection(currentThread, targetThread);
+#endif /* JAVA_SPEC_VERSION >= 19 */
 
 	/* Check for stack walk failure. */
-	if (rc != J9_STACKWALK_RC_NONE) {
+	if (data.rc != J9_STACKWALK_RC_NONE) {
 		vmfns->setNativeOutOfMemoryError(currentThread, 0, 0);
 		goto fail;
 	}
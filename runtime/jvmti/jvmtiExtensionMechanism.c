@@ -84,6 +84,7 @@ static jvmtiError JNICALL jvmtiIterateSharedCaches(jvmtiEnv* env, ...);
 static jvmtiError JNICALL jvmtiDestroySharedCache(jvmtiEnv *env, ...);
 
 static jvmtiError JNICALL jvmtiRemoveAllTags(jvmtiEnv* env, ...);
+static jvmtiError JNICALL jvmtiSetHeapCallbacksThreadSafe(jvmtiEnv* env, ...);
 
 static jvmtiError JNICALL jvmtiRegisterTraceSubscriber(jvmtiEnv *env, ...);
 static jvmtiError JNICALL jvmtiDeregisterTraceSubscriber(jvmtiEnv *env, ...);
@@ -355,6 +356,11 @@ static const jvmtiParamInfo jvmtiRegisterTracePointSubscriber_params[] = {
 static const jvmtiParamInfo jvmtiDeregisterTracepointSubscriber_params[] = {
 	{ "subscriptionID", JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID, JNI_FALSE }
 };
+
+/* (jvmtiEnv *jvmti_env, jboolean thread_safe) */
+static const jvmtiParamInfo jvmtiSetHeapCallbacksThreadSafe_params[] = {
+	{ "thread_safe", JVMTI_KIND_IN, JVMTI_TYPE_JBOOLEAN, JNI_FALSE }
+};
 #if JAVA_SPEC_VERSION >= 19
 /* (jvmtiEnv *jvmti_env, jthread thread) */
 static const jvmtiParamInfo jvmtiVirtualThreadMount_params[] = {
@@ -816,6 +822,13 @@ static const J9JVMTIExtensionFunctionInfo J9JVMTIExtensionFunctionInfoTable[] =
 		SIZE_AND_TABLE(jvmtiDeregisterTracepointSubscriber_params),
 		SIZE_AND_TABLE(jvmtiDeregisterTracePointSubscriber_errors)
 	},
+	{
+		(jvmtiExtensionFunction) jvmtiSetHeapCallbacksThreadSafe,
+		COM_IBM_SET_HEAP_CALLBACKS_THREAD_SAFE,
+		J9NLS_JVMTI_COM_IBM_SET_HEAP_CALLBACKS_THREAD_SAFE,
+		SIZE_AND_TABLE(jvmtiSetHeapCallbacksThreadSafe_params),
+		EMPTY_SIZE_AND_TABLE
+	},
 #if JAVA_SPEC_VERSION >= 19
 	{
 		(jvmtiExtensionFunction)jvmtiGetVirtualThread,
@@ -2416,25 +2429,54 @@ jvmtiRemoveAllTags(jvmtiEnv* jvmti_env, ...)
 {
 	J9JVMTIEnv * j9env = (J9JVMTIEnv *) jvmti_env;
 	jvmtiError rc = JVMTI_ERROR_NOT_AVAILABLE;
-
-	J9HashTableHashFn hashFn = j9env->objectTagTable->hashFn;
-	J9HashTableEqualFn hashEqualFn = j9env->objectTagTable->hashEqualFn;
-
+	UDATA shard = 0;
 
 	Trc_JVMTI_jvmtiRemoveAllTags_Entry(jvmti_env);
 
-	/* Ensure exclusive access to tag table */
-	omrthread_monitor_enter(j9env->mutex);
+	for (shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+		/* Ensure exclusive access to the tag table shard */
+		omrthread_monitor_enter(j9env->objectTagTableMutexes[shard]);
 
-	if (j9env->objectTagTable != NULL) {
-		hashTableFree(j9env->objectTagTable);
-		j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(j9env->vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0,  J9MEM_CATEGORY_JVMTI, hashFn, hashEqualFn, NULL, NULL);
-		rc = JVMTI_ERROR_NONE;
+		if (j9env->objectTagTables[shard] != NULL) {
+			hashTableFree(j9env->objectTagTables[shard]);
+			j9env->objectTagTables[shard] = newObjectTagTable(j9env->vm);
+			rc = JVMTI_ERROR_NONE;
+		}
+
+		omrthread_monitor_exit(j9env->objectTagTableMutexes[shard]);
 	}
 
+	TRACE_JVMTI_RETURN(jvmtiRemoveAllTags);
+}
+
+/**
+ * Declare whether the heap callbacks of this environment are thread safe. IterateThroughHeap
+ * calls thread safe callbacks concurrently on the GC worker threads, and the agent must then
+ * not assume that the objects are reported in any particular order.
+ */
+static jvmtiError JNICALL
+jvmtiSetHeapCallbacksThreadSafe(jvmtiEnv* jvmti_env, ...)
+{
+	J9JVMTIEnv * j9env = (J9JVMTIEnv *) jvmti_env;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	jboolean threadSafe;
+	va_list args;
+
+	va_start(args, jvmti_env);
+	threadSafe = (jboolean) va_arg(args, jint);
+	va_end(args);
+
+	Trc_JVMTI_jvmtiSetHeapCallbacksThreadSafe_Entry(jvmti_env, threadSafe);
+
+	omrthread_monitor_enter(j9env->mutex);
+	if (threadSafe) {
+		j9env->flags |= J9JVMTIENV_FLAG_HEAP_CALLBACKS_THREAD_SAFE;
+	} else {
+		j9env->flags &= ~(UDATA)J9JVMTIENV_FLAG_HEAP_CALLBACKS_THREAD_SAFE;
+	}
 	omrthread_monitor_exit(j9env->mutex);
 
-	TRACE_JVMTI_RETURN(jvmtiRemoveAllTags);
+	TRACE_JVMTI_RETURN(jvmtiSetHeapCallbacksThreadSafe);
 }
 
 
@@ -96,6 +96,7 @@ typedef struct J9JVMTIHeapData {
 	jvmtiHeapTags	 tags;
 
 	const jvmtiHeapCallbacks *callbacks;
+	BOOLEAN            concurrent;     /** callbacks run on several GC worker threads, tag table shards must be locked */
 } J9JVMTIHeapData;
 
 
@@ -104,6 +105,7 @@ typedef struct J9JVMTIHeapData {
 static UDATA copyObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static UDATA countObjectTags (J9JVMTIObjectTag * entry, J9JVMTIObjectTagMatch * results);
 static jvmtiIterationControl iterateThroughHeapCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDesc, void * userData);
+static jvmtiIterationControl iterateThroughHeapParallelCallback(J9VMThread * workerThread, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void * userData);
 
 static jvmtiIterationControl wrap_heapReferenceCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
 static jvmtiIterationControl wrap_heapIterationCallback(J9JavaVM * vm, J9JVMTIHeapData * iteratorData);
@@ -120,6 +122,8 @@ static void mapEventType(J9JVMTIHeapData * data, IDATA type, jint index, j9objec
 static void jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9object_t  object); 
 static UDATA jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData * iteratorData, J9MM_StackSlotDescriptor *stackSlotDescriptor);
 static IDATA heapReferenceFilter(J9JVMTIHeapData * iteratorData);
+static jlong heapWalkGetTag(J9JVMTIHeapData * iteratorData, j9object_t object);
+static jvmtiError heapWalkSetTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong tag);
 
 
 #ifdef JVMTI_HEAP_DEBUG
@@ -173,8 +177,7 @@ jvmtiGetTag(jvmtiEnv* env,
 
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
-		J9JVMTIObjectTag entry;
-		J9JVMTIObjectTag * objectTag;
+		j9object_t ref = NULL;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
 
@@ -184,20 +187,11 @@ jvmtiGetTag(jvmtiEnv* env,
 		ENSURE_JOBJECT_NON_NULL(object);
 		ENSURE_NON_NULL(tag_ptr);
 
-		entry.ref = *(j9object_t *)object;
-
-		if ( entry.ref ) {
-
-			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
-
-			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-			if (objectTag) {
-				rv_tag = objectTag->tag;
-			}
-
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+		ref = *(j9object_t *)object;
 
+		if ( ref ) {
+			/* Only the tag table shard holding this object is locked */
+			rv_tag = getObjectTag((J9JVMTIEnv *)env, ref);
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
 		}
@@ -226,8 +220,7 @@ jvmtiSetTag(jvmtiEnv* env,
 
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
-		J9JVMTIObjectTag entry;
-		J9JVMTIObjectTag * objectTag;
+		j9object_t ref = NULL;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
 
@@ -236,31 +229,11 @@ jvmtiSetTag(jvmtiEnv* env,
 
 		ENSURE_JOBJECT_NON_NULL(object);
 
-		entry.ref = *(j9object_t *)object;
-		entry.tag = tag;
-
-		if ( entry.ref ) {
-
-			/* Ensure exclusive access to tag table */
-			omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
-
-			objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-			if (objectTag) {
-				if (tag) {
-					objectTag->tag = tag;
-				} else {
-					hashTableRemove(((J9JVMTIEnv *)env)->objectTagTable, &entry);
-				}
-			} else {
-				if (tag) {
-					if ( hashTableAdd(((J9JVMTIEnv *)env)->objectTagTable, &entry) == NULL ) {
-						rc = JVMTI_ERROR_OUT_OF_MEMORY;
-					}
-				}
-			}
-
-			omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+		ref = *(j9object_t *)object;
 
+		if ( ref ) {
+			/* Only the tag table shard holding this object is locked */
+			rc = setObjectTag((J9JVMTIEnv *)env, ref, tag);
 		} else {
 			rc = JVMTI_ERROR_INVALID_OBJECT;
 		}
@@ -324,6 +297,7 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 	rc = getCurrentVMThread(vm, &currentThread);
 	if (rc == JVMTI_ERROR_NONE) {
 		jint i;
+		UDATA shard = 0;
 		J9JVMTIObjectTagMatch results;
 
 		vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
@@ -346,8 +320,8 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			}
 		}
 
-		/* Ensure exclusive access to tag table */
-		omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+		/* Ensure exclusive access to all tag table shards so that both passes see the same entries */
+		lockObjectTagTables((J9JVMTIEnv *)env);
 
 		memset(&results, 0, sizeof(J9JVMTIObjectTagMatch));
 
@@ -356,7 +330,9 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 		results.forTags = tags;
 		results.forLen = tag_count;
 
-		hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTable, (J9HashTableDoFn) countObjectTags, &results);
+		for (shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+			hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTables[shard], (J9HashTableDoFn) countObjectTags, &results);
+		}
 
 		if (object_result_ptr) {
 			results.objects = j9mem_allocate_memory(sizeof(jobject) * results.count, J9MEM_CATEGORY_JVMTI_ALLOCATE);
@@ -385,7 +361,9 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 
 			/* Fill in elements ... unwinds results.count */
 			if (object_result_ptr || tag_result_ptr) {
-				hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTable, (J9HashTableDoFn) copyObjectTags, &results);
+				for (shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+					hashTableForEachDo(((J9JVMTIEnv *)env)->objectTagTables[shard], (J9HashTableDoFn) copyObjectTags, &results);
+				}
 			}
 
 		} else {
@@ -394,7 +372,7 @@ jvmtiGetObjectsWithTags(jvmtiEnv* env,
 			j9mem_free_memory(results.tags);
 		}
 
-		omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+		unlockObjectTagTables((J9JVMTIEnv *)env);
 
 done:
 		vm->internalVMFunctions->internalExitVMToJNI(currentThread);
@@ -507,6 +485,7 @@ jvmtiFollowReferences(jvmtiEnv* env, jint heap_filter, jclass klass, jobject ini
 		iteratorData.userData = (void *) user_data;
 		iteratorData.clazz = 0;
 		iteratorData.rc = JVMTI_ERROR_NONE;
+		iteratorData.concurrent = FALSE;
 		
 		/* Do not report anything if the class filter set by the user is an interface class.  Quote from the spec:
 		 * "If klass is an interface, no objects are reported. This applies to both the object and primitive callbacks." 
@@ -847,8 +826,8 @@ jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData *iteratorData, J9MM_StackSlotDe
 	jint depth = -1;
 	J9Method *ramMethod = NULL;
 	jmethodID method = (jmethodID) -1;
-	J9JVMTIObjectTag search = {NULL, 0};
-	J9JVMTIObjectTag *result = NULL;
+	j9object_t threadObject = NULL;
+	jlong threadTag = 0;
 	jlong threadID = 0;
 	J9StackWalkState *walkState = stackSlotDescriptor->walkState;
 
@@ -884,22 +863,22 @@ jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData *iteratorData, J9MM_StackSlotDe
 
 	/* Find thread tag */
 	
-	search.ref = (j9object_t)stackSlotDescriptor->vmThread->threadObject;
+	threadObject = (j9object_t)stackSlotDescriptor->vmThread->threadObject;
 
-	if (NULL != search.ref) {
-		result = hashTableFind(iteratorData->env->objectTagTable, &search);
+	if (NULL != threadObject) {
+		threadTag = heapWalkGetTag(iteratorData, threadObject);
 
 		/* Retrieve the Thread ID. */
 		threadID = J9VMJAVALANGTHREAD_TID(iteratorData->currentThread, stackSlotDescriptor->vmThread->threadObject);
 	} else {
 		/* Set 0 for tag/ID since ref to threadObject can be lost while walking a continuation. */
-		result = NULL;
+		threadTag = 0;
 		threadID = 0;
 	}
 
 	switch (e->refKind) {
 		case JVMTI_HEAP_REFERENCE_STACK_LOCAL:
-			e->refInfo.stack_local.thread_tag = (result) ? result->tag : 0;
+			e->refInfo.stack_local.thread_tag = threadTag;
 			e->refInfo.stack_local.thread_id = threadID;
 			e->refInfo.stack_local.depth = depth;
 			e->refInfo.stack_local.method = method;
@@ -909,7 +888,7 @@ jvmtiHeapFollowRefs_getStackData(J9JVMTIHeapData *iteratorData, J9MM_StackSlotDe
 
 		case JVMTI_HEAP_REFERENCE_JNI_LOCAL:
 
-			e->refInfo.jni_local.thread_tag = (result) ? result->tag : 0;
+			e->refInfo.jni_local.thread_tag = threadTag;
 			e->refInfo.jni_local.thread_id = threadID;
 			e->refInfo.jni_local.depth = depth;
 			e->refInfo.jni_local.method = method;
@@ -999,33 +978,24 @@ jvmtiHeapFollowReferencesPrint(J9JavaVM * vm, j9object_t object, j9object_t refe
 static void
 jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9object_t  object) 
 {
-	J9JVMTIObjectTag entry, *result;
 	J9Class *clazz;
 
 	/* get the object tag */
-	entry.ref = object;
-	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-	iteratorData->tags.objectTag = (result == NULL) ? 0 : result->tag;
+	iteratorData->tags.objectTag = heapWalkGetTag(iteratorData, object);
 	
 	/* get the class (of object) tag */
 	clazz = J9OBJECT_CLAZZ(iteratorData->currentThread, object);
-	entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-	result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-	iteratorData->tags.classTag = (result == NULL) ? 0 : result->tag;
+	iteratorData->tags.classTag = heapWalkGetTag(iteratorData, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 
 	/* The referrer argument for stack slot events carries metadata rather then
 	 * the usual j9object, ignore it here */   
 	if ((referrer != NULL) && (iteratorData->event.type != J9JVMTI_HEAP_EVENT_STACK)) {
 		/* get the referrer object tag */
-		entry.ref = referrer;
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-		iteratorData->tags.referrerObjectTag = (result == NULL) ? 0 : result->tag;
+		iteratorData->tags.referrerObjectTag = heapWalkGetTag(iteratorData, referrer);
 
 		/* get the referrer object class tag */
 		clazz = J9OBJECT_CLAZZ(iteratorData->currentThread, referrer);
-		entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-		iteratorData->tags.referrerClassTag = (result == NULL) ? 0 : result->tag;
+		iteratorData->tags.referrerClassTag = heapWalkGetTag(iteratorData, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 	} else {
 		iteratorData->tags.referrerObjectTag = 0;
 		iteratorData->tags.referrerClassTag = 0;
@@ -1036,6 +1006,48 @@ jvmtiFollowRefs_getTags(J9JVMTIHeapData * iteratorData, j9object_t  referrer, j9
 
 
 
+/**
+ * \brief	Look up an object tag during a heap walk
+ * \ingroup	jvmti.heap
+ *
+ * @param[in] iteratorData	iteration structure containing misc data
+ * @param[in] object		the object
+ * @return			the tag of the object, or 0 if it is not tagged
+ *
+ *	Serial walks hold exclusive VM access, which already excludes every other
+ *	user of the tag table. Only concurrent walks lock the tag table shard.
+ */
+static jlong
+heapWalkGetTag(J9JVMTIHeapData * iteratorData, j9object_t object)
+{
+	if (iteratorData->concurrent) {
+		return getObjectTag(iteratorData->env, object);
+	}
+	return getObjectTagNoLock(iteratorData->env, object);
+}
+
+
+
+/**
+ * \brief	Tag or untag an object during a heap walk
+ * \ingroup	jvmti.heap
+ *
+ * @param[in] iteratorData	iteration structure containing misc data
+ * @param[in] object		the object
+ * @param[in] tag		the new tag, 0 to untag the object
+ * @return			a jvmtiError value
+ */
+static jvmtiError
+heapWalkSetTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong tag)
+{
+	if (iteratorData->concurrent) {
+		return setObjectTag(iteratorData->env, object, tag);
+	}
+	return setObjectTagNoLock(iteratorData->env, object, tag);
+}
+
+
+
 /** 
  * \brief	GC event mapper 
  * \ingroup     jvmti.heap
@@ -1329,8 +1341,35 @@ jvmtiError JNICALL jvmtiIterateThroughHeap(jvmtiEnv* env,
 		vmFuncs->acquireExclusiveVMAccess(currentThread);
 		ensureHeapWalkable(currentThread);
 
-		/* Walk the heap */
-		vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		/* Walk the heap, on the GC worker threads if the callbacks of the environment are thread safe */
+		if (J9_ARE_ANY_BITS_SET(((J9JVMTIEnv *)env)->flags, J9JVMTIENV_FLAG_HEAP_CALLBACKS_THREAD_SAFE)) {
+			PORT_ACCESS_FROM_JAVAVM(vm);
+			UDATA threadCount = vm->memoryManagerFunctions->j9mm_parallel_iteration_thread_count(currentThread);
+			J9JVMTIHeapData *workerData = j9mem_allocate_memory(threadCount * sizeof(J9JVMTIHeapData), J9MEM_CATEGORY_JVMTI);
+
+			if (NULL != workerData) {
+				UDATA i = 0;
+
+				/* every worker thread reports through its own copy of the iterator data */
+				iteratorData.concurrent = TRUE;
+				for (i = 0; i < threadCount; i++) {
+					workerData[i] = iteratorData;
+				}
+				vm->memoryManagerFunctions->j9mm_iterate_all_objects_parallel(currentThread, vm->portLibrary, 0, iterateThroughHeapParallelCallback, workerData);
+				for (i = 0; i < threadCount; i++) {
+					if (JVMTI_ERROR_NONE != workerData[i].rc) {
+						iteratorData.rc = workerData[i].rc;
+						break;
+					}
+				}
+				j9mem_free_memory(workerData);
+			} else {
+				/* not enough memory to walk in parallel, walk on this thread */
+				vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+			}
+		} else {
+			vm->memoryManagerFunctions->j9mm_iterate_all_objects(vm, vm->portLibrary, 0, iterateThroughHeapCallback, &iteratorData);
+		}
 		rc = iteratorData.rc;
 
 		vmFuncs->releaseExclusiveVMAccess(currentThread);
@@ -1346,6 +1385,27 @@ done:
 
 
 
+/**
+ * \brief      Heap Iteration callback of the walk on the GC worker threads
+ * \ingroup    jvmti.heap
+ *
+ * @param[in] workerThread  the GC worker thread the callback runs on
+ * @param[in] objectDesc    object being iterated over
+ * @param[in] workerID      index of the worker thread, selects its iterator data
+ * @param[in] userData      array of <code>J9JVMTIHeapData</code>, one per worker thread
+ * @return                  JVMTI_ITERATION_ABORT to stop the walk on all the worker threads
+ */
+static jvmtiIterationControl
+iterateThroughHeapParallelCallback(J9VMThread *workerThread, J9MM_IterateObjectDescriptor *objectDesc, UDATA workerID, void * userData)
+{
+	J9JVMTIHeapData * iteratorData = &((J9JVMTIHeapData *)userData)[workerID];
+
+	iteratorData->currentThread = workerThread;
+	return iterateThroughHeapCallback(workerThread->javaVM, objectDesc, iteratorData);
+}
+
+
+
 /** 
  * \brief      Heap Iteration callback
  * \ingroup    jvmti.heap
@@ -2003,34 +2063,11 @@ getArrayPrimitiveType(J9VMThread* vmThread, j9object_t  object, jlong *primitive
 static void
 updateObjectTag(J9JVMTIHeapData * iteratorData, j9object_t object, jlong *originalTag, jlong newTag)
 {
-	J9JVMTIObjectTag entry;
-	J9JVMTIObjectTag *resultTag;
-	
-	/* The callback could have added or removed the tag. Modify the hashtable entry to
+	/* The callback could have added, changed or removed the tag. Modify the hashtable entry to
 	 * account for it */
-	if (*originalTag != 0) {
-		/* object was tagged before callback */
-		if (newTag) {
-			if (*originalTag != newTag) {
-				/* was and still is tagged, but the user has changed the tag */
-				entry.ref = object;
-				resultTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
-				resultTag->tag = newTag;
-			}
-		} else {
-			/* no longer tagged, remove the table entry */
-			entry.ref = object;
-			hashTableRemove(iteratorData->env->objectTagTable, &entry);
-			*originalTag = 0;
-		}
-	} else {
-		/* object was untagged before callback */
-		if (newTag) {
-			/* now tagged, add table entry */
-			entry.ref = object;
-			entry.tag = newTag;
-			resultTag = hashTableAdd(iteratorData->env->objectTagTable, &entry);
-			*originalTag = resultTag->tag;
+	if (*originalTag != newTag) {
+		if (JVMTI_ERROR_NONE == heapWalkSetTag(iteratorData, object, newTag)) {
+			*originalTag = newTag;
 		}
 	}
 }
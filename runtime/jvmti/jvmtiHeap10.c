@@ -468,8 +468,7 @@ processStackRoot(J9JVMTIObjectIteratorData *data, J9JVMTIObjectTag *entry, jlong
 	jint depth = -1;
 	J9Method *ramMethod = NULL;
 	jmethodID method = (jmethodID) -1;
-	J9JVMTIObjectTag search = {NULL, 0};
-	J9JVMTIObjectTag *result = NULL;
+	jlong threadTag = 0;
 
 	if (NULL != stackSlotDescriptor->walkState) {
 		J9StackWalkState *walkState = stackSlotDescriptor->walkState;
@@ -504,8 +503,7 @@ processStackRoot(J9JVMTIObjectIteratorData *data, J9JVMTIObjectTag *entry, jlong
 
 	/* Find thread tag */
 
-	search.ref = (j9object_t)stackSlotDescriptor->vmThread->threadObject;
-	result = hashTableFind(data->env->objectTagTable, &search);
+	threadTag = getObjectTagNoLock(data->env, (j9object_t)stackSlotDescriptor->vmThread->threadObject);
 	
 	/* Call the callback */
 
@@ -514,7 +512,7 @@ processStackRoot(J9JVMTIObjectIteratorData *data, J9JVMTIObjectTag *entry, jlong
 		classTag,
 		size,
 		&entry->tag,
-		result ? result->tag : 0,
+		threadTag,
 		depth,
 		method,
 		slot,
@@ -529,6 +527,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 	J9JVMTIHeapIteratorData * iteratorData = userData;
 
 	if ( iteratorData->clazz == NULL ||isSameOrSuperClassOf(iteratorData->clazz, J9OBJECT_CLAZZ_VM(vm, object))) {
+		J9HashTable * objectTagTable = iteratorData->env->objectTagTables[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)];
 		J9JVMTIObjectTag entry;
 		J9JVMTIObjectTag * objectTag;
 
@@ -538,26 +537,25 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 		}
 
 		entry.ref = object;
-		objectTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
+		objectTag = hashTableFind(objectTagTable, &entry);
 
 		if ( (iteratorData->filter == JVMTI_HEAP_OBJECT_EITHER) ||
 		     (iteratorData->filter == JVMTI_HEAP_OBJECT_TAGGED && objectTag != NULL) ||
 		     (iteratorData->filter == JVMTI_HEAP_OBJECT_UNTAGGED && objectTag == NULL) )
 		{
 			jvmtiIterationControl rc;
-			J9JVMTIObjectTag * classTag;
+			jlong classTag;
 			jlong objectSize;
 			jlong tag = objectTag ? objectTag->tag : 0;
 			J9Class *clazz;
 
 			clazz = J9OBJECT_CLAZZ_VM(vm, object);
-			entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-			classTag = hashTableFind(iteratorData->env->objectTagTable, &entry);
+			classTag = getObjectTagNoLock(iteratorData->env, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 
 			objectSize = getObjectSize(vm, object);
 
 			rc = iteratorData->callback(
-					classTag ? classTag->tag : 0,
+					classTag,
 					objectSize,
 					&tag,
 					iteratorData->userData);
@@ -570,7 +568,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 				} else {
 					/* no longer tagged, remove the table entry */
 					entry.ref = object;
-					hashTableRemove(iteratorData->env->objectTagTable, &entry);
+					hashTableRemove(objectTagTable, &entry);
 				}
 			} else {
 				/* object was untagged before callback */
@@ -578,7 +576,7 @@ wrapHeapIterationCallback(J9JavaVM * vm, J9MM_IterateObjectDescriptor *objectDes
 					/* now tagged, add table entry */
 					entry.ref = object;
 					entry.tag = tag;
-					hashTableAdd(iteratorData->env->objectTagTable, &entry);
+					hashTableAdd(objectTagTable, &entry);
 				}
 			}
 		
@@ -601,6 +599,7 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 	J9JVMTIHeapEvent event = mapEventType(vmThread, iteratorData, type, referrerIndex, referrer, object);
 
 	if (( event.type != J9JVMTI_HEAP_EVENT_NONE ) && ( event.type != J9JVMTI_HEAP_EVENT_NONE_NOFOLLOW )) {
+		J9HashTable * objectTagTable = iteratorData->env->objectTagTables[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)];
 		J9JVMTIObjectTag entry;
 		J9JVMTIObjectTag * result;
 		J9Class* clazz;
@@ -614,21 +613,17 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 		}
 
 		clazz = J9OBJECT_CLAZZ(vmThread, object);
-		entry.ref = J9VM_J9CLASS_TO_HEAPCLASS(clazz);
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-		classTag = result ? result->tag : 0;
+		classTag = getObjectTagNoLock(iteratorData->env, J9VM_J9CLASS_TO_HEAPCLASS(clazz));
 
 		if ( referrer && (event.type != J9JVMTI_HEAP_EVENT_STACK)) {
-			entry.ref = referrer;
-			result = hashTableFind(iteratorData->env->objectTagTable, &entry);
-			referrerTag = result ? result->tag : 0;
+			referrerTag = getObjectTagNoLock(iteratorData->env, referrer);
 		}
 
 		objectSize = getObjectSize(vm, object);
 
 		entry.ref = object;
 		entry.tag = 0;
-		result = hashTableFind(iteratorData->env->objectTagTable, &entry);
+		result = hashTableFind(objectTagTable, &entry);
 		if ( result == NULL ) {
 			result = &entry;
 		}
@@ -650,12 +645,12 @@ wrapObjectIterationCallback(j9object_t *slotPtr, j9object_t referrer, void *user
 		if ( &entry == result ) {
 			/* Tag wasn't set, but now is... */
 			if (result->tag != 0) {
-				hashTableAdd(iteratorData->env->objectTagTable, result);
+				hashTableAdd(objectTagTable, result);
 			}
 		} else {
 			/* Tag was set, but now isn't... */
 			if (result->tag == 0) {
-				hashTableRemove(iteratorData->env->objectTagTable, result);
+				hashTableRemove(objectTagTable, result);
 			}
 		}
 	} else if (J9JVMTI_HEAP_EVENT_NONE_NOFOLLOW == event.type) {
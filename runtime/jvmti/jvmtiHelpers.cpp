@@ -222,9 +222,15 @@ disposeEnvironment(J9JVMTIEnv * j9env, UDATA freeData)
 			j9env->threadDataPool = NULL;
 		}
 
-		if (NULL != j9env->objectTagTable) {
-			hashTableFree(j9env->objectTagTable);
-			j9env->objectTagTable = NULL;
+		for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+			if (NULL != j9env->objectTagTables[shard]) {
+				hashTableFree(j9env->objectTagTables[shard]);
+				j9env->objectTagTables[shard] = NULL;
+			}
+			if (NULL != j9env->objectTagTableMutexes[shard]) {
+				omrthread_monitor_destroy(j9env->objectTagTableMutexes[shard]);
+				j9env->objectTagTableMutexes[shard] = NULL;
+			}
 		}
 
 		if (NULL != j9env->watchedClasses) {
@@ -322,9 +328,14 @@ allocateEnvironment(J9InvocationJavaVM * invocationJavaVM, jint version, void **
 			if (j9env->threadDataPool == NULL) {
 				goto fail;
 			}
-			j9env->objectTagTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0, J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, NULL);
-			if (j9env->objectTagTable == NULL) {
-				goto fail;
+			for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+				if (omrthread_monitor_init_with_name(&(j9env->objectTagTableMutexes[shard]), 0, "JVMTI object tag table") != 0) {
+					goto fail;
+				}
+				j9env->objectTagTables[shard] = newObjectTagTable(vm);
+				if (j9env->objectTagTables[shard] == NULL) {
+					goto fail;
+				}
 			}
 			j9env->watchedClasses = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIWatchedClass), sizeof(UDATA), 0, J9MEM_CATEGORY_JVMTI, watchedClassHash, watchedClassEqual, NULL, NULL);
 			if (j9env->watchedClasses == NULL) {
@@ -944,6 +955,103 @@ hashEqualObjectTag(void *lhsEntry, void *rhsEntry, void *userData)
 }
 
 
+J9HashTable *
+newObjectTagTable(J9JavaVM *vm)
+{
+	return hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9JVMTIObjectTag), sizeof(jlong), 0, J9MEM_CATEGORY_JVMTI, hashObjectTag, hashEqualObjectTag, NULL, NULL);
+}
+
+
+jlong
+getObjectTagNoLock(J9JVMTIEnv *j9env, j9object_t object)
+{
+	J9JVMTIObjectTag entry;
+	J9JVMTIObjectTag *objectTag = NULL;
+
+	entry.ref = object;
+	objectTag = (J9JVMTIObjectTag *)hashTableFind(j9env->objectTagTables[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)], &entry);
+
+	return (NULL == objectTag) ? 0 : objectTag->tag;
+}
+
+
+jvmtiError
+setObjectTagNoLock(J9JVMTIEnv *j9env, j9object_t object, jlong tag)
+{
+	J9HashTable *objectTagTable = j9env->objectTagTables[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)];
+	J9JVMTIObjectTag entry;
+	J9JVMTIObjectTag *objectTag = NULL;
+	jvmtiError rc = JVMTI_ERROR_NONE;
+
+	entry.ref = object;
+	entry.tag = tag;
+
+	objectTag = (J9JVMTIObjectTag *)hashTableFind(objectTagTable, &entry);
+	if (NULL != objectTag) {
+		if (0 != tag) {
+			objectTag->tag = tag;
+		} else {
+			hashTableRemove(objectTagTable, &entry);
+		}
+	} else if (0 != tag) {
+		if (NULL == hashTableAdd(objectTagTable, &entry)) {
+			rc = JVMTI_ERROR_OUT_OF_MEMORY;
+		}
+	}
+
+	return rc;
+}
+
+
+jlong
+getObjectTag(J9JVMTIEnv *j9env, j9object_t object)
+{
+	omrthread_monitor_t mutex = j9env->objectTagTableMutexes[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)];
+	jlong tag = 0;
+
+	omrthread_monitor_enter(mutex);
+	tag = getObjectTagNoLock(j9env, object);
+	omrthread_monitor_exit(mutex);
+
+	return tag;
+}
+
+
+jvmtiError
+setObjectTag(J9JVMTIEnv *j9env, j9object_t object, jlong tag)
+{
+	omrthread_monitor_t mutex = j9env->objectTagTableMutexes[J9JVMTI_OBJECT_TAG_TABLE_SHARD(object)];
+	jvmtiError rc = JVMTI_ERROR_NONE;
+
+	omrthread_monitor_enter(mutex);
+	rc = setObjectTagNoLock(j9env, object, tag);
+	omrthread_monitor_exit(mutex);
+
+	return rc;
+}
+
+
+void
+lockObjectTagTables(J9JVMTIEnv *j9env)
+{
+	for (UDATA shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+		omrthread_monitor_enter(j9env->objectTagTableMutexes[shard]);
+	}
+}
+
+
+void
+unlockObjectTagTables(J9JVMTIEnv *j9env)
+{
+	UDATA shard = J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT;
+
+	while (shard > 0) {
+		shard -= 1;
+		omrthread_monitor_exit(j9env->objectTagTableMutexes[shard]);
+	}
+}
+
+
 static UDATA
 watchedClassHash(void *entry, void *userData)
 {
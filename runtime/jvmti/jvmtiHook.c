@@ -2400,7 +2400,9 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 	J9JVMTIObjectTag * taggedObject;
 	J9HashTableState hashState;
 	UDATA phase = J9JVMTI_DATA_FROM_ENV(j9env)->phase;
-	J9JVMTIObjectTag * deletedHead = NULL;
+	jvmtiEventObjectFree objectFreeCallback = j9env->callbacks.ObjectFree;
+	UDATA reportObjectFreeEvents = FALSE;
+	UDATA shard = 0;
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
 	J9VMThread * currentThread = NULL;
 	UDATA javaOffloadOldState = 0;
@@ -2416,32 +2418,33 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 
 	Trc_JVMTI_jvmtiHookGCEnd_Entry();
 
-	/* Link all NULLed entries */
+	reportObjectFreeEvents =
+		(phase == JVMTI_PHASE_LIVE) &&
+		(objectFreeCallback != NULL) &&
+		EVENT_IS_ENABLED(JVMTI_EVENT_OBJECT_FREE, &(j9env->globalEventEnable));
 
-	taggedObject = hashTableStartDo(j9env->objectTagTable, &hashState);
-	while (taggedObject != NULL) {
-		if (taggedObject->ref == NULL) {
-			taggedObject->ref = (j9object_t) deletedHead;
-			deletedHead = (J9JVMTIObjectTag *) taggedObject;
-		}
-		taggedObject = hashTableNextDo(&hashState);
-	}
+	for (shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+		J9HashTable * objectTagTable = j9env->objectTagTables[shard];
+		J9JVMTIObjectTag * deletedHead = NULL;
 
-	/* Rehash the object tag table for this environment */
+		/* Link all NULLed entries */
 
-	hashTableRehash(j9env->objectTagTable);
+		taggedObject = hashTableStartDo(objectTagTable, &hashState);
+		while (taggedObject != NULL) {
+			if (taggedObject->ref == NULL) {
+				taggedObject->ref = (j9object_t) deletedHead;
+				deletedHead = (J9JVMTIObjectTag *) taggedObject;
+			}
+			taggedObject = hashTableNextDo(&hashState);
+		}
 
-	/* Remove freed objects from the tag table - report events if need be */
+		/* Rehash the object tag table shard */
 
-	if (deletedHead != NULL) {
-		jvmtiEventObjectFree objectFreeCallback = j9env->callbacks.ObjectFree;
-		UDATA reportObjectFreeEvents;
+		hashTableRehash(objectTagTable);
 
-		reportObjectFreeEvents =
-			(phase == JVMTI_PHASE_LIVE) &&
-			(objectFreeCallback != NULL) &&
-			EVENT_IS_ENABLED(JVMTI_EVENT_OBJECT_FREE, &(j9env->globalEventEnable));
-		do {
+		/* Remove freed objects from the tag table - report events if need be */
+
+		while (deletedHead != NULL) {
 			taggedObject = deletedHead;
 			if (reportObjectFreeEvents) {
 #if defined(J9VM_OPT_JAVA_OFFLOAD_SUPPORT)
@@ -2459,8 +2462,25 @@ jvmtiHookGCEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* us
 #endif /* J9VM_OPT_JAVA_OFFLOAD_SUPPORT */
 			}
 			deletedHead = (J9JVMTIObjectTag *) taggedObject->ref;
-			hashTableRemove(j9env->objectTagTable, taggedObject);
-		} while (deletedHead != NULL);
+			hashTableRemove(objectTagTable, taggedObject);
+		}
+	}
+
+	/* Objects moved by the GC may now select a different shard - migrate their entries.
+	 * An entry which cannot be added to its new shard is left in place and retried at the next GC.
+	 */
+
+	for (shard = 0; shard < J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT; shard++) {
+		taggedObject = hashTableStartDo(j9env->objectTagTables[shard], &hashState);
+		while (taggedObject != NULL) {
+			UDATA targetShard = J9JVMTI_OBJECT_TAG_TABLE_SHARD(taggedObject->ref);
+			if (targetShard != shard) {
+				if (NULL != hashTableAdd(j9env->objectTagTables[targetShard], taggedObject)) {
+					hashTableDoRemove(&hashState);
+				}
+			}
+			taggedObject = hashTableNextDo(&hashState);
+		}
 	}
 
 	/* Call the event callback */
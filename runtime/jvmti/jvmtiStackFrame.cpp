@@ -36,6 +36,18 @@ static jvmtiError jvmtiInternalGetStackTrace(
 	jvmtiEnv *env, J9VMThread *currentThread, J9VMThread *targetThread, j9object_t threadObject,
 	jint start_depth, UDATA max_frame_count, jvmtiFrameInfo *frame_buffer, jint *count_ptr);
 
+typedef struct J9JVMTIGetStackTraceData {
+	jvmtiEnv *env;
+	jthread thread;
+	jint startDepth;
+	UDATA maxFrameCount;
+	jvmtiFrameInfo *frameBuffer;
+	jint count;
+	jvmtiError rc;
+} J9JVMTIGetStackTraceData;
+
+static void jvmtiGetStackTraceHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData);
+
 
 jvmtiError JNICALL
 jvmtiGetStackTrace(jvmtiEnv* env,
@@ -69,20 +81,20 @@ jvmtiGetStackTrace(jvmtiEnv* env,
 				currentThread, thread, &targetThread, JVMTI_ERROR_NONE,
 				J9JVMTI_GETVMTHREAD_ERROR_ON_DEAD_THREAD);
 		if (rc == JVMTI_ERROR_NONE) {
-			j9object_t threadObject = NULL;
-#if JAVA_SPEC_VERSION >= 19
-			if (NULL != targetThread)
-#endif /* JAVA_SPEC_VERSION >= 19 */
-			{
-				vmFuncs->haltThreadForInspection(currentThread, targetThread);
-			}
-			threadObject = (NULL == thread) ? currentThread->threadObject : J9_JNI_UNWRAP_REFERENCE(thread);
-			rc = jvmtiInternalGetStackTrace(env, currentThread, targetThread, threadObject, start_depth, (UDATA) max_frame_count, frame_buffer, &rv_count);
 #if JAVA_SPEC_VERSION >= 19
-			if (NULL != targetThread)
+			if (NULL == targetThread) {
+				/* An unmounted virtual thread has no thread to run on - walk its continuation directly */
+				j9object_t threadObject = J9_JNI_UNWRAP_REFERENCE(thread);
+				rc = jvmtiInternalGetStackTrace(env, currentThread, targetThread, threadObject, start_depth, (UDATA) max_frame_count, frame_buffer, &rv_count);
+			} else
 #endif /* JAVA_SPEC_VERSION >= 19 */
 			{
-				vmFuncs->resumeThreadForInspection(currentThread, targetThread);
+				J9JVMTIGetStackTraceData data = { env, thread, start_depth, (UDATA) max_frame_count, frame_buffer, 0, JVMTI_ERROR_NONE };
+
+				/* Walk the stack at the next safe point of the target thread rather than stopping it */
+				vmFuncs->executeThreadHandshake(currentThread, targetThread, jvmtiGetStackTraceHandshake, &data);
+				rc = data.rc;
+				rv_count = data.count;
 			}
 			releaseVMThread(currentThread, targetThread, thread);
 		}
@@ -911,6 +923,20 @@ jvmtiInternalGetStackTrace(
 	return JVMTI_ERROR_NONE;
 }
 
+/**
+ * Thread handshake function which walks the stack of the target thread for GetStackTrace.
+ * The thread object is unwrapped here since VM access may have been released since the
+ * request was made.
+ */
+static void
+jvmtiGetStackTraceHandshake(J9VMThread *currentThread, J9VMThread *targetThread, void *userData)
+{
+	J9JVMTIGetStackTraceData *data = (J9JVMTIGetStackTraceData *)userData;
+	j9object_t threadObject = (NULL == data->thread) ? targetThread->threadObject : J9_JNI_UNWRAP_REFERENCE(data->thread);
+
+	data->rc = jvmtiInternalGetStackTrace(data->env, currentThread, targetThread, threadObject, data->startDepth, data->maxFrameCount, data->frameBuffer, &data->count);
+}
+
 #if JAVA_SPEC_VERSION >= 25
 /**
  * @brief Iterator function used during a stack walk to clear frame pop requests.
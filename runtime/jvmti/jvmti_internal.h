@@ -964,6 +964,70 @@ jvmtiTLSGet(J9VMThread *vmThread, j9object_t thread, UDATA key);
 void
 ensureHeapWalkable(J9VMThread *currentThread);
 
+/**
+* @brief Get the tag of an object. The caller must hold exclusive VM access or the mutex of
+* the object tag table shard which holds the object.
+* @param j9env The JVMTI environment
+* @param object The object
+* @return the tag of the object, or 0 if the object is not tagged
+*/
+jlong
+getObjectTagNoLock(J9JVMTIEnv *j9env, j9object_t object);
+
+/**
+* @brief Tag an object, or untag it if tag is 0. The caller must hold exclusive VM access or the
+* mutex of the object tag table shard which holds the object.
+* @param j9env The JVMTI environment
+* @param object The object
+* @param tag The new tag
+* @return JVMTI_ERROR_NONE on success, JVMTI_ERROR_OUT_OF_MEMORY if a new entry could not be added
+*/
+jvmtiError
+setObjectTagNoLock(J9JVMTIEnv *j9env, j9object_t object, jlong tag);
+
+/**
+* @brief Get the tag of an object, locking the object tag table shard which holds it
+* @param j9env The JVMTI environment
+* @param object The object
+* @return the tag of the object, or 0 if the object is not tagged
+*/
+jlong
+getObjectTag(J9JVMTIEnv *j9env, j9object_t object);
+
+/**
+* @brief Tag an object, or untag it if tag is 0, locking the object tag table shard which holds it
+* @param j9env The JVMTI environment
+* @param object The object
+* @param tag The new tag
+* @return JVMTI_ERROR_NONE on success, JVMTI_ERROR_OUT_OF_MEMORY if a new entry could not be added
+*/
+jvmtiError
+setObjectTag(J9JVMTIEnv *j9env, j9object_t object, jlong tag);
+
+/**
+* @brief Lock every object tag table shard of an environment, in shard order
+* @param j9env The JVMTI environment
+* @return void
+*/
+void
+lockObjectTagTables(J9JVMTIEnv *j9env);
+
+/**
+* @brief Unlock every object tag table shard locked by lockObjectTagTables
+* @param j9env The JVMTI environment
+* @return void
+*/
+void
+unlockObjectTagTables(J9JVMTIEnv *j9env);
+
+/**
+* @brief Create an empty object tag table shard
+* @param vm The Java VM
+* @return the new hash table, or NULL on allocation failure
+*/
+J9HashTable *
+newObjectTagTable(J9JavaVM *vm);
+
 
 /**
 * @brief
@@ -282,17 +282,55 @@ public:
 		}
 	}
 
+	/**
+	 * Record where currentThread was when it responded to an exclusive or safe point access request.
+	 * Responses arrive in time order, so keeping the most recent responders keeps the slowest ones.
+	 * The literals of the thread only hold its method if the top frame is a bytecode frame; for special
+	 * frames (such as JIT resolve or native method frames) and JNI call-in frames only the frame type
+	 * and the JIT return address are recorded.
+	 * Caller must hold vm->exclusiveAccessMutex.
+	 *
+	 * @parm[in] stats the statistics of the request
+	 * @parm[in] currentThread the thread responding
+	 * @parm[in] responseTime the time in ticks the thread took to respond
+	 * @parm[in] reason J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE or J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL
+	 */
+	static VMINLINE void
+	recordExclusiveAccessResponder(J9ExclusiveAccessSyncStats *stats, J9VMThread *currentThread, U_64 responseTime, UDATA reason)
+	{
+		J9ExclusiveAccessResponder *responder = &stats->responders[stats->responderCount % J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS];
+		U_8 *pc = currentThread->pc;
+		U_8 *callInReturnPC = currentThread->javaVM->callInReturnPC;
+		responder->thread = currentThread;
+		responder->responseTime = responseTime;
+		responder->pc = pc;
+		if (((UDATA)pc > J9SF_MAX_SPECIAL_FRAME_TYPE) && (callInReturnPC != pc) && ((callInReturnPC + 3) != pc)) {
+			responder->method = currentThread->literals;
+			responder->jitPC = NULL;
+		} else {
+			responder->method = NULL;
+			responder->jitPC = currentThread->jitReturnAddress;
+		}
+		responder->publicFlags = currentThread->publicFlags;
+		responder->reason = reason;
+		stats->responderCount += 1;
+		if (J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL == reason) {
+			stats->jniCriticalResponderCount += 1;
+		}
+	}
+
 	/**
 	 * Update the vm's J9ExclusiveVMStats structure once currentThread has responded.
 	 *
 	 * @parm[in] currentThread the thread responding
 	 * @parm[in] vm the J9JavaVM
 	 * @parm[in] portLibrary the port library
+	 * @parm[in] reason J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE or J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL
 	 *
 	 * @return the current time used for the statistics
 	 */
 	static VMINLINE U_64
-	updateExclusiveVMAccessStats(J9VMThread* currentThread, J9JavaVM *vm, J9PortLibrary *portLibrary)
+	updateExclusiveVMAccessStats(J9VMThread* currentThread, J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA reason)
 	{
 		PORT_ACCESS_FROM_PORT(portLibrary);
 		/* update stats */
@@ -305,6 +343,9 @@ public:
 		vm->omrVM->exclusiveVMAccessStats.totalResponseTime += (timeNow - exclusiveStartTime);
 		vm->omrVM->exclusiveVMAccessStats.lastResponder = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 		vm->omrVM->exclusiveVMAccessStats.haltedThreads += 1;
+		if (NULL != currentThread) {
+			recordExclusiveAccessResponder(&vm->exclusiveAccessSyncStats, currentThread, timeNow - exclusiveStartTime, reason);
+		}
 		return timeNow;
 	}
 
@@ -390,6 +390,11 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME3_ENABLE_JFR_CLASSLOAD_TRANSFORM 0x100
 #define J9_EXTENDED_RUNTIME3_JFR_V2_SUPPORT 0x200
 #define J9_EXTENDED_RUNTIME3_GCCONTAINERHEURISTICS 0x400
+#define J9_EXTENDED_RUNTIME3_SHARE_MAPS 0x800
+#define J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT 0x1000
+#define J9_EXTENDED_RUNTIME3_SHARDED_MONITOR_TABLE 0x2000
+#define J9_EXTENDED_RUNTIME3_COMPACT_PARKED_CONTINUATION_STACKS 0x4000
+#define J9_EXTENDED_RUNTIME3_FORCE_CONTINUATION_THAW_FAILURE 0x8000
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
 #define J9_OBJECT_HEADER_SHAPE_MASK 0xE /* OBJECT_HEADER_SHAPE_MASK */
@@ -989,6 +994,9 @@ extern "C" {
 #define J9JFR_EVENT_TYPE_YOUNG_GC_ENTRY 14
 #define J9JFR_EVENT_TYPE_GARBAGE_COLLECTION_ENTRY 15
 #define J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY 16
+#define J9JFR_EVENT_TYPE_SAFEPOINT 17
+#define J9JFR_EVENT_TYPE_CONTINUATION_FREEZE 18
+#define J9JFR_EVENT_TYPE_CONTINUATION_THAW 19
 
 /* JFR thread states. */
 
@@ -43,6 +43,11 @@
 
 #define J9VM_DLT_HISTORY_SIZE  16
 #define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_MONITOR_TABLE_SHARD_CACHE_SIZE  256
+#define J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS  4
+#define J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS  4
+#define J9VM_EXCLUSIVE_SYNC_HISTOGRAM_BUCKETS  24
+#define J9VM_CONTINUATION_STACK_CACHE_SIZE  4
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 /* The bit fields used by verifyQualifiedName to verify a qualified class name */
@@ -341,6 +346,8 @@ struct J9MM_IterateObjectDescriptor;
 struct J9MM_IterateObjectRefDescriptor;
 struct J9MM_IterateRegionDescriptor;
 struct J9MM_IterateSpaceDescriptor;
+struct J9MM_IterateWorkUnitDescriptor;
+struct J9MM_WorkUnitIterator;
 struct J9ObjectMonitorInfo;
 struct J9Pool;
 struct J9PortLibrary;
@@ -544,6 +551,23 @@ typedef struct J9JFRGCHeapSummary {
 	I_64 heapUsed;
 } J9JFRGCHeapSummary;
 
+typedef struct J9JFRSafepoint {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	U_64 safepointID;
+	UDATA totalThreadCount;
+	UDATA jniCriticalThreadCount;
+	UDATA initialThreadCount;
+} J9JFRSafepoint;
+
+/* A continuation stack moved by a freeze or a thaw */
+typedef struct J9JFRContinuationStackMoved {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	struct J9Class *continuationClass;
+	UDATA size;
+} J9JFRContinuationStackMoved;
+
 typedef struct J9JFRTypeID {
 	jlong id;
 	struct J9UTF8 *className;
@@ -973,6 +997,12 @@ typedef struct J9ClassHotFieldsInfo {
 	uint8_t hotFieldListLength;
 } J9ClassHotFieldsInfo;
 
+/* Entry of J9JavaVM->hotFieldLayoutTable: the hot fields used to lay out instances of a ROM class with -XX:+HotFieldLayout */
+typedef struct J9HotFieldLayoutTableEntry {
+	struct J9ROMClass* romClass; /* key to the table */
+	U_64 hotFields; /* bit mask of instance field ordinals */
+} J9HotFieldLayoutTableEntry;
+
 typedef struct J9ROMNameAndSignature {
 	J9SRP name;
 	J9SRP signature;
@@ -1245,6 +1275,18 @@ typedef struct J9MapCacheEntry {
 	U_32 bits[J9_MAP_CACHE_SLOTS];
 } J9MapCacheEntry;
 
+/* Number of lock stripes for the map caches, and of shards in a split class loader cache - must be a power of 2 */
+#define J9_MAP_CACHE_SHARD_COUNT 16
+/* Number of entries in one table of a class loader's single shard which makes the loader split its caches */
+#define J9_MAP_CACHE_SPLIT_THRESHOLD 64
+
+/* One shard of a class loader's map caches, guarded by one of the J9JavaVM->mapCacheMutexes */
+typedef struct J9MapCacheShard {
+	struct J9HashTable* localmapCache;
+	struct J9HashTable* argsbitsCache;
+	struct J9HashTable* stackmapCache;
+} J9MapCacheShard;
+
 #if defined(J9VM_OPT_SHARED_CLASSES)
 
 typedef enum J9SharedClassCacheMode {
@@ -1867,6 +1909,67 @@ typedef struct J9MonitorTableListEntry {
 	struct J9MonitorTableListEntry* next;
 } J9MonitorTableListEntry;
 
+/* The lock and statistics for each of the J9JavaVM monitorTables. The lookup cache is only allocated
+ * with -XX:+ShardedMonitorTable, otherwise every shard shares the monitorTableMutex.
+ */
+typedef struct J9MonitorTableShard {
+	omrthread_monitor_t mutex;
+	j9objectmonitor_t* lookupCache;
+	UDATA hitCount;
+	UDATA missCount;
+	UDATA contendedCount;
+} J9MonitorTableShard;
+
+/* A thread which responded to an exclusive or safe point access request, and where it was when it responded.
+ * The thread is only valid while the request is held. The method is that of the bytecode frame the thread was in,
+ * or is resolved from the JIT return address when the request is reported.
+ */
+typedef struct J9ExclusiveAccessResponder {
+	struct J9VMThread* thread;
+	U_64 responseTime;
+	struct J9Method* method;
+	U_8* pc;
+	void* jitPC;
+	UDATA publicFlags;
+	UDATA reason;
+} J9ExclusiveAccessResponder;
+
+/* Time-to-safepoint statistics for exclusive or safe point access requests. The responders of the current
+ * request are kept in a ring, so the last J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS are the slowest ones.
+ * Bucket N of the histogram counts requests synchronized in [2^(N-1), 2^N) microseconds, and the last
+ * bucket also counts all longer ones.
+ */
+typedef struct J9ExclusiveAccessSyncStats {
+	U_64 startTime;
+	UDATA responderCount;
+	UDATA jniCriticalResponderCount;
+	J9ExclusiveAccessResponder responders[J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS];
+	U_64 requestCount;
+	U_64 totalSyncTime;
+	U_64 maxSyncTime;
+	U_64 syncTimeHistogram[J9VM_EXCLUSIVE_SYNC_HISTOGRAM_BUCKETS];
+} J9ExclusiveAccessSyncStats;
+
+/* A closure which runs on behalf of one thread, either on that thread at its next async check point or
+ * on the requesting thread while the target is halted for inspection. currentThread is the thread
+ * running the closure and has VM access; targetThread is the thread the closure was posted to.
+ */
+typedef void (*J9ThreadHandshakeFunction)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, void *userData);
+
+#define J9_THREAD_HANDSHAKE_POSTED  0
+#define J9_THREAD_HANDSHAKE_RUNNING  1
+#define J9_THREAD_HANDSHAKE_DONE  2
+
+/* A handshake posted to a thread. The record lives on the requester's stack, and its state is
+ * protected by the target's publicFlagsMutex.
+ */
+typedef struct J9ThreadHandshake {
+	J9ThreadHandshakeFunction function;
+	void *userData;
+	struct J9VMThread *requester;
+	UDATA state;
+} J9ThreadHandshake;
+
 typedef struct J9UnsafeMemoryBlock {
 	struct J9UnsafeMemoryBlock* linkNext;
 	struct J9UnsafeMemoryBlock* linkPrevious;
@@ -1964,6 +2067,11 @@ typedef struct J9ROMFieldOffsetWalkState {
 	U_32 objectStaticsSeen;
 	U_32 doubleStaticsSeen;
 	U_32 walkFlags;
+	U_64 hotInstanceFields;
+	U_32 instanceFieldsSeen;
+	U_32 hotObjectsSeen;
+	U_32 hotObjectSlots;
+	BOOLEAN hotObjectTakesBackfill;
 	UDATA lockOffset;
 	UDATA finalizeLinkOffset;
 	struct J9HiddenInstanceField hiddenLockwordField;
@@ -3868,10 +3976,8 @@ typedef struct J9ClassLoader {
 	omrthread_rwmutex_t cpEntriesMutex;
 	UDATA initClassPathEntryCount;
 	UDATA asyncGetCallTraceUsed;
-	omrthread_monitor_t mapCacheMutex;
-	struct J9HashTable* localmapCache;
-	struct J9HashTable* argsbitsCache;
-	struct J9HashTable* stackmapCache;
+	struct J9MapCacheShard* mapCacheShards;
+	UDATA mapCacheShardCount;
 #if defined(J9VM_OPT_JFR)
 	J9HashTable *typeIDs;
 #endif /* defined(J9VM_OPT_JFR) */
@@ -4995,6 +5101,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_ext_check_is_valid_heap_object)(struct J9JavaVM *javaVM, j9object_t ptr, UDATA flags) ;
 #if defined(J9VM_GC_FINALIZATION)
 	UDATA  ( *j9gc_get_objects_pending_finalization_count)(struct J9JavaVM* vm) ;
+	void  ( *j9gc_finalizer_statistics_do)(struct J9VMThread *vmThread, void (*func)(struct J9VMThread *vmThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData), void *userData) ;
 #endif /* defined(J9VM_GC_FINALIZATION) */
 	UDATA  ( *j9gc_set_softmx)(struct J9JavaVM *javaVM, UDATA newsoftmx) ;
 	UDATA  ( *j9gc_get_softmx)(struct J9JavaVM *javaVM) ;
@@ -5170,6 +5277,12 @@ typedef struct J9MemoryManagerFunctions {
 
 	jvmtiIterationControl  ( *j9mm_iterate_all_ownable_synchronizer_objects)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9VMThread *vmThread, struct J9MM_IterateObjectDescriptor *object, void *userData), void *userData) ;
 	jvmtiIterationControl  ( *j9mm_iterate_all_continuation_objects)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9VMThread *vmThread, struct J9MM_IterateObjectDescriptor *object, void *userData), void *userData) ;
+	UDATA  ( *j9mm_parallel_iteration_thread_count)(struct J9VMThread *vmThread) ;
+	jvmtiIterationControl  ( *j9mm_iterate_all_objects_parallel)(struct J9VMThread *vmThread, J9PortLibrary *portLibrary, UDATA flags, jvmtiIterationControl (*func)(struct J9VMThread *workerThread, struct J9MM_IterateObjectDescriptor *object, UDATA workerID, void *userData), void *userData) ;
+	struct J9MM_WorkUnitIterator*  ( *j9mm_start_work_units)(struct J9JavaVM *vm, J9PortLibrary *portLibrary, UDATA workUnitSize, BOOLEAN (*func)(struct J9JavaVM *vm, struct J9MM_IterateRegionDescriptor *regionDesc, j9object_t object, void *userData), void *userData) ;
+	BOOLEAN  ( *j9mm_next_work_unit)(struct J9MM_WorkUnitIterator *iterator, struct J9MM_IterateWorkUnitDescriptor *workUnit) ;
+	void  ( *j9mm_end_work_units)(struct J9MM_WorkUnitIterator *iterator) ;
+	jvmtiIterationControl  ( *j9mm_iterate_work_unit_objects)(struct J9JavaVM *vm, J9PortLibrary *portLibrary, struct J9MM_IterateWorkUnitDescriptor *workUnit, UDATA flags, jvmtiIterationControl (*func)(struct J9JavaVM *vm, struct J9MM_IterateObjectDescriptor *objectDesc, void *userData), void *userData) ;
 	UDATA ( *continuationObjectCreated)(struct J9VMThread *vmThread, j9object_t object) ;
 	UDATA ( *continuationObjectStarted)(struct J9VMThread *vmThread, j9object_t object) ;
 	UDATA ( *continuationObjectFinished)(struct J9VMThread *vmThread, j9object_t object) ;
@@ -5660,6 +5773,8 @@ typedef struct J9InternalVMFunctions {
 	UDATA (*totalNumberOfDisclaimableClassMemorySegments)(struct J9JavaVM *vm);
 	jint (*signalNameToValue)(const char *signalName);
 	void (JNICALL *internalRunStaticMethod)(struct J9VMThread *currentThread, struct J9Method *method, BOOLEAN returnsObject, UDATA argCount, UDATA *arguments);
+	BOOLEAN (*inheritHotFieldLayout)(struct J9JavaVM *javaVM, struct J9ROMClass *originalROMClass, struct J9ROMClass *replacementROMClass);
+	void (*executeThreadHandshake)(struct J9VMThread *currentThread, struct J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData);
 } J9InternalVMFunctions;
 
 /* Jazz 99339: define a new structure to replace JavaVM so as to pass J9NativeLibrary to JVMTIEnv  */
@@ -5780,6 +5895,10 @@ typedef struct J9VMContinuation {
 	I_64 startTicks;
 	struct J9VMThread* previousOwner;
 #endif /* JAVA_SPEC_VERSION >= 24 */
+	UDATA frozenStackSize;
+	U_64 frozenAt;
+	UDATA compactableYields;
+	UDATA freezeBackoff;
 } J9VMContinuation;
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
@@ -6065,6 +6184,11 @@ typedef struct J9VMThread {
 #endif /* defined(J9VM_OPT_JFR) */
 	U_8 *superClassNameBytes;
 	UDATA superClassNameLength;
+	J9ThreadHandshake *pendingHandshake;
+#if JAVA_SPEC_VERSION >= 19
+	J9JavaStack *continuationStackCache;
+	UDATA continuationStackCacheCount;
+#endif /* JAVA_SPEC_VERSION >= 19 */
 } J9VMThread;
 
 #if defined(J9VM_ENV_DATA64)
@@ -6167,6 +6291,20 @@ typedef struct JFRState {
 	jclass jfrEventClassRef;
 	J9Method *onRetransformUpcallMethod;
 	J9Method *transformToListMethod;
+	/* Continuous recording: chunks are streamed to rotating files by the JFR writer thread. */
+	BOOLEAN continuousRecording;
+	U_64 maxChunkSize;
+	U_64 maxChunkAge;
+	U_64 maxRetainedSize;
+	I_64 recordingFileStartTime;
+	UDATA recordingFileSequence;
+	UDATA oldestRetainedSequence;
+	U_64 retainedSize;
+	UDATA handedOffBufferCount;
+	UDATA writtenBufferCount;
+	UDATA droppedBufferCount;
+	U_64 droppedBytes;
+	U_64 reportedDroppedBytes;
 } JFRState;
 
 typedef struct J9ReflectFunctionTable {
@@ -6409,6 +6547,7 @@ typedef struct J9JavaVM {
 	struct J9HashTable** monitorTables;
 	UDATA monitorTableCount;
 	omrthread_monitor_t monitorTableMutex;
+	struct J9MonitorTableShard* monitorTableShards;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
 	UDATA thrStaggerStep;
@@ -6518,6 +6657,9 @@ typedef struct J9JavaVM {
 	struct J9HashTable* fieldIndexTable;
 	UDATA fieldIndexThreshold;
 	omrthread_monitor_t fieldIndexMutex;
+	struct J9HashTable* hotFieldLayoutTable;
+	omrthread_monitor_t hotFieldLayoutMutex;
+	BOOLEAN hotFieldLayoutTableFull;
 	IDATA  ( *localMapFunction)(struct J9PortLibrary * portLib, struct J9ROMClass * romClass, struct J9ROMMethod * romMethod, UDATA pc, U_32 * resultArrayBase, void * userData, UDATA * (* getBuffer) (void * userData), void (* releaseBuffer) (void * userData)) ;
 	UDATA realtimeHeapMapBasePageRounded;
 	UDATA* realtimeHeapMapBits;
@@ -6596,6 +6738,7 @@ typedef struct J9JavaVM {
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	IDATA threadNameHandlerKey;
 #endif /* defined(J9VM_THR_ASYNC_NAME_UPDATE) */
+	IDATA threadHandshakeHandlerKey;
 	char *decompileName;
 	omrthread_monitor_t classLoaderModuleAndLocationMutex;
 	struct J9Pool* modularityPool;
@@ -6614,6 +6757,8 @@ typedef struct J9JavaVM {
 	UDATA addModulesCount;
 	UDATA safePointState;
 	UDATA safePointResponseCount;
+	struct J9ExclusiveAccessSyncStats exclusiveAccessSyncStats;
+	struct J9ExclusiveAccessSyncStats safePointSyncStats;
 	BOOLEAN alreadyHaveExclusive;
 	struct J9VMRuntimeStateListener vmRuntimeStateListener;
 #if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
@@ -6685,6 +6830,12 @@ typedef struct J9JavaVM {
 	volatile U_32 t2store;
 	volatile U_32 cacheFree;
 	volatile U_64 totalContinuationStackSize;
+	volatile U_64 continuationFreezeCount;
+	volatile U_64 continuationFreezeTime;
+	volatile U_64 continuationFrozenBytesSaved;
+	volatile U_64 continuationThawCount;
+	volatile U_64 continuationThawTime;
+	volatile U_64 continuationThawFailures;
 #if defined(J9VM_PROF_CONTINUATION_ALLOCATION)
 	volatile I_64 avgCacheLookupTime;
 	volatile U_32 fastAlloc;
@@ -6716,8 +6867,12 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t jfrSamplerMutex;
 	omrthread_t jfrSamplerThread;
 	UDATA jfrSamplerState;
+	J9JFRBuffer jfrPendingBuffer;
+	omrthread_t jfrWriterThread;
+	UDATA jfrWriterState;
 	IDATA jfrAsyncKey;
 	IDATA jfrThreadCPULoadAsyncKey;
+	IDATA jfrFlushAsyncKey;
 #endif /* defined(J9VM_OPT_JFR) */
 	UDATA unsafeIndexableHeaderSize;
 #if defined(J9VM_OPT_SNAPSHOTS)
@@ -6743,6 +6898,7 @@ typedef struct J9JavaVM {
 	int64_t prevProcTimestamp;
 	omrthread_monitor_t cpuUtilCacheMutex;
 #endif /* defined(OMR_THR_YIELD_ALG) */
+	omrthread_monitor_t mapCacheMutexes[J9_MAP_CACHE_SHARD_COUNT];
 	UDATA defaultPageSize;
 #if defined(J9VM_OPT_OPENJDK_METHODHANDLE)
 	/* Pool for allocating J9ConstRefArray. Protected by constRefsMutex. */
@@ -6758,6 +6914,11 @@ typedef struct J9JavaVM {
 #define J9JFR_SAMPLER_STATE_STOP 2
 #define J9JFR_SAMPLER_STATE_DEAD 3
 
+#define J9JFR_WRITER_STATE_UNINITIALIZED 0
+#define J9JFR_WRITER_STATE_RUNNING 1
+#define J9JFR_WRITER_STATE_STOP 2
+#define J9JFR_WRITER_STATE_DEAD 3
+
 #define J9VM_PHASE_STARTUP  1
 #define J9VM_PHASE_NOT_STARTUP  2
 #define J9VM_PHASE_LATE_SCC_DISCLAIM 3
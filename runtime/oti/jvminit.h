@@ -683,6 +683,14 @@ enum INIT_STAGE {
 
 #define VMOPT_XXCACHEMAPS "-XX:+CacheMaps"
 #define VMOPT_XXNOCACHEMAPS "-XX:-CacheMaps"
+#define VMOPT_XXSHAREMAPS "-XX:+ShareMaps"
+#define VMOPT_XXNOSHAREMAPS "-XX:-ShareMaps"
+#define VMOPT_XXHOTFIELDLAYOUT "-XX:+HotFieldLayout"
+#define VMOPT_XXNOHOTFIELDLAYOUT "-XX:-HotFieldLayout"
+#define VMOPT_XXSHARDEDMONITORTABLE "-XX:+ShardedMonitorTable"
+#define VMOPT_XXNOSHARDEDMONITORTABLE "-XX:-ShardedMonitorTable"
+#define VMOPT_XXCOMPACTPARKEDCONTINUATIONSTACKS "-XX:+CompactParkedContinuationStacks"
+#define VMOPT_XXNOCOMPACTPARKEDCONTINUATIONSTACKS "-XX:-CompactParkedContinuationStacks"
 
 #define VMOPT_XXLEGACYXLOGOPTION "-XX:+LegacyXlogOption"
 #define VMOPT_XXNOLEGACYXLOGOPTION "-XX:-LegacyXlogOption"
@@ -148,6 +148,13 @@ typedef struct J9JVMTICompileEvent {
 	UDATA isLoad;
 } J9JVMTICompileEvent;
 
+/* The object tag table of an environment is split into shards, selected by object address,
+ * so that threads tagging different objects do not contend on a single table.
+ * Entries for objects moved by the GC are migrated to their new shard at GC end.
+ */
+#define J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT 16
+#define J9JVMTI_OBJECT_TAG_TABLE_SHARD(object) ((((UDATA)(object)) / sizeof(UDATA)) & (J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT - 1))
+
 typedef struct J9JVMTIHookInterfaceWithID {
 	J9HookInterface **hookInterface;
 	UDATA agentID;
@@ -167,7 +174,8 @@ typedef struct J9JVMTIEnv {
 	J9JVMTIExtensionCallbacks extensionCallbacks;
 	omrthread_monitor_t threadDataPoolMutex;
 	J9Pool *threadDataPool;
-	J9HashTable *objectTagTable;
+	J9HashTable *objectTagTables[J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT];
+	omrthread_monitor_t objectTagTableMutexes[J9JVMTI_OBJECT_TAG_TABLE_SHARD_COUNT];
 	J9JVMTIEventEnableMap globalEventEnable;
 	J9HashTable *watchedClasses;
 	J9Pool *breakpoints;
@@ -187,7 +195,7 @@ typedef struct J9JVMTIEnv {
 } J9JVMTIEnv;
 
 #define J9JVMTIENV_FLAG_DISPOSED 1
-/* unused: 2 */
+#define J9JVMTIENV_FLAG_HEAP_CALLBACKS_THREAD_SAFE 2
 #define J9JVMTIENV_FLAG_CLASS_LOAD_HOOK_EVER_ENABLED 4
 #define J9JVMTIENV_FLAG_RETRANSFORM_CAPABLE 8
 
@@ -60,7 +60,9 @@
 #define J9SHR_ATTACHED_DATA_TYPE_UNKNOWN  0
 #define J9SHR_ATTACHED_DATA_TYPE_JITPROFILE  1
 #define J9SHR_ATTACHED_DATA_TYPE_JITHINT  2
-#define J9SHR_ATTACHED_DATA_TYPE_MAX 2
+#define J9SHR_ATTACHED_DATA_TYPE_STACKMAP  3
+#define J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT  4
+#define J9SHR_ATTACHED_DATA_TYPE_MAX 4
 
 #define J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS  1
 #define J9SHR_RUNTIMEFLAG_ENABLE_LOCAL_CACHEING  2
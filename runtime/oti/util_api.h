@@ -2964,6 +2964,45 @@ getPackageDefinitionWithName(J9VMThread *currentThread, J9Module *fromModule, U_
 
 #endif /* JAVA_SPEC_VERSION >= 11 */
 
+/* ---------------- stringkernels.c ---------------- */
+
+/**
+ * Count the leading bytes of a Latin-1 or UTF8 sequence which are in the range 0x01 - 0x7F,
+ * i.e. which encode as a single byte in (modified) UTF8.
+ *
+ * @param[in] data the bytes to scan
+ * @param[in] length the number of bytes to scan
+ *
+ * @return the number of leading single byte characters
+ */
+UDATA
+countLeadingASCIIBytes(const U_8 *data, UDATA length);
+
+/**
+ * Copy the leading UTF16 characters in the range 0x01 - 0x7F to dest as single bytes,
+ * stopping at the first character which needs a multi-byte UTF8 encoding.
+ *
+ * @param[in] dest the buffer to receive the bytes, at least length bytes long
+ * @param[in] src the UTF16 characters
+ * @param[in] length the number of characters to copy at most
+ *
+ * @return the number of characters copied
+ */
+UDATA
+copyASCIIFromUTF16(U_8 *dest, const U_16 *src, UDATA length);
+
+/**
+ * Compare Latin-1 characters to UTF16 characters for equality.
+ *
+ * @param[in] latin1 the Latin-1 characters
+ * @param[in] utf16 the UTF16 characters
+ * @param[in] length the number of characters in both
+ *
+ * @return 1 if the characters are equal, 0 otherwise
+ */
+UDATA
+compareLatin1ToUTF16(const U_8 *latin1, const U_16 *utf16, UDATA length);
+
 /* ---------------- strhelp.c ---------------- */
 /* This function searches for the last occurrence of the character c in a string given its length
  *
@@ -1308,6 +1308,16 @@ freeStacks(J9VMThread * vmThread, UDATA * bp);
 UDATA
 growJavaStack(J9VMThread * vmThread, UDATA newStackSize);
 
+/**
+* @brief Move the frames of a thread into a new stack, which may be smaller than the current one.
+* @param vmThread the current thread
+* @param newStack the stack to move to, which belongs to the caller if the move fails
+* @param unusedStack returns the old stack if no frame refers to it any more, or NULL
+* @return 0 on success, non-zero on failure
+*/
+UDATA
+relocateJavaStack(J9VMThread * vmThread, J9JavaStack * newStack, J9JavaStack ** unusedStack);
+
 
 #endif /* J9VM_INTERP_GROWABLE_STACKS */ /* End File Level Build Flags */
 
@@ -2549,7 +2559,7 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
  * @brief Search the monitor tables in vm->monitorTable for the inflated monitor corresponding to an
  * object. Similar to monitorTableAt(), but doesn't add the monitor if it isn't found in the hashtable.
  *
- * This function may block on vm->monitorTableMutex.
+ * This function may block on the vm->monitorTableShards mutex of the object's monitor table.
  * This function can work out-of-process.
  *
  * @param[in] vm the JavaVM. For out-of-process: may be a local or target pointer.
@@ -2706,6 +2716,19 @@ addHiddenInstanceField(J9JavaVM *vm, const char *className, const char *fieldNam
 void
 reportHotField(J9JavaVM *javaVM, int32_t reducedCpuUtil, J9Class* clazz, uint8_t fieldOffset,  uint32_t reducedFrequency);
 
+/**
+ * Give a ROM class created by class redefinition the hot field layout of the ROM class it replaces,
+ * so that the instance fields of the replacement class keep their offsets.
+ * Valid if -XX:+HotFieldLayout is enabled.
+ *
+ * @param javaVM[in] pointer to the J9JavaVM
+ * @param originalROMClass the ROM class being replaced
+ * @param replacementROMClass the new ROM class
+ * @return TRUE if the replacement class will have the same instance field layout, FALSE if it already has a different one
+ */
+BOOLEAN
+inheritHotFieldLayout(J9JavaVM *javaVM, J9ROMClass *originalROMClass, J9ROMClass *replacementROMClass);
+
 /**
 * @brief
 * @param *vmStruct
@@ -4065,6 +4088,35 @@ haltThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread);
 void
 resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread);
 
+/**
+ * Run a function on behalf of a single thread without stopping any other thread.
+ *
+ * If the target thread holds VM access, the function is posted to it and runs on the target at
+ * its next async check point while the current thread waits with VM access released. Otherwise
+ * (or if the target cannot take the handshake) the target is halted for inspection and the
+ * function runs on the current thread. The function must not release VM access.
+ *
+ * Note that VM access may be released and reacquired by this call - direct object pointers must
+ * not be held across this call.
+ *
+ * @param currentThread the current J9VMThread, which must have VM access
+ * @param targetThread the thread to run the function for
+ * @param function the function to run
+ * @param userData the data passed to the function
+ */
+void
+executeThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData);
+
+/**
+ * The async event handler which runs the handshake posted to the current thread.
+ *
+ * @param currentThread the current J9VMThread
+ * @param handlerKey the async event key of the handshake handler
+ * @param userData unused
+ */
+void
+threadHandshakeAsyncHandler(J9VMThread *currentThread, IDATA handlerKey, void *userData);
+
 
 /**
 * @brief
@@ -4240,6 +4292,15 @@ void
 releaseExclusiveVMAccessMetronome(J9VMThread * vmThread);
 #endif /* J9VM_GC_REALTIME */
 
+/**
+ * Trace the time-to-safepoint histograms and totals of the exclusive and safe point access
+ * requests made since the VM started.
+ *
+ * @param vm the J9JavaVM
+ */
+void
+reportExclusiveAccessSyncHistograms(J9JavaVM *vm);
+
 /**
  * Release VM and/or JNI critical access. Record what was held in accessMask.
  * This will respond to any pending exclusive VM access request in progress.
@@ -4758,6 +4819,14 @@ freeContinuation(J9VMThread *currentThread, j9object_t continuationObject, BOOLE
 void
 recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation *continuation, BOOLEAN skipLocalCache);
 
+/**
+ * @brief Free the stacks cached by a carrier thread for thawing frozen continuations.
+ *
+ * @param vmThread the carrier thread
+ */
+void
+freeContinuationStackCache(J9VMThread *vmThread);
+
 /**
  * @brief Determine if the current continuation is pinned.
  *
@@ -5836,6 +5905,19 @@ jfrYoungGarbageCollection(OMR_VMThread *omrVMThread);
 void
 jfrGarbageCollection(OMR_VMThread *omrVMThread);
 
+/**
+ * Record the freeze or thaw of the stack of the continuation mounted on the current thread.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param eventType[in] J9JFR_EVENT_TYPE_CONTINUATION_FREEZE or J9JFR_EVENT_TYPE_CONTINUATION_THAW
+ * @param continuationClass[in] the class of the continuation
+ * @param startTicks[in] when the frames started to move
+ * @param duration[in] how long the frames took to move
+ * @param size[in] the number of bytes moved
+ */
+void
+jfrContinuationStackMoved(J9VMThread *currentThread, UDATA eventType, J9Class *continuationClass, I_64 startTicks, I_64 duration, UDATA size);
+
 /**
  * Set JFR recording file name.
  *
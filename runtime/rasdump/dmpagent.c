@@ -1864,7 +1864,7 @@ printDumpSpec(struct J9JavaVM *vm, IDATA kind, IDATA verboseLevel)
 					"        [+<name>...]     (see -Xdump:request)\n");
 
 				if (strcmp(spec->name, "heap") == 0) {
-					j9tty_err_printf("\n  opts=PHD|CLASSIC\n");
+					j9tty_err_printf("\n  opts=PHD|CLASSIC|PHD+PARALLEL\n");
 				} else if (strcmp(spec->name, "tool") == 0) {
 					j9tty_err_printf("\n  opts=WAIT<msec>|ASYNC\n");
 #ifdef J9ZOS390
@@ -2811,6 +2811,12 @@ runDumpAgent(struct J9JavaVM *vm, J9RASdumpAgent * agent, J9RASdumpContext * con
 				if (agent->dumpFn == doHeapDump) {
 					if (agent->dumpOptions && strstr(agent->dumpOptions, "PHD")) {
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), label);
+						if (strstr(agent->dumpOptions, "PARALLEL") && !(agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)
+							&& ((reqLen < 3) || (0 != strcmp(&label[reqLen - 3], ".gz")))
+						) {
+							/* a parallel heapdump is written compressed, see BinaryHeapDumpWriter */
+							writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), ".gz");
+						}
 						writeIntoBuffer(context->dumpList, context->dumpListSize, (IDATA*)&(context->dumpListIndex), "\t");
 					}
 
@@ -27,6 +27,7 @@
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
 #include "FileStream.hpp"
+#include "zlib.h"
 
 #include "ut_j9dmp.h"
 
@@ -43,6 +44,21 @@ static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 
+static jvmtiIterationControl parallelHeapDumpObjectIteratorCallback (J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static int J9THREAD_PROC     parallelHeapDumpWorkerThreadProc       (void* entryArg);
+
+/* Parallel (PHD+PARALLEL) heap dumps: size of the work units the heap is split into, sizes of the uncompressed and compressed
+ * buffers, bound on the compressed data held for work units which cannot be written to the file yet, and maximum number of
+ * worker threads
+ */
+#define PARALLEL_HEAPDUMP_WORK_UNIT_SIZE       (4 * 1024 * 1024)
+#define PARALLEL_HEAPDUMP_INPUT_BUFFER_SIZE    (256 * 1024)
+#define PARALLEL_HEAPDUMP_CHUNK_SIZE           (256 * 1024)
+#define PARALLEL_HEAPDUMP_MAX_BUFFERED_BYTES   (64 * 1024 * 1024)
+#define PARALLEL_HEAPDUMP_MAX_THREADS          64
+/* Index of the segment written by the dump thread itself (file header and file trailer) */
+#define PARALLEL_HEAPDUMP_MAIN_SEGMENT         UDATA_MAX
+
 #define allClassesStartDo(vm, state, loader) \
 	vm->internalVMFunctions->allClassesStartDo(state, vm, loader)
 
@@ -730,12 +746,19 @@ public:
 /* Class for writing binary portable heap dump files                                              */
 /*                                                                                                */
 /**************************************************************************************************/
+class ParallelHeapDump;
+class CompressedSegment;
+struct HeapDumpChunk;
+
 class BinaryHeapDumpWriter
 {
 public :
 	/* Constructor */
 	BinaryHeapDumpWriter(const char* fileName, J9RASdumpContext* context, J9RASdumpAgent* agent);
 
+	/* Constructor for the writers of the worker threads of a parallel heap dump */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, CompressedSegment* segment);
+
 	/* Destructor */
 	~BinaryHeapDumpWriter();
 	
@@ -756,6 +779,7 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend class ParallelHeapDump;
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -828,6 +852,12 @@ private :
 
 		/* Method for setting the object back to its initial state (i.e. empty) */
 		void clear(void);
+
+		/* Method for emptying the cache of a part of a parallel dump, which starts at the given index */
+		void clear(int index);
+
+		/* Method for getting the number of classes added since the cache was emptied */
+		UDATA additions(void) const;
 		
 	private :
 		/* Prevent use of the copy constructor and assignment operator */
@@ -837,6 +867,7 @@ private :
 		/* Declared data */
 		const void* _Cache[4];
 		int         _Index;
+		UDATA       _Additions;
 	};
 
 	friend class ReferenceTraits;
@@ -851,6 +882,7 @@ private :
 	void             writeNormalObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeArrayObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeClassRecord(J9Class* clazz);
+	void             writeParallelDump(void);
 	static int       numberSize(IDATA number);
 	int              getObjectHashCode(j9object_t object);
 	static int       numberSizeEncoding(int numberSize);
@@ -871,6 +903,9 @@ private :
 	FileStream        _OutputStream;
 	void*             _CurrentObject;
 	ClassCache        _ClassCache;
+	bool              _Parallel;
+	bool              _CountOnly;
+	CompressedSegment* _Segment;
 	bool              _FileMode;
 	bool              _Error;
 
@@ -909,6 +944,179 @@ private :
 	inline static char        dumpEndField(void)           {return 0x03;}
 };
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class for a compressed part of a parallel heap dump                                            */
+/*                                                                                                */
+/*   The PHD data of each part is compressed into raw deflate data, which is handed to the        */
+/*   ParallelHeapDump in chunks. Every part starts with an empty dictionary and ends on a byte    */
+/*   boundary with a sync flush, so the parts written one after the other form the deflate data   */
+/*   of a single gzip member. Its header and trailer are written by the dump thread, which        */
+/*   combines the checksums of the parts.                                                         */
+/*                                                                                                */
+/**************************************************************************************************/
+class CompressedSegment
+{
+public :
+	/* Constructor */
+	CompressedSegment(ParallelHeapDump* parallelDump, J9PortLibrary* portLibrary);
+
+	/* Destructor */
+	~CompressedSegment();
+
+	/* Method for allocating the buffers and the compression state */
+	bool initialize(void);
+
+	/* Methods for starting and completing the data of one part of the dump */
+	void begin(UDATA index);
+	void end(void);
+
+	/* Methods for getting the object's status */
+	bool  hasError(void) const;
+	uLong checksum(void) const;
+	UDATA length(void) const;
+
+	/* Methods for writing data to the part */
+	void writeCharacters (const char* data, IDATA length);
+	void writeNumber     (IDATA data, int length);
+
+private :
+	/* Prevent use of the copy constructor and assignment operator */
+	CompressedSegment(const CompressedSegment& source);
+	CompressedSegment& operator=(const CompressedSegment& source);
+
+	/* Method for compressing the buffered input */
+	void compressInput(int flush);
+
+	/* Declared data */
+	ParallelHeapDump* _ParallelDump;
+	J9PortLibrary*    _PortLibrary;
+	z_stream          _Stream;
+	bool              _StreamInitialized;
+	char*             _Input;
+	UDATA             _InputLength;
+	HeapDumpChunk*    _Output;
+	UDATA             _Index;
+	uLong             _Checksum;        /* CRC-32 of the uncompressed data of the part */
+	UDATA             _Length;          /* length of the uncompressed data of the part */
+	bool              _Error;
+};
+
+/* Chunk of compressed data of a parallel heap dump */
+struct HeapDumpChunk
+{
+	HeapDumpChunk* _Next;
+	UDATA          _Length;
+	char           _Data[PARALLEL_HEAPDUMP_CHUNK_SIZE];
+};
+
+/* A work unit of a parallel heap dump and the progress of its dump */
+struct HeapDumpWorkUnit
+{
+	J9MM_IterateWorkUnitDescriptor _Descriptor;
+	HeapDumpChunk*                 _Head;           /* compressed data not written to the file yet */
+	HeapDumpChunk*                 _Tail;
+	UDATA                          _BufferedBytes;  /* bytes held in the chunks of _Head */
+	void*                          _BaseObject;     /* object the first record of the work unit is relative to */
+	void*                          _LastObject;     /* last object of the work unit, or NULL if there is none */
+	UDATA                          _Additions;      /* classes the records of the work unit add to the class cache */
+	int                            _CacheIndex;     /* index of the class cache at the start of the work unit */
+	uLong                          _Checksum;       /* CRC-32 of the uncompressed data of the work unit */
+	UDATA                          _Length;
+	bool                           _Done;           /* true once all chunks have been added to _Head */
+};
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Class for writing the heap into the dump file in parallel                                      */
+/*                                                                                                */
+/*   The heap is split into work units, which worker threads claim and dump into their own        */
+/*   compressed segments, while the dump thread writes the segments to the file in address        */
+/*   order. The address of each PHD record is relative to the previous record, and the records    */
+/*   of objects whose class is in the cache name its slot, so the workers walk the heap twice.    */
+/*   The first walk finds the last object of every work unit and counts the classes its records   */
+/*   add to the class cache; the dump thread then works out the object and the cache index each   */
+/*   work unit starts from, and the second walk writes the records.                               */
+/*   The work units are handed out by the heap iterator, which holds no lock while they are       */
+/*   walked, so a worker can wait for the dump thread to drain the data buffered in memory.       */
+/*                                                                                                */
+/**************************************************************************************************/
+class ParallelHeapDump
+{
+public :
+	/* Constructor */
+	ParallelHeapDump(BinaryHeapDumpWriter* heapDumpWriter, UDATA threadCount);
+
+	/* Destructor */
+	~ParallelHeapDump();
+
+	/* Method for allocating the state of the dump */
+	bool initialize(void);
+
+	/* Method for dumping all work units: starts the worker threads and writes their output to the file */
+	void run(void);
+
+	/* Methods for writing the gzip header and trailer around the compressed data */
+	void writeGzipHeader(void);
+	void writeGzipTrailer(void);
+	void appendChecksum(uLong checksum, UDATA length);
+
+	/* Methods for getting the object's status */
+	bool hasError(void) const;
+
+	/* Methods for managing the chunks of compressed data */
+	HeapDumpChunk* allocateChunk(void);
+	void           publishChunk(UDATA index, HeapDumpChunk* chunk);
+
+	/* Per worker thread state of the heap walk */
+	struct Worker
+	{
+		ParallelHeapDump*     _ParallelDump;
+		BinaryHeapDumpWriter* _RegionWriter;
+		CompressedSegment*    _Segment;
+	};
+
+	/* Methods used by the worker threads */
+	void           runWorker(void);
+	void           countWorkUnit(Worker* worker, J9MM_IterateWorkUnitDescriptor* descriptor);
+	UDATA          claimWorkUnit(void);
+	void           writeWorkUnit(Worker* worker, UDATA index);
+	void           writeObject(Worker* worker, J9MM_IterateObjectDescriptor* objectDescriptor);
+
+	volatile bool _Abort;
+
+private :
+	/* Prevent use of the copy constructor and assignment operator */
+	ParallelHeapDump(const ParallelHeapDump& source);
+	ParallelHeapDump& operator=(const ParallelHeapDump& source);
+
+	/* Method for working out the object and the class cache index each work unit starts from */
+	void startWorkUnits(void);
+
+	/* Method for writing the compressed data of a work unit to the file */
+	void writeSegment(UDATA index);
+	void freeChunks(HeapDumpChunk* chunk);
+
+	/* Declared data */
+	BinaryHeapDumpWriter*  _HeapDumpWriter;
+	J9PortLibrary*         _PortLibrary;
+	UDATA                  _ThreadCount;
+	J9MM_WorkUnitIterator* _Iterator;
+	HeapDumpWorkUnit*      _WorkUnits;
+	UDATA                  _WorkUnitCount;
+	UDATA                  _WorkUnitCapacity;
+	omrthread_monitor_t    _Monitor;
+	UDATA                  _NextWorkUnit;   /* next work unit to be written by a worker thread */
+	UDATA                  _HeadWorkUnit;   /* work unit being written to the file */
+	UDATA                  _BufferedBytes;  /* bytes held in the chunks of all work units */
+	UDATA                  _ActiveWorkers;
+	UDATA                  _CountingWorkers;
+	bool                   _Counted;        /* true once the work units can be written */
+	bool                   _OutOfMemory;
+	uLong                  _Checksum;       /* CRC-32 of the uncompressed data written to the file */
+	UDATA                  _Length;
+};
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::ReferenceTraits::ReferenceTraits() method implementation                 */
@@ -1045,7 +1253,8 @@ BinaryHeapDumpWriter::ReferenceWriter::writeNumber(j9object_t objectReference)
 /*                                                                                                */
 /**************************************************************************************************/
 BinaryHeapDumpWriter::ClassCache::ClassCache() :
-	_Index(0)
+	_Index(0),
+	_Additions(0)
 {
 	/* Initialize the class cache */
 	clear();
@@ -1061,6 +1270,7 @@ BinaryHeapDumpWriter::ClassCache::add(const void* clazz)
 {
 	_Cache[_Index] = clazz;
 	_Index         = (_Index + 1) % 4;
+	_Additions    += 1;
 }
 
 /**************************************************************************************************/
@@ -1105,6 +1315,34 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	} 
 
 	_Index = 0;
+	_Additions = 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::clear() method implementation for parts of a parallel dump   */
+/*                                                                                                */
+/*   The classes the previous parts left in the cache are unknown, but the slot the next class    */
+/*   goes to is not: records of the part can name the classes it adds itself.                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::clear(int index)
+{
+	clear();
+
+	_Index = index;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::additions() method implementation                            */
+/*                                                                                                */
+/**************************************************************************************************/
+UDATA
+BinaryHeapDumpWriter::ClassCache::additions(void) const
+{
+	return _Additions;
 }
 
 /**************************************************************************************************/
@@ -1123,6 +1361,9 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_FileName(context->javaVM->portLibrary),
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
+	_Parallel(false),
+	_CountOnly(false),
+	_Segment(NULL),
 	_FileMode(false),
 	_Error(false)
 {
@@ -1135,11 +1376,20 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	
 	/* Remember the file name */
 	_FileName += fileName;
+
+	/* A single dump file can be written by several threads, compressed with gzip */
+	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) && (agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "PARALLEL") != 0)) {
+		UDATA length = strlen(fileName);
+		_Parallel = true;
+		if ((length < 3) || (strcmp(fileName + length - 3, ".gz") != 0)) {
+			_FileName += ".gz";
+		}
+	}
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
 		/* It's a single file so open it */
 		_OutputStream.open(_FileName.data());
@@ -1148,17 +1398,24 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		startTimer();
 		*/
 
-		/* Start writing the file */
-		writeDumpFileHeader();
+		if (_Parallel) {
+			/* Write the whole file */
+			writeParallelDump();
+		} else {
+			/* Start writing the file */
+			writeDumpFileHeader();
+		}
 	}
 
-	/* It's multiple files so iterate through the heaps and spaces */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, binaryHeapDumpHeapIteratorCallback, this);
+	if (!_Parallel) {
+		/* It's multiple files so iterate through the heaps and spaces */
+		_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, binaryHeapDumpHeapIteratorCallback, this);
+	}
 
 	/* Handle the cases of multiple dump files and a single dump file separately */
 	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
 		/* Complete the dump file */
-		if (! _Error) {
+		if (! _Error && ! _Parallel) {
 			writeDumpFileTrailer();
 		}
 
@@ -1176,16 +1433,41 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
 		if (! _Error) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation for parallel dump workers   */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, CompressedSegment* segment) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(parent->_Context),
+	_Agent(parent->_Agent),
+	_VirtualMachine(parent->_VirtualMachine),
+	_PortLibrary(parent->_PortLibrary),
+	_FileName(parent->_PortLibrary),
+	_OutputStream(parent->_PortLibrary),
+	_CurrentObject(0),
+	_Parallel(true),
+	_CountOnly(false),
+	_Segment(segment),
+	_FileMode(false),
+	_Error(false)
+{
+	/* Nothing to do: the records are written to the segment as the worker walks its regions */
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::~BinaryHeapDumpWriter() method implementation                            */
@@ -2394,30 +2676,798 @@ BinaryHeapDumpWriter::checkForIOError(void)
 void
 BinaryHeapDumpWriter::writeCharacters (const char* data, IDATA length)
 {
-	if (!_Error) {
-		_OutputStream.writeCharacters(data,length);
+	if (!_Error && !_CountOnly) {
+		if (NULL != _Segment) {
+			_Segment->writeCharacters(data, length);
+			_Error = _Segment->hasError();
+		} else {
+			_OutputStream.writeCharacters(data,length);
 
-		checkForIOError();
+			checkForIOError();
+		}
 	}
 }
 
 void
 BinaryHeapDumpWriter::writeCharacters (const char* data)
 {
+	writeCharacters(data, strlen(data));
+}
+
+void
+BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
+{
+	if (!_Error && !_CountOnly) {
+		if (NULL != _Segment) {
+			_Segment->writeNumber(data, length);
+			_Error = _Segment->hasError();
+		} else {
+			_OutputStream.writeNumber(data, length);
+
+			checkForIOError();
+		}
+	}
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeParallelDump() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeParallelDump(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	UDATA threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+	if (threadCount > PARALLEL_HEAPDUMP_MAX_THREADS) {
+		threadCount = PARALLEL_HEAPDUMP_MAX_THREADS;
+	}
+	if (0 == threadCount) {
+		threadCount = 1;
+	}
+
+	ParallelHeapDump parallelDump(this, threadCount);
+	CompressedSegment mainSegment(&parallelDump, _PortLibrary);
+
+	if (!parallelDump.initialize() || !mainSegment.initialize()) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "insufficient native memory for a parallel heap dump");
+		Trc_dump_reportDumpError_Event2("Heap", "insufficient native memory for a parallel heap dump");
+		_Error = true;
+		return;
+	}
+
+	/* Records written by this thread go to the main segment */
+	_Segment = &mainSegment;
+
+	parallelDump.writeGzipHeader();
+
+	if (!_Error) {
+		mainSegment.begin(PARALLEL_HEAPDUMP_MAIN_SEGMENT);
+		writeDumpFileHeader();
+		mainSegment.end();
+		parallelDump.appendChecksum(mainSegment.checksum(), mainSegment.length());
+	}
+
+	if (!_Error) {
+		parallelDump.run();
+	}
+
 	if (!_Error) {
-		_OutputStream.writeCharacters(data);
+		mainSegment.begin(PARALLEL_HEAPDUMP_MAIN_SEGMENT);
+		writeDumpFileTrailer();
+		mainSegment.end();
+		parallelDump.appendChecksum(mainSegment.checksum(), mainSegment.length());
+	}
+
+	if (mainSegment.hasError()) {
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "insufficient native memory for a parallel heap dump");
+		Trc_dump_reportDumpError_Event2("Heap", "insufficient native memory for a parallel heap dump");
+		_Error = true;
+	}
+
+	if (!_Error) {
+		parallelDump.writeGzipTrailer();
+	}
+
+	_Segment = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* CompressedSegment method implementations                                                       */
+/*                                                                                                */
+/**************************************************************************************************/
+CompressedSegment::CompressedSegment(ParallelHeapDump* parallelDump, J9PortLibrary* portLibrary) :
+	_ParallelDump(parallelDump),
+	_PortLibrary(portLibrary),
+	_StreamInitialized(false),
+	_Input(NULL),
+	_InputLength(0),
+	_Output(NULL),
+	_Index(0),
+	_Checksum(0),
+	_Length(0),
+	_Error(false)
+{
+	memset(&_Stream, 0, sizeof(_Stream));
+}
+
+CompressedSegment::~CompressedSegment()
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_StreamInitialized) {
+		deflateEnd(&_Stream);
+	}
+	j9mem_free_memory(_Output);
+	j9mem_free_memory(_Input);
+}
+
+bool
+CompressedSegment::initialize(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
-		checkForIOError();
+	_Input = (char*)j9mem_allocate_memory(PARALLEL_HEAPDUMP_INPUT_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+	if (NULL == _Input) {
+		return false;
 	}
+
+	/* A negative window size produces raw deflate data, without a header; favour speed over size, as the VM is paused */
+	if (Z_OK != deflateInit2(&_Stream, Z_BEST_SPEED, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY)) {
+		return false;
+	}
+	_StreamInitialized = true;
+
+	return true;
 }
 
 void
-BinaryHeapDumpWriter::writeNumber (IDATA data, int length)
+CompressedSegment::begin(UDATA index)
 {
+	_Index = index;
+	_InputLength = 0;
+	_Checksum = crc32(0, NULL, 0);
+	_Length = 0;
+}
+
+void
+CompressedSegment::end(void)
+{
+	/* The sync flush ends the data on a byte boundary without a final block, so that the next part can follow it */
 	if (!_Error) {
-		_OutputStream.writeNumber(data, length);
+		compressInput(Z_SYNC_FLUSH);
+	}
+
+	/* Hand out what is left of the part */
+	if ((NULL != _Output) && (0 != _Output->_Length) && !_Error) {
+		_ParallelDump->publishChunk(_Index, _Output);
+		_Output = NULL;
+	}
+
+	/* The next part starts with an empty dictionary */
+	deflateReset(&_Stream);
+}
 
-		checkForIOError();
+bool
+CompressedSegment::hasError(void) const
+{
+	return _Error;
+}
+
+uLong
+CompressedSegment::checksum(void) const
+{
+	return _Checksum;
+}
+
+UDATA
+CompressedSegment::length(void) const
+{
+	return _Length;
+}
+
+void
+CompressedSegment::writeCharacters(const char* data, IDATA length)
+{
+	while (!_Error && (length > 0)) {
+		UDATA count = PARALLEL_HEAPDUMP_INPUT_BUFFER_SIZE - _InputLength;
+		if (count > (UDATA)length) {
+			count = (UDATA)length;
+		}
+		memcpy(_Input + _InputLength, data, count);
+		_InputLength += count;
+		data += count;
+		length -= count;
+
+		if (PARALLEL_HEAPDUMP_INPUT_BUFFER_SIZE == _InputLength) {
+			compressInput(Z_NO_FLUSH);
+		}
+	}
+}
+
+void
+CompressedSegment::writeNumber(IDATA data, int length)
+{
+	/* Same network order encoding as FileStream::writeNumber() */
+	IDATA number = data;
+	int   count  = (length > 8) ? 8 : length;
+	char buffer[8] = {0,0,0,0,0,0,0,0};
+
+	while (count-- > 0) {
+		buffer[count] = (char)(number & 0xFF);
+		number >>= 8;
+	}
+
+	writeCharacters(buffer, length);
+}
+
+void
+CompressedSegment::compressInput(int flush)
+{
+	_Checksum = crc32(_Checksum, (Bytef*)_Input, (uInt)_InputLength);
+	_Length += _InputLength;
+
+	_Stream.next_in  = (Bytef*)_Input;
+	_Stream.avail_in = (uInt)_InputLength;
+
+	/* A flush is complete once deflate leaves room in the output */
+	do {
+		if (NULL == _Output) {
+			_Output = _ParallelDump->allocateChunk();
+			if (NULL == _Output) {
+				_Error = true;
+				return;
+			}
+		}
+
+		_Stream.next_out  = (Bytef*)(_Output->_Data + _Output->_Length);
+		_Stream.avail_out = (uInt)(PARALLEL_HEAPDUMP_CHUNK_SIZE - _Output->_Length);
+
+		if (Z_STREAM_ERROR == deflate(&_Stream, flush)) {
+			_Error = true;
+			return;
+		}
+		_Output->_Length = PARALLEL_HEAPDUMP_CHUNK_SIZE - _Stream.avail_out;
+
+		if (PARALLEL_HEAPDUMP_CHUNK_SIZE == _Output->_Length) {
+			_ParallelDump->publishChunk(_Index, _Output);
+			_Output = NULL;
+		}
+	} while ((0 != _Stream.avail_in) || ((Z_NO_FLUSH != flush) && (0 == _Stream.avail_out)));
+
+	_InputLength = 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* Functions for combining the CRC-32 checksums of the parts of a parallel heap dump              */
+/*                                                                                                */
+/*   The checksum of two consecutive parts is derived from their own checksums by feeding as many */
+/*   zero bits as the second part holds through the CRC register, using matrices over GF(2).      */
+/*   This is the algorithm of zlib's crc32_combine(), which j9zlib does not export.               */
+/*                                                                                                */
+/**************************************************************************************************/
+static uLong
+gf2MatrixTimes(const uLong* matrix, uLong vector)
+{
+	uLong sum = 0;
+
+	while (0 != vector) {
+		if (0 != (vector & 1)) {
+			sum ^= *matrix;
+		}
+		vector >>= 1;
+		matrix += 1;
+	}
+
+	return sum;
+}
+
+static void
+gf2MatrixSquare(uLong* square, const uLong* matrix)
+{
+	for (int n = 0; n < 32; n++) {
+		square[n] = gf2MatrixTimes(matrix, matrix[n]);
+	}
+}
+
+static uLong
+crc32Combine(uLong checksum1, uLong checksum2, UDATA length2)
+{
+	uLong even[32]; /* operator for an even power of two zero bits */
+	uLong odd[32];  /* operator for an odd power of two zero bits */
+	uLong row = 1;
+
+	if (0 == length2) {
+		return checksum1;
+	}
+
+	/* Operator for one zero bit */
+	odd[0] = 0xedb88320UL;
+	for (int n = 1; n < 32; n++) {
+		odd[n] = row;
+		row <<= 1;
+	}
+
+	/* Operators for two and four zero bits */
+	gf2MatrixSquare(even, odd);
+	gf2MatrixSquare(odd, even);
+
+	/* Apply length2 zero bytes to checksum1, the first square being the operator for one zero byte */
+	do {
+		gf2MatrixSquare(even, odd);
+		if (0 != (length2 & 1)) {
+			checksum1 = gf2MatrixTimes(even, checksum1);
+		}
+		length2 >>= 1;
+		if (0 == length2) {
+			break;
+		}
+
+		gf2MatrixSquare(odd, even);
+		if (0 != (length2 & 1)) {
+			checksum1 = gf2MatrixTimes(odd, checksum1);
+		}
+		length2 >>= 1;
+	} while (0 != length2);
+
+	return checksum1 ^ checksum2;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* ParallelHeapDump method implementations                                                        */
+/*                                                                                                */
+/**************************************************************************************************/
+ParallelHeapDump::ParallelHeapDump(BinaryHeapDumpWriter* heapDumpWriter, UDATA threadCount) :
+	_Abort(false),
+	_HeapDumpWriter(heapDumpWriter),
+	_PortLibrary(heapDumpWriter->_PortLibrary),
+	_ThreadCount(threadCount),
+	_Iterator(NULL),
+	_WorkUnits(NULL),
+	_WorkUnitCount(0),
+	_WorkUnitCapacity(0),
+	_Monitor(NULL),
+	_NextWorkUnit(0),
+	_HeadWorkUnit(0),
+	_BufferedBytes(0),
+	_ActiveWorkers(0),
+	_CountingWorkers(0),
+	_Counted(false),
+	_OutOfMemory(false),
+	_Checksum(0),
+	_Length(0)
+{
+	/* Nothing to do */
+}
+
+ParallelHeapDump::~ParallelHeapDump()
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (NULL != _WorkUnits) {
+		for (UDATA index = 0; index < _WorkUnitCount; index++) {
+			freeChunks(_WorkUnits[index]._Head);
+		}
+		j9mem_free_memory(_WorkUnits);
+	}
+	if (NULL != _Iterator) {
+		J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+		vm->memoryManagerFunctions->j9mm_end_work_units(_Iterator);
+	}
+	if (NULL != _Monitor) {
+		omrthread_monitor_destroy(_Monitor);
+	}
+}
+
+bool
+ParallelHeapDump::initialize(void)
+{
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+
+	if (0 != omrthread_monitor_init_with_name(&_Monitor, 0, "Parallel heap dump")) {
+		_Monitor = NULL;
+		return false;
+	}
+
+	/* The regions are split into work units as the workers claim them */
+	_Iterator = vm->memoryManagerFunctions->j9mm_start_work_units(vm, _PortLibrary, PARALLEL_HEAPDUMP_WORK_UNIT_SIZE, NULL, NULL);
+
+	return NULL != _Iterator;
+}
+
+bool
+ParallelHeapDump::hasError(void) const
+{
+	return _Abort;
+}
+
+void
+ParallelHeapDump::writeGzipHeader(void)
+{
+	/* Magic number, deflate method, no flags, no modification time, fastest compression, unknown operating system */
+	static const char header[10] = { (char)0x1F, (char)0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, (char)0xFF };
+
+	_HeapDumpWriter->_OutputStream.writeCharacters(header, sizeof(header));
+	_HeapDumpWriter->checkForIOError();
+}
+
+void
+ParallelHeapDump::writeGzipTrailer(void)
+{
+	/* An empty final block ends the deflate data, followed by the CRC-32 and the length modulo 2^32 of the
+	 * uncompressed data, least significant byte first
+	 */
+	char trailer[10];
+
+	trailer[0] = 0x03;
+	trailer[1] = 0x00;
+	for (int i = 0; i < 4; i++) {
+		trailer[2 + i] = (char)((_Checksum >> (8 * i)) & 0xFF);
+		trailer[6 + i] = (char)((_Length >> (8 * i)) & 0xFF);
+	}
+
+	_HeapDumpWriter->_OutputStream.writeCharacters(trailer, sizeof(trailer));
+	_HeapDumpWriter->checkForIOError();
+}
+
+void
+ParallelHeapDump::appendChecksum(uLong checksum, UDATA length)
+{
+	_Checksum = crc32Combine(_Checksum, checksum, length);
+	_Length += length;
+}
+
+HeapDumpChunk*
+ParallelHeapDump::allocateChunk(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	HeapDumpChunk* chunk = (HeapDumpChunk*)j9mem_allocate_memory(sizeof(HeapDumpChunk), OMRMEM_CATEGORY_VM);
+	if (NULL != chunk) {
+		chunk->_Next = NULL;
+		chunk->_Length = 0;
+	}
+
+	return chunk;
+}
+
+void
+ParallelHeapDump::freeChunks(HeapDumpChunk* chunk)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	while (NULL != chunk) {
+		HeapDumpChunk* next = chunk->_Next;
+		j9mem_free_memory(chunk);
+		chunk = next;
+	}
+}
+
+void
+ParallelHeapDump::publishChunk(UDATA index, HeapDumpChunk* chunk)
+{
+	if (PARALLEL_HEAPDUMP_MAIN_SEGMENT == index) {
+		/* Data of the dump thread is written straight away */
+		_HeapDumpWriter->_OutputStream.writeCharacters(chunk->_Data, chunk->_Length);
+		_HeapDumpWriter->checkForIOError();
+		freeChunks(chunk);
+		return;
+	}
+
+	HeapDumpWorkUnit* workUnit = &_WorkUnits[index];
+
+	omrthread_monitor_enter(_Monitor);
+	if (NULL == workUnit->_Tail) {
+		workUnit->_Head = chunk;
+	} else {
+		workUnit->_Tail->_Next = chunk;
+	}
+	workUnit->_Tail = chunk;
+	workUnit->_BufferedBytes += chunk->_Length;
+	_BufferedBytes += chunk->_Length;
+	omrthread_monitor_notify_all(_Monitor);
+
+	/* Bound the memory held for work units which cannot be written yet. The work units are written in the order they
+	 * are claimed in, so the one being written has been claimed and its worker never waits: the dump progresses.
+	 */
+	while (!_Abort && (index != _HeadWorkUnit) && (_BufferedBytes > PARALLEL_HEAPDUMP_MAX_BUFFERED_BYTES)) {
+		omrthread_monitor_wait(_Monitor);
+	}
+	omrthread_monitor_exit(_Monitor);
+}
+
+void
+ParallelHeapDump::run(void)
+{
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+
+	/* Start the worker threads */
+	omrthread_monitor_enter(_Monitor);
+	for (UDATA i = 0; i < _ThreadCount; i++) {
+		_ActiveWorkers += 1;
+		_CountingWorkers += 1;
+		if (0 != vm->internalVMFunctions->createThreadWithCategory(
+				NULL,
+				vm->defaultOSStackSize,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				parallelHeapDumpWorkerThreadProc,
+				this,
+				J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			_ActiveWorkers -= 1;
+			_CountingWorkers -= 1;
+			break;
+		}
+	}
+	if (0 == _ActiveWorkers) {
+		_OutOfMemory = true;
+		_Abort = true;
+	}
+
+	/* Wait for the first walk of the heap */
+	while (!_Abort && (0 != _CountingWorkers)) {
+		omrthread_monitor_wait(_Monitor);
+	}
+	if (!_Abort) {
+		startWorkUnits();
+	}
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
+
+	/* Write the work units in order as the workers complete them */
+	for (UDATA index = 0; (index < _WorkUnitCount) && !_Abort; index++) {
+		writeSegment(index);
+	}
+
+	/* Wait for the worker threads before the state of the dump is freed */
+	omrthread_monitor_enter(_Monitor);
+	if (_HeapDumpWriter->_Error) {
+		_Abort = true;
+	}
+	omrthread_monitor_notify_all(_Monitor);
+	while (0 != _ActiveWorkers) {
+		omrthread_monitor_wait(_Monitor);
+	}
+	omrthread_monitor_exit(_Monitor);
+
+	if (_OutOfMemory) {
+		/* I/O errors have already been reported by checkForIOError() */
+		PORT_ACCESS_FROM_PORT(_PortLibrary);
+		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "insufficient native memory for a parallel heap dump");
+		Trc_dump_reportDumpError_Event2("Heap", "insufficient native memory for a parallel heap dump");
+	}
+	if (_Abort) {
+		_HeapDumpWriter->_Error = true;
+	}
+}
+
+void
+ParallelHeapDump::startWorkUnits(void)
+{
+	/* The records follow on from those of the dump thread, which leave the class cache alone */
+	void* baseObject = _HeapDumpWriter->_CurrentObject;
+	int cacheIndex = _HeapDumpWriter->_ClassCache.index();
+
+	for (UDATA index = 0; index < _WorkUnitCount; index++) {
+		HeapDumpWorkUnit* workUnit = &_WorkUnits[index];
+
+		workUnit->_BaseObject = baseObject;
+		workUnit->_CacheIndex = cacheIndex;
+		if (NULL != workUnit->_LastObject) {
+			baseObject = workUnit->_LastObject;
+		}
+		cacheIndex = (int)((cacheIndex + workUnit->_Additions) % 4);
+	}
+
+	_Counted = true;
+}
+
+void
+ParallelHeapDump::writeSegment(UDATA index)
+{
+	HeapDumpWorkUnit* workUnit = &_WorkUnits[index];
+	BinaryHeapDumpWriter* writer = _HeapDumpWriter;
+
+	omrthread_monitor_enter(_Monitor);
+	_HeadWorkUnit = index;
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
+
+	bool done = false;
+	while (!done && !writer->_Error) {
+		omrthread_monitor_enter(_Monitor);
+		while (!_Abort && (NULL == workUnit->_Head) && !workUnit->_Done) {
+			omrthread_monitor_wait(_Monitor);
+		}
+		HeapDumpChunk* chunks = workUnit->_Head;
+		workUnit->_Head = NULL;
+		workUnit->_Tail = NULL;
+		_BufferedBytes -= workUnit->_BufferedBytes;
+		workUnit->_BufferedBytes = 0;
+		done = workUnit->_Done || _Abort;
+		omrthread_monitor_notify_all(_Monitor);
+		omrthread_monitor_exit(_Monitor);
+
+		for (HeapDumpChunk* chunk = chunks; (NULL != chunk) && !writer->_Error; chunk = chunk->_Next) {
+			writer->_OutputStream.writeCharacters(chunk->_Data, chunk->_Length);
+			writer->checkForIOError();
+		}
+		freeChunks(chunks);
+	}
+
+	if (!_Abort) {
+		appendChecksum(workUnit->_Checksum, workUnit->_Length);
+	}
+
+	/* The class records of the trailer follow on from the last object */
+	if (NULL != workUnit->_LastObject) {
+		writer->_CurrentObject = workUnit->_LastObject;
+	}
+
+	if (writer->_Error) {
+		omrthread_monitor_enter(_Monitor);
+		_Abort = true;
+		omrthread_monitor_notify_all(_Monitor);
+		omrthread_monitor_exit(_Monitor);
+	}
+}
+
+void
+ParallelHeapDump::runWorker(void)
+{
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+	CompressedSegment segment(this, _PortLibrary);
+
+	if (segment.initialize()) {
+		BinaryHeapDumpWriter regionWriter(_HeapDumpWriter, &segment);
+		Worker worker;
+		worker._ParallelDump = this;
+		worker._RegionWriter = &regionWriter;
+		worker._Segment = &segment;
+
+		/* First walk: claim the work units from the heap iterator and count their class cache additions */
+		J9MM_IterateWorkUnitDescriptor descriptor;
+		while (!_Abort && vm->memoryManagerFunctions->j9mm_next_work_unit(_Iterator, &descriptor)) {
+			countWorkUnit(&worker, &descriptor);
+		}
+
+		omrthread_monitor_enter(_Monitor);
+		_CountingWorkers -= 1;
+		omrthread_monitor_notify_all(_Monitor);
+		while (!_Abort && !_Counted) {
+			omrthread_monitor_wait(_Monitor);
+		}
+		omrthread_monitor_exit(_Monitor);
+
+		/* Second walk: write the records of the work units, claimed in order */
+		for (UDATA index = claimWorkUnit(); !_Abort && (index < _WorkUnitCount); index = claimWorkUnit()) {
+			writeWorkUnit(&worker, index);
+		}
+	} else {
+		omrthread_monitor_enter(_Monitor);
+		_CountingWorkers -= 1;
+		_OutOfMemory = true;
+		_Abort = true;
+		omrthread_monitor_exit(_Monitor);
+	}
+
+	omrthread_monitor_enter(_Monitor);
+	_ActiveWorkers -= 1;
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
+}
+
+void
+ParallelHeapDump::countWorkUnit(Worker* worker, J9MM_IterateWorkUnitDescriptor* descriptor)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+	BinaryHeapDumpWriter* regionWriter = worker->_RegionWriter;
+	UDATA index = descriptor->index;
+
+	/* The first record of a work unit never finds its class in the cache, wherever the work unit starts from */
+	regionWriter->_CountOnly = true;
+	regionWriter->_CurrentObject = 0;
+	regionWriter->_ClassCache.clear();
+	vm->memoryManagerFunctions->j9mm_iterate_work_unit_objects(vm, _PortLibrary, descriptor, 0, parallelHeapDumpObjectIteratorCallback, worker);
+	regionWriter->_CountOnly = false;
+
+	omrthread_monitor_enter(_Monitor);
+	if (index >= _WorkUnitCapacity) {
+		UDATA capacity = (0 == _WorkUnitCapacity) ? 64 : _WorkUnitCapacity;
+		while (index >= capacity) {
+			capacity *= 2;
+		}
+		HeapDumpWorkUnit* workUnits = (HeapDumpWorkUnit*)j9mem_allocate_memory(capacity * sizeof(HeapDumpWorkUnit), OMRMEM_CATEGORY_VM);
+		if (NULL == workUnits) {
+			_OutOfMemory = true;
+			_Abort = true;
+			omrthread_monitor_notify_all(_Monitor);
+			omrthread_monitor_exit(_Monitor);
+			return;
+		}
+		memset(workUnits, 0, capacity * sizeof(HeapDumpWorkUnit));
+		if (NULL != _WorkUnits) {
+			memcpy(workUnits, _WorkUnits, _WorkUnitCapacity * sizeof(HeapDumpWorkUnit));
+			j9mem_free_memory(_WorkUnits);
+		}
+		_WorkUnits = workUnits;
+		_WorkUnitCapacity = capacity;
+	}
+
+	HeapDumpWorkUnit* workUnit = &_WorkUnits[index];
+	workUnit->_Descriptor = *descriptor;
+	workUnit->_LastObject = regionWriter->_CurrentObject;
+	workUnit->_Additions = regionWriter->_ClassCache.additions();
+	if (index >= _WorkUnitCount) {
+		_WorkUnitCount = index + 1;
+	}
+	omrthread_monitor_exit(_Monitor);
+}
+
+UDATA
+ParallelHeapDump::claimWorkUnit(void)
+{
+	omrthread_monitor_enter(_Monitor);
+	UDATA index = _NextWorkUnit;
+	_NextWorkUnit += 1;
+	omrthread_monitor_exit(_Monitor);
+
+	return index;
+}
+
+void
+ParallelHeapDump::writeWorkUnit(Worker* worker, UDATA index)
+{
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+	HeapDumpWorkUnit* workUnit = &_WorkUnits[index];
+	BinaryHeapDumpWriter* regionWriter = worker->_RegionWriter;
+
+	regionWriter->_CurrentObject = workUnit->_BaseObject;
+	regionWriter->_ClassCache.clear(workUnit->_CacheIndex);
+
+	worker->_Segment->begin(index);
+	vm->memoryManagerFunctions->j9mm_iterate_work_unit_objects(vm, _PortLibrary, &workUnit->_Descriptor, 0, parallelHeapDumpObjectIteratorCallback, worker);
+	worker->_Segment->end();
+
+	omrthread_monitor_enter(_Monitor);
+	if (!_Abort && (regionWriter->_Error || worker->_Segment->hasError())) {
+		_OutOfMemory = true;
+		_Abort = true;
+	}
+	workUnit->_Checksum = worker->_Segment->checksum();
+	workUnit->_Length = worker->_Segment->length();
+	workUnit->_Done = true;
+	omrthread_monitor_notify_all(_Monitor);
+	omrthread_monitor_exit(_Monitor);
+}
+
+void
+ParallelHeapDump::writeObject(Worker* worker, J9MM_IterateObjectDescriptor* objectDescriptor)
+{
+	J9JavaVM* vm = _HeapDumpWriter->_VirtualMachine;
+	BinaryHeapDumpWriter* regionWriter = worker->_RegionWriter;
+	j9object_t object = objectDescriptor->object;
+
+	if (!regionWriter->_CountOnly) {
+		regionWriter->writeObjectRecord(objectDescriptor);
+	} else if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(vm, object)) {
+		/* Heap classes have no object record, they are written with the trailer */
+	} else if (J9ROMCLASS_IS_ARRAY(J9OBJECT_CLAZZ_VM(vm, object)->romClass)) {
+		/* Array records leave the class cache alone, only the base of the next record matters */
+		regionWriter->_CurrentObject = object;
+	} else {
+		/* Nothing is written, but the record chosen decides whether the class is added to the cache */
+		regionWriter->writeNormalObjectRecord(objectDescriptor);
+	}
+
+	if (regionWriter->_Error) {
+		_Abort = true;
 	}
 }
 
@@ -2477,6 +3527,22 @@ binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9
 	return referenceWriter->_HeapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+parallelHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
+{
+	ParallelHeapDump::Worker* worker = (ParallelHeapDump::Worker*)userData;
+
+	worker->_ParallelDump->writeObject(worker, objectDescriptor);
+	return worker->_ParallelDump->_Abort ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
+}
+
+static int J9THREAD_PROC
+parallelHeapDumpWorkerThreadProc(void* entryArg)
+{
+	((ParallelHeapDump*)entryArg)->runWorker();
+	return 0;
+}
+
 void
 writePHD(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
 {
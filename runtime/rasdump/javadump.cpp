@@ -514,9 +514,12 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	/* The monitor section is crash prone as objects mutate under it.
 	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
 	 * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while looking
-	 * for waiting threads on any given monitor
+	 * for waiting threads on any given monitor. With -XX:+ShardedMonitorTable each monitor table has its own mutex, so
+	 * all of them are entered in table order; otherwise every shard shares the monitorTableMutex, which is reentrant.
 	 */
-	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+	for (UDATA shardIndex = 0; shardIndex < _VirtualMachine->monitorTableCount; shardIndex++) {
+		omrthread_monitor_enter(_VirtualMachine->monitorTableShards[shardIndex].mutex);
+	}
 	omrthread_t self = omrthread_self();
 	if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
@@ -531,7 +534,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
 			"NULL           ------------------------------------------------------------------------\n");
 	}
-	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
+	for (UDATA shardIndex = _VirtualMachine->monitorTableCount; shardIndex > 0; shardIndex--) {
+		omrthread_monitor_exit(_VirtualMachine->monitorTableShards[shardIndex - 1].mutex);
+	}
 
 	/* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
 	if (J9_ARE_ANY_BITS_SET(_Agent->requestMask, J9RAS_DUMP_DO_PREEMPT_THREADS)) {
@@ -1973,7 +1978,7 @@ JavaCoreDumpWriter::writeNativeAllocator(const char * name, U_32 depth, BOOLEAN
 void
 JavaCoreDumpWriter::writeMonitorSection(void)
 {
-	/* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
+	/* The code calling this method must have taken the monitor table shard mutexes and the thread library monitor_mutex
 	 * (in that order) prior to calling and must release those locks on return from this method.
 	 */
 	J9ThreadMonitor *monitor = NULL;
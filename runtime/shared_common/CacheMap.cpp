@@ -2820,7 +2820,9 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 		break;
 	case TYPE_ATTACHED_DATA :
 		if ((J9SHR_ATTACHED_DATA_TYPE_JITPROFILE == resourceSubType) ||
-			(J9SHR_ATTACHED_DATA_TYPE_JITHINT == resourceSubType)
+			(J9SHR_ATTACHED_DATA_TYPE_JITHINT == resourceSubType) ||
+			(J9SHR_ATTACHED_DATA_TYPE_STACKMAP == resourceSubType) ||
+			(J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT == resourceSubType)
 		){
 			itemInCache = (ShcItem*)(cacheAreaForAllocate->allocateJIT(currentThread, itemPtr, dataLength));
 		}
@@ -4309,6 +4311,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->jitHintDataBytes += _adm->getDataBytesForType(type);
 				descriptor->numJitHints += _adm->getNumOfType(type);
 				break;
+			case J9SHR_ATTACHED_DATA_TYPE_STACKMAP:
+			case J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT:
+				/* Persisted local maps and field layouts share the JIT data area but are not JIT data; they are reported in otherBytes */
+				break;
 			default:
 				Trc_SHR_CM_getJavacoreData_InvalidAttachedDataType(type);
 				Trc_SHR_Assert_ShouldNeverHappen();
@@ -6104,6 +6110,10 @@ SH_CacheMap::attachedTypeString(UDATA type)
 		return "JITPROFILE";
 	case J9SHR_ATTACHED_DATA_TYPE_JITHINT:
 		return "JITHINT";
+	case J9SHR_ATTACHED_DATA_TYPE_STACKMAP:
+		return "STACKMAP";
+	case J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT:
+		return "FIELDLAYOUT";
 	default:
 		Trc_SHR_CM_attachedTypeString_Error(type);
 		Trc_SHR_Assert_ShouldNeverHappen();
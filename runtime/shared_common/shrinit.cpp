@@ -2071,7 +2071,10 @@ j9shr_storeAttachedData(J9VMThread* currentThread, const void* addressInCache, c
 	}
 
 	if ((J9SHR_ATTACHED_DATA_TYPE_JITPROFILE != data->type)
-		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)) {
+		&& (J9SHR_ATTACHED_DATA_TYPE_JITHINT != data->type)
+		&& (J9SHR_ATTACHED_DATA_TYPE_STACKMAP != data->type)
+		&& (J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT != data->type)
+	) {
 		Trc_SHR_INIT_storeAttachedData_exit_TypeUnknown(currentThread, data->type);
 		return J9SHR_RESOURCE_PARAMETER_ERROR;
 	}
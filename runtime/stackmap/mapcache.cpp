@@ -22,9 +22,33 @@
 
 #include "rommeth.h"
 #include "stackmap_api.h"
+#include "j9consts.h"
+#if defined(J9VM_OPT_SHARED_CLASSES)
+#include "../shared_common/include/SCQueryFunctions.h"
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
 
 extern "C" {
 
+/* The caches held in each J9MapCacheShard */
+typedef enum J9MapCacheType {
+	J9_MAP_CACHE_LOCAL_MAP,
+	J9_MAP_CACHE_ARGS_BITS,
+	J9_MAP_CACHE_STACK_MAP
+} J9MapCacheType;
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/* Number of PCs which may be recorded for a ROM method in the shared classes cache */
+#define J9_SHARED_LOCAL_MAP_ENTRIES 16
+/* PC value marking an unused entry in a persisted local map record */
+#define J9_SHARED_LOCAL_MAP_EMPTY_PC ((U_32)-1)
+
+/* Local map for one bytecode PC, persisted as part of a J9SHR_ATTACHED_DATA_TYPE_STACKMAP record */
+typedef struct J9SharedLocalMapEntry {
+	U_32 pc;
+	U_32 bits[J9_MAP_CACHE_SLOTS];
+} J9SharedLocalMapEntry;
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
 /**
  * @brief Map cache hash function
  * @param key J9MapCacheEntry pointer
@@ -55,36 +79,237 @@ localMapHashEqualFn(void *leftKey, void *rightKey, void *userData)
 	return (leftEntry->key == rightEntry->key);
 }
 
+/**
+ * @brief Hash a cache key or class loader. Keys are ROM method and bytecode addresses,
+ * so the bits are mixed to spread neighbouring PCs across the shards.
+ * @param key the cache key
+ * @return the hash value
+ */
+static VMINLINE UDATA
+mapCacheHash(void *key)
+{
+	U_32 hash = (U_32)(UDATA)key;
+
+	hash ^= hash >> 16;
+	hash *= 0x45D9F3B;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+/**
+ * @brief Find the lock stripe guarding a shard of a class loader's caches. The loader is
+ * part of the selection so that loaders which have not split their caches do not all
+ * share the first stripe.
+ * @param vm the J9JavaVM
+ * @param classLoader the J9ClassLoader
+ * @param shardIndex the index of the shard in the loader
+ * @return the lock stripe
+ */
+static VMINLINE omrthread_monitor_t
+mapCacheMutex(J9JavaVM *vm, J9ClassLoader *classLoader, UDATA shardIndex)
+{
+	return vm->mapCacheMutexes[(mapCacheHash(classLoader) + shardIndex) & (J9_MAP_CACHE_SHARD_COUNT - 1)];
+}
+
+/**
+ * @brief Lock the stripe guarding the shard which holds the key. A class loader starts
+ * with no shard, creates a single one on its first update and splits it into
+ * J9_MAP_CACHE_SHARD_COUNT shards once it holds J9_MAP_CACHE_SPLIT_THRESHOLD maps of
+ * a kind, so small loaders do not pay for the striping.
+ * @param vm the J9JavaVM
+ * @param classLoader the J9ClassLoader
+ * @param key the cache key
+ * @param mutex[out] the locked stripe, to be exited by the caller
+ * @return the shard, or NULL if the loader has no shard yet
+ */
+static J9MapCacheShard *
+lockMapCacheShard(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, omrthread_monitor_t *mutex)
+{
+	UDATA hash = mapCacheHash(key);
+
+	for (;;) {
+		/* A split holds every stripe, so the count is stable once a stripe is held */
+		bool split = (J9_MAP_CACHE_SHARD_COUNT == classLoader->mapCacheShardCount);
+		UDATA shardIndex = split ? (hash & (J9_MAP_CACHE_SHARD_COUNT - 1)) : 0;
+		omrthread_monitor_t stripe = mapCacheMutex(vm, classLoader, shardIndex);
+
+		omrthread_monitor_enter(stripe);
+		if (split == (J9_MAP_CACHE_SHARD_COUNT == classLoader->mapCacheShardCount)) {
+			J9MapCacheShard *shards = classLoader->mapCacheShards;
+			*mutex = stripe;
+			return (NULL == shards) ? NULL : &shards[shardIndex];
+		}
+		omrthread_monitor_exit(stripe);
+	}
+}
+
+/**
+ * @brief Find the slot holding a cache in the given shard
+ * @param shard the J9MapCacheShard
+ * @param type the cache to find
+ * @return pointer to the slot holding the cache pointer
+ */
+static VMINLINE J9HashTable **
+mapCacheSlot(J9MapCacheShard *shard, J9MapCacheType type)
+{
+	J9HashTable **slot = &shard->localmapCache;
+
+	if (J9_MAP_CACHE_ARGS_BITS == type) {
+		slot = &shard->argsbitsCache;
+	} else if (J9_MAP_CACHE_STACK_MAP == type) {
+		slot = &shard->stackmapCache;
+	}
+	return slot;
+}
+
+/**
+ * @brief Add an entry to a cache of the shard, creating the cache if necessary
+ * @param vm the J9JavaVM
+ * @param shard the J9MapCacheShard, whose stripe is held by the caller
+ * @param type the cache to update
+ * @param entry the entry to copy into the cache
+ * @return the cache, or NULL if it could not be created or the entry could not be added
+ */
+static J9HashTable *
+addCacheEntry(J9JavaVM *vm, J9MapCacheShard *shard, J9MapCacheType type, J9MapCacheEntry *entry)
+{
+	J9HashTable **cacheSlot = mapCacheSlot(shard, type);
+	J9HashTable *mapCache = *cacheSlot;
+
+	if (NULL == mapCache) {
+		mapCache = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary),
+				J9_GET_CALLSITE(),
+				0,
+				sizeof(J9MapCacheEntry),
+				sizeof(J9MapCacheEntry *),
+				0,
+				J9MEM_CATEGORY_VM,
+				localMapHashFn,
+				localMapHashEqualFn,
+				NULL,
+				NULL);
+		*cacheSlot = mapCache;
+	}
+
+	if ((NULL != mapCache) && (NULL == hashTableAdd(mapCache, entry))) {
+		mapCache = NULL;
+	}
+	return mapCache;
+}
+
+/**
+ * @brief Free the caches of the shards
+ * @param shards the shards
+ * @param shardCount the number of shards
+ */
+static void
+freeMapCacheShards(J9MapCacheShard *shards, UDATA shardCount)
+{
+	UDATA i = 0;
+
+	for (i = 0; i < shardCount; ++i) {
+		J9MapCacheShard *shard = &shards[i];
+		if (NULL != shard->localmapCache) {
+			hashTableFree(shard->localmapCache);
+		}
+		if (NULL != shard->argsbitsCache) {
+			hashTableFree(shard->argsbitsCache);
+		}
+		if (NULL != shard->stackmapCache) {
+			hashTableFree(shard->stackmapCache);
+		}
+	}
+}
+
+/**
+ * @brief Split the single shard of a class loader's caches into J9_MAP_CACHE_SHARD_COUNT
+ * shards. Failure is non-fatal, the loader keeps its single shard.
+ * @param vm the J9JavaVM
+ * @param classLoader the J9ClassLoader
+ */
+static void
+splitMapCache(J9JavaVM *vm, J9ClassLoader *classLoader)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	IDATA i = 0;
+
+	/* Stripes are only ever held one at a time otherwise, so taking all of them in order can not deadlock */
+	for (i = 0; i < J9_MAP_CACHE_SHARD_COUNT; ++i) {
+		omrthread_monitor_enter(vm->mapCacheMutexes[i]);
+	}
+
+	if (1 == classLoader->mapCacheShardCount) {
+		UDATA shardsSize = sizeof(J9MapCacheShard) * J9_MAP_CACHE_SHARD_COUNT;
+		J9MapCacheShard *shards = (J9MapCacheShard *)j9mem_allocate_memory(shardsSize, J9MEM_CATEGORY_VM);
+
+		if (NULL != shards) {
+			J9MapCacheShard *oldShard = classLoader->mapCacheShards;
+			J9MapCacheType type = J9_MAP_CACHE_LOCAL_MAP;
+			bool copied = true;
+
+			memset(shards, 0, shardsSize);
+			for (type = J9_MAP_CACHE_LOCAL_MAP; copied && (type <= J9_MAP_CACHE_STACK_MAP); type = (J9MapCacheType)(type + 1)) {
+				J9HashTable *mapCache = *mapCacheSlot(oldShard, type);
+				if (NULL != mapCache) {
+					J9HashTableState walkState;
+					J9MapCacheEntry *entry = (J9MapCacheEntry *)hashTableStartDo(mapCache, &walkState);
+					while (copied && (NULL != entry)) {
+						J9MapCacheShard *shard = &shards[mapCacheHash(entry->key) & (J9_MAP_CACHE_SHARD_COUNT - 1)];
+						copied = (NULL != addCacheEntry(vm, shard, type, entry));
+						entry = (J9MapCacheEntry *)hashTableNextDo(&walkState);
+					}
+				}
+			}
+
+			if (copied) {
+				freeMapCacheShards(oldShard, 1);
+				j9mem_free_memory(oldShard);
+				classLoader->mapCacheShards = shards;
+				classLoader->mapCacheShardCount = J9_MAP_CACHE_SHARD_COUNT;
+			} else {
+				freeMapCacheShards(shards, J9_MAP_CACHE_SHARD_COUNT);
+				j9mem_free_memory(shards);
+			}
+		}
+	}
+
+	for (i = J9_MAP_CACHE_SHARD_COUNT - 1; i >= 0; --i) {
+		omrthread_monitor_exit(vm->mapCacheMutexes[i]);
+	}
+}
+
 /**
 * @brief Check the given cache for the key. If found, populate the resultArray.
 * @param vm the J9JavaVM
 * @param classLoader the J9ClassLoader
 * @param key the cache key
-* @param mapCache the cache to search
+* @param type the cache to search
 * @param resultArrayBase the result array
 * @param mapWords the numhber of U_32 in the result array
 * @return true on cache hit, false on miss
 */
 static bool
-checkCache(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, J9HashTable *mapCache, U_32 *resultArrayBase, UDATA mapWords)
+checkCache(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, J9MapCacheType type, U_32 *resultArrayBase, UDATA mapWords)
 {
 	bool found = false;
-	omrthread_monitor_t mapCacheMutex = classLoader->mapCacheMutex;
 
-	/* If the mapCacheMutex exists, the caching feature is enabled */
-	if (NULL != mapCacheMutex) {
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_CACHE_MAPS)) {
 		if (mapWords <= J9_MAP_CACHE_SLOTS) {
-			omrthread_monitor_enter(mapCacheMutex);
+			omrthread_monitor_t mapCacheMutex = NULL;
+			J9MapCacheShard *shard = lockMapCacheShard(vm, classLoader, key, &mapCacheMutex);
 
 			/* If the cache exists, check it for this key */
-			if (NULL != mapCache) {
-				J9MapCacheEntry exemplar = { 0 };
-				exemplar.key = key;
-				J9MapCacheEntry *entry = (J9MapCacheEntry*)hashTableFind(mapCache, &exemplar);
-
-				if (NULL != entry) {
-					memcpy(resultArrayBase, entry->bits, sizeof(U_32) * mapWords);
-					found = true;
+			if (NULL != shard) {
+				J9HashTable *mapCache = *mapCacheSlot(shard, type);
+				if (NULL != mapCache) {
+					J9MapCacheEntry exemplar = { 0 };
+					exemplar.key = key;
+					J9MapCacheEntry *entry = (J9MapCacheEntry*)hashTableFind(mapCache, &exemplar);
+
+					if (NULL != entry) {
+						memcpy(resultArrayBase, entry->bits, sizeof(U_32) * mapWords);
+						found = true;
+					}
 				}
 			}
 
@@ -100,50 +325,172 @@ checkCache(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, J9HashTable *map
 * @param vm the J9JavaVM
 * @param classLoader the J9ClassLoader
 * @param key the cache key
-* @param cacheSlot pointer to the slot holding the cache pointer
+* @param type the cache to update
 * @param resultArrayBase the result array
 * @param mapWords the numhber of U_32 in the result array
 */
 static void
-updateCache(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, J9HashTable **cacheSlot, U_32 *resultArrayBase, UDATA mapWords)
+updateCache(J9JavaVM *vm, J9ClassLoader *classLoader, void *key, J9MapCacheType type, U_32 *resultArrayBase, UDATA mapWords)
 {
-	omrthread_monitor_t mapCacheMutex = classLoader->mapCacheMutex;
-
-	/* If the mapCacheMutex exists, the caching feature is enabled */
-	if (NULL != mapCacheMutex) {
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_CACHE_MAPS)) {
 		if (mapWords <= J9_MAP_CACHE_SLOTS) {
-			omrthread_monitor_enter(mapCacheMutex);
-
-			/* Create the cache if necessary - failure is non-fatal */
-			J9HashTable *mapCache = *cacheSlot;
-			if (NULL == mapCache) {
-				mapCache = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary),
-						J9_GET_CALLSITE(),
-						0,
-						sizeof(J9MapCacheEntry),
-						sizeof(J9MapCacheEntry *),
-						0,
-						J9MEM_CATEGORY_VM,
-						localMapHashFn,
-						localMapHashEqualFn,
-						NULL,
-						NULL);
-				*cacheSlot = mapCache;
+			omrthread_monitor_t mapCacheMutex = NULL;
+			J9MapCacheShard *shard = lockMapCacheShard(vm, classLoader, key, &mapCacheMutex);
+			bool split = false;
+
+			/* Create the single shard of the loader if necessary - failure is non-fatal */
+			if (NULL == shard) {
+				PORT_ACCESS_FROM_JAVAVM(vm);
+				shard = (J9MapCacheShard *)j9mem_allocate_memory(sizeof(J9MapCacheShard), J9MEM_CATEGORY_VM);
+				if (NULL != shard) {
+					memset(shard, 0, sizeof(J9MapCacheShard));
+					classLoader->mapCacheShards = shard;
+					classLoader->mapCacheShardCount = 1;
+				}
 			}
 
-			/* If the cache exists, attempt to add and entry for this map - failure is non-fatal */
-			if (NULL != mapCache) {
+			/* Attempt to add an entry for this map, creating the cache if necessary - failure is non-fatal */
+			if (NULL != shard) {
 				J9MapCacheEntry entry = { 0 };
 				entry.key = key;
 				memcpy(entry.bits, resultArrayBase, sizeof(U_32) * mapWords);
-				hashTableAdd(mapCache, &entry);
+				J9HashTable *mapCache = addCacheEntry(vm, shard, type, &entry);
+				split = (1 == classLoader->mapCacheShardCount)
+						&& (NULL != mapCache)
+						&& (hashTableGetCount(mapCache) >= J9_MAP_CACHE_SPLIT_THRESHOLD);
 			}
 
 			omrthread_monitor_exit(mapCacheMutex);
+
+			if (split) {
+				splitMapCache(vm, classLoader);
+			}
+		}
+	}
+}
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+* @brief Determine whether local maps for the method may be persisted in the shared classes cache.
+* @param vm the J9JavaVM
+* @param classLoader the J9ClassLoader
+* @param romClass the J9ROMClass declaring the method
+* @param mapWords the numhber of U_32 in the result array
+* @return the current J9VMThread if the maps may be shared, NULL if not
+*/
+static J9VMThread *
+sharedLocalMapThread(J9JavaVM *vm, J9ClassLoader *classLoader, J9ROMClass *romClass, UDATA mapWords)
+{
+	J9VMThread *currentThread = NULL;
+
+	/* Only the optimized local mapper results are persisted, the debug mapper answers differently */
+	if (J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_SHARE_MAPS)
+		&& (j9localmap_LocalBitsForPC == vm->localMapFunction)
+		&& J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_CACHE_MAPS)
+		&& (mapWords <= J9_MAP_CACHE_SLOTS)
+		/* Neither look up nor store maps during exclusive access, such as GC stack walks */
+		&& (J9_XACCESS_NONE == vm->exclusiveAccessState)
+		&& j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)
+	) {
+		currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	}
+	return currentThread;
+}
+
+/**
+* @brief Look up the persisted local maps for a ROM method. All of the maps found are
+* added to the in-memory cache so that the shared classes cache is consulted at most
+* once per PC.
+* @param currentThread the current J9VMThread
+* @param classLoader the J9ClassLoader
+* @param romMethod the J9ROMMethod
+* @param pc the bytecode PC being mapped
+* @param resultArrayBase the result array
+* @param mapWords the numhber of U_32 in the result array
+* @param freeSlot[out] index of the first unused entry, J9_SHARED_LOCAL_MAP_ENTRIES if the
+* record is full, or -1 if there is no record for the method
+* @return true if the map for pc was found, false if not
+*/
+static bool
+findSharedLocalMap(J9VMThread *currentThread, J9ClassLoader *classLoader, J9ROMMethod *romMethod, UDATA pc,
+		U_32 *resultArrayBase, UDATA mapWords, IDATA *freeSlot)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9SharedLocalMapEntry record[J9_SHARED_LOCAL_MAP_ENTRIES];
+	J9SharedDataDescriptor descriptor;
+	IDATA dataIsCorrupt = -1;
+	U_8 *bytecodes = J9_BYTECODE_START_FROM_ROM_METHOD(romMethod);
+	bool found = false;
+
+	*freeSlot = -1;
+	descriptor.address = (U_8 *)record;
+	descriptor.length = sizeof(record);
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_STACKMAP;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	if ((NULL != vm->sharedClassConfig->findAttachedData(currentThread, romMethod, &descriptor, &dataIsCorrupt))
+		&& (-1 == dataIsCorrupt)
+		&& (sizeof(record) == descriptor.length)
+	) {
+		IDATA i = 0;
+		*freeSlot = J9_SHARED_LOCAL_MAP_ENTRIES;
+		for (i = 0; i < J9_SHARED_LOCAL_MAP_ENTRIES; ++i) {
+			J9SharedLocalMapEntry *entry = &record[i];
+			if (J9_SHARED_LOCAL_MAP_EMPTY_PC == entry->pc) {
+				*freeSlot = i;
+				break;
+			}
+			if (entry->pc == pc) {
+				memcpy(resultArrayBase, entry->bits, sizeof(U_32) * mapWords);
+				found = true;
+			}
+			updateCache(vm, classLoader, bytecodes + entry->pc, J9_MAP_CACHE_LOCAL_MAP, entry->bits, mapWords);
 		}
 	}
+	return found;
 }
 
+/**
+* @brief Persist a computed local map for a ROM method. Only done outside of exclusive
+* access, so that GC stack walks never write to the shared classes cache.
+* @param currentThread the current J9VMThread
+* @param romMethod the J9ROMMethod
+* @param pc the bytecode PC which was mapped
+* @param resultArrayBase the computed map
+* @param mapWords the numhber of U_32 in the result array
+* @param freeSlot the freeSlot returned from findSharedLocalMap
+*/
+static void
+storeSharedLocalMap(J9VMThread *currentThread, J9ROMMethod *romMethod, UDATA pc, U_32 *resultArrayBase, UDATA mapWords, IDATA freeSlot)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if ((J9_XACCESS_NONE == vm->exclusiveAccessState) && (J9_SHARED_LOCAL_MAP_ENTRIES != freeSlot)) {
+		J9SharedLocalMapEntry entry;
+		J9SharedDataDescriptor descriptor;
+
+		memset(&entry, 0, sizeof(entry));
+		entry.pc = (U_32)pc;
+		memcpy(entry.bits, resultArrayBase, sizeof(U_32) * mapWords);
+		descriptor.type = J9SHR_ATTACHED_DATA_TYPE_STACKMAP;
+		descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+		if (-1 == freeSlot) {
+			/* First map for this method - store a record with the remaining entries unused */
+			J9SharedLocalMapEntry record[J9_SHARED_LOCAL_MAP_ENTRIES];
+			memset(record, 0xFF, sizeof(record));
+			record[0] = entry;
+			descriptor.address = (U_8 *)record;
+			descriptor.length = sizeof(record);
+			vm->sharedClassConfig->storeAttachedData(currentThread, romMethod, &descriptor, FALSE);
+		} else {
+			/* Losing a race with another thread or JVM for the slot only drops one entry */
+			descriptor.address = (U_8 *)&entry;
+			descriptor.length = sizeof(entry);
+			vm->sharedClassConfig->updateAttachedData(currentThread, romMethod, (I_32)(freeSlot * sizeof(entry)), &descriptor);
+		}
+	}
+}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
 IDATA
 j9cached_StackBitsForPC(UDATA pc, J9ROMClass * romClass, J9ROMMethod * romMethod,
 								U_32 * resultArrayBase, UDATA resultArraySize,
@@ -156,12 +503,12 @@ j9cached_StackBitsForPC(UDATA pc, J9ROMClass * romClass, J9ROMMethod * romMethod
 	void *bytecodePC = (void*)(J9_BYTECODE_START_FROM_ROM_METHOD(romMethod) + pc);
 	IDATA rc = 0;
 
-	if (!checkCache(vm, classLoader, bytecodePC, classLoader->stackmapCache, resultArrayBase, mapWords)) {
+	if (!checkCache(vm, classLoader, bytecodePC, J9_MAP_CACHE_STACK_MAP, resultArrayBase, mapWords)) {
 		/* Cache miss - perform the map and attempt to cache the result if successful */
 		rc = j9stackmap_StackBitsForPC(vm->portLibrary, pc, romClass, romMethod,
 				resultArrayBase, resultArraySize, userData, getBuffer, releaseBuffer);
 		if (0 == rc) {
-			updateCache(vm, classLoader, bytecodePC, &classLoader->stackmapCache, resultArrayBase, mapWords);
+			updateCache(vm, classLoader, bytecodePC, J9_MAP_CACHE_STACK_MAP, resultArrayBase, mapWords);
 		}
 	}
 	return rc;
@@ -172,10 +519,10 @@ j9cached_ArgBitsForPC0(J9ROMClass *romClass, J9ROMMethod *romMethod, U_32 *resul
 {
 	UDATA mapWords = (J9_ARG_COUNT_FROM_ROM_METHOD(romMethod) + 31) >> 5;
 
-	if (!checkCache(vm, classLoader, (void*)romMethod, classLoader->argsbitsCache, resultArrayBase, mapWords)) {
+	if (!checkCache(vm, classLoader, (void*)romMethod, J9_MAP_CACHE_ARGS_BITS, resultArrayBase, mapWords)) {
 		/* Cache miss - perform the map and attempt to cache the result */
 		j9localmap_ArgBitsForPC0(romClass, romMethod, resultArrayBase);
-		updateCache(vm, classLoader, (void*)romMethod, &classLoader->argsbitsCache, resultArrayBase, mapWords);
+		updateCache(vm, classLoader, (void*)romMethod, J9_MAP_CACHE_ARGS_BITS, resultArrayBase, mapWords);
 	}
 }
 
@@ -190,11 +537,27 @@ j9cached_LocalBitsForPC(J9ROMClass * romClass, J9ROMMethod * romMethod, UDATA pc
 	void *bytecodePC = (void*)(J9_BYTECODE_START_FROM_ROM_METHOD(romMethod) + pc);
 	UDATA mapWords = (UDATA) ((J9_TEMP_COUNT_FROM_ROM_METHOD(romMethod) + J9_ARG_COUNT_FROM_ROM_METHOD(romMethod) + 31) >> 5);
 
-	if (!checkCache(vm, classLoader, bytecodePC, classLoader->localmapCache, resultArrayBase, mapWords)) {
-		/* Cache miss - perform the map and attempt to cache the result if successful */
-		rc = vm->localMapFunction(vm->portLibrary, romClass, romMethod, pc, resultArrayBase, userData, getBuffer, releaseBuffer);
-		if (0 == rc) {
-			updateCache(vm, classLoader, bytecodePC, &classLoader->localmapCache, resultArrayBase, mapWords);
+	if (!checkCache(vm, classLoader, bytecodePC, J9_MAP_CACHE_LOCAL_MAP, resultArrayBase, mapWords)) {
+#if defined(J9VM_OPT_SHARED_CLASSES)
+		J9VMThread *currentThread = sharedLocalMapThread(vm, classLoader, romClass, mapWords);
+		IDATA freeSlot = J9_SHARED_LOCAL_MAP_ENTRIES;
+
+		/* A hit in the shared classes cache has already been added to the in-memory cache */
+		if ((NULL == currentThread)
+			|| !findSharedLocalMap(currentThread, classLoader, romMethod, pc, resultArrayBase, mapWords, &freeSlot)
+		)
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+		{
+			/* Cache miss - perform the map and attempt to cache the result if successful */
+			rc = vm->localMapFunction(vm->portLibrary, romClass, romMethod, pc, resultArrayBase, userData, getBuffer, releaseBuffer);
+			if (0 == rc) {
+				updateCache(vm, classLoader, bytecodePC, J9_MAP_CACHE_LOCAL_MAP, resultArrayBase, mapWords);
+#if defined(J9VM_OPT_SHARED_CLASSES)
+				if (NULL != currentThread) {
+					storeSharedLocalMap(currentThread, romMethod, pc, resultArrayBase, mapWords, freeSlot);
+				}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+			}
 		}
 	}
 
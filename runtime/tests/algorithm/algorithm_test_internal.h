@@ -123,6 +123,19 @@ verifySRPHashtable(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 I_32
 verifyPrimeNumberHelper(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount);
 
+/* ---------------- stringkerneltest.c ---------------- */
+
+/**
+* @brief
+* @param *portLib
+* @param *passCount
+* @param *failCount
+* @param benchmark
+* @return I_32
+*/
+I_32
+verifyStringKernels(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount, BOOLEAN benchmark);
+
 #ifdef __cplusplus
 }
 #endif
@@ -30,11 +30,11 @@ J9PortLibrary *algoTestPortLib = NULL;
 UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 {
 	struct j9cmdlineOptions * args = arg;
-#if defined(J9VM_OPT_MEMORY_CHECK_SUPPORT)
 	int argc = args->argc;
 	char **argv = args->argv;
-#endif /* defined(J9VM_OPT_MEMORY_CHECK_SUPPORT) */
 	I_32 numSuitesNotRun = 0;
+	BOOLEAN benchmarkStringKernels = FALSE;
+	int i = 0;
 	UDATA passCount = 0;
 	UDATA failCount = 0;
 
@@ -47,6 +47,13 @@ UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 	memoryCheck_parseCmdLine( algoTestPortLib, argc-1, argv );
 #endif /* J9VM_OPT_MEMORY_CHECK_SUPPORT */
 
+	/* The string kernel benchmark is slow and its timings are noisy, so it only runs when asked for */
+	for (i = 1; i < argc; i++) {
+		if (0 == strcmp(argv[i], "-benchmarkStringKernels")) {
+			benchmarkStringKernels = TRUE;
+		}
+	}
+
 	j9tty_printf( PORTLIB, "Algorithm Test Start\n");
 
 
@@ -74,6 +81,10 @@ UDATA signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
 		numSuitesNotRun++;
 	}
 
+	if (verifyStringKernels(PORTLIB, &passCount, &failCount, benchmarkStringKernels)) {
+		numSuitesNotRun++;
+	}
+
 	j9tty_printf( PORTLIB, "Algorithm Test Finished\n");
 	j9tty_printf( PORTLIB, "total tests: %d\n", passCount + failCount);
 	j9tty_printf( PORTLIB, "total passes: %d\n", passCount);
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+#include "j9port.h"
+#include "util_api.h"
+#include "algorithm_test_internal.h"
+
+#define STRING_KERNEL_MAX_LENGTH 4096
+#define STRING_KERNEL_CHECK_LENGTH 100
+#define STRING_KERNEL_BENCHMARK_BYTES ((UDATA)64 * 1024 * 1024)
+
+/* Reference implementations, matching the per character loops the kernels replace */
+
+static UDATA
+referenceCountLeadingASCIIBytes(const U_8 *data, UDATA length)
+{
+	UDATA count = 0;
+	while ((count < length) && (data[count] >= 0x01) && (data[count] <= 0x7F)) {
+		count += 1;
+	}
+	return count;
+}
+
+static UDATA
+referenceCopyASCIIFromUTF16(U_8 *dest, const U_16 *src, UDATA length)
+{
+	UDATA count = 0;
+	while ((count < length) && (src[count] >= 0x01) && (src[count] <= 0x7F)) {
+		dest[count] = (U_8)src[count];
+		count += 1;
+	}
+	return count;
+}
+
+static UDATA
+referenceCompareLatin1ToUTF16(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	UDATA i = 0;
+	for (i = 0; i < length; i++) {
+		if ((U_16)latin1[i] != utf16[i]) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static UDATA
+referenceComputeHashForUTF8(const U_8 *data, UDATA length)
+{
+	UDATA hash = 0;
+	const U_8 *end = data + length;
+	while (data < end) {
+		U_16 c = 0;
+		data += decodeUTF8Char(data, &c);
+		hash = (hash << 5) - hash + c;
+	}
+	return hash;
+}
+
+/**
+ * Fill the buffers with the same text, mostly ASCII with an occasional Latin-1 character.
+ */
+static void
+fillText(U_8 *latin1, U_16 *utf16, UDATA length, UDATA seed)
+{
+	UDATA i = 0;
+	for (i = 0; i < length; i++) {
+		seed = (seed * 1103515245) + 12345;
+		if (0 == ((seed >> 16) % 61)) {
+			latin1[i] = (U_8)(0xC0 + ((seed >> 8) % 0x40));
+		} else {
+			latin1[i] = (U_8)('!' + ((seed >> 8) % ('~' - '!')));
+		}
+		utf16[i] = latin1[i];
+	}
+}
+
+static void
+checkResult(J9PortLibrary *portLib, const char *testName, UDATA offset, UDATA length, UDATA expected, UDATA actual, UDATA *passCount, UDATA *failCount)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	if (expected == actual) {
+		(*passCount)++;
+	} else {
+		j9tty_printf(PORTLIB, "\t%s failure. offset=%zu length=%zu expected=%zu actual=%zu\n", testName, offset, length, expected, actual);
+		(*failCount)++;
+	}
+}
+
+/**
+ * Check every kernel against its reference for each length and (mis)alignment, with a non-ASCII or
+ * mismatching character placed at each position.
+ */
+static void
+testStringKernels(J9PortLibrary *portLib, U_8 *latin1, U_16 *utf16, U_8 *dest, UDATA *passCount, UDATA *failCount)
+{
+	UDATA offset = 0;
+	UDATA length = 0;
+	UDATA position = 0;
+
+	for (offset = 0; offset < 16; offset++) {
+		for (length = 0; length <= STRING_KERNEL_CHECK_LENGTH; length++) {
+			U_8 *latin1Data = latin1 + offset;
+			U_16 *utf16Data = utf16 + offset;
+			UDATA expected = 0;
+			UDATA actual = 0;
+
+			memset(latin1, 'a', STRING_KERNEL_CHECK_LENGTH + 16);
+			for (position = 0; position < STRING_KERNEL_CHECK_LENGTH + 16; position++) {
+				utf16[position] = 'a';
+			}
+			checkResult(portLib, "countLeadingASCIIBytes", offset, length, length, countLeadingASCIIBytes(latin1Data, length), passCount, failCount);
+			checkResult(portLib, "compareLatin1ToUTF16", offset, length, 1, compareLatin1ToUTF16(latin1Data, utf16Data, length), passCount, failCount);
+
+			for (position = 0; position < length; position++) {
+				latin1Data[position] = (0 == (position & 1)) ? 0xE9 : 0;
+				expected = referenceCountLeadingASCIIBytes(latin1Data, length);
+				actual = countLeadingASCIIBytes(latin1Data, length);
+				checkResult(portLib, "countLeadingASCIIBytes", offset, length, expected, actual, passCount, failCount);
+
+				expected = referenceCompareLatin1ToUTF16(latin1Data, utf16Data, length);
+				actual = compareLatin1ToUTF16(latin1Data, utf16Data, length);
+				checkResult(portLib, "compareLatin1ToUTF16", offset, length, expected, actual, passCount, failCount);
+				latin1Data[position] = 'a';
+
+				utf16Data[position] = (0 == (position & 1)) ? 0x20AC : 0x80;
+				memset(dest, 0, STRING_KERNEL_CHECK_LENGTH);
+				expected = position;
+				actual = copyASCIIFromUTF16(dest, utf16Data, length);
+				checkResult(portLib, "copyASCIIFromUTF16", offset, length, expected, actual, passCount, failCount);
+				checkResult(portLib, "copyASCIIFromUTF16 data", offset, length, 0, (UDATA)memcmp(dest, latin1Data, position), passCount, failCount);
+
+				expected = referenceCompareLatin1ToUTF16(latin1Data, utf16Data, length);
+				actual = compareLatin1ToUTF16(latin1Data, utf16Data, length);
+				checkResult(portLib, "compareLatin1ToUTF16", offset, length, expected, actual, passCount, failCount);
+				utf16Data[position] = 'a';
+			}
+		}
+	}
+
+	/* mixed single and multi-byte UTF8 */
+	fillText(latin1, utf16, STRING_KERNEL_CHECK_LENGTH, 1);
+	for (length = 0; length <= STRING_KERNEL_CHECK_LENGTH; length++) {
+		UDATA utf8Length = 0;
+		for (position = 0; position < length; position++) {
+			U_16 c = utf16[position];
+			if ((c >= 0x80) || (0 == (position % 7))) {
+				dest[utf8Length++] = (U_8)(0xC0 | (c >> 6));
+				dest[utf8Length++] = (U_8)(0x80 | (c & 0x3F));
+			} else {
+				dest[utf8Length++] = (U_8)c;
+			}
+		}
+		checkResult(portLib, "computeHashForUTF8", 0, utf8Length, referenceComputeHashForUTF8(dest, utf8Length), computeHashForUTF8(dest, utf8Length), passCount, failCount);
+	}
+}
+
+/**
+ * Time a kernel and its reference over the same Latin-1 or UTF-16 input of the given length.
+ */
+static void
+benchmarkStringKernels(J9PortLibrary *portLib, U_8 *latin1, U_16 *utf16, U_8 *dest, UDATA length)
+{
+	UDATA iterations = STRING_KERNEL_BENCHMARK_BYTES / length;
+	UDATA sink = 0;
+	UDATA i = 0;
+	I_64 start = 0;
+	I_64 kernelTime = 0;
+	I_64 referenceTime = 0;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	/* ASCII only, so every kernel processes the whole input */
+	memset(latin1, 'x', length);
+	for (i = 0; i < length; i++) {
+		utf16[i] = 'x';
+	}
+
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += countLeadingASCIIBytes(latin1, length);
+	}
+	kernelTime = j9time_nano_time() - start;
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += referenceCountLeadingASCIIBytes(latin1, length);
+	}
+	referenceTime = j9time_nano_time() - start;
+	j9tty_printf(PORTLIB, "\t%-26s Latin-1 length=%-5zu kernel=%zu us reference=%zu us\n", "countLeadingASCIIBytes", length, (UDATA)(kernelTime / 1000), (UDATA)(referenceTime / 1000));
+
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += copyASCIIFromUTF16(dest, utf16, length);
+	}
+	kernelTime = j9time_nano_time() - start;
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += referenceCopyASCIIFromUTF16(dest, utf16, length);
+	}
+	referenceTime = j9time_nano_time() - start;
+	j9tty_printf(PORTLIB, "\t%-26s UTF-16 length=%-5zu kernel=%zu us reference=%zu us\n", "copyASCIIFromUTF16", length, (UDATA)(kernelTime / 1000), (UDATA)(referenceTime / 1000));
+
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += compareLatin1ToUTF16(latin1, utf16, length);
+	}
+	kernelTime = j9time_nano_time() - start;
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += referenceCompareLatin1ToUTF16(latin1, utf16, length);
+	}
+	referenceTime = j9time_nano_time() - start;
+	j9tty_printf(PORTLIB, "\t%-26s Latin-1/UTF-16 length=%-5zu kernel=%zu us reference=%zu us\n", "compareLatin1ToUTF16", length, (UDATA)(kernelTime / 1000), (UDATA)(referenceTime / 1000));
+
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += computeHashForUTF8(latin1, length);
+	}
+	kernelTime = j9time_nano_time() - start;
+	start = j9time_nano_time();
+	for (i = 0; i < iterations; i++) {
+		sink += referenceComputeHashForUTF8(latin1, length);
+	}
+	referenceTime = j9time_nano_time() - start;
+	j9tty_printf(PORTLIB, "\t%-26s UTF8 length=%-5zu kernel=%zu us reference=%zu us\n", "computeHashForUTF8", length, (UDATA)(kernelTime / 1000), (UDATA)(referenceTime / 1000));
+
+	/* keep the results live */
+	if (0 == sink) {
+		j9tty_printf(PORTLIB, "\tno work done\n");
+	}
+}
+
+/**
+ * Verify the string kernels against per character reference loops and, if asked for, report their
+ * speed over Latin-1 and UTF-16 inputs of several lengths.
+ *
+ * @param portLib Pointer to the port library.
+ * @param passCount Pointer to the passed tests counter.
+ * @param failCount Pointer to the failed tests counter.
+ * @param benchmark TRUE to also run the benchmark, which is enabled with -benchmarkStringKernels.
+ * @return 0 on success, -1 if the buffers could not be allocated
+ */
+I_32
+verifyStringKernels(J9PortLibrary *portLib, UDATA *passCount, UDATA *failCount, BOOLEAN benchmark)
+{
+	static const UDATA benchmarkLengths[] = { 16, 64, 256, 4096 };
+	I_32 rc = 0;
+	U_8 *latin1 = NULL;
+	U_16 *utf16 = NULL;
+	U_8 *dest = NULL;
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	j9tty_printf(PORTLIB, "Testing string kernels...\n");
+
+	latin1 = j9mem_allocate_memory(STRING_KERNEL_MAX_LENGTH + 16, OMRMEM_CATEGORY_VM);
+	utf16 = j9mem_allocate_memory((STRING_KERNEL_MAX_LENGTH + 16) * sizeof(U_16), OMRMEM_CATEGORY_VM);
+	dest = j9mem_allocate_memory((STRING_KERNEL_MAX_LENGTH + 16) * 2, OMRMEM_CATEGORY_VM);
+	if ((NULL == latin1) || (NULL == utf16) || (NULL == dest)) {
+		j9tty_printf(PORTLIB, "\tFailed to allocate the string kernel buffers\n");
+		rc = -1;
+	} else {
+		testStringKernels(portLib, latin1, utf16, dest, passCount, failCount);
+
+		if (benchmark) {
+			UDATA i = 0;
+
+			for (i = 0; i < sizeof(benchmarkLengths) / sizeof(benchmarkLengths[0]); i++) {
+				benchmarkStringKernels(portLib, latin1, utf16, dest, benchmarkLengths[i]);
+			}
+		}
+	}
+
+	j9mem_free_memory(dest);
+	j9mem_free_memory(utf16);
+	j9mem_free_memory(latin1);
+
+	j9tty_printf(PORTLIB, "Finished testing string kernels.\n");
+	return rc;
+}
@@ -47,6 +47,7 @@ static jvmtiTest jvmtiTestList[] =
 	{ "fer003", fer003, "com.ibm.jvmti.tests.forceEarlyReturn.fer003", "ForceEarlyReturn - check return values" },
 	{ "ioioc001", ioioc001, "com.ibm.jvmti.tests.iterateOverInstancesOfClass.ioioc001", "IterateOverInstancesOfClass " },
 	{ "ith001", ith001, "com.ibm.jvmti.tests.iterateThroughHeap.ith001", "IterateThroughHeap" },
+	{ "ith002", ith002, "com.ibm.jvmti.tests.iterateThroughHeap.ith002", "IterateThroughHeap on GC worker threads" },
 	{ "ioh001", ioh001, "com.ibm.jvmti.tests.iterateOverHeap.ioh001", "IterateOverHeap" },
 	{ "re001", re001, "com.ibm.jvmti.tests.resourceExhausted.re001", "ResourceExhausted OutOfMemory" },
 	{ "re002", re002, "com.ibm.jvmti.tests.resourceExhausted.re002", "ResourceExhausted Thread" },
@@ -57,6 +58,9 @@ static jvmtiTest jvmtiTestList[] =
 	{ "gpc002", gpc002, "com.ibm.jvmti.tests.getPotentialCapabilities.gpc002", "GetPotentialCapabilities - Test retention of capabilities in latter phases" },
 	{ "gst001", gst001, "com.ibm.jvmti.tests.getStackTrace.gst001", "GetStackTrace - check a predefined stack trace" },
 	{ "gst002", gst002, "com.ibm.jvmti.tests.getStackTrace.gst002", "GetStackTrace - check return of an empty stack for a dead thread" },
+#if JAVA_SPEC_VERSION >= 21
+	{ "gst003", gst003, "com.ibm.jvmti.tests.getStackTrace.gst003", "GetStackTrace - check the stack of a parked virtual thread" },
+#endif /* JAVA_SPEC_VERSION >= 21 */
 	{ "gste001", gste001, "com.ibm.jvmti.tests.getStackTraceExtended.gste001", "GetStackTraceExtended" },
 #if JAVA_SPEC_VERSION >= 21
 	{ "gste002", gste002, "com.ibm.jvmti.tests.getStackTraceExtended.gste002", "GetStackTraceExtended" },
@@ -38,6 +38,8 @@ omr_add_exports(jvmtitest
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_testFieldPrimitive
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_testStringPrimitive
 	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith001Sub_tagObject
+	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_tagObjects
+	Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_iterateInParallel
 	Java_com_ibm_jvmti_tests_iterateOverHeap_ioh001_iterate
 	Java_com_ibm_jvmti_tests_getClassFields_gcf001_checkClassFields
 	Java_com_ibm_jvmti_tests_getStackTrace_gst001_check
@@ -231,6 +233,7 @@ endif()
 
 if(NOT JAVA_SPEC_VERSION LESS 21)
 	omr_add_exports(jvmtitest
+		Java_com_ibm_jvmti_tests_getStackTrace_gst003_check
 		Java_com_ibm_jvmti_tests_getStackTraceExtended_gste002_anyJittedFrame
 		Java_com_ibm_jvmti_tests_getThreadListStackTracesExtended_gtlste002_anyJittedFrame
 	)
@@ -164,6 +164,7 @@ jint JNICALL fer002(agentEnv *env, char *args);
 jint JNICALL fer003(agentEnv *env, char *args);
 jint JNICALL ioioc001(agentEnv * env, char * args);
 jint JNICALL ith001(agentEnv * env, char * args);
+jint JNICALL ith002(agentEnv * env, char * args);
 jint JNICALL ioh001(agentEnv * env, char * args);
 jint JNICALL ta001(agentEnv * env, char * args);
 jint JNICALL rc001(agentEnv * env, char * args);
@@ -198,6 +199,7 @@ jint JNICALL gpc001(agentEnv * env, char * args);
 jint JNICALL gpc002(agentEnv * env, char * args);
 jint JNICALL gst001(agentEnv * env, char * args);
 jint JNICALL gst002(agentEnv * env, char * args);
+jint JNICALL gst003(agentEnv * env, char * args);
 jint JNICALL gste001(agentEnv * env, char * args);
 jint JNICALL gste002(agentEnv * env, char * args);
 jint JNICALL gaste001(agentEnv * env, char * args);
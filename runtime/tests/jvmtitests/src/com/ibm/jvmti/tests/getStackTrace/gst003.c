@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "ibmjvmti.h"
+#include "jvmti_test.h"
+
+#if JAVA_SPEC_VERSION >= 21
+#define JVMTI_TEST_GST003_MAX_FRAMES 64
+
+static agentEnv *env = NULL;
+
+jint JNICALL
+gst003(agentEnv *agent_env, char *args)
+{
+	env = agent_env;
+	return JNI_OK;
+}
+
+/**
+ * Check the stack trace of a thread, which may be an unmounted virtual thread.
+ *
+ * @param t the thread
+ * @param expectedMethod the name of a method which must be on the stack
+ * @param minFrames the minimum number of frames on the stack
+ * @return JNI_TRUE if the stack has at least minFrames frames, one of which is in expectedMethod
+ */
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_getStackTrace_gst003_check(JNIEnv *jni_env, jclass cls, jthread t, jstring expectedMethod, jint minFrames)
+{
+	JVMTI_ACCESS_FROM_AGENT(env);
+	jvmtiFrameInfo frames[JVMTI_TEST_GST003_MAX_FRAMES];
+	jvmtiError err = JVMTI_ERROR_NONE;
+	jint count = 0;
+	jint i = 0;
+	jboolean found = JNI_FALSE;
+	const char *expected = NULL;
+
+	err = (*jvmti_env)->GetStackTrace(jvmti_env, t, 0, JVMTI_TEST_GST003_MAX_FRAMES, frames, &count);
+	if (JVMTI_ERROR_NONE != err) {
+		error(env, err, "GetStackTrace failed");
+		return JNI_FALSE;
+	}
+	if (count < minFrames) {
+		error(env, JVMTI_ERROR_INTERNAL, "Expected at least %d frames, returned %d frames", minFrames, count);
+		return JNI_FALSE;
+	}
+
+	expected = (*jni_env)->GetStringUTFChars(jni_env, expectedMethod, NULL);
+	if (NULL == expected) {
+		error(env, JVMTI_ERROR_OUT_OF_MEMORY, "GetStringUTFChars failed");
+		return JNI_FALSE;
+	}
+	for (i = 0; (i < count) && !found; i++) {
+		char *name = NULL;
+
+		err = (*jvmti_env)->GetMethodName(jvmti_env, frames[i].method, &name, NULL, NULL);
+		if (JVMTI_ERROR_NONE != err) {
+			error(env, err, "GetMethodName failed for frame %d", i);
+			break;
+		}
+		if (0 == strcmp(name, expected)) {
+			found = JNI_TRUE;
+		}
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)name);
+	}
+	if ((JVMTI_ERROR_NONE == err) && !found) {
+		error(env, JVMTI_ERROR_INTERNAL, "%s was not found in the %d frames returned", expected, count);
+	}
+	(*jni_env)->ReleaseStringUTFChars(jni_env, expectedMethod, expected);
+
+	return found;
+}
+#endif /* JAVA_SPEC_VERSION >= 21 */
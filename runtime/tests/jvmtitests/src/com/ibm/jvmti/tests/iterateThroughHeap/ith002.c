@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#include <string.h>
+
+#include "ibmjvmti.h"
+#include "jvmti_test.h"
+
+static agentEnv * env;
+
+#define ITH002_RETAG_OFFSET 0x100000
+
+typedef struct testParallelIterationData {
+	jrawMonitorID lock;
+	jint          objectCount;
+	jint          badTagCount;
+} testParallelIterationData;
+
+static jint JNICALL testParallelIteration_callback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data);
+
+jint JNICALL
+ith002(agentEnv * agent_env, char * args)
+{
+	jvmtiError err;
+	jvmtiCapabilities capabilities;
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+
+	if (!ensureVersion(agent_env, JVMTI_VERSION_1_1)) {
+		return JNI_ERR;
+	}
+
+	env = agent_env;
+
+	memset(&capabilities, 0, sizeof(jvmtiCapabilities));
+	capabilities.can_tag_objects = 1;
+	err = (*jvmti_env)->AddCapabilities(jvmti_env, &capabilities);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to AddCapabilities");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+/**
+ * Called concurrently from the GC worker threads, so the counts are updated under a raw monitor.
+ * Every tagged object is retagged, which the test checks with GetObjectsWithTags.
+ */
+static jint JNICALL
+testParallelIteration_callback(jlong class_tag, jlong size, jlong* tag_ptr, jint length, void* user_data)
+{
+	testParallelIterationData *userData = (testParallelIterationData *) user_data;
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	jlong tag = *tag_ptr;
+
+	(*jvmti_env)->RawMonitorEnter(jvmti_env, userData->lock);
+	userData->objectCount++;
+	if ((tag <= 0) || (tag >= ITH002_RETAG_OFFSET)) {
+		userData->badTagCount++;
+	}
+	(*jvmti_env)->RawMonitorExit(jvmti_env, userData->lock);
+
+	*tag_ptr = tag + ITH002_RETAG_OFFSET;
+
+	return JVMTI_VISIT_OBJECTS;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_tagObjects(JNIEnv *jni_env, jclass cls, jobjectArray objects)
+{
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	jsize count = (*jni_env)->GetArrayLength(jni_env, objects);
+	jsize i;
+
+	for (i = 0; i < count; i++) {
+		jobject object = (*jni_env)->GetObjectArrayElement(jni_env, objects, i);
+		jvmtiError err = (*jvmti_env)->SetTag(jvmti_env, object, (jlong)i + 1);
+		(*jni_env)->DeleteLocalRef(jni_env, object);
+		if (err != JVMTI_ERROR_NONE) {
+			error(env, err, "SetTag failed for object %d", i);
+			return JNI_FALSE;
+		}
+	}
+
+	return JNI_TRUE;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_iterateThroughHeap_ith002_iterateInParallel(JNIEnv *jni_env, jclass cls, jint count)
+{
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	jvmtiExtensionFunction setHeapCallbacksThreadSafe = NULL;
+	jvmtiExtensionFunctionInfo *extensionFunctions = NULL;
+	jint extensionCount = 0;
+	jvmtiHeapCallbacks callbacks;
+	testParallelIterationData userData;
+	jlong *tags = NULL;
+	jint resultCount = 0;
+	jboolean rc = JNI_FALSE;
+	jvmtiError err;
+	jint i;
+
+	err = (*jvmti_env)->GetExtensionFunctions(jvmti_env, &extensionCount, &extensionFunctions);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed GetExtensionFunctions");
+		return JNI_FALSE;
+	}
+
+	for (i = 0; i < extensionCount; i++) {
+		if (strcmp(extensionFunctions[i].id, COM_IBM_SET_HEAP_CALLBACKS_THREAD_SAFE) == 0) {
+			setHeapCallbacksThreadSafe = extensionFunctions[i].func;
+		}
+	}
+
+	err = (*jvmti_env)->Deallocate(jvmti_env, (unsigned char*)extensionFunctions);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to Deallocate extension functions");
+		return JNI_FALSE;
+	}
+
+	if (setHeapCallbacksThreadSafe == NULL) {
+		error(env, JVMTI_ERROR_NOT_FOUND, "SetHeapCallbacksThreadSafe extension was not found");
+		return JNI_FALSE;
+	}
+
+	err = (setHeapCallbacksThreadSafe)(jvmti_env, JNI_TRUE);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "SetHeapCallbacksThreadSafe failed");
+		return JNI_FALSE;
+	}
+
+	memset(&userData, 0, sizeof(testParallelIterationData));
+	err = (*jvmti_env)->CreateRawMonitor(jvmti_env, "ith002 lock", &userData.lock);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "CreateRawMonitor failed");
+		goto done;
+	}
+
+	memset(&callbacks, 0, sizeof(jvmtiHeapCallbacks));
+	callbacks.heap_iteration_callback = testParallelIteration_callback;
+
+	err = (*jvmti_env)->IterateThroughHeap(jvmti_env, JVMTI_HEAP_FILTER_UNTAGGED, NULL, &callbacks, &userData);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "IterateThroughHeap failed");
+		goto done;
+	}
+
+	if (userData.objectCount != count) {
+		error(env, JVMTI_ERROR_INTERNAL, "IterateThroughHeap reported %d tagged objects, expected %d", userData.objectCount, count);
+		goto done;
+	}
+	if (userData.badTagCount != 0) {
+		error(env, JVMTI_ERROR_INTERNAL, "IterateThroughHeap reported %d unexpected tags", userData.badTagCount);
+		goto done;
+	}
+
+	/* every object must carry the tag set by the callback */
+	err = (*jvmti_env)->Allocate(jvmti_env, count * sizeof(jlong), (unsigned char **)&tags);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Allocate failed");
+		goto done;
+	}
+	for (i = 0; i < count; i++) {
+		tags[i] = (jlong)i + 1 + ITH002_RETAG_OFFSET;
+	}
+	err = (*jvmti_env)->GetObjectsWithTags(jvmti_env, count, tags, &resultCount, NULL, NULL);
+	(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)tags);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "GetObjectsWithTags failed");
+		goto done;
+	}
+	if (resultCount != count) {
+		error(env, JVMTI_ERROR_INTERNAL, "GetObjectsWithTags found %d retagged objects, expected %d", resultCount, count);
+		goto done;
+	}
+
+	rc = JNI_TRUE;
+
+done:
+	if (NULL != userData.lock) {
+		(*jvmti_env)->DestroyRawMonitor(jvmti_env, userData.lock);
+	}
+	(setHeapCallbacksThreadSafe)(jvmti_env, JNI_FALSE);
+	return rc;
+}
@@ -3759,6 +3759,13 @@ reloadROMClasses(J9VMThread * currentThread, jint class_count, const jvmtiClassD
 			classPairs[i].methodRemap = NULL;
 			classPairs[i].methodRemapIndices = NULL;
 
+			/* Existing instances must keep their field offsets under -XX:+HotFieldLayout */
+			if (!vm->internalVMFunctions->inheritHotFieldLayout(vm, originalRAMClass->romClass, loadData.romClass)) {
+#ifdef J9VM_THR_PREEMPTIVE
+				omrthread_monitor_exit(vm->classTableMutex);
+#endif
+				return JVMTI_ERROR_UNSUPPORTED_REDEFINITION_SCHEMA_CHANGE;
+			}
 		} else {
 			/* Grab a field before releasing the mutex to avoid potential race condition */
 			UDATA errorAction = ((J9CfrError *) vm->dynamicLoadBuffers->classFileError)->errorAction;
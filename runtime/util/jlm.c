@@ -188,19 +188,20 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 						if (object != NULL) {							
 						J9JVMTIObjectTag   entry;
 						J9JVMTIObjectTag * objectTag;
+						UDATA shard = J9JVMTI_OBJECT_TAG_TABLE_SHARD(object);
 
 						entry.ref = object;
 
 						/* No need to check if entry.ref != NULL, since we checked object above */
 
-						/* Ensure exclusive access to tag table */
-						omrthread_monitor_enter(((J9JVMTIEnv *)env)->mutex);
+						/* Ensure exclusive access to the tag table shard holding the object */
+						omrthread_monitor_enter(((J9JVMTIEnv *)env)->objectTagTableMutexes[shard]);
 
-						objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTable, &entry);
+						objectTag = hashTableFind(((J9JVMTIEnv *)env)->objectTagTables[shard], &entry);
 						if (objectTag) {
 							tag = objectTag->tag;
 						}
-						omrthread_monitor_exit(((J9JVMTIEnv *)env)->mutex);
+						omrthread_monitor_exit(((J9JVMTIEnv *)env)->objectTagTableMutexes[shard]);
 					}
 				}
 
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "j9.h"
+#include "util_api.h"
+
+/* SSE2 is part of the x86-64 baseline. AVX2 is used when the build targets it, or
+ * selected at runtime through the compiler's CPU feature check otherwise.
+ */
+#if defined(J9HAMMER)
+#define USE_SSE2_STRING_KERNELS
+#include <emmintrin.h>
+#if defined(__AVX2__)
+#define USE_AVX2_STRING_KERNELS
+#define AVX2_TARGET
+#define IS_AVX2_SUPPORTED() TRUE
+#elif defined(__GNUC__)
+#define USE_AVX2_STRING_KERNELS
+#define AVX2_TARGET __attribute__((target("avx2")))
+#define IS_AVX2_SUPPORTED() (0 != __builtin_cpu_supports("avx2"))
+#endif /* defined(__AVX2__) */
+#if defined(USE_AVX2_STRING_KERNELS)
+#include <immintrin.h>
+#endif /* defined(USE_AVX2_STRING_KERNELS) */
+#elif defined(J9AARCH64)
+#define USE_NEON_STRING_KERNELS
+#include <arm_neon.h>
+#endif /* defined(J9HAMMER) */
+
+#define ASCII_LOW_BITS (((UDATA)-1) / 0xFF)
+#define ASCII_HIGH_BITS (ASCII_LOW_BITS * 0x80)
+
+/**
+ * @return TRUE if c is encoded as a single byte in (modified) UTF8, i.e. c is in the range 0x01 - 0x7F
+ */
+static VMINLINE BOOLEAN
+isSingleByteUTF8(UDATA c)
+{
+	return (c - 1) < 0x7F;
+}
+
+#if defined(USE_AVX2_STRING_KERNELS)
+/* The AVX2 kernels only consume whole blocks that pass their check; the caller finishes the rest. */
+
+static AVX2_TARGET UDATA
+countLeadingASCIIBytesAVX2(const U_8 *data, UDATA length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	UDATA count = 0;
+
+	while ((length - count) >= 32) {
+		__m256i bytes = _mm256_loadu_si256((const __m256i *)(data + count));
+		/* signed compare: 0x01 - 0x7F are the only bytes greater than zero */
+		if (0xFFFFFFFF != (U_32)_mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, zero))) {
+			break;
+		}
+		count += 32;
+	}
+	return count;
+}
+
+static AVX2_TARGET UDATA
+copyASCIIFromUTF16AVX2(U_8 *dest, const U_16 *src, UDATA length)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i limit = _mm256_set1_epi16(0x80);
+	UDATA count = 0;
+
+	while ((length - count) >= 32) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)(src + count));
+		__m256i high = _mm256_loadu_si256((const __m256i *)(src + count + 16));
+		__m256i ascii = _mm256_and_si256(
+				_mm256_and_si256(_mm256_cmpgt_epi16(low, zero), _mm256_cmpgt_epi16(limit, low)),
+				_mm256_and_si256(_mm256_cmpgt_epi16(high, zero), _mm256_cmpgt_epi16(limit, high)));
+		if (0xFFFFFFFF != (U_32)_mm256_movemask_epi8(ascii)) {
+			break;
+		}
+		/* packus works within 128-bit lanes, so restore the element order afterwards */
+		_mm256_storeu_si256((__m256i *)(dest + count), _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8));
+		count += 32;
+	}
+	return count;
+}
+
+static AVX2_TARGET UDATA
+compareLatin1ToUTF16AVX2(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	UDATA count = 0;
+
+	while ((length - count) >= 16) {
+		__m256i chars = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(latin1 + count)));
+		__m256i equal = _mm256_cmpeq_epi16(chars, _mm256_loadu_si256((const __m256i *)(utf16 + count)));
+		if (0xFFFFFFFF != (U_32)_mm256_movemask_epi8(equal)) {
+			break;
+		}
+		count += 16;
+	}
+	return count;
+}
+#endif /* defined(USE_AVX2_STRING_KERNELS) */
+
+UDATA
+countLeadingASCIIBytes(const U_8 *data, UDATA length)
+{
+	UDATA count = 0;
+
+#if defined(USE_AVX2_STRING_KERNELS)
+	if ((length >= 32) && IS_AVX2_SUPPORTED()) {
+		count = countLeadingASCIIBytesAVX2(data, length);
+	}
+#endif /* defined(USE_AVX2_STRING_KERNELS) */
+#if defined(USE_SSE2_STRING_KERNELS)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		while ((length - count) >= 16) {
+			__m128i bytes = _mm_loadu_si128((const __m128i *)(data + count));
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, zero))) {
+				break;
+			}
+			count += 16;
+		}
+	}
+#elif defined(USE_NEON_STRING_KERNELS)
+	{
+		const uint8x16_t one = vdupq_n_u8(1);
+		const uint8x16_t limit = vdupq_n_u8(0x7F);
+		while ((length - count) >= 16) {
+			uint8x16_t bytes = vld1q_u8(data + count);
+			if (0xFF != vminvq_u8(vcltq_u8(vsubq_u8(bytes, one), limit))) {
+				break;
+			}
+			count += 16;
+		}
+	}
+#else /* defined(USE_SSE2_STRING_KERNELS) */
+	while ((length - count) >= sizeof(UDATA)) {
+		UDATA word = 0;
+		memcpy(&word, data + count, sizeof(UDATA));
+		/* reject any byte with the high bit set, or any zero byte */
+		if (0 != ((word | ((word - ASCII_LOW_BITS) & ~word)) & ASCII_HIGH_BITS)) {
+			break;
+		}
+		count += sizeof(UDATA);
+	}
+#endif /* defined(USE_SSE2_STRING_KERNELS) */
+	while ((count < length) && isSingleByteUTF8(data[count])) {
+		count += 1;
+	}
+	return count;
+}
+
+UDATA
+copyASCIIFromUTF16(U_8 *dest, const U_16 *src, UDATA length)
+{
+	UDATA count = 0;
+
+#if defined(USE_AVX2_STRING_KERNELS)
+	if ((length >= 32) && IS_AVX2_SUPPORTED()) {
+		count = copyASCIIFromUTF16AVX2(dest, src, length);
+	}
+#endif /* defined(USE_AVX2_STRING_KERNELS) */
+#if defined(USE_SSE2_STRING_KERNELS)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i limit = _mm_set1_epi16(0x80);
+		while ((length - count) >= 16) {
+			__m128i low = _mm_loadu_si128((const __m128i *)(src + count));
+			__m128i high = _mm_loadu_si128((const __m128i *)(src + count + 8));
+			__m128i ascii = _mm_and_si128(
+					_mm_and_si128(_mm_cmpgt_epi16(low, zero), _mm_cmplt_epi16(low, limit)),
+					_mm_and_si128(_mm_cmpgt_epi16(high, zero), _mm_cmplt_epi16(high, limit)));
+			if (0xFFFF != _mm_movemask_epi8(ascii)) {
+				break;
+			}
+			_mm_storeu_si128((__m128i *)(dest + count), _mm_packus_epi16(low, high));
+			count += 16;
+		}
+	}
+#elif defined(USE_NEON_STRING_KERNELS)
+	{
+		const uint16x8_t one = vdupq_n_u16(1);
+		const uint16x8_t limit = vdupq_n_u16(0x7F);
+		while ((length - count) >= 16) {
+			uint16x8_t low = vld1q_u16(src + count);
+			uint16x8_t high = vld1q_u16(src + count + 8);
+			uint16x8_t ascii = vandq_u16(
+					vcltq_u16(vsubq_u16(low, one), limit),
+					vcltq_u16(vsubq_u16(high, one), limit));
+			if (0xFFFF != vminvq_u16(ascii)) {
+				break;
+			}
+			vst1q_u8(dest + count, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+			count += 16;
+		}
+	}
+#endif /* defined(USE_SSE2_STRING_KERNELS) */
+	while (count < length) {
+		U_16 c = src[count];
+		if (!isSingleByteUTF8(c)) {
+			break;
+		}
+		dest[count] = (U_8)c;
+		count += 1;
+	}
+	return count;
+}
+
+UDATA
+compareLatin1ToUTF16(const U_8 *latin1, const U_16 *utf16, UDATA length)
+{
+	UDATA count = 0;
+
+#if defined(USE_AVX2_STRING_KERNELS)
+	if ((length >= 16) && IS_AVX2_SUPPORTED()) {
+		count = compareLatin1ToUTF16AVX2(latin1, utf16, length);
+	}
+#endif /* defined(USE_AVX2_STRING_KERNELS) */
+#if defined(USE_SSE2_STRING_KERNELS)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		while ((length - count) >= 16) {
+			__m128i bytes = _mm_loadu_si128((const __m128i *)(latin1 + count));
+			__m128i equalLow = _mm_cmpeq_epi16(_mm_unpacklo_epi8(bytes, zero), _mm_loadu_si128((const __m128i *)(utf16 + count)));
+			__m128i equalHigh = _mm_cmpeq_epi16(_mm_unpackhi_epi8(bytes, zero), _mm_loadu_si128((const __m128i *)(utf16 + count + 8)));
+			if (0xFFFF != _mm_movemask_epi8(_mm_and_si128(equalLow, equalHigh))) {
+				return 0;
+			}
+			count += 16;
+		}
+	}
+#elif defined(USE_NEON_STRING_KERNELS)
+	while ((length - count) >= 16) {
+		uint8x16_t bytes = vld1q_u8(latin1 + count);
+		uint16x8_t equalLow = vceqq_u16(vmovl_u8(vget_low_u8(bytes)), vld1q_u16(utf16 + count));
+		uint16x8_t equalHigh = vceqq_u16(vmovl_high_u8(bytes), vld1q_u16(utf16 + count + 8));
+		if (0xFFFF != vminvq_u16(vandq_u16(equalLow, equalHigh))) {
+			return 0;
+		}
+		count += 16;
+	}
+#endif /* defined(USE_SSE2_STRING_KERNELS) */
+	while (count < length) {
+		if ((U_16)latin1[count] != utf16[count]) {
+			return 0;
+		}
+		count += 1;
+	}
+	return 1;
+}
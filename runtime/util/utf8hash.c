@@ -37,6 +37,25 @@ computeHashForUTF8(const U_8 * data, UDATA length)
 	UDATA hash = 0;
 	const U_8 * end = data + length;
 
+	/* Hash runs of single byte characters four at a time: hash * 31^4 + c0 * 31^3 + c1 * 31^2 + c2 * 31 + c3
+	 * gives the same result as four sequential steps, without the dependency between them.
+	 */
+	while ((end - data) >= 4) {
+		UDATA c0 = data[0];
+		UDATA c1 = data[1];
+		UDATA c2 = data[2];
+		UDATA c3 = data[3];
+
+		if (0 == ((c0 | c1 | c2 | c3) & 0x80)) {
+			hash = (hash * 923521) + (c0 * 29791) + (c1 * 961) + (c2 * 31) + c3;
+			data += 4;
+		} else {
+			U_16 c;
+
+			data += decodeUTF8Char(data, &c);
+			hash = (hash << 5) - hash + c;
+		}
+	}
 	while (data < end) {
 		U_16 c;
 
@@ -34,6 +34,190 @@
 
 extern "C" {
 
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+/* Frozen stacks are sized in multiples of this many bytes */
+#define FROZEN_STACK_SIZE_ALIGNMENT 512
+/* A continuation mounted again within this many nanoseconds of being frozen did not park long enough for the freeze to pay off */
+#define FROZEN_STACK_MIN_PARK_NANOS (10 * 1000 * 1000)
+/* Largest freezeBackoff, so a continuation is frozen at least every 2^N compactable yields */
+#define FROZEN_STACK_MAX_BACKOFF 6
+
+static void cacheContinuationStack(J9VMThread *currentThread, J9JavaStack *stack);
+static J9JavaStack *takeCachedContinuationStack(J9VMThread *currentThread, UDATA stackSize);
+static void freezeContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation, j9object_t continuationObject);
+static void thawContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation, j9object_t continuationObject);
+
+/**
+ * Keep an unused continuation stack for reuse by the continuations mounted on the current
+ * (carrier) thread, or free it if the cache is full.
+ *
+ * @param currentThread the current J9VMThread
+ * @param stack the unused stack
+ */
+static void
+cacheContinuationStack(J9VMThread *currentThread, J9JavaStack *stack)
+{
+	if (currentThread->continuationStackCacheCount < J9VM_CONTINUATION_STACK_CACHE_SIZE) {
+		stack->previous = currentThread->continuationStackCache;
+		currentThread->continuationStackCache = stack;
+		currentThread->continuationStackCacheCount += 1;
+	} else {
+		freeJavaStack(currentThread->javaVM, stack);
+	}
+}
+
+/**
+ * Take a stack of exactly stackSize bytes from the stack cache of the current (carrier) thread.
+ *
+ * @param currentThread the current J9VMThread
+ * @param stackSize the size of the stack
+ * @return the stack, or NULL if none of that size is cached
+ */
+static J9JavaStack *
+takeCachedContinuationStack(J9VMThread *currentThread, UDATA stackSize)
+{
+	J9JavaStack **stackPtr = &currentThread->continuationStackCache;
+	J9JavaStack *stack = NULL;
+
+	while (NULL != (stack = *stackPtr)) {
+		if (stackSize == stack->size) {
+			*stackPtr = stack->previous;
+			stack->previous = NULL;
+			currentThread->continuationStackCacheCount -= 1;
+			break;
+		}
+		stackPtr = &stack->previous;
+	}
+	return stack;
+}
+
+/**
+ * Move the frames of the continuation mounted on the current thread, which is parking, into a
+ * stack just large enough to hold them, and cache the stack it was using for the next thaw. The
+ * frozen stack keeps the usual overflow area, so the continuation can always be resumed on it.
+ *
+ * A continuation is only frozen after 2^freezeBackoff consecutive yields that would each return
+ * at least half of its stack, so a single shallow park does not pay for a freeze and a thaw.
+ * The backoff grows every time a frozen continuation is mounted again too soon (see thawContinuationStack).
+ *
+ * @param currentThread the current J9VMThread
+ * @param continuation the continuation mounted on currentThread
+ * @param continuationObject the continuation object
+ */
+static void
+freezeContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation, j9object_t continuationObject)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9JavaStack *stack = currentThread->stackObject;
+	UDATA usedBytes = ((U_8 *)stack->end) - ((U_8 *)currentThread->sp);
+	UDATA frozenSize = ROUND_UP_TO_POWEROF2(usedBytes, FROZEN_STACK_SIZE_ALIGNMENT);
+
+	/* Only freeze if at least half of the stack would be returned, and no frame refers to an older stack */
+	if ((frozenSize > (stack->size / 2)) || (NULL != stack->previous)) {
+		continuation->compactableYields = 0;
+	} else if (continuation->compactableYields < ((UDATA)1 << continuation->freezeBackoff)) {
+		continuation->compactableYields += 1;
+	} else {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		U_64 startTime = j9time_nano_time();
+		J9JavaStack *frozenStack = allocateJavaStack(vm, frozenSize, NULL);
+
+		continuation->compactableYields = 0;
+
+		if (NULL != frozenStack) {
+			J9JavaStack *unusedStack = NULL;
+			UDATA stackSize = stack->size;
+
+			if (0 == relocateJavaStack(currentThread, frozenStack, &unusedStack)) {
+				/* If a frame still refers to the old stack, it stays linked to the frozen stack and nothing is saved.
+				 * The continuation then keeps the frozen stack, which grows on demand, rather than being thawed.
+				 */
+				if (NULL != unusedStack) {
+					U_64 freezeTime = j9time_nano_time() - startTime;
+
+					continuation->frozenStackSize = stackSize;
+					continuation->frozenAt = startTime + freezeTime;
+					cacheContinuationStack(currentThread, unusedStack);
+					/* Continuations freeze on every carrier at once, keep the totals exact */
+					VM_AtomicSupport::addU64(&vm->continuationFreezeCount, 1);
+					VM_AtomicSupport::addU64(&vm->continuationFreezeTime, freezeTime);
+					VM_AtomicSupport::addU64(&vm->continuationFrozenBytesSaved, stackSize - frozenSize);
+					Trc_VM_freezeContinuationStack(currentThread, continuation, usedBytes, stackSize, frozenSize, freezeTime);
+#if defined(J9VM_OPT_JFR)
+					jfrContinuationStackMoved(currentThread, J9JFR_EVENT_TYPE_CONTINUATION_FREEZE, J9OBJECT_CLAZZ(currentThread, continuationObject), (I_64)startTime, (I_64)freezeTime, usedBytes);
+#endif /* defined(J9VM_OPT_JFR) */
+				}
+			} else {
+				freeJavaStack(vm, frozenStack);
+			}
+		}
+	}
+}
+
+/**
+ * Move the frames of a frozen continuation which has just been mounted on the current thread
+ * back into a stack of the size it had when it was frozen. If no stack can be had, the
+ * continuation keeps running on the frozen stack, which grows on demand.
+ *
+ * @param currentThread the current J9VMThread
+ * @param continuation the continuation mounted on currentThread
+ * @param continuationObject the continuation object
+ */
+static void
+thawContinuationStack(J9VMThread *currentThread, J9VMContinuation *continuation, j9object_t continuationObject)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_64 startTime = j9time_nano_time();
+	UDATA stackSize = continuation->frozenStackSize;
+	J9JavaStack *stack = NULL;
+	bool thawed = false;
+
+	continuation->frozenStackSize = 0;
+	/* Freeze less often while parks are too short to make up for the moves, and more often again once they are long enough */
+	if ((startTime - continuation->frozenAt) < FROZEN_STACK_MIN_PARK_NANOS) {
+		if (continuation->freezeBackoff < FROZEN_STACK_MAX_BACKOFF) {
+			continuation->freezeBackoff += 1;
+		}
+	} else if (continuation->freezeBackoff > 0) {
+		continuation->freezeBackoff -= 1;
+	}
+	/* -XX:ContinuationCache:forceThawFailure leaves every continuation on its frozen stack, for testing */
+	if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_FORCE_CONTINUATION_THAW_FAILURE)) {
+		stack = takeCachedContinuationStack(currentThread, stackSize);
+		if (NULL == stack) {
+			stack = allocateJavaStack(vm, stackSize, NULL);
+		}
+	}
+	if (NULL != stack) {
+		J9JavaStack *frozenStack = NULL;
+
+		if (0 == relocateJavaStack(currentThread, stack, &frozenStack)) {
+			if (NULL != frozenStack) {
+				freeJavaStack(vm, frozenStack);
+			}
+			thawed = true;
+		} else {
+			cacheContinuationStack(currentThread, stack);
+		}
+	}
+
+	if (thawed) {
+		U_64 thawTime = j9time_nano_time() - startTime;
+
+		VM_AtomicSupport::addU64(&vm->continuationThawCount, 1);
+		VM_AtomicSupport::addU64(&vm->continuationThawTime, thawTime);
+		Trc_VM_thawContinuationStack(currentThread, continuation, stackSize, thawTime);
+#if defined(J9VM_OPT_JFR)
+		jfrContinuationStackMoved(currentThread, J9JFR_EVENT_TYPE_CONTINUATION_THAW, J9OBJECT_CLAZZ(currentThread, continuationObject), (I_64)startTime, (I_64)thawTime, ((U_8 *)currentThread->stackObject->end) - ((U_8 *)currentThread->sp));
+#endif /* defined(J9VM_OPT_JFR) */
+	} else {
+		VM_AtomicSupport::addU64(&vm->continuationThawFailures, 1);
+		Trc_VM_thawContinuationStack_Failed(currentThread, continuation, stackSize);
+	}
+}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
+
 BOOLEAN
 createContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 {
@@ -262,6 +446,11 @@ enterContinuation(J9VMThread *currentThread, j9object_t continuationObject)
 	VM_ContinuationHelpers::swapFieldsWithContinuation(currentThread, continuation, continuationObject, started);
 
 	currentThread->currentContinuation = continuation;
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	if (0 != continuation->frozenStackSize) {
+		thawContinuationStack(currentThread, continuation, continuationObject);
+	}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
 #if JAVA_SPEC_VERSION >= 24
 	Trc_VM_enterContinuation_Mount(currentThread, continuation, continuation->returnState, currentThread->ownedMonitorCount, continuation->enteredMonitors);
 #endif /* JAVA_SPEC_VERSION >= 24 */
@@ -322,6 +511,15 @@ yieldContinuation(J9VMThread *currentThread, BOOLEAN isFinished, UDATA returnSta
 	if (isFinished) {
 		VM_ContinuationHelpers::setFinished(continuationStatePtr);
 	}
+#if defined(J9VM_INTERP_GROWABLE_STACKS)
+	/* Freeze a parking continuation while it is still mounted, so its frames are moved the same way a growing stack is. */
+	if (!isFinished
+	&& (J9VM_CONTINUATION_RETURN_FROM_YIELD == returnState)
+	&& J9_ARE_ANY_BITS_SET(currentThread->javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_COMPACT_PARKED_CONTINUATION_STACKS)
+	) {
+		freezeContinuationStack(currentThread, continuation, continuationObject);
+	}
+#endif /* defined(J9VM_INTERP_GROWABLE_STACKS) */
 
 	currentThread->currentContinuation = NULL;
 	VM_ContinuationHelpers::swapFieldsWithContinuation(currentThread, continuation, continuationObject);
@@ -411,9 +609,11 @@ recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation* contin
 {
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	bool cached = false;
+	/* A frozen stack is too small to be worth reusing */
+	bool reusable = (0 == continuation->frozenStackSize);
 	vm->totalContinuationStackSize += continuation->stackObject->size;
 
-	if (!skipLocalCache && (0 < vm->continuationT1Size)) {
+	if (reusable && !skipLocalCache && (0 < vm->continuationT1Size)) {
 		/* If called by carrier thread (not global), try to store in local cache first.
 		 * Allocate cacheArray if it doesn't exist.
 		 */
@@ -437,7 +637,7 @@ recycleContinuation(J9JavaVM *vm, J9VMThread *vmThread, J9VMContinuation* contin
 T2:
 	if (!cached) {
 		/* Greedily try to cache continuation struct in global array. */
-		for (U_32 i = 0; i < vm->continuationT2Size; i++) {
+		for (U_32 i = 0; reusable && (i < vm->continuationT2Size); i++) {
 			if ((NULL == vm->continuationT2Cache[i])
 			&& (NULL == (UDATA*)VM_AtomicSupport::lockCompareExchange(
 													(uintptr_t*)&(vm->continuationT2Cache[i]),
@@ -459,6 +659,21 @@ T2:
 	}
 }
 
+void
+freeContinuationStackCache(J9VMThread *vmThread)
+{
+	J9JavaStack *stack = vmThread->continuationStackCache;
+
+	while (NULL != stack) {
+		J9JavaStack *next = stack->previous;
+
+		freeJavaStack(vmThread->javaVM, stack);
+		stack = next;
+	}
+	vmThread->continuationStackCache = NULL;
+	vmThread->continuationStackCacheCount = 0;
+}
+
 jint
 isPinnedContinuation(J9VMThread *currentThread)
 {
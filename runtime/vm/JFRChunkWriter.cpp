@@ -734,6 +734,46 @@ VM_JFRChunkWriter::writePhysicalMemoryEvent()
 	return dataStart;
 }
 
+/**
+ * Write a DataLoss event if thread buffers were dropped since the last chunk
+ * because the JFR writer thread was busy.
+ *
+ * @returns the total number of bytes dropped, to be recorded as reported once
+ * the chunk is written
+ */
+U_64
+VM_JFRChunkWriter::writeDataLossEvent()
+{
+	omrthread_monitor_enter(_vm->jfrBufferMutex);
+	U_64 droppedBytes = _vm->jfrState.droppedBytes;
+	UDATA droppedBufferCount = _vm->jfrState.droppedBufferCount;
+	omrthread_monitor_exit(_vm->jfrBufferMutex);
+
+	U_64 amount = droppedBytes - _vm->jfrState.reportedDroppedBytes;
+	if (0 != amount) {
+		Trc_VM_jfr_DataLoss(_currentThread, amount, droppedBytes, droppedBufferCount);
+
+		/* reserve size field */
+		U_8 *dataStart = reserveEventSize();
+
+		_bufferWriter->writeLEB128(DataLossID);
+
+		/* write start time */
+		_bufferWriter->writeLEB128(j9time_nano_time());
+
+		/* write bytes dropped since the last chunk */
+		_bufferWriter->writeLEB128(amount);
+
+		/* write bytes dropped since the recording started */
+		_bufferWriter->writeLEB128(droppedBytes);
+
+		/* write size */
+		writeEventSize(dataStart);
+	}
+
+	return droppedBytes;
+}
+
 U_8 *
 VM_JFRChunkWriter::writeCPUInformationEvent()
 {
@@ -1624,6 +1664,70 @@ VM_JFRChunkWriter::writeGCHeapSummaryEvent(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeSafepointEvents(void *anElement, void *userData)
+{
+	SafepointEntry *entry = (SafepointEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(SafepointBeginID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration time which is always in ticks, in our case nanos */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index, which is the requesting thread */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write safepoint id */
+	bufferWriter->writeLEB128(entry->safepointID);
+
+	/* Write total thread count */
+	bufferWriter->writeLEB128(entry->totalThreadCount);
+
+	/* Write number of threads which responded by leaving a JNI critical region */
+	bufferWriter->writeLEB128(entry->jniCriticalThreadCount);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+
+	/* The threads are synchronized over the whole request, so the state synchronization event covers the same time */
+	dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(SafepointStateSynchronizationID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration time which is always in ticks, in our case nanos */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write safepoint id */
+	bufferWriter->writeLEB128(entry->safepointID);
+
+	/* Write number of threads which had to respond */
+	bufferWriter->writeLEB128(entry->initialThreadCount);
+
+	/* Write number of threads still running, which is none once the request is synchronized */
+	bufferWriter->writeLEB128(0);
+
+	/* Write number of iterations, threads are waited for rather than polled */
+	bufferWriter->writeLEB128(1);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeModuleRequire(void *anElement, void *userData)
 {
@@ -1674,4 +1778,73 @@ VM_JFRChunkWriter::writeModuleExport(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeFinalizerStatisticsEvent(void *anElement, void *userData)
+{
+	FinalizerStatisticsEntry *entry = (FinalizerStatisticsEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field. */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type. */
+	bufferWriter->writeLEB128(FinalizerStatisticsID);
+
+	/* Write start time. */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write finalizable class index. */
+	bufferWriter->writeLEB128(entry->classIndex);
+
+	/* Write code source, the class URL is not recorded. */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write objects waiting on the finalize queue. */
+	bufferWriter->writeLEB128(entry->objects);
+
+	/* Write finalizers run since startup. */
+	bufferWriter->writeLEB128(entry->totalFinalizersRun);
+
+	/* Write size. */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeContinuationStackEvent(void *anElement, void *userData)
+{
+	ContinuationStackEntry *entry = (ContinuationStackEntry *)anElement;
+	VM_BufferWriter *bufferWriter = (VM_BufferWriter *)userData;
+
+	/* Reserve size field. */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type. */
+	bufferWriter->writeLEB128(entry->thaw ? ContinuationThawID : ContinuationFreezeID);
+
+	/* Write start time. */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration time which is always in ticks, in our case nanos. */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index. */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write carrier thread index, the event thread is always the carrier. */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write continuation class index. */
+	bufferWriter->writeLEB128(entry->continuationClassIndex);
+
+	/* Write interpreted frames and references, which are not counted. */
+	bufferWriter->writeLEB128((U_64)0);
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write the bytes moved, the field is an unsigned short. */
+	bufferWriter->writeLEB128((U_64)OMR_MIN(entry->size, U_16_MAX));
+
+	/* Write size. */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 #endif /* defined(J9VM_OPT_JFR) */
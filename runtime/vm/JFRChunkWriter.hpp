@@ -95,11 +95,16 @@ enum MetadataTypeID {
 	ThreadParkID = 5,
 	MonitorEnterID = 6,
 	MonitorWaitID = 7,
+	ContinuationFreezeID = 10,
+	ContinuationThawID = 11,
 	GCHeapSummaryID = 27,
 	GarbageCollectionID = 35,
 	SystemGCID = 36,
 	YoungGarbageCollectionID = 38,
 	OldGarbageCollectionID = 39,
+	SafepointBeginID = 74,
+	SafepointStateSynchronizationID = 75,
+	DataLossID = 86,
 	JVMInformationID = 87,
 	OSInformationID = 88,
 	VirtualizationInformationID = 89,
@@ -119,6 +124,7 @@ enum MetadataTypeID {
 	NativeLibraryID = 112,
 	ModuleRequireID = 113,
 	ModuleExportID = 114,
+	FinalizerStatisticsID = 115,
 	GCHeapConfigID = 133,
 	YoungGenerationConfigID = 134,
 	VirtualSpaceID = 149,
@@ -234,6 +240,11 @@ private:
 	static constexpr int YOUNG_GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (2 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE);
 	static constexpr int GARBAGE_COLLECTION_EVENT_SIZE = sizeof(U_8) + (6 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE);
 	static constexpr int GC_HEAP_SUMMARY_EVENT_SIZE = sizeof(U_8) + (7 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE) + STRING_BUFFER_LENGTH;
+	static constexpr int SAFEPOINT_BEGIN_EVENT_SIZE = (3 * LEB128_64_SIZE) + (5 * LEB128_32_SIZE);
+	static constexpr int SAFEPOINT_STATE_SYNCHRONIZATION_EVENT_SIZE = (3 * LEB128_64_SIZE) + (6 * LEB128_32_SIZE);
+	static constexpr int CONTINUATION_STACK_EVENT_SIZE = (3 * LEB128_64_SIZE) + (5 * LEB128_32_SIZE);
+	static constexpr int FINALIZER_STATISTICS_EVENT_SIZE = (3 * LEB128_64_SIZE) + (4 * LEB128_32_SIZE);
+	static constexpr int DATA_LOSS_EVENT_SIZE = (3 * LEB128_64_SIZE) + (2 * LEB128_32_SIZE);
 
 	static constexpr int METADATA_ID = 1;
 
@@ -281,14 +292,14 @@ private:
 protected:
 
 public:
-	VM_JFRChunkWriter(J9VMThread *currentThread, bool finalWrite)
+	VM_JFRChunkWriter(J9VMThread *currentThread, J9JFRBuffer *jfrBuffer, bool finalWrite)
 		: _currentThread(currentThread)
 		, _vm(currentThread->javaVM)
 		, _buildResult(OK)
 		, _debug(false)
 		, privatePortLibrary(_vm->portLibrary)
 		, _finalWrite(finalWrite)
-		, _constantPoolTypes(currentThread)
+		, _constantPoolTypes(currentThread, jfrBuffer)
 		, _currentStackFrameBuffer(NULL)
 		, _previousStackTraceEntry(NULL)
 		, _firstStackTraceEntry(NULL)
@@ -352,6 +363,7 @@ done:
 	{
 		U_8 *buffer = NULL;
 		UDATA requiredBufferSize = 0;
+		U_64 droppedBytes = 0;
 
 		if (NULL == _vm->jfrState.metaDataBlobFile) {
 			_buildResult = MetaDataFileNotLoaded;
@@ -448,6 +460,8 @@ done:
 
 			pool_do(_constantPoolTypes.getClassLoaderStatisticsTable(), &writeClassLoaderStatisticsEvent, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getFinalizerStatisticsTable(), &writeFinalizerStatisticsEvent, _bufferWriter);
+
 			pool_do(_constantPoolTypes.getThreadContextSwitchRateTable(), &writeThreadContextSwitchRateEvent, _bufferWriter);
 
 			pool_do(_constantPoolTypes.getThreadStatisticsTable(), &writeThreadStatisticsEvent, _bufferWriter);
@@ -466,6 +480,10 @@ done:
 
 			pool_do(_constantPoolTypes.getGCHeapSummaryTable(), &writeGCHeapSummaryEvent, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getSafepointTable(), &writeSafepointEvents, _bufferWriter);
+
+			pool_do(_constantPoolTypes.getContinuationStackTable(), &writeContinuationStackEvent, _bufferWriter);
+
 			/* Only write constant events in first chunk */
 			if (0 == _vm->jfrState.jfrChunkCount) {
 				writeJVMInformationEvent();
@@ -487,6 +505,8 @@ done:
 
 			writePhysicalMemoryEvent();
 
+			droppedBytes = writeDataLossEvent();
+
 			if (dumpCalled) {
 				writeThreadDumpEvent();
 				pool_do(_constantPoolTypes.getSystemProcessTable(), &writeSystemProcessEvent, this);
@@ -507,6 +527,7 @@ done:
 			writeJFRChunkToFile();
 
 			_vm->jfrState.jfrChunkCount += 1;
+			_vm->jfrState.reportedDroppedBytes = droppedBytes;
 			_vm->jfrState.chunkStartTime = VM_JFRUtils::getCurrentTimeNanos(privatePortLibrary, _buildResult);
 			_vm->jfrState.chunkStartTicks = j9time_nano_time();
 
@@ -878,6 +899,8 @@ done:
 
 	U_8 *writePhysicalMemoryEvent();
 
+	U_64 writeDataLossEvent();
+
 	U_8 *writeCPUInformationEvent();
 
 	U_8 *writeVirtualizationInformationEvent();
@@ -926,6 +949,12 @@ done:
 
 	static void writeGCHeapSummaryEvent(void *anElement, void *userData);
 
+	static void writeSafepointEvents(void *anElement, void *userData);
+
+	static void writeFinalizerStatisticsEvent(void *anElement, void *userData);
+
+	static void writeContinuationStackEvent(void *anElement, void *userData);
+
 	UDATA
 	calculateRequiredBufferSize()
 	{
@@ -984,6 +1013,8 @@ done:
 
 		requiredBufferSize += PHYSICAL_MEMORY_EVENT_SIZE;
 
+		requiredBufferSize += DATA_LOSS_EVENT_SIZE;
+
 		requiredBufferSize += VIRTUALIZATION_INFORMATION_EVENT_SIZE;
 
 		requiredBufferSize += CPU_INFORMATION_EVENT_SIZE;
@@ -1000,6 +1031,8 @@ done:
 
 		requiredBufferSize += _constantPoolTypes.getClassLoaderStatisticsCount() * CLASS_LOADER_STATISTICS_EVENT_SIZE;
 
+		requiredBufferSize += _constantPoolTypes.getFinalizerStatisticsCount() * FINALIZER_STATISTICS_EVENT_SIZE;
+
 		requiredBufferSize += _constantPoolTypes.getThreadContextSwitchRateCount() * THREAD_CONTEXT_SWITCH_RATE_SIZE;
 
 		requiredBufferSize += _constantPoolTypes.getThreadStatisticsCount() * THREAD_STATISTICS_EVENT_SIZE;
@@ -1026,6 +1059,10 @@ done:
 
 		requiredBufferSize += (_constantPoolTypes.getGCHeapSummaryCount() * GC_HEAP_SUMMARY_EVENT_SIZE);
 
+		requiredBufferSize += (_constantPoolTypes.getSafepointCount() * (SAFEPOINT_BEGIN_EVENT_SIZE + SAFEPOINT_STATE_SYNCHRONIZATION_EVENT_SIZE));
+
+		requiredBufferSize += (_constantPoolTypes.getContinuationStackCount() * CONTINUATION_STACK_EVENT_SIZE);
+
 		return requiredBufferSize;
 	}
 
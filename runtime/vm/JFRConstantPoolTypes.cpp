@@ -1490,6 +1490,90 @@ done:
 	return;
 }
 
+void
+VM_JFRConstantPoolTypes::addSafepointEntry(J9JFRSafepoint *safepointData)
+{
+	SafepointEntry *entry = (SafepointEntry *)pool_newElement(_safepointTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = safepointData->startTicks;
+	entry->duration = safepointData->duration;
+
+	entry->eventThreadIndex = addThreadEntry(safepointData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->safepointID = safepointData->safepointID;
+	entry->totalThreadCount = safepointData->totalThreadCount;
+	entry->jniCriticalThreadCount = safepointData->jniCriticalThreadCount;
+	entry->initialThreadCount = safepointData->initialThreadCount;
+
+	_safepointCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addContinuationStackEntry(J9JFRContinuationStackMoved *continuationStackData)
+{
+	ContinuationStackEntry *entry = (ContinuationStackEntry *)pool_newElement(_continuationStackTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = continuationStackData->startTicks;
+	entry->duration = continuationStackData->duration;
+
+	entry->eventThreadIndex = addThreadEntry(continuationStackData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->continuationClassIndex = getClassEntry(continuationStackData->continuationClass);
+	if (isResultNotOKay()) goto done;
+
+	entry->size = continuationStackData->size;
+	entry->thaw = (J9JFR_EVENT_TYPE_CONTINUATION_THAW == continuationStackData->eventType);
+
+	_continuationStackCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addFinalizerStatisticsEntry(J9VMThread *currentThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData)
+{
+	VM_JFRConstantPoolTypes *cp = (VM_JFRConstantPoolTypes *)userData;
+	PORT_ACCESS_FROM_VMC(currentThread);
+	FinalizerStatisticsEntry *entry = NULL;
+
+	if (cp->isResultNotOKay()) goto done;
+
+	entry = (FinalizerStatisticsEntry *)pool_newElement(cp->_finalizerStatisticsTable);
+	if (NULL == entry) {
+		cp->_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = j9time_nano_time();
+
+	entry->classIndex = cp->getClassEntry(clazz);
+	if (cp->isResultNotOKay()) goto done;
+
+	entry->objects = objects;
+	entry->totalFinalizersRun = finalizersRun;
+
+	cp->_finalizerStatisticsCount += 1;
+
+done:
+	return;
+}
+
 void
 VM_JFRConstantPoolTypes::printTables()
 {
@@ -353,6 +353,32 @@ struct GCHeapSummaryEntry {
 	I_64 heapUsed;
 };
 
+struct SafepointEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_32 eventThreadIndex;
+	U_64 safepointID;
+	UDATA totalThreadCount;
+	UDATA jniCriticalThreadCount;
+	UDATA initialThreadCount;
+};
+
+struct ContinuationStackEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_32 eventThreadIndex;
+	U_32 continuationClassIndex;
+	UDATA size;
+	bool thaw;
+};
+
+struct FinalizerStatisticsEntry {
+	I_64 ticks;
+	U_32 classIndex;
+	U_64 objects;
+	U_64 totalFinalizersRun;
+};
+
 struct ModuleRequireEntry {
 	I_64 ticks;
 	U_32 sourceModuleIndex;
@@ -435,6 +461,7 @@ class VM_JFRConstantPoolTypes {
 private:
 	J9VMThread *_currentThread;
 	J9JavaVM *_vm;
+	J9JFRBuffer *_jfrBuffer;
 	JfrBuildResult _buildResult;
 	bool _debug;
 	J9PortLibrary *privatePortLibrary;
@@ -508,6 +535,12 @@ private:
 	UDATA _garbageCollectionCount;
 	J9Pool *_gcHeapSummaryTable;
 	UDATA _gcHeapSummaryCount;
+	J9Pool *_safepointTable;
+	UDATA _safepointCount;
+	J9Pool *_finalizerStatisticsTable;
+	UDATA _finalizerStatisticsCount;
+	J9Pool *_continuationStackTable;
+	UDATA _continuationStackCount;
 
 	/* Processing buffers */
 	StackFrame *_currentStackFrameBuffer;
@@ -797,6 +830,12 @@ public:
 
 	void addGCHeapSummaryEntry(J9JFRGCHeapSummary *gcHeapSummaryData);
 
+	void addSafepointEntry(J9JFRSafepoint *safepointData);
+
+	void addContinuationStackEntry(J9JFRContinuationStackMoved *continuationStackData);
+
+	static void addFinalizerStatisticsEntry(J9VMThread *currentThread, J9Class *clazz, UDATA objects, U_64 finalizersRun, void *userData);
+
 	J9Pool *getExecutionSampleTable()
 	{
 		return _executionSampleTable;
@@ -937,6 +976,36 @@ public:
 		return _gcHeapSummaryCount;
 	}
 
+	J9Pool *getSafepointTable()
+	{
+		return _safepointTable;
+	}
+
+	UDATA getSafepointCount()
+	{
+		return _safepointCount;
+	}
+
+	J9Pool *getFinalizerStatisticsTable()
+	{
+		return _finalizerStatisticsTable;
+	}
+
+	UDATA getFinalizerStatisticsCount()
+	{
+		return _finalizerStatisticsCount;
+	}
+
+	J9Pool *getContinuationStackTable()
+	{
+		return _continuationStackTable;
+	}
+
+	UDATA getContinuationStackCount()
+	{
+		return _continuationStackCount;
+	}
+
 	UDATA getThreadStartCount()
 	{
 		return _threadStartCount;
@@ -1153,7 +1222,7 @@ public:
 	{
 		J9JFRBufferWalkState walkstate = {0};
 		J9Pool *shallowEntries = NULL;
-		J9JFREvent *event = jfrBufferStartDo(&_vm->jfrBuffer, &walkstate);
+		J9JFREvent *event = jfrBufferStartDo(_jfrBuffer, &walkstate);
 
 		while (NULL != event) {
 			switch (event->eventType) {
@@ -1208,6 +1277,13 @@ public:
 			case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 				addGCHeapSummaryEntry((J9JFRGCHeapSummary *)event);
 				break;
+			case J9JFR_EVENT_TYPE_SAFEPOINT:
+				addSafepointEntry((J9JFRSafepoint *)event);
+				break;
+			case J9JFR_EVENT_TYPE_CONTINUATION_FREEZE:
+			case J9JFR_EVENT_TYPE_CONTINUATION_THAW:
+				addContinuationStackEntry((J9JFRContinuationStackMoved *)event);
+				break;
 			default:
 				Assert_VM_unreachable();
 				break;
@@ -1224,6 +1300,7 @@ public:
 			loadNativeLibraries(_currentThread);
 			loadModuleRequireAndModuleExportEvents();
 			loadClassLoaderStatisticsEvents(_currentThread);
+			loadFinalizerStatisticsEvents(_currentThread);
 		}
 
 		shallowEntries = pool_new(sizeof(ClassEntry **), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
@@ -1797,9 +1874,22 @@ done:
 		vmFuncs->allClassLoadersEndDo(&walkState);
 	}
 
-	VM_JFRConstantPoolTypes(J9VMThread *currentThread)
+	/**
+	 * @brief Generate and add FinalizerStatistics events to _finalizerStatisticsTable.
+	 *
+	 * @param currentThread[in] The pointer to the current J9VMThread
+	 */
+	void loadFinalizerStatisticsEvents(J9VMThread *currentThread)
+	{
+#if defined(J9VM_GC_FINALIZATION)
+		_vm->memoryManagerFunctions->j9gc_finalizer_statistics_do(currentThread, addFinalizerStatisticsEntry, this);
+#endif /* defined(J9VM_GC_FINALIZATION) */
+	}
+
+	VM_JFRConstantPoolTypes(J9VMThread *currentThread, J9JFRBuffer *jfrBuffer)
 		: _currentThread(currentThread)
 		, _vm(currentThread->javaVM)
+		, _jfrBuffer(jfrBuffer)
 		, _buildResult(OK)
 		, _debug(false)
 		, privatePortLibrary(_vm->portLibrary)
@@ -1868,6 +1958,12 @@ done:
 		, _garbageCollectionCount(0)
 		, _gcHeapSummaryTable(NULL)
 		, _gcHeapSummaryCount(0)
+		, _safepointTable(NULL)
+		, _safepointCount(0)
+		, _finalizerStatisticsTable(NULL)
+		, _finalizerStatisticsCount(0)
+		, _continuationStackTable(NULL)
+		, _continuationStackCount(0)
 		, _previousStackTraceEntry(NULL)
 		, _firstStackTraceEntry(NULL)
 		, _previousThreadEntry(NULL)
@@ -2074,6 +2170,24 @@ done:
 			goto done;
 		}
 
+		_safepointTable = pool_new(sizeof(SafepointEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _safepointTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_finalizerStatisticsTable = pool_new(sizeof(FinalizerStatisticsEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _finalizerStatisticsTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_continuationStackTable = pool_new(sizeof(ContinuationStackEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _continuationStackTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
 		/* Add reserved index for default entries. For strings zero is the empty or NUll string.
 		 * For package zero is the deafult package, for Module zero is the unnamed module. ThreadGroup
 		 * zero is NULL threadGroup.
@@ -2177,6 +2291,9 @@ done:
 		pool_kill(_youngGarbageCollectionTable);
 		pool_kill(_garbageCollectionTable);
 		pool_kill(_gcHeapSummaryTable);
+		pool_kill(_safepointTable);
+		pool_kill(_finalizerStatisticsTable);
+		pool_kill(_continuationStackTable);
 		j9mem_free_memory(_globalStringTable);
 	}
 
@@ -129,17 +129,58 @@ public:
 		}
 	}
 
+	/**
+	 * Build the name of a continuous recording file. The sequence number is
+	 * inserted in front of the ".jfr" extension of the recording file name.
+	 *
+	 * @param vm[in] the J9JavaVM
+	 * @param sequence[in] the sequence number of the recording file
+	 * @param buffer[out] the buffer to receive the file name
+	 * @param bufferLength[in] the size of the buffer in bytes
+	 */
+	static void
+	getRecordingFileName(J9JavaVM *vm, UDATA sequence, char *buffer, UDATA bufferLength)
+	{
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		const char *jfrFileName = vm->jfrState.jfrFileName;
+		UDATA stemLength = 0;
+
+		if (NULL == jfrFileName) {
+			jfrFileName = DEFAULT_JFR_FILE_NAME;
+		}
+
+		stemLength = strlen(jfrFileName);
+#define JFR_FILE_EXTENSION ".jfr"
+		if ((stemLength > LITERAL_STRLEN(JFR_FILE_EXTENSION))
+		&& (0 == strcmp(jfrFileName + stemLength - LITERAL_STRLEN(JFR_FILE_EXTENSION), JFR_FILE_EXTENSION))
+		) {
+			stemLength -= LITERAL_STRLEN(JFR_FILE_EXTENSION);
+		}
+		j9str_printf(buffer, bufferLength, "%.*s.%zu" JFR_FILE_EXTENSION, (int)stemLength, jfrFileName, sequence);
+#undef JFR_FILE_EXTENSION
+	}
+
 	static bool
 	openJFRFile(J9JavaVM *vm)
 	{
 		PORT_ACCESS_FROM_JAVAVM(vm);
 		bool result = true;
 		const char *jfrFileName = vm->jfrState.jfrFileName;
+		char recordingFileName[EsMaxPath];
 
 		if (NULL == jfrFileName) {
 			jfrFileName = DEFAULT_JFR_FILE_NAME;
 		}
 
+		/* The recording file may already be open if the file name was set while parsing the command line. */
+		closeJFRFile(vm);
+
+		if (vm->jfrState.continuousRecording) {
+			getRecordingFileName(vm, vm->jfrState.recordingFileSequence, recordingFileName, sizeof(recordingFileName));
+			jfrFileName = recordingFileName;
+			vm->jfrState.recordingFileStartTime = j9time_current_time_millis();
+		}
+
 		vm->jfrState.blobFileDescriptor = j9file_open(jfrFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate , 0666);
 
 		if (-1 == vm->jfrState.blobFileDescriptor) {
@@ -149,6 +190,77 @@ public:
 		return result;
 	}
 
+	/**
+	 * Check whether the current continuous recording file has reached its size or age bound.
+	 *
+	 * @param vm[in] the J9JavaVM
+	 *
+	 * @returns true if the recording file should be rotated, false otherwise
+	 */
+	static bool
+	isJFRFileRotationRequired(J9JavaVM *vm)
+	{
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		bool result = false;
+
+		if (vm->jfrState.continuousRecording && (-1 != vm->jfrState.blobFileDescriptor)) {
+			if ((0 != vm->jfrState.maxChunkSize)
+			&& ((U_64)j9file_flength(vm->jfrState.blobFileDescriptor) >= vm->jfrState.maxChunkSize)
+			) {
+				result = true;
+			} else if ((0 != vm->jfrState.maxChunkAge)
+			&& ((U_64)(j9time_current_time_millis() - vm->jfrState.recordingFileStartTime) >= vm->jfrState.maxChunkAge)
+			) {
+				result = true;
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	 * Close the current continuous recording file and open the next one in sequence.
+	 * Once the rotated files exceed the retention budget the oldest ones are deleted.
+	 *
+	 * Only the JFR writer thread, or a thread with exclusive VM access, may rotate the file.
+	 *
+	 * @param vm[in] the J9JavaVM
+	 *
+	 * @returns true on success, false if the next recording file could not be opened
+	 */
+	static bool
+	rotateJFRFile(J9JavaVM *vm)
+	{
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		char fileName[EsMaxPath];
+		I_64 fileLength = j9file_flength(vm->jfrState.blobFileDescriptor);
+
+		if (fileLength > 0) {
+			vm->jfrState.retainedSize += (U_64)fileLength;
+		}
+		vm->jfrState.recordingFileSequence += 1;
+		/* Start the chunk count over so that every file carries the one-time constant events. */
+		vm->jfrState.jfrChunkCount = 0;
+
+		if (0 != vm->jfrState.maxRetainedSize) {
+			while ((vm->jfrState.retainedSize > vm->jfrState.maxRetainedSize)
+			&& (vm->jfrState.oldestRetainedSequence < vm->jfrState.recordingFileSequence)
+			) {
+				getRecordingFileName(vm, vm->jfrState.oldestRetainedSequence, fileName, sizeof(fileName));
+				fileLength = j9file_length(fileName);
+				j9file_unlink(fileName);
+				if ((fileLength > 0) && ((U_64)fileLength < vm->jfrState.retainedSize)) {
+					vm->jfrState.retainedSize -= (U_64)fileLength;
+				} else if (fileLength > 0) {
+					vm->jfrState.retainedSize = 0;
+				}
+				vm->jfrState.oldestRetainedSequence += 1;
+			}
+		}
+
+		return openJFRFile(vm);
+	}
+
 	static bool
 	initializaJFRWriter(J9JavaVM *vm)
 	{
@@ -175,10 +287,10 @@ done:
 	}
 
 	static bool
-	flushJFRDataToFile(J9VMThread *currentThread, bool finalWrite, bool dumpCalled)
+	flushJFRDataToFile(J9VMThread *currentThread, J9JFRBuffer *jfrBuffer, bool finalWrite, bool dumpCalled)
 	{
 		bool result = true;
-		VM_JFRChunkWriter chunkWriter(currentThread, finalWrite);
+		VM_JFRChunkWriter chunkWriter(currentThread, jfrBuffer, finalWrite);
 
 		if (!chunkWriter.isOkay()) {
 			result = false;
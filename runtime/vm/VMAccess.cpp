@@ -54,7 +54,10 @@
 extern "C" {
 
 static void initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread);
-static U_64 updateExclusiveVMAccessStats(J9VMThread* currentThread);
+static U_64 updateExclusiveVMAccessStats(J9VMThread* currentThread, UDATA reason);
+static void initializeExclusiveAccessSyncStats(J9ExclusiveAccessSyncStats *stats, U_64 startTime);
+static void reportExclusiveAccessSync(J9JavaVM *vm, J9VMThread *currentThread, J9ExclusiveAccessSyncStats *stats, U_64 endTime, UDATA safePoint);
+static void disableInlineVMAccess(J9JavaVM *vm, J9VMThread *targetThread);
 
 #if (defined(J9VM_DBG))
 static void badness (char *description);
@@ -96,21 +99,123 @@ initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread)
 	vm->omrVM->exclusiveVMAccessStats.requester = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.lastResponder = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.haltedThreads = 0;
+	initializeExclusiveAccessSyncStats(&vm->exclusiveAccessSyncStats, vm->omrVM->exclusiveVMAccessStats.startTime);
 }
 
 /**
  * Update the vm's J9ExclusiveVMStats structure once currentThread has responded.
  *
  * @parm[in] currentThread the thread responding
+ * @parm[in] reason J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE or J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL
  *
  * @return the current time used for the statistics
  */
 static U_64
-updateExclusiveVMAccessStats(J9VMThread* currentThread)
+updateExclusiveVMAccessStats(J9VMThread* currentThread, UDATA reason)
 {
 	J9JavaVM* const vm = currentThread->javaVM;
 	PORT_ACCESS_FROM_JAVAVM(vm);
-	return VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB);
+	return VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB, reason);
+}
+
+/**
+ * Start collecting the responders of a new exclusive or safe point access request.
+ *
+ * @parm[in] stats the statistics to initialize
+ * @parm[in] startTime the time in ticks the request was made
+ */
+static void
+initializeExclusiveAccessSyncStats(J9ExclusiveAccessSyncStats *stats, U_64 startTime)
+{
+	stats->startTime = startTime;
+	stats->responderCount = 0;
+	stats->jniCriticalResponderCount = 0;
+}
+
+/**
+ * Account for an exclusive or safe point access request once all threads have responded: add the
+ * time it took to the histogram, identify the slowest responders and report them through trace and
+ * J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED. The requester must have exclusive or safe point access.
+ *
+ * @parm[in] vm the J9JavaVM
+ * @parm[in] currentThread the requesting thread, or NULL for an external request
+ * @parm[in] stats the statistics of the request
+ * @parm[in] endTime the time in ticks when all threads had responded
+ * @parm[in] safePoint TRUE for a safe point request, FALSE for an exclusive one
+ */
+static void
+reportExclusiveAccessSync(J9JavaVM *vm, J9VMThread *currentThread, J9ExclusiveAccessSyncStats *stats, U_64 endTime, UDATA safePoint)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_64 syncTime = 0;
+	UDATA bucket = 0;
+	UDATA recorded = OMR_MIN(stats->responderCount, J9VM_EXCLUSIVE_SYNC_SLOWEST_RESPONDERS);
+	UDATA i = 0;
+
+	if (endTime > stats->startTime) {
+		syncTime = j9time_hires_delta(stats->startTime, endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	for (U_64 bound = syncTime; (0 != bound) && (bucket < (J9VM_EXCLUSIVE_SYNC_HISTOGRAM_BUCKETS - 1)); bound >>= 1) {
+		bucket += 1;
+	}
+	stats->syncTimeHistogram[bucket] += 1;
+	stats->requestCount += 1;
+	stats->totalSyncTime += syncTime;
+	if (syncTime > stats->maxSyncTime) {
+		stats->maxSyncTime = syncTime;
+	}
+
+	/* Responders which have since exited are no longer in the thread list, and the JIT PC they were last
+	 * seen at is only meaningful if it is in compiled code. The requester holds off class unloading.
+	 */
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	for (i = 0; i < recorded; i++) {
+		J9ExclusiveAccessResponder *responder = &stats->responders[i];
+		J9VMThread *walkThread = vm->mainThread;
+		bool found = false;
+		while (NULL != walkThread) {
+			if (walkThread == responder->thread) {
+				found = true;
+				break;
+			}
+			walkThread = walkThread->linkNext;
+			if (vm->mainThread == walkThread) {
+				break;
+			}
+		}
+		if (!found) {
+			responder->thread = NULL;
+		} else if ((NULL != vm->jitConfig) && (NULL != responder->jitPC)) {
+			J9JITExceptionTable *metaData = vm->jitConfig->jitGetExceptionTableFromPC(responder->thread, (UDATA)responder->jitPC);
+			if (NULL != metaData) {
+				responder->method = metaData->ramMethod;
+			} else {
+				responder->jitPC = NULL;
+			}
+		}
+		Trc_VM_exclusiveAccessSync_Responder(currentThread, responder->thread, (UDATA)j9time_hires_delta(0, responder->responseTime, J9PORT_TIME_DELTA_IN_MICROSECONDS),
+				responder->method, responder->pc, responder->jitPC, responder->publicFlags, responder->reason);
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+
+	Trc_VM_exclusiveAccessSync(currentThread, safePoint, (UDATA)syncTime, stats->responderCount);
+	TRIGGER_J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED(vm->hookInterface, currentThread, safePoint, syncTime, stats);
+}
+
+void
+reportExclusiveAccessSyncHistograms(J9JavaVM *vm)
+{
+	UDATA bucket = 0;
+
+	for (bucket = 0; bucket < J9VM_EXCLUSIVE_SYNC_HISTOGRAM_BUCKETS; bucket++) {
+		U_64 exclusiveCount = vm->exclusiveAccessSyncStats.syncTimeHistogram[bucket];
+		U_64 safePointCount = vm->safePointSyncStats.syncTimeHistogram[bucket];
+		if ((0 != exclusiveCount) || (0 != safePointCount)) {
+			Trc_VM_exclusiveAccessSyncHistogram(((UDATA)1 << bucket) >> 1, exclusiveCount, safePointCount);
+		}
+	}
+	Trc_VM_exclusiveAccessSyncTotals(vm->exclusiveAccessSyncStats.requestCount, vm->exclusiveAccessSyncStats.totalSyncTime, vm->exclusiveAccessSyncStats.maxSyncTime,
+			vm->safePointSyncStats.requestCount, vm->safePointSyncStats.totalSyncTime, vm->safePointSyncStats.maxSyncTime);
 }
 
 
@@ -328,6 +433,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->vmThreadListMutex);
 
 		vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+		reportExclusiveAccessSync(vm, vmThread, &vm->exclusiveAccessSyncStats, vm->omrVM->exclusiveVMAccessStats.endTime, FALSE);
 	}
 	Assert_VM_true((J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState));
 	Trc_VM_acquireExclusiveVMAccess_Exit(vmThread);
@@ -364,7 +470,7 @@ void   internalAcquireVMAccessNoMutexWithMask(J9VMThread * vmThread, UDATA haltM
 		if (J9_ARE_ANY_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE)) {
 			omrthread_monitor_enter(vm->exclusiveAccessMutex);
 
-			U_64 timeNow = updateExclusiveVMAccessStats(vmThread);
+			U_64 timeNow = updateExclusiveVMAccessStats(vmThread, J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL);
 
 			--vm->jniCriticalResponseCount;
 			if(vm->jniCriticalResponseCount == 0) {
@@ -446,7 +552,7 @@ static void  internalReleaseVMAccessNoMutexNoCheck(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->exclusiveAccessMutex);
 
 		if (J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE == (vmThread->publicFlags & (J9_PUBLIC_FLAGS_HALT_THREAD_EXCLUSIVE | J9_PUBLIC_FLAGS_NOT_COUNTED_BY_EXCLUSIVE))) {
-			U_64 timeNow = updateExclusiveVMAccessStats(vmThread);
+			U_64 timeNow = updateExclusiveVMAccessStats(vmThread, J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE);
 
 			--vm->exclusiveAccessResponseCount;
 			if (vm->exclusiveAccessResponseCount == 0) {
@@ -458,6 +564,13 @@ static void  internalReleaseVMAccessNoMutexNoCheck(J9VMThread * vmThread)
 				VM_VMAccess::clearPublicFlags(vmThread, J9_PUBLIC_FLAGS_REQUEST_SAFE_POINT);
 				VM_VMAccess::setPublicFlags(vmThread, J9_PUBLIC_FLAGS_HALTED_AT_SAFE_POINT);
 				if (J9_ARE_NO_BITS_SET(vmThread->publicFlags, J9_PUBLIC_FLAGS_NOT_COUNTED_BY_SAFE_POINT)) {
+					U_64 const safePointStartTime = vm->safePointSyncStats.startTime;
+					U_64 timeNow = j9time_hires_clock();
+					if (timeNow < safePointStartTime) {
+						/* don't let time go backwards */
+						timeNow = safePointStartTime;
+					}
+					VM_VMAccess::recordExclusiveAccessResponder(&vm->safePointSyncStats, vmThread, timeNow - safePointStartTime, J9_EXCLUSIVE_SLOW_REASON_EXCLUSIVE);
 					--vm->safePointResponseCount;
 					if (vm->safePointResponseCount == 0) {
 						omrthread_monitor_notify_all(vm->exclusiveAccessMutex);
@@ -720,7 +833,7 @@ synchronizeRequestsFromExternalThread(J9JavaVM * vm, BOOLEAN block)
 }
 
 static void
-waitForResponseFromExternalThread(J9JavaVM * vm, UDATA vmResponsesExpected, UDATA jniResponsesExpected)
+waitForResponseFromExternalThread(J9JavaVM * vm, J9VMThread * requester, UDATA vmResponsesExpected, UDATA jniResponsesExpected)
 {
 	PORT_ACCESS_FROM_JAVAVM(vm);
 
@@ -746,6 +859,7 @@ waitForResponseFromExternalThread(J9JavaVM * vm, UDATA vmResponsesExpected, UDAT
 	omrthread_monitor_enter(vm->vmThreadListMutex);
 
 	vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+	reportExclusiveAccessSync(vm, requester, &vm->exclusiveAccessSyncStats, vm->omrVM->exclusiveVMAccessStats.endTime, FALSE);
 }
 
 void
@@ -833,7 +947,7 @@ acquireExclusiveVMAccessFromExternalThread(J9JavaVM * vm)
 
 	/* Wait for all threads to respond to the halt request */
 
-	waitForResponseFromExternalThread(vm, vmResponsesExpected, jniResponsesExpected);
+	waitForResponseFromExternalThread(vm, NULL, vmResponsesExpected, jniResponsesExpected);
 
 }
 
@@ -1033,7 +1147,7 @@ waitForExclusiveVMAccessMetronomeTemp(J9VMThread * vmThread, UDATA vmResponsesRe
 		return;
 	}
 
-	waitForResponseFromExternalThread(vm, vmResponsesRequired, jniResponsesRequired);
+	waitForResponseFromExternalThread(vm, vmThread, vmResponsesRequired, jniResponsesRequired);
 
 	VM_VMAccess::backOffFromSafePoint(vmThread);
 
@@ -1128,6 +1242,7 @@ void
 acquireSafePointVMAccess(J9VMThread * vmThread)
 {
 	J9JavaVM* vm = vmThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
 	UDATA responsesExpected = 0;
 	J9VMThread * currentThread;
 
@@ -1162,6 +1277,7 @@ acquireSafePointVMAccess(J9VMThread * vmThread)
 		/* Grant safe point access to the thread now */
 		vm->safePointState = J9_XACCESS_PENDING;
 		vm->safePointResponseCount = 0;
+		initializeExclusiveAccessSyncStats(&vm->safePointSyncStats, j9time_hires_clock());
 		omrthread_monitor_exit(vm->exclusiveAccessMutex);
 
 		/* Post a safe point request to all threads */
@@ -1249,6 +1365,7 @@ retry:
 		omrthread_monitor_exit(vm->exclusiveAccessMutex);
 		// Not necessary?
 		VM_VMAccess::clearPublicFlags(vmThread, J9_PUBLIC_FLAGS_HALTED_AT_SAFE_POINT | J9_PUBLIC_FLAGS_NOT_COUNTED_BY_SAFE_POINT);
+		reportExclusiveAccessSync(vm, vmThread, &vm->safePointSyncStats, j9time_hires_clock(), TRUE);
 	}
 	Assert_VM_mustHaveVMAccess(vmThread);
 	Assert_VM_true(J9_XACCESS_EXCLUSIVE == vm->safePointState);
@@ -1385,4 +1502,138 @@ resumeThreadForInspection(J9VMThread * currentThread, J9VMThread * vmThread)
 	}
 }
 
+/**
+ * Force the target thread to release and acquire VM access out of line, so that it notifies its
+ * publicFlagsMutex when it does so. The caller must hold the target's publicFlagsMutex.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param targetThread[in] the thread to modify
+ */
+static void
+disableInlineVMAccess(J9JavaVM *vm, J9VMThread *targetThread)
+{
+	VM_VMAccess::setPublicFlags(targetThread, J9_PUBLIC_FLAGS_DISABLE_INLINE_VM_ACCESS);
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI)
+#if defined(J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH)
+	flushProcessWriteBuffers(vm);
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI_USES_FLUSH */
+	VM_AtomicSupport::readWriteBarrier();
+#endif /* J9VM_INTERP_ATOMIC_FREE_JNI */
+}
+
+/* Note that VM access may be released and reacquired by this call - direct object pointers must not be held across this call */
+
+void
+executeThreadHandshake(J9VMThread *currentThread, J9VMThread *targetThread, J9ThreadHandshakeFunction function, void *userData)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	IDATA handlerKey = vm->threadHandshakeHandlerKey;
+	J9ThreadHandshake handshake = { function, userData, currentThread, J9_THREAD_HANDSHAKE_POSTED };
+	bool posted = false;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	/* The current thread is always at a safe point for itself */
+	if (currentThread == targetThread) {
+		function(currentThread, targetThread, userData);
+		return;
+	}
+
+	/* Keep the target from being freed while the current thread runs without VM access */
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	targetThread->inspectorCount += 1;
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+
+	omrthread_monitor_enter(targetThread->publicFlagsMutex);
+	/* A thread which does not hold VM access is already stopped for inspection purposes, so only
+	 * running threads are handed the closure. Only one handshake may be pending per thread, and a
+	 * thread queued for exclusive will not reach an async check point until the exclusive is released.
+	 */
+	if ((handlerKey >= 0)
+		&& (NULL == targetThread->pendingHandshake)
+		&& J9_ARE_NO_BITS_SET(targetThread->publicFlags, J9_PUBLIC_FLAGS_QUEUED_FOR_EXCLUSIVE)
+		&& VM_VMAccess::mustWaitForVMAccessRelease(targetThread)
+	) {
+		targetThread->pendingHandshake = &handshake;
+		/* Force the target to release VM access out of line, so that the current thread is notified if
+		 * the target stops (e.g. blocks or is suspended) before it reaches an async check point.
+		 */
+		disableInlineVMAccess(vm, targetThread);
+		J9SignalAsyncEvent(vm, targetThread, handlerKey);
+		Trc_VM_executeThreadHandshake_posted(currentThread, targetThread, function, userData);
+		posted = true;
+	}
+	omrthread_monitor_exit(targetThread->publicFlagsMutex);
+
+	if (posted) {
+		internalReleaseVMAccess(currentThread);
+
+		omrthread_monitor_enter(targetThread->publicFlagsMutex);
+		while (J9_THREAD_HANDSHAKE_POSTED == handshake.state) {
+			/* The flag is cleared by every out-of-line release or acquire of the target, so it must be set
+			 * again each time the target is seen holding VM access, or its next release (e.g. entering a
+			 * blocking native) would be inlined and never notify the current thread.
+			 */
+			disableInlineVMAccess(vm, targetThread);
+			if (!VM_VMAccess::mustWaitForVMAccessRelease(targetThread)) {
+				break;
+			}
+			omrthread_monitor_wait(targetThread->publicFlagsMutex);
+		}
+		if (J9_THREAD_HANDSHAKE_POSTED == handshake.state) {
+			/* The target stopped without taking the handshake - withdraw it and inspect the halted target instead */
+			targetThread->pendingHandshake = NULL;
+			posted = false;
+		} else {
+			while (J9_THREAD_HANDSHAKE_DONE != handshake.state) {
+				omrthread_monitor_wait(targetThread->publicFlagsMutex);
+			}
+		}
+		omrthread_monitor_exit(targetThread->publicFlagsMutex);
+
+		internalAcquireVMAccess(currentThread);
+	}
+
+	if (!posted) {
+		Trc_VM_executeThreadHandshake_halted(currentThread, targetThread, function, userData);
+		haltThreadForInspection(currentThread, targetThread);
+		function(currentThread, targetThread, userData);
+		resumeThreadForInspection(currentThread, targetThread);
+	}
+
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	if (0 == --targetThread->inspectorCount) {
+		omrthread_monitor_notify_all(vm->vmThreadListMutex);
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+}
+
+void
+threadHandshakeAsyncHandler(J9VMThread *currentThread, IDATA handlerKey, void *userData)
+{
+	J9ThreadHandshake *handshake = NULL;
+
+	Assert_VM_mustHaveVMAccess(currentThread);
+
+	/* The requester may have withdrawn the handshake since the event was signalled */
+	omrthread_monitor_enter(currentThread->publicFlagsMutex);
+	handshake = currentThread->pendingHandshake;
+	if (NULL != handshake) {
+		handshake->state = J9_THREAD_HANDSHAKE_RUNNING;
+	}
+	omrthread_monitor_exit(currentThread->publicFlagsMutex);
+
+	if (NULL != handshake) {
+		Trc_VM_threadHandshakeAsyncHandler_run(currentThread, handshake->requester, handshake->function, handshake->userData);
+		handshake->function(currentThread, currentThread, handshake->userData);
+
+		/* The record belongs to the requester, which may return as soon as it is done */
+		omrthread_monitor_enter(currentThread->publicFlagsMutex);
+		currentThread->pendingHandshake = NULL;
+		handshake->state = J9_THREAD_HANDSHAKE_DONE;
+		omrthread_monitor_notify_all(currentThread->publicFlagsMutex);
+		omrthread_monitor_exit(currentThread->publicFlagsMutex);
+	}
+}
+
 } /* extern "C" */
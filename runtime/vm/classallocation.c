@@ -67,17 +67,24 @@ U_32 classPropagationTable[CLASS_PROPAGATION_TABLE_SIZE] = {
 void
 freeMapCaches(J9ClassLoader *classLoader)
 {
-	if (NULL != classLoader->localmapCache) {
-		hashTableFree(classLoader->localmapCache);
-		classLoader->localmapCache = NULL;
-	}
-	if (NULL != classLoader->argsbitsCache) {
-		hashTableFree(classLoader->argsbitsCache);
-		classLoader->argsbitsCache = NULL;
-	}
-	if (NULL != classLoader->stackmapCache) {
-		hashTableFree(classLoader->stackmapCache);
-		classLoader->stackmapCache = NULL;
+	J9MapCacheShard *shards = classLoader->mapCacheShards;
+	if (NULL != shards) {
+		UDATA i = 0;
+		for (i = 0; i < classLoader->mapCacheShardCount; ++i) {
+			J9MapCacheShard *shard = &shards[i];
+			if (NULL != shard->localmapCache) {
+				hashTableFree(shard->localmapCache);
+				shard->localmapCache = NULL;
+			}
+			if (NULL != shard->argsbitsCache) {
+				hashTableFree(shard->argsbitsCache);
+				shard->argsbitsCache = NULL;
+			}
+			if (NULL != shard->stackmapCache) {
+				hashTableFree(shard->stackmapCache);
+				shard->stackmapCache = NULL;
+			}
+		}
 	}
 }
 
@@ -179,14 +186,10 @@ allocateClassLoader(J9JavaVM *javaVM)
 
 	if (NULL != classLoader) {
 		UDATA classRelationshipsHashTableResult = -1;
-		BOOLEAN cacheMaps = J9_ARE_ANY_BITS_SET(javaVM->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_CACHE_MAPS);
 #if defined(J9VM_OPT_JFR)
 		classLoader->loadedClassCount = 0;
 #endif /* defined(J9VM_OPT_JFR) */
 		/* memset not required as the classLoaderBlocks pool returns zero'd memory */
-		if (cacheMaps) {
-			omrthread_monitor_init_with_name(&classLoader->mapCacheMutex, 0, "map cache mutex");
-		}
 		classLoader->classHashTable = hashClassTableNew(javaVM, INITIAL_CLASSHASHTABLE_SIZE);
 #if JAVA_SPEC_VERSION > 8
 		classLoader->moduleHashTable = hashModuleNameTableNew(javaVM, INITIAL_MODULE_HASHTABLE_SIZE);
@@ -204,7 +207,6 @@ allocateClassLoader(J9JavaVM *javaVM)
 		classRelationshipsHashTableResult = j9bcv_hashClassRelationshipTableNew(classLoader, javaVM);
 
 		if ((NULL == classLoader->classHashTable)
-			|| (cacheMaps && (NULL == classLoader->mapCacheMutex))
 #if JAVA_SPEC_VERSION > 8
 			|| (NULL == classLoader->moduleHashTable)
 			|| (NULL == classLoader->packageHashTable)
@@ -533,9 +535,10 @@ freeClassLoader(J9ClassLoader *classLoader, J9JavaVM *javaVM, J9VMThread *vmThre
 	}
 
 	freeMapCaches(classLoader);
-	if (NULL != classLoader->mapCacheMutex) {
-		omrthread_monitor_destroy(classLoader->mapCacheMutex);
-		classLoader->mapCacheMutex = NULL;
+	if (NULL != classLoader->mapCacheShards) {
+		j9mem_free_memory(classLoader->mapCacheShards);
+		classLoader->mapCacheShards = NULL;
+		classLoader->mapCacheShardCount = 0;
 	}
 
 	TRIGGER_J9HOOK_VM_CLASS_LOADER_DESTROY(javaVM->hookInterface, javaVM, classLoader);
@@ -72,7 +72,7 @@ static void fixStackWalkState (J9StackWalkState * walkState, UDATA oldStackStart
 static UDATA addI2J (J9StackWalkState * walkState, J9I2JState * i2jState);
 #endif /* J9VM_INTERP_NATIVE_SUPPORT */
 static UDATA growFrameIterator (J9VMThread * vmThread, J9StackWalkState * walkState);
-static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize);
+static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize, J9JavaStack * newStack, J9JavaStack ** unusedStack);
 
 
 #if (defined(J9VM_JIT_FULL_SPEED_DEBUG)) 
@@ -94,21 +94,31 @@ UDATA   growJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 {
 	UDATA rc;
 
-	rc = internalGrowJavaStack(vmThread, newStackSize);
+	rc = internalGrowJavaStack(vmThread, newStackSize, NULL, NULL);
 	if (0 != rc) {
 		vmThread->javaVM->memoryManagerFunctions->j9gc_modron_global_collect_with_overrides(vmThread, J9MMCONSTANT_EXPLICIT_GC_NATIVE_OUT_OF_MEMORY);
-		rc = internalGrowJavaStack(vmThread, newStackSize);
+		rc = internalGrowJavaStack(vmThread, newStackSize, NULL, NULL);
 	}
 
 	return rc;
 }
 
 
-static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
+UDATA   relocateJavaStack(J9VMThread * vmThread, J9JavaStack * newStack, J9JavaStack ** unusedStack)
+{
+	return internalGrowJavaStack(vmThread, newStack->size, newStack, unusedStack);
+}
+
+
+/* If newStack is NULL, a stack of newStackSize bytes is allocated, otherwise the caller owns newStack
+ * if the copy fails. If unusedStack is NULL, the old stack is freed when no frame refers to it any more,
+ * otherwise it is unlinked and returned in unusedStack (or NULL if it must be kept).
+ */
+static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize, J9JavaStack * newStack, J9JavaStack ** unusedStack)
 {
 	PORT_ACCESS_FROM_VMC(vmThread);
 	J9JavaStack * oldStack = vmThread->stackObject;
-	J9JavaStack * newStack;
+	bool allocatedStack = (NULL == newStack);
 	UDATA delta;
 	J9StackWalkState walkState;
 	UDATA usedBytes = ((U_8 *) oldStack->end) - ((U_8 *) vmThread->sp);
@@ -128,11 +138,15 @@ static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 		rc = 3;
 		goto done;
 	}
-	newStack = allocateJavaStack(vmThread->javaVM, newStackSize, oldStack);
-	if (!newStack) {
-		Trc_VM_growJavaStack_AllocFailed(vmThread);
-		rc = 1;
-		goto done;
+	if (allocatedStack) {
+		newStack = allocateJavaStack(vmThread->javaVM, newStackSize, oldStack);
+		if (!newStack) {
+			Trc_VM_growJavaStack_AllocFailed(vmThread);
+			rc = 1;
+			goto done;
+		}
+	} else {
+		newStack->previous = oldStack;
 	}
 	delta = newStack->end - oldStack->end;
 	/* Assert that double-slot alignment has been maintained */
@@ -156,7 +170,9 @@ static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 		walkState.restartPoint = pool_new(sizeof(J9I2JState *), 0, 0, 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(PORTLIB));
 		if (!walkState.restartPoint) {
 			Trc_VM_growJavaStack_PoolAllocFailed(vmThread);
-			freeJavaStack(vmThread->javaVM, newStack);
+			if (allocatedStack) {
+				freeJavaStack(vmThread->javaVM, newStack);
+			}
 			rc = 4;
 			goto done;
 		}
@@ -176,7 +192,9 @@ static UDATA internalGrowJavaStack(J9VMThread * vmThread, UDATA newStackSize)
 		if (walkState.restartException) {
 poolElementAllocFailed:
 			pool_kill((J9Pool *) walkState.restartPoint);
-			freeJavaStack(vmThread->javaVM, newStack);
+			if (allocatedStack) {
+				freeJavaStack(vmThread->javaVM, newStack);
+			}
 			rc = 5;
 			goto done;
 		}
@@ -247,13 +265,21 @@ poolElementAllocFailed:
 	newStack->isVirtual = oldStack->isVirtual;
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
+	if (NULL != unusedStack) {
+		*unusedStack = NULL;
+	}
 	if (walkState.userData2) {
 		Trc_VM_growJavaStack_KeepingOldStack(vmThread, walkState.userData2);
 		oldStack->firstReferenceFrame = oldStack->end - ((UDATA *) walkState.userData2);
 	} else {
 		Trc_VM_growJavaStack_FreeingOldStack(vmThread, oldStack);
 		newStack->previous = oldStack->previous;
-		freeJavaStack(vmThread->javaVM, oldStack);
+		if (NULL != unusedStack) {
+			oldStack->previous = NULL;
+			*unusedStack = oldStack;
+		} else {
+			freeJavaStack(vmThread->javaVM, oldStack);
+		}
 	}
 
 	Trc_VM_growJavaStack_Success(vmThread);
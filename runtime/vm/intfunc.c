@@ -505,4 +505,6 @@ J9InternalVMFunctions J9InternalFunctions = {
 	totalNumberOfDisclaimableClassMemorySegments,
 	signalNameToValue,
 	internalRunStaticMethod,
+	inheritHotFieldLayout,
+	executeThreadHandshake,
 };
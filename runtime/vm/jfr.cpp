@@ -52,6 +52,10 @@ J9_DECLARE_CONSTANT_NAS(transformToListNAS, transformToListUTF8, transformToList
 #define J9JFR_THREAD_BUFFER_SIZE (1024*1024)
 #define J9JFR_GLOBAL_BUFFER_SIZE (10 * J9JFR_THREAD_BUFFER_SIZE)
 #define J9JFR_SAMPLING_RATE 10
+/* Interval in milliseconds at which the JFR writer streams buffered events to disk in continuous mode. */
+#define J9JFR_WRITER_PERIOD 1000
+/* Size bound for continuous recording files when neither a size nor an age bound was requested. */
+#define J9JFR_DEFAULT_MAX_CHUNK_SIZE (12 * 1024 * 1024)
 #define J9JFR_CLASSNAME_BUFFER_SIZE 128
 
 /* Value needs to be the same as jdk.jfr.internal.JVM.RESERVED_CLASS_ID_LIMIT. */
@@ -70,10 +74,13 @@ J9_DECLARE_CONSTANT_NAS(transformToListNAS, transformToListUTF8, transformToList
 #define STRING_TYPE_ID 214
 
 static void jfrStartSamplingThread(J9JavaVM *vm);
+static void jfrStartWriterThread(J9JavaVM *vm);
 static void initializeEventFields(J9VMThread *currentThread, J9JFREvent *jfrEvent, UDATA eventType);
 static int J9THREAD_PROC jfrSamplingThreadProc(void *entryArg);
+static int J9THREAD_PROC jfrWriterThreadProc(void *entryArg);
 static void jfrExecutionSampleCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
 static void jfrThreadCPULoadCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
+static void jfrFlushBufferCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
 static void jfrCheckJFRCMDLineOptions(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
 static jlong getTypeIdImpl(J9VMThread *currentThread, J9ClassLoader *classLoader, J9UTF8 *className, BOOLEAN freeName);
 
@@ -140,6 +147,13 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	case J9JFR_EVENT_TYPE_GC_HEAP_SUMMARY_ENTRY:
 		size = sizeof(J9JFRGCHeapSummary);
 		break;
+	case J9JFR_EVENT_TYPE_SAFEPOINT:
+		size = sizeof(J9JFRSafepoint);
+		break;
+	case J9JFR_EVENT_TYPE_CONTINUATION_FREEZE:
+	case J9JFR_EVENT_TYPE_CONTINUATION_THAW:
+		size = sizeof(J9JFRContinuationStackMoved);
+		break;
 	default:
 		Assert_VM_unreachable();
 		break;
@@ -193,6 +207,83 @@ areJFRBuffersReadyForWrite(J9VMThread *currentThread)
 	return result;
 }
 
+static bool
+isJFRBufferEmpty(J9JFRBuffer *buffer)
+{
+	return buffer->bufferCurrent == buffer->bufferStart;
+}
+
+static bool
+hasExclusiveVMAccess(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	return (currentThread->omrVMThread->exclusiveCount > 0)
+		&& ((J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState));
+}
+
+/**
+ * Pass the global JFR buffer to the JFR writer thread by swapping it with the
+ * empty pending buffer.
+ *
+ * The current thread must hold the jfrBufferMutex.
+ *
+ * @param vm[in] the J9JavaVM
+ *
+ * @returns true if the global buffer is empty on return, false if the writer
+ * has not finished with the previous pending buffer
+ */
+static bool
+handOffGlobalBuffer(J9JavaVM *vm)
+{
+	bool result = true;
+
+	if (!isJFRBufferEmpty(&vm->jfrBuffer)) {
+		if ((NULL != vm->jfrPendingBuffer.bufferStart) && isJFRBufferEmpty(&vm->jfrPendingBuffer)) {
+			J9JFRBuffer swap = vm->jfrPendingBuffer;
+			vm->jfrPendingBuffer = vm->jfrBuffer;
+			vm->jfrBuffer = swap;
+			vm->jfrState.handedOffBufferCount += 1;
+			omrthread_monitor_notify_all(vm->jfrBufferMutex);
+		} else {
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Write out the contents of the pending JFR buffer handed off to the writer thread.
+ *
+ * The current thread must have VM access and either be the JFR writer thread or
+ * have exclusive VM access. The pending buffer is not modified by other threads
+ * until it has been reset here.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @returns true on success, false on failure
+ */
+static bool
+writeOutPendingBuffer(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	bool result = true;
+
+	if ((NULL != vm->jfrPendingBuffer.bufferStart) && !isJFRBufferEmpty(&vm->jfrPendingBuffer)) {
+		result = VM_JFRWriter::flushJFRDataToFile(currentThread, &vm->jfrPendingBuffer, false, false);
+
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		vm->jfrPendingBuffer.bufferRemaining = vm->jfrPendingBuffer.bufferSize;
+		vm->jfrPendingBuffer.bufferCurrent = vm->jfrPendingBuffer.bufferStart;
+		vm->jfrState.writtenBufferCount += 1;
+		omrthread_monitor_notify_all(vm->jfrBufferMutex);
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+	}
+
+	return result;
+}
+
 /**
  * Write out the contents of the global JFR buffer.
  *
@@ -213,7 +304,10 @@ writeOutGlobalBuffer(J9VMThread *currentThread, bool finalWrite, bool dumpCalled
 #endif /* defined(DEBUG) */
 
 	if (vm->jfrState.isStarted && (NULL != vm->jfrBuffer.bufferCurrent)) {
-		VM_JFRWriter::flushJFRDataToFile(currentThread, finalWrite, dumpCalled);
+		/* Events handed off to the writer thread are older than the ones in the global buffer. */
+		writeOutPendingBuffer(currentThread);
+
+		VM_JFRWriter::flushJFRDataToFile(currentThread, &vm->jfrBuffer, finalWrite, dumpCalled);
 
 		/* Reset the buffer */
 		vm->jfrBuffer.bufferRemaining = vm->jfrBuffer.bufferSize;
@@ -257,7 +351,17 @@ flushBufferToGlobal(J9VMThread *currentThread, J9VMThread *flushThread)
 
 	omrthread_monitor_enter(vm->jfrBufferMutex);
 	if (vm->jfrBuffer.bufferRemaining < bufferSize) {
-		if (!writeOutGlobalBuffer(currentThread, false, false)) {
+		if ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) && handOffGlobalBuffer(vm)) {
+			/* The JFR writer thread will write the full buffer out. */
+		} else if ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) && !hasExclusiveVMAccess(currentThread)) {
+			/* The writer is still busy with the previous buffer. Drop the events
+			 * rather than block this thread on file I/O.
+			 */
+			vm->jfrState.droppedBufferCount += 1;
+			vm->jfrState.droppedBytes += bufferSize;
+			omrthread_monitor_exit(vm->jfrBufferMutex);
+			goto resetBuffer;
+		} else if (!writeOutGlobalBuffer(currentThread, false, false)) {
 			omrthread_monitor_exit(vm->jfrBufferMutex);
 			success = false;
 			goto done;
@@ -268,6 +372,7 @@ flushBufferToGlobal(J9VMThread *currentThread, J9VMThread *flushThread)
 	vm->jfrBuffer.bufferRemaining -= bufferSize;
 	omrthread_monitor_exit(vm->jfrBufferMutex);
 
+resetBuffer:
 	/* Reset the buffer */
 	flushThread->jfrBuffer.bufferRemaining = flushThread->jfrBuffer.bufferSize;
 	flushThread->jfrBuffer.bufferCurrent = flushThread->jfrBuffer.bufferStart;
@@ -543,6 +648,42 @@ jfrThreadStarting(J9HookInterface **hook, UDATA eventNum, void *eventData, void
 	}
 }
 
+/**
+ * Copy the buffer of an ending thread to the global buffer without dropping
+ * any events, waiting for the JFR writer thread if the global buffer is full.
+ * VM access is released while waiting, so that the writer can proceed.
+ *
+ * The current thread must have VM access.
+ *
+ * @param currentThread[in] the current J9VMThread
+ */
+static void
+flushEndingThreadBuffer(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	omrthread_monitor_enter(vm->jfrBufferMutex);
+	while ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState)
+		&& (vm->jfrBuffer.bufferRemaining < (UDATA)(currentThread->jfrBuffer.bufferCurrent - currentThread->jfrBuffer.bufferStart))
+		&& !handOffGlobalBuffer(vm)
+	) {
+		UDATA writtenBufferCount = vm->jfrState.writtenBufferCount;
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+		internalReleaseVMAccess(currentThread);
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		while ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) && (writtenBufferCount == vm->jfrState.writtenBufferCount)) {
+			omrthread_monitor_wait(vm->jfrBufferMutex);
+		}
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+		/* A class unload may have flushed the buffer meanwhile, so its size is read again */
+		internalAcquireVMAccess(currentThread);
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+	}
+	/* The buffer now fits, or the writer has stopped and the global buffer is written out directly */
+	flushBufferToGlobal(currentThread, currentThread);
+	omrthread_monitor_exit(vm->jfrBufferMutex);
+}
+
 /**
  * Hook for thread ending.
  *
@@ -568,15 +709,39 @@ jfrThreadEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void *user
 		initializeEventFields(currentThread, jfrEvent, J9JFR_EVENT_TYPE_THREAD_END);
 	}
 	PORT_ACCESS_FROM_VMC(currentThread);
-	acquireExclusiveVMAccess(currentThread);
-	flushAllThreadBuffers(currentThread, false);
-	writeOutGlobalBuffer(currentThread, false, false);
+	J9JavaVM *vm = currentThread->javaVM;
+	bool waitForWriter = false;
+	UDATA handedOffBufferCount = 0;
+	if (J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) {
+		/* Leave the file I/O to the writer thread, but wait below for it to write out
+		 * the events referring to this thread before the J9VMThread goes away. The
+		 * other threads copy their own buffers when the writer asks them to.
+		 */
+		flushEndingThreadBuffer(currentThread);
+		waitForWriter = true;
+	} else {
+		acquireExclusiveVMAccess(currentThread);
+		flushAllThreadBuffers(currentThread, false);
+		writeOutGlobalBuffer(currentThread, false, false);
+		releaseExclusiveVMAccess(currentThread);
+	}
 
 	/* Free the thread local buffer */
 	j9mem_free_memory((void*)currentThread->jfrBuffer.bufferStart);
 	memset(&currentThread->jfrBuffer, 0, sizeof(currentThread->jfrBuffer));
-	releaseExclusiveVMAccess(currentThread);
 	internalReleaseVMAccess(currentThread);
+
+	if (waitForWriter) {
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		while ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) && !handOffGlobalBuffer(vm)) {
+			omrthread_monitor_wait(vm->jfrBufferMutex);
+		}
+		handedOffBufferCount = vm->jfrState.handedOffBufferCount;
+		while ((J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) && (vm->jfrState.writtenBufferCount < handedOffBufferCount)) {
+			omrthread_monitor_wait(vm->jfrBufferMutex);
+		}
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+	}
 }
 
 /**
@@ -626,6 +791,7 @@ jfrVMInitialized(J9HookInterface **hook, UDATA eventNum, void *eventData, void *
 	j9tty_printf(PORTLIB, "\n!!! VM init %p\n", currentThread);
 #endif /* defined(DEBUG) */
 	jfrStartSamplingThread(currentThread->javaVM);
+	jfrStartWriterThread(currentThread->javaVM);
 }
 
 /**
@@ -650,6 +816,28 @@ jfrStartSamplingThread(J9JavaVM *vm)
 	}
 }
 
+/**
+ * Start the JFR writer thread if continuous recording was requested. If the
+ * thread cannot be started, the global buffer is written out synchronously as
+ * for a regular recording.
+ *
+ * @param vm[in] the J9JavaVM
+ */
+static void
+jfrStartWriterThread(J9JavaVM *vm)
+{
+	if (vm->jfrState.continuousRecording && (NULL != vm->jfrPendingBuffer.bufferStart)) {
+		IDATA rc = omrthread_create(&(vm->jfrWriterThread), vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, jfrWriterThreadProc, (void*)vm);
+		if (0 == rc) {
+			omrthread_monitor_enter(vm->jfrBufferMutex);
+			while (J9JFR_WRITER_STATE_UNINITIALIZED == vm->jfrWriterState) {
+				omrthread_monitor_wait(vm->jfrBufferMutex);
+			}
+			omrthread_monitor_exit(vm->jfrBufferMutex);
+		}
+	}
+}
+
 /**
  * Hook for VM monitor waited. Called without VM access.
  *
@@ -762,6 +950,53 @@ jfrSystemGC(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userD
 	}
 }
 
+/**
+ * Hook for exclusive and safe point access requests once all threads have responded. The requester
+ * holds exclusive or safe point access, so all other threads are halted. Requests made from
+ * external threads have no thread buffer to record them in.
+ *
+ * @param hook[in] the VM hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrVMExclusiveAccessSynchronized(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	J9VMExclusiveAccessSynchronizedEvent *event = (J9VMExclusiveAccessSynchronizedEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+
+	if (NULL != currentThread) {
+		J9JavaVM *vm = currentThread->javaVM;
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		J9JFRSafepoint *jfrEvent = (J9JFRSafepoint *)reserveBuffer(currentThread, sizeof(J9JFRSafepoint));
+		if (NULL != jfrEvent) {
+			initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_SAFEPOINT);
+			/* syncTime is in microseconds and ends now */
+			jfrEvent->duration = (I_64)(event->syncTime * 1000);
+			jfrEvent->startTicks = j9time_nano_time() - jfrEvent->duration;
+			/* Number the exclusive and safe point requests together, in the order they synchronized */
+			jfrEvent->safepointID = vm->exclusiveAccessSyncStats.requestCount + vm->safePointSyncStats.requestCount;
+			jfrEvent->totalThreadCount = vm->totalThreadCount;
+			jfrEvent->jniCriticalThreadCount = event->stats->jniCriticalResponderCount;
+			jfrEvent->initialThreadCount = event->stats->responderCount;
+		}
+	}
+}
+
+void
+jfrContinuationStackMoved(J9VMThread *currentThread, UDATA eventType, J9Class *continuationClass, I_64 startTicks, I_64 duration, UDATA size)
+{
+	J9JFRContinuationStackMoved *jfrEvent = (J9JFRContinuationStackMoved *)reserveBuffer(currentThread, sizeof(J9JFRContinuationStackMoved));
+	if (NULL != jfrEvent) {
+		initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, eventType);
+		jfrEvent->startTicks = startTicks;
+		jfrEvent->duration = duration;
+		jfrEvent->continuationClass = continuationClass;
+		jfrEvent->size = size;
+	}
+}
+
 /**
  * Hook for old garbage collection event. Called without VM access.
  *
@@ -859,6 +1094,15 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 		goto fail;
 	}
 
+	/* Register async handler for the JFR writer to collect the thread local buffers in continuous mode. */
+	vm->jfrFlushAsyncKey = -1;
+	if (vm->jfrState.continuousRecording) {
+		vm->jfrFlushAsyncKey = J9RegisterAsyncEvent(vm, jfrFlushBufferCallback, NULL);
+		if (vm->jfrFlushAsyncKey < 0) {
+			goto fail;
+		}
+	}
+
 	if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_THREAD_CREATED, jfrThreadCreated, OMR_GET_CALLSITE(), NULL)) {
 		goto fail;
 	}
@@ -894,6 +1138,9 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, OMR_GET_CALLSITE(), NULL)) {
 		goto fail;
 	}
+	if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED, jfrVMExclusiveAccessSynchronized, OMR_GET_CALLSITE(), NULL)) {
+		goto fail;
+	}
 	/* Register GC-related hooks via gc_base */
 	if (0 != (vm->memoryManagerFunctions->j9gc_register_jfr_hooks(vm))) {
 		goto fail;
@@ -920,6 +1167,22 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	vm->jfrBuffer.bufferCurrent = buffer;
 	vm->jfrBuffer.bufferSize = J9JFR_GLOBAL_BUFFER_SIZE;
 	vm->jfrBuffer.bufferRemaining = J9JFR_GLOBAL_BUFFER_SIZE;
+
+	if (vm->jfrState.continuousRecording) {
+		/* The second global buffer is filled by application threads while the writer thread drains the first. */
+		buffer = (U_8 *)j9mem_allocate_memory(J9JFR_GLOBAL_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
+		if (NULL == buffer) {
+			goto fail;
+		}
+		vm->jfrPendingBuffer.bufferStart = buffer;
+		vm->jfrPendingBuffer.bufferCurrent = buffer;
+		vm->jfrPendingBuffer.bufferSize = J9JFR_GLOBAL_BUFFER_SIZE;
+		vm->jfrPendingBuffer.bufferRemaining = J9JFR_GLOBAL_BUFFER_SIZE;
+
+		if ((0 == vm->jfrState.maxChunkSize) && (0 == vm->jfrState.maxChunkAge)) {
+			vm->jfrState.maxChunkSize = J9JFR_DEFAULT_MAX_CHUNK_SIZE;
+		}
+	}
 	vm->jfrState.jfrChunkCount = 0;
 	vm->jfrState.isConstantEventsInitialized = FALSE;
 
@@ -974,6 +1237,7 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 		}
 
 		jfrStartSamplingThread(vm);
+		jfrStartWriterThread(vm);
 	}
 
 done:
@@ -1011,10 +1275,24 @@ tearDownJFR(J9JavaVM *vm)
 		vm->jfrSamplerMutex = NULL;
 	}
 
+	/* Stop the writer thread */
+	if (NULL != vm->jfrBufferMutex) {
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		if (J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) {
+			vm->jfrWriterState = J9JFR_WRITER_STATE_STOP;
+			omrthread_monitor_notify_all(vm->jfrBufferMutex);
+			while (J9JFR_WRITER_STATE_DEAD != vm->jfrWriterState) {
+				omrthread_monitor_wait(vm->jfrBufferMutex);
+			}
+		}
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+	}
+
 	internalAcquireVMAccess(currentThread);
 
 	vm->jfrState.isStarted = FALSE;
 	vm->jfrSamplerState = J9JFR_SAMPLER_STATE_UNINITIALIZED;
+	vm->jfrWriterState = J9JFR_WRITER_STATE_UNINITIALIZED;
 
 	VM_JFRWriter::teardownJFRWriter(vm);
 
@@ -1031,6 +1309,7 @@ tearDownJFR(J9JavaVM *vm)
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_MONITOR_CONTENDED_ENTERED, jfrVMMonitorEntered, NULL);
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_UNPARKED, jfrVMThreadParked, NULL);
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, NULL);
+	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_EXCLUSIVE_ACCESS_SYNCHRONIZED, jfrVMExclusiveAccessSynchronized, NULL);
 	/* Deregister GC-related hooks via gc_base */
 	vm->memoryManagerFunctions->j9gc_deregister_jfr_hooks(vm);
 
@@ -1039,6 +1318,8 @@ tearDownJFR(J9JavaVM *vm)
 
 	j9mem_free_memory((void*)vm->jfrBuffer.bufferStart);
 	memset(&vm->jfrBuffer, 0, sizeof(vm->jfrBuffer));
+	j9mem_free_memory((void*)vm->jfrPendingBuffer.bufferStart);
+	memset(&vm->jfrPendingBuffer, 0, sizeof(vm->jfrPendingBuffer));
 	if (NULL != vm->jfrBufferMutex) {
 		omrthread_monitor_destroy(vm->jfrBufferMutex);
 		vm->jfrBufferMutex = NULL;
@@ -1058,6 +1339,10 @@ tearDownJFR(J9JavaVM *vm)
 		J9UnregisterAsyncEvent(vm, vm->jfrThreadCPULoadAsyncKey);
 		vm->jfrThreadCPULoadAsyncKey = -1;
 	}
+	if (vm->jfrFlushAsyncKey >= 0) {
+		J9UnregisterAsyncEvent(vm, vm->jfrFlushAsyncKey);
+		vm->jfrFlushAsyncKey = -1;
+	}
 }
 
 /**
@@ -1109,6 +1394,14 @@ jfrExecutionSampleCallback(J9VMThread *currentThread, IDATA handlerKey, void *us
 	jfrExecutionSample(currentThread, currentThread);
 }
 
+static void
+jfrFlushBufferCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData)
+{
+	if (!isJFRBufferEmpty(&currentThread->jfrBuffer)) {
+		flushBufferToGlobal(currentThread, currentThread);
+	}
+}
+
 static void
 jfrCPULoad(J9VMThread *currentThread)
 {
@@ -1295,6 +1588,87 @@ jfrSamplingThreadProc(void *entryArg)
 	return 0;
 }
 
+/**
+ * Stream the buffered events to the continuous recording file and rotate the
+ * file once it reaches its size or age bound.
+ *
+ * The current thread is the JFR writer thread and must have VM access. The
+ * writer never takes exclusive VM access: each thread copies its own buffer to
+ * the global buffer when asked to, holding only the jfrBufferMutex, and the
+ * writer swaps out the global buffer under the same mutex before writing it,
+ * so application threads never wait for file I/O.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param streamAllBuffers[in] true to also collect the events still held in the thread local buffers
+ */
+static void
+jfrWriterStreamEvents(J9VMThread *currentThread, bool streamAllBuffers)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	writeOutPendingBuffer(currentThread);
+
+	if (streamAllBuffers) {
+		/* The threads copy their buffers at their next async check. Events copied since
+		 * the previous period are written out now, the others with the next period.
+		 */
+		J9SignalAsyncEvent(vm, NULL, vm->jfrFlushAsyncKey);
+
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		handOffGlobalBuffer(vm);
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+
+		writeOutPendingBuffer(currentThread);
+	}
+
+	if (VM_JFRWriter::isJFRFileRotationRequired(vm)) {
+		if (!VM_JFRWriter::rotateJFRFile(vm)) {
+			Trc_VM_jfr_ErrorWritingChunk(currentThread, FileIOError);
+		}
+	}
+}
+
+static int J9THREAD_PROC
+jfrWriterThreadProc(void *entryArg)
+{
+	J9JavaVM *vm = (J9JavaVM*)entryArg;
+	J9VMThread *currentThread = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (JNI_OK == attachSystemDaemonThread(vm, &currentThread, "JFR writer")) {
+		I_64 lastStreamTime = j9time_current_time_millis();
+		omrthread_monitor_enter(vm->jfrBufferMutex);
+		vm->jfrWriterState = J9JFR_WRITER_STATE_RUNNING;
+		omrthread_monitor_notify_all(vm->jfrBufferMutex);
+		while (J9JFR_WRITER_STATE_STOP != vm->jfrWriterState) {
+			bool streamAllBuffers = false;
+			if (isJFRBufferEmpty(&vm->jfrPendingBuffer)) {
+				omrthread_monitor_wait_timed(vm->jfrBufferMutex, J9JFR_WRITER_PERIOD, 0);
+				if (J9JFR_WRITER_STATE_STOP == vm->jfrWriterState) {
+					break;
+				}
+			}
+			if ((j9time_current_time_millis() - lastStreamTime) >= J9JFR_WRITER_PERIOD) {
+				streamAllBuffers = true;
+				lastStreamTime = j9time_current_time_millis();
+			}
+			omrthread_monitor_exit(vm->jfrBufferMutex);
+			internalAcquireVMAccess(currentThread);
+			jfrWriterStreamEvents(currentThread, streamAllBuffers);
+			internalReleaseVMAccess(currentThread);
+			omrthread_monitor_enter(vm->jfrBufferMutex);
+		}
+		omrthread_monitor_exit(vm->jfrBufferMutex);
+		DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(vm->jfrBufferMutex);
+	vm->jfrWriterState = J9JFR_WRITER_STATE_DEAD;
+	omrthread_monitor_notify_all(vm->jfrBufferMutex);
+	omrthread_exit(vm->jfrBufferMutex);
+	return 0;
+}
+
 jboolean
 setJFRRecordingFileName(J9JavaVM *vm, char *newFileName)
 {
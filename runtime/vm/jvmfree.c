@@ -273,6 +273,7 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 		}
 		j9mem_free_memory(vmThread->continuationT1Cache);
 	}
+	freeContinuationStackCache(vmThread);
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
 	/* freeing the per thread buffers in the portlibrary */
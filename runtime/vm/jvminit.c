@@ -716,7 +716,8 @@ freeJavaVM(J9JavaVM * vm)
 
 	/* Kill global hot field class info pool and its monitor if dynamicBreadthFirstScanOrdering is enabled */
 	if (NULL != vm->memoryManagerFunctions) {
-		hotReferenceFieldRequired = vm->memoryManagerFunctions->j9gc_hot_reference_field_required(vm);
+		hotReferenceFieldRequired = vm->memoryManagerFunctions->j9gc_hot_reference_field_required(vm)
+				|| J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT);
 		if (hotReferenceFieldRequired && NULL != vm->hotFieldClassInfoPool) {
 			pool_kill(vm->hotFieldClassInfoPool);
 			vm->hotFieldClassInfoPool = NULL;
@@ -955,6 +956,7 @@ freeJavaVM(J9JavaVM * vm)
 #ifndef J9VM_SIZE_SMALL_CODE
 	fieldIndexTableFree(vm);
 #endif
+	hotFieldLayoutTableFree(vm);
 
 	/* Close the trace DLL. This has to be after all hashtable and pool free events, otherwise we'll crash on pool tracepoints */
 	if (0 != traceDescriptor) {
@@ -1180,6 +1182,7 @@ initializeJavaVM(void * osMainThread, J9JavaVM ** vmPtr, J9CreateJavaVMParams *c
 #if defined(J9VM_THR_ASYNC_NAME_UPDATE)
 	vm->threadNameHandlerKey = -1;
 #endif /* J9VM_THR_ASYNC_NAME_UPDATE */
+	vm->threadHandshakeHandlerKey = -1;
 
 #if defined(J9VM_JIT_RUNTIME_INSTRUMENTATION)
 	/* Protection in case updateJITRuntimeInstrumentationFlags is called before initializeJITRuntimeInstrumentation */
@@ -2132,6 +2135,10 @@ processContinuationCacheOptions(J9JavaVM *vm)
 				/* Set VM flag. */
 				vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_ENABLE_CONTINUATION_CACHE_SUMMARY;
 				rc = 0;
+			} else if (try_scan(&cursor, "forceThawFailure")) {
+				/* Test option: parked continuations are never moved back off their frozen stacks. */
+				vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_FORCE_CONTINUATION_THAW_FAILURE;
+				rc = 0;
 			} else {
 				rc = -1;
 				break;
@@ -4612,6 +4619,10 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 #define JFR_OPTION_FILENAME "filename="
 #define JFR_OPTION_DELAY "delay="
 #define JFR_OPTION_DURATION "duration="
+#define JFR_OPTION_DISK "disk="
+#define JFR_OPTION_MAXCHUNKSIZE "maxchunksize="
+#define JFR_OPTION_MAXCHUNKAGE "maxchunkage="
+#define JFR_OPTION_MAXSIZE "maxsize="
 					char *scan_start = optionBuffer;
 
 					while ('\0' != *scan_start) {
@@ -4630,6 +4641,47 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 							targetPtr = &vm->jfrState.delay;
 						} else if (try_scan(&scan_start, JFR_OPTION_DURATION)) {
 							targetPtr = &vm->jfrState.duration;
+						} else if (try_scan(&scan_start, JFR_OPTION_DISK)) {
+							/* Continuous recording streams the events to rotating files from a writer thread. */
+							if (try_scan(&scan_start, "true")) {
+								vm->jfrState.continuousRecording = TRUE;
+							} else if (try_scan(&scan_start, "false")) {
+								vm->jfrState.continuousRecording = FALSE;
+							} else {
+								j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_UNRECOGNISED_CMD_LINE_OPT, optionBuffer);
+								return JNI_ERR;
+							}
+							continue;
+						} else if (try_scan(&scan_start, JFR_OPTION_MAXCHUNKSIZE)) {
+							if (0 != scan_u64_memory_size(&scan_start, &vm->jfrState.maxChunkSize)) {
+								j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_UNRECOGNISED_CMD_LINE_OPT, optionBuffer);
+								return JNI_ERR;
+							}
+							continue;
+						} else if (try_scan(&scan_start, JFR_OPTION_MAXSIZE)) {
+							if (0 != scan_u64_memory_size(&scan_start, &vm->jfrState.maxRetainedSize)) {
+								j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_UNRECOGNISED_CMD_LINE_OPT, optionBuffer);
+								return JNI_ERR;
+							}
+							continue;
+						} else if (try_scan(&scan_start, JFR_OPTION_MAXCHUNKAGE)) {
+							/* The age is in seconds unless followed by one of the ms, s, m or h units. */
+							U_64 maxChunkAge = 0;
+							if (0 != scan_u64(&scan_start, &maxChunkAge)) {
+								j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_UNRECOGNISED_CMD_LINE_OPT, optionBuffer);
+								return JNI_ERR;
+							}
+							if (try_scan(&scan_start, "ms")) {
+								vm->jfrState.maxChunkAge = maxChunkAge;
+							} else if (try_scan(&scan_start, "m")) {
+								vm->jfrState.maxChunkAge = maxChunkAge * 60 * 1000;
+							} else if (try_scan(&scan_start, "h")) {
+								vm->jfrState.maxChunkAge = maxChunkAge * 60 * 60 * 1000;
+							} else {
+								try_scan(&scan_start, "s");
+								vm->jfrState.maxChunkAge = maxChunkAge * 1000;
+							}
+							continue;
 						} else {
 							j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_VM_UNRECOGNISED_CMD_LINE_OPT, optionBuffer);
 							return JNI_ERR;
@@ -4654,6 +4706,10 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 #undef JFR_OPTION_FILENAME
 #undef JFR_OPTION_DELAY
 #undef JFR_OPTION_DURATION
+#undef JFR_OPTION_DISK
+#undef JFR_OPTION_MAXCHUNKSIZE
+#undef JFR_OPTION_MAXCHUNKAGE
+#undef JFR_OPTION_MAXSIZE
 			}
 		}
 	}
@@ -4734,6 +4790,56 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA shareMaps = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXSHAREMAPS, NULL);
+		IDATA noShareMaps = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOSHAREMAPS, NULL);
+
+		/* Persisting maps in the shared classes cache is layered on the map caches, see -XX:+CacheMaps */
+		if (shareMaps > noShareMaps) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_SHARE_MAPS;
+		} else if (shareMaps < noShareMaps) {
+			vm->extendedRuntimeFlags3 &= ~J9_EXTENDED_RUNTIME3_SHARE_MAPS;
+		}
+	}
+
+	{
+		IDATA hotFieldLayout = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXHOTFIELDLAYOUT, NULL);
+		IDATA noHotFieldLayout = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOHOTFIELDLAYOUT, NULL);
+
+		/* Hot fields are recorded in, and read from, the shared classes cache */
+		if (hotFieldLayout > noHotFieldLayout) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT;
+		} else if (hotFieldLayout < noHotFieldLayout) {
+			vm->extendedRuntimeFlags3 &= ~J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT;
+		}
+	}
+
+	{
+		IDATA shardedMonitorTable = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXSHARDEDMONITORTABLE, NULL);
+		IDATA noShardedMonitorTable = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOSHARDEDMONITORTABLE, NULL);
+
+		/* Give each monitor table its own lock and a lookup cache read without locking */
+		if (shardedMonitorTable > noShardedMonitorTable) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_SHARDED_MONITOR_TABLE;
+		} else if (shardedMonitorTable < noShardedMonitorTable) {
+			vm->extendedRuntimeFlags3 &= ~J9_EXTENDED_RUNTIME3_SHARDED_MONITOR_TABLE;
+		}
+	}
+
+#if JAVA_SPEC_VERSION >= 19
+	{
+		IDATA compactParkedStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXCOMPACTPARKEDCONTINUATIONSTACKS, NULL);
+		IDATA noCompactParkedStacks = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOCOMPACTPARKEDCONTINUATIONSTACKS, NULL);
+
+		/* Move the frames of parked virtual threads into right-sized stacks while they are unmounted */
+		if (compactParkedStacks > noCompactParkedStacks) {
+			vm->extendedRuntimeFlags3 |= J9_EXTENDED_RUNTIME3_COMPACT_PARKED_CONTINUATION_STACKS;
+		} else if (compactParkedStacks < noCompactParkedStacks) {
+			vm->extendedRuntimeFlags3 &= ~J9_EXTENDED_RUNTIME3_COMPACT_PARKED_CONTINUATION_STACKS;
+		}
+	}
+#endif /* JAVA_SPEC_VERSION >= 19 */
+
 	{
 		IDATA useDebugLocalMap = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXUSEDEBUGLOCALMAP, NULL);
 		IDATA noUseDebugLocalMap = FIND_AND_CONSUME_VMARG(EXACT_MATCH, VMOPT_XXNOUSEDEBUGLOCALMAP, NULL);
@@ -5202,6 +5308,8 @@ threadInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
 				goto _error;
 			}
 #endif /* defined(J9VM_THR_ASYNC_NAME_UPDATE) */
+			/* Without a handler key, thread handshakes halt the target thread instead */
+			vm->threadHandshakeHandlerKey = J9RegisterAsyncEvent(vm, threadHandshakeAsyncHandler, NULL);
 			break;
 		case JCL_INITIALIZED :
 			break;
@@ -7105,6 +7213,14 @@ runExitStages(J9JavaVM* vm, J9VMThread* vmThread)
 		j9tty_printf(PORTLIB, "\n     T2 Cache store:            %u", vm->t2store);
 		j9tty_printf(PORTLIB, "\nCache Freed:                %u\n", vm->cacheFree);
 		j9tty_printf(PORTLIB, "\nAvg Cache Stack Size:       %.2f KB\n", (double)vm->totalContinuationStackSize / (vm->t1CacheHit + vm->t2CacheHit + vm->cacheMiss) / 1024);
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_COMPACT_PARKED_CONTINUATION_STACKS)) {
+			j9tty_printf(PORTLIB, "\nFrozen Stacks:              %llu", vm->continuationFreezeCount);
+			j9tty_printf(PORTLIB, "\n     Avg Freeze Time:           %llu ns", (vm->continuationFreezeCount > 0) ? (vm->continuationFreezeTime / vm->continuationFreezeCount) : 0);
+			j9tty_printf(PORTLIB, "\n     Total Stack Saved:         %llu KB", vm->continuationFrozenBytesSaved / 1024);
+			j9tty_printf(PORTLIB, "\nThawed Stacks:              %llu", vm->continuationThawCount);
+			j9tty_printf(PORTLIB, "\n     Avg Thaw Time:             %llu ns", (vm->continuationThawCount > 0) ? (vm->continuationThawTime / vm->continuationThawCount) : 0);
+			j9tty_printf(PORTLIB, "\n     Thaw Failures:             %llu\n", vm->continuationThawFailures);
+		}
 	}
 #endif /* JAVA_SPEC_VERSION >= 19 */
 
@@ -7926,6 +8042,12 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 	}
 #endif
 
+	if (J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT)) {
+		if (0 != hotFieldLayoutTableNew(vm)) {
+			goto error;
+		}
+	}
+
 #ifdef J9VM_OPT_ZIP_SUPPORT
 	if (NULL == vm->zipCachePool) {
 		vm->zipCachePool = zipCachePool_new(portLibrary, vm);
@@ -8173,8 +8295,11 @@ protectedInitializeJavaVM(J9PortLibrary* portLibrary, void * userData)
 		 * The global hot field class info pool and global hot field class info pool monitor will be used to store hot
 		 * field information for all classes containing hot fields. In addition to this, the globalHotFieldPoolMutex that is created
 		 * is used when a new hot field pool for a classLoader is to be dynamically created.
+		 * -XX:+HotFieldLayout also needs the hot field information, to record it in the shared classes cache.
 		 */
-		if (vm->memoryManagerFunctions->j9gc_hot_reference_field_required(vm)) {
+		if (vm->memoryManagerFunctions->j9gc_hot_reference_field_required(vm)
+			|| J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT)
+		) {
 			vm->hotFieldClassInfoPool = pool_new(sizeof(J9ClassHotFieldsInfo), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(portLibrary)); /* Create the hot field class pool */
 			if ((NULL == vm->hotFieldClassInfoPool)
 				|| (0 != omrthread_monitor_init_with_name(&vm->hotFieldClassInfoPoolMutex, 0, "hotFieldClassInfoPoolMutex"))
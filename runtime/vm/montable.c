@@ -47,10 +47,14 @@ static UDATA hits, misses;
 
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
 
+#define J9_MONITOR_TABLE_SHARD_CACHE_SETS (J9VM_MONITOR_TABLE_SHARD_CACHE_SIZE / J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS)
+
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
 static UDATA hashMonitorHash (void *key, void *userData);
 static J9HashTable* createMonitorTable(J9JavaVM *vm, char *tableName);
+static J9ObjectMonitor* monitorTableShardCacheLookup(J9JavaVM *vm, J9MonitorTableShard *shard, UDATA hash, j9object_t object);
+static void monitorTableShardCacheAdd(J9JavaVM *vm, J9MonitorTableShard *shard, UDATA hash, J9ObjectMonitor *objectMonitor);
 
 
 static UDATA
@@ -96,6 +100,73 @@ cacheObjectMonitorForLookup(J9JavaVM* vm, J9VMThread* vmStruct, J9ObjectMonitor*
 
 
 
+/**
+ * Search the lookup cache of a monitor table shard, without locking, for the monitor of an object.
+ * Entries are only published once their monitor is in the shard's table, and only the GC (while
+ * mutators are stopped) destroys monitors, after clearing the caches. A miss does not mean there
+ * is no monitor; the caller must then search the table.
+ *
+ * @param vm		the vm
+ * @param shard		the shard of the object's monitor table
+ * @param hash		the object's hash code
+ * @param object	the object
+ *
+ * @return the object monitor, or NULL if it is not cached
+ */
+static J9ObjectMonitor*
+monitorTableShardCacheLookup(J9JavaVM *vm, J9MonitorTableShard *shard, UDATA hash, j9object_t object)
+{
+	/* The cache is written without locks, so read each entry exactly once */
+	volatile j9objectmonitor_t *cacheSet = shard->lookupCache + (((hash / vm->monitorTableCount) % J9_MONITOR_TABLE_SHARD_CACHE_SETS) * J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS);
+	J9ObjectMonitor *result = NULL;
+	UDATA way = 0;
+
+	for (way = 0; way < J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS; way++) {
+		J9ObjectMonitor *candidate = (J9ObjectMonitor *)(UDATA)cacheSet[way];
+		if ((NULL != candidate) && (J9WEAKROOT_OBJECT_LOAD_VM(vm, &((J9ThreadAbstractMonitor *)candidate->monitor)->userData) == object)) {
+			result = candidate;
+			break;
+		}
+	}
+	return result;
+}
+
+/**
+ * Publish a monitor to the lookup cache of its monitor table shard.
+ *
+ * @pre the caller must hold the shard's mutex, and the monitor must be in the shard's table
+ *
+ * @param vm			the vm
+ * @param shard			the shard of the monitor table containing the monitor
+ * @param hash			the hash code of the monitor's object
+ * @param objectMonitor	the object monitor
+ */
+static void
+monitorTableShardCacheAdd(J9JavaVM *vm, J9MonitorTableShard *shard, UDATA hash, J9ObjectMonitor *objectMonitor)
+{
+	UDATA setHash = hash / vm->monitorTableCount;
+	volatile j9objectmonitor_t *cacheSet = shard->lookupCache + ((setHash % J9_MONITOR_TABLE_SHARD_CACHE_SETS) * J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS);
+	j9objectmonitor_t entry = (j9objectmonitor_t)(UDATA)objectMonitor;
+	/* Use the hash bits above the ones selecting the set to pick the entry to replace */
+	UDATA victim = (setHash / J9_MONITOR_TABLE_SHARD_CACHE_SETS) % J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS;
+	UDATA way = 0;
+
+	for (way = 0; way < J9VM_MONITOR_TABLE_SHARD_CACHE_WAYS; way++) {
+		j9objectmonitor_t candidate = cacheSet[way];
+		if (entry == candidate) {
+			return;
+		}
+		if (0 == candidate) {
+			victim = way;
+			break;
+		}
+	}
+
+	/* The monitor must be fully initialized before lock-free readers can see it */
+	issueWriteBarrier();
+	cacheSet[victim] = entry;
+}
+
 /**
  * Creates the monitor hashtable
  *
@@ -147,6 +218,12 @@ initializeMonitorTable(J9JavaVM* vm)
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
 
+	vm->monitorTableShards = (J9MonitorTableShard *)j9mem_allocate_memory(sizeof(J9MonitorTableShard) * tableCount, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableShards) {
+		return -1;
+	}
+	memset(vm->monitorTableShards, 0, sizeof(J9MonitorTableShard) * tableCount);
+
 	vm->monitorTableList = NULL;
 
 	for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
@@ -167,6 +244,22 @@ initializeMonitorTable(J9JavaVM* vm)
 		vm->monitorTables[tableIndex] = table;
 		/* Store the table into the list entry */
 		monitorTableListEntry->monitorTable = table;
+
+		if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_SHARDED_MONITOR_TABLE)) {
+			J9MonitorTableShard *shard = &vm->monitorTableShards[tableIndex];
+			UDATA cacheBytes = sizeof(j9objectmonitor_t) * J9VM_MONITOR_TABLE_SHARD_CACHE_SIZE;
+
+			if (omrthread_monitor_init_with_name(&shard->mutex, 0, "VM monitor table shard")) {
+				return -1;
+			}
+			shard->lookupCache = (j9objectmonitor_t *)j9mem_allocate_memory(cacheBytes, OMRMEM_CATEGORY_VM);
+			if (NULL == shard->lookupCache) {
+				return -1;
+			}
+			memset(shard->lookupCache, 0, cacheBytes);
+		} else {
+			vm->monitorTableShards[tableIndex].mutex = vm->monitorTableMutex;
+		}
 	}
 
 	vm->monitorTableCount = tableCount;
@@ -196,6 +289,25 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableShards) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		UDATA tableIndex = 0;
+		for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+			J9MonitorTableShard *shard = &vm->monitorTableShards[tableIndex];
+
+			if (NULL != shard->lookupCache) {
+				Trc_VM_monitorTableShardStatistics(tableIndex, shard->hitCount, shard->missCount, shard->contendedCount);
+			}
+			if ((NULL != shard->mutex) && (vm->monitorTableMutex != shard->mutex)) {
+				omrthread_monitor_destroy(shard->mutex);
+			}
+			j9mem_free_memory(shard->lookupCache);
+		}
+
+		j9mem_free_memory(vm->monitorTableShards);
+		vm->monitorTableShards = NULL;
+	}
+
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -224,11 +336,12 @@ J9ObjectMonitor *
 monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
 	J9JavaVM* vm = vmStruct->javaVM;
-	omrthread_monitor_t mutex = vm->monitorTableMutex;
+	omrthread_monitor_t mutex = NULL;
 	J9ObjectMonitor * objectMonitor = NULL;
 	J9ObjectMonitor key_objectMonitor;
 	J9ThreadAbstractMonitor key_monitor;
 	struct J9HashTable* monitorTable = NULL;
+	J9MonitorTableShard *shard = NULL;
 	UDATA index = 0;
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
 	J9Class *ramClass = J9OBJECT_CLAZZ(vmStruct, object);
@@ -271,9 +384,33 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_objectMonitor.hash = objectHashCode(vm, object);
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
+	shard = &vm->monitorTableShards[index];
+
+	/* With -XX:+ShardedMonitorTable, existing monitors are usually found without locking */
+	if (NULL != shard->lookupCache) {
+		objectMonitor = monitorTableShardCacheLookup(vm, shard, (UDATA)key_objectMonitor.hash, object);
+		if (NULL != objectMonitor) {
+			if (TrcEnabled_Trc_VM_monitorTableAt_ShardStatistics) {
+				/* Only counted while tracing, so that readers do not write to the shared shard */
+				shard->hitCount += 1;
+			}
+			cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+			Trc_VM_monitorTableAt_ShardCacheHit_Exit(vmStruct, objectMonitor, index);
+			return objectMonitor;
+		}
+	}
 
-
-	omrthread_monitor_enter(mutex);
+	if (NULL == shard->lookupCache) {
+		mutex = vm->monitorTableMutex;
+		omrthread_monitor_enter(mutex);
+	} else {
+		mutex = shard->mutex;
+		if (0 != omrthread_monitor_try_enter(mutex)) {
+			omrthread_monitor_enter(mutex);
+			shard->contendedCount += 1;
+		}
+		shard->missCount += 1;
+	}
 
 	if (NULL == monitorTable){
 		TRACE("Out of memory creating tenant monitor table");
@@ -346,6 +483,13 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 
 	if (NULL != objectMonitor) {
 		cacheObjectMonitorForLookup(vm, vmStruct, objectMonitor);
+		if (NULL != shard->lookupCache) {
+			monitorTableShardCacheAdd(vm, shard, (UDATA)key_objectMonitor.hash, objectMonitor);
+		}
+	}
+
+	if (NULL != shard->lookupCache) {
+		Trc_VM_monitorTableAt_ShardStatistics(vmStruct, index, shard->hitCount, shard->missCount, shard->contendedCount);
 	}
 
 	omrthread_monitor_exit(mutex);
@@ -32,10 +32,17 @@
 #include "ObjectFieldInfo.hpp"
 #include "util_api.h"
 #include "vm_api.h"
+#include "SCQueryFunctions.h"
+#include "vmaccess.h"
 
 /* Extra hidden fields are lockword and finalizeLink. */
 #define NUMBER_OF_EXTRA_HIDDEN_FIELDS 2
 
+/* Number of hot fields recorded per class for -XX:+HotFieldLayout. */
+#define J9_HOT_FIELD_LAYOUT_MAX_FIELDS 8
+/* Only the first 64 instance fields of a class can be moved by a hot field layout. */
+#define J9_HOT_FIELD_LAYOUT_MAX_INDEX 64
+
 #if !defined (J9VM_SIZE_SMALL_CODE)
 
 typedef struct J9FieldTableEntry {
@@ -80,6 +87,11 @@ VMINLINE bool createClassLoaderHotFieldPool(J9JavaVM *javaVM, J9ClassLoader* cla
 VMINLINE void createClassHotFieldsInfo(J9JavaVM *javaVM, J9Class* clazz, uint8_t fieldOffset, int32_t reducedCpuUtil, uint32_t reducedFrequency);
 VMINLINE void addOrUpdateHotField(J9JavaVM *javaVM, J9Class* clazz, uint8_t fieldOffset, int32_t reducedCpuUtil, uint32_t reducedFrequency);
 
+/* Methods for laying out hot fields first when -XX:+HotFieldLayout is enabled */
+static U_64 getHotFieldLayout(J9JavaVM *vm, J9ROMClass *romClass);
+static void setHotInstanceFields(J9ROMFieldOffsetWalkState *state, U_64 hotFields);
+VMINLINE static UDATA nextInstanceObjectOffset(J9ROMFieldOffsetWalkState *state, U_32 instanceIndex, UDATA referenceSize);
+
 J9ROMFieldShape*
 findFieldExt(J9VMThread *vmStruct, J9Class *clazz, U_8 *fieldName, UDATA fieldNameLength, U_8 *signature, UDATA signatureLength, J9Class **definingClass, UDATA *offsetOrAddress, UDATA options)
 {
@@ -842,6 +854,85 @@ releaseMutex:
 	}
 }
 
+/**
+ * Select the hot instance fields of the class being walked which can be moved to the start of its object area.
+ * Only object fields which are not flattened are eligible.
+ *
+ * @param state the field offset walk state
+ * @param hotFields bit mask of the hot instance fields of the class, indexed by instance field ordinal
+ */
+static void
+setHotInstanceFields(J9ROMFieldOffsetWalkState *state, U_64 hotFields)
+{
+	J9ROMFieldWalkState fieldWalkState;
+	U_64 hotObjectFields = 0;
+	U_32 hotObjectCount = 0;
+	U_32 instanceIndex = 0;
+
+	if (0 == hotFields) {
+		return;
+	}
+	J9ROMFieldShape *field = romFieldsStartDo(state->romClass, &fieldWalkState);
+	while ((NULL != field) && (instanceIndex < J9_HOT_FIELD_LAYOUT_MAX_INDEX)) {
+		U_32 modifiers = field->modifiers;
+		if (J9_ARE_NO_BITS_SET(modifiers, J9AccStatic)) {
+			U_64 fieldBit = ((U_64)1) << instanceIndex;
+			if (J9_ARE_ANY_BITS_SET(hotFields, fieldBit)
+				&& J9_ARE_ALL_BITS_SET(modifiers, J9FieldFlagObject)
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+				&& J9_ARE_NO_BITS_SET(modifiers, J9FieldFlagIsNullRestricted)
+#endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
+			) {
+				hotObjectFields |= fieldBit;
+				hotObjectCount += 1;
+			}
+			instanceIndex += 1;
+		}
+		field = romFieldsNextDo(&fieldWalkState);
+	}
+
+	state->hotInstanceFields = hotObjectFields;
+	state->hotObjectSlots = hotObjectCount;
+	if ((0 != hotObjectCount) && J9_ARE_ALL_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
+		/* The backfill slot goes to the hottest object field rather than the first one declared */
+		state->hotObjectTakesBackfill = TRUE;
+		state->hotObjectSlots -= 1;
+	}
+}
+
+/**
+ * Return the offset of the next object instance field which is not flattened.
+ * Hot object fields take the backfill slot, if there is one for objects, and then the start of the object area.
+ * The other object fields follow them in declaration order.
+ *
+ * @param state the field offset walk state
+ * @param instanceIndex the ordinal of the field among the instance fields of the class
+ * @param referenceSize the size of an object reference
+ * @return the offset of the field from the end of the object header
+ */
+VMINLINE static UDATA
+nextInstanceObjectOffset(J9ROMFieldOffsetWalkState *state, U_32 instanceIndex, UDATA referenceSize)
+{
+	UDATA offset = 0;
+	bool isHot = (instanceIndex < J9_HOT_FIELD_LAYOUT_MAX_INDEX)
+			&& J9_ARE_ANY_BITS_SET(state->hotInstanceFields, ((U_64)1) << instanceIndex);
+
+	if (J9_ARE_ALL_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)
+		&& (isHot || !state->hotObjectTakesBackfill)
+	) {
+		Assert_VM_true(state->backfillOffsetToUse >= 0);
+		offset = state->backfillOffsetToUse;
+		state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
+	} else if (isHot) {
+		offset = state->firstObjectOffset + state->hotObjectsSeen * referenceSize;
+		state->hotObjectsSeen++;
+	} else {
+		offset = state->firstObjectOffset + (state->hotObjectSlots + state->objectsSeen) * referenceSize;
+		state->objectsSeen++;
+	}
+	return offset;
+}
+
 J9ROMFieldOffsetWalkResult *
 #if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
 fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9ROMFieldOffsetWalkState *state, U_32 flags, J9FlattenedClassCache *flattenedClassCache)
@@ -1001,6 +1092,18 @@ fieldOffsetsStartDo(J9JavaVM *vm, J9ROMClass *romClass, J9Class *superClazz, J9R
 #endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
 		}
 
+		/*
+		 * With -XX:+HotFieldLayout, the hot object fields recorded for this class go first in its object area.
+		 * Only the order within the area changes: the instance size, the backfill and the hidden fields are unaffected.
+		 */
+		if (J9_ARE_ALL_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE)
+			&& J9_ARE_ALL_BITS_SET(vm->extendedRuntimeFlags3, J9_EXTENDED_RUNTIME3_HOT_FIELD_LAYOUT)
+			&& (0 != fieldInfo.getInstanceObjectCount())
+			&& !fieldInfo.isContendedClassLayout()
+		) {
+			setHotInstanceFields(state, getHotFieldLayout(vm, romClass));
+		}
+
 		/*
 		 * Calculate offsets (from the object header) for hidden fields.  Hidden fields follow immediately the instance fields of the same type.
 		 * Give instance fields priority for backfill slots.
@@ -1194,6 +1297,8 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 				}
 			}
 		} else {
+			U_32 instanceIndex = state->instanceFieldsSeen;
+			state->instanceFieldsSeen++;
 			if( state->walkFlags & J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE ) {
 				{
 					if( modifiers & J9FieldFlagObject ) {
@@ -1204,14 +1309,7 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 							J9Class *fieldClass = NULL;
 							fieldClass = findJ9ClassInFlattenedClassCache(state->flattenedClassCache, fieldSigBytes + 1, J9UTF8_LENGTH(fieldSig) - 2);
 							if (!J9_IS_FIELD_FLATTENED(fieldClass, field)) {
-								if (J9_ARE_ALL_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
-									Assert_VM_true(state->backfillOffsetToUse >= 0);
-									state->result.offset = state->backfillOffsetToUse;
-									state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
-								} else {
-									state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
-									state->objectsSeen++;
-								}
+								state->result.offset = nextInstanceObjectOffset(state, instanceIndex, referenceSize);
 							} else {
 								U_32 size = (U_32)fieldClass->totalInstanceSize;
 								bool forceDoubleAlignment = false;
@@ -1261,24 +1359,10 @@ fieldOffsetsFindNext(J9ROMFieldOffsetWalkState *state, J9ROMFieldShape *field)
 								}
 							}
 						} else {
-							if (J9_ARE_ALL_BITS_SET(state->walkFlags, J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD)) {
-								Assert_VM_true(state->backfillOffsetToUse >= 0);
-								state->result.offset = state->backfillOffsetToUse;
-								state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
-							} else {
-								state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
-								state->objectsSeen++;
-							}
+							state->result.offset = nextInstanceObjectOffset(state, instanceIndex, referenceSize);
 						}
 #else /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
-						if (state->walkFlags & J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD) {
-							Assert_VM_true(state->backfillOffsetToUse >= 0);
-							state->result.offset = state->backfillOffsetToUse;
-							state->walkFlags &= ~(UDATA)J9VM_FIELD_OFFSET_WALK_BACKFILL_OBJECT_FIELD;
-						} else {
-							state->result.offset = state->firstObjectOffset + state->objectsSeen * referenceSize;
-							state->objectsSeen++;
-						}
+						state->result.offset = nextInstanceObjectOffset(state, instanceIndex, referenceSize);
 #endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
 						break;
 					} else if ( 0 == (state->walkFlags & J9VM_FIELD_OFFSET_WALK_ONLY_OBJECT_SLOTS) ) {
@@ -1844,4 +1928,375 @@ fieldIndexTableRemove(J9JavaVM* vm, J9Class *ramClass)
 
 
 #endif
+
+/* ============================================ Hot field layout methods ===================================*/
+
+/* Hot fields of a class as recorded in the shared classes cache, attached to the first ROM method of the class */
+typedef struct J9SharedHotFieldLayout {
+	U_32 instanceFieldCount; /* number of instance fields in the class, used to validate the record */
+	U_32 hotFieldCount;
+	U_16 hotFields[J9_HOT_FIELD_LAYOUT_MAX_FIELDS]; /* instance field ordinals, hottest first */
+} J9SharedHotFieldLayout;
+
+/**
+ * Count the instance fields declared by a ROM class.
+ * @param romClass the ROM class
+ * @return the number of instance fields
+ */
+static U_32
+countRomInstanceFields(J9ROMClass *romClass)
+{
+	J9ROMFieldWalkState fieldWalkState;
+	U_32 count = 0;
+
+	for (J9ROMFieldShape *field = romFieldsStartDo(romClass, &fieldWalkState); NULL != field; field = romFieldsNextDo(&fieldWalkState)) {
+		if (J9_ARE_NO_BITS_SET(field->modifiers, J9AccStatic)) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+/**
+ * Create a hash key based on the ROM class
+ * @param key J9HotFieldLayoutTableEntry
+ * @param userData not used
+ */
+static UDATA
+hotFieldLayoutHashFn(void *key, void *userData)
+{
+	return (UDATA)((J9HotFieldLayoutTableEntry *)key)->romClass;
+}
+
+/**
+ * Compare two ROM class pointers for equality
+ * @param leftKey J9HotFieldLayoutTableEntry
+ * @param rightKey J9HotFieldLayoutTableEntry
+ * @param userData not used
+ */
+static UDATA
+hotFieldLayoutHashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	return ((J9HotFieldLayoutTableEntry *)leftKey)->romClass == ((J9HotFieldLayoutTableEntry *)rightKey)->romClass;
+}
+
+/**
+ * Read the hot field record of a ROM class from the shared classes cache.
+ * @param vm the J9JavaVM
+ * @param romClass a ROM class in the shared classes cache
+ * @return bit mask of the hot instance fields, 0 if there is no valid record
+ */
+static U_64
+findSharedHotFieldLayout(J9JavaVM *vm, J9ROMClass *romClass)
+{
+	U_64 hotFields = 0;
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	J9VMThread *currentThread = currentVMThread(vm);
+
+	if ((NULL != currentThread) && (0 != romClass->romMethodCount)) {
+		J9SharedHotFieldLayout record;
+		J9SharedDataDescriptor descriptor;
+		IDATA dataIsCorrupt = 0;
+
+		descriptor.address = (U_8 *)&record;
+		descriptor.length = sizeof(record);
+		descriptor.type = J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT;
+		descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+		if ((NULL != vm->sharedClassConfig->findAttachedData(currentThread, J9ROMCLASS_ROMMETHODS(romClass), &descriptor, &dataIsCorrupt))
+			&& (-1 == dataIsCorrupt)
+			&& (sizeof(record) == descriptor.length)
+			&& (record.hotFieldCount <= J9_HOT_FIELD_LAYOUT_MAX_FIELDS)
+			&& (record.instanceFieldCount == countRomInstanceFields(romClass))
+		) {
+			for (U_32 i = 0; i < record.hotFieldCount; i++) {
+				if (record.hotFields[i] < J9_HOT_FIELD_LAYOUT_MAX_INDEX) {
+					hotFields |= ((U_64)1) << record.hotFields[i];
+				}
+			}
+		}
+	}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+	return hotFields;
+}
+
+/**
+ * Return the hot fields used to lay out instances of a ROM class.
+ * The answer for a ROM class never changes once given, as every field offset walk of the class must agree.
+ * Only ROM classes in the shared classes cache, or created by redefining a class with hot fields, have hot fields.
+ * @param vm the J9JavaVM
+ * @param romClass the ROM class
+ * @return bit mask of the hot instance fields, indexed by instance field ordinal
+ */
+static U_64
+getHotFieldLayout(J9JavaVM *vm, J9ROMClass *romClass)
+{
+	J9HotFieldLayoutTableEntry query;
+	J9HotFieldLayoutTableEntry *entry = NULL;
+	U_64 hotFields = 0;
+
+	if (NULL == vm->hotFieldLayoutTable) {
+		return 0;
+	}
+
+	query.romClass = romClass;
+	query.hotFields = 0;
+	omrthread_monitor_enter(vm->hotFieldLayoutMutex);
+	entry = (J9HotFieldLayoutTableEntry *)hashTableFind(vm->hotFieldLayoutTable, &query);
+	omrthread_monitor_exit(vm->hotFieldLayoutMutex);
+
+	if (NULL != entry) {
+		hotFields = entry->hotFields;
+	} else if (j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)) {
+		query.hotFields = findSharedHotFieldLayout(vm, romClass);
+		omrthread_monitor_enter(vm->hotFieldLayoutMutex);
+		if (!vm->hotFieldLayoutTableFull) {
+			/* If another thread added the class first, use its answer */
+			entry = (J9HotFieldLayoutTableEntry *)hashTableAdd(vm->hotFieldLayoutTable, &query);
+			if (NULL == entry) {
+				/* Without an entry the answer could change later, so stop giving out hot fields for new classes */
+				vm->hotFieldLayoutTableFull = TRUE;
+			} else {
+				hotFields = entry->hotFields;
+			}
+		}
+		omrthread_monitor_exit(vm->hotFieldLayoutMutex);
+	}
+	return hotFields;
+}
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/**
+ * Record the hot fields of a class in the shared classes cache, for the layout of the class in later JVMs.
+ * The hot fields are ranked by the hot field information the JIT reported for the class.
+ * @param currentThread the current J9VMThread, which has VM access
+ * @param clazz the class
+ */
+static void
+storeSharedHotFieldLayout(J9VMThread *currentThread, J9Class *clazz)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9ROMClass *romClass = clazz->romClass;
+	J9ClassHotFieldsInfo *hotFieldsInfo = clazz->hotFieldsInfo;
+	U_8 hotSlots[J9_HOT_FIELD_LAYOUT_MAX_FIELDS];
+	U_32 hotSlotCount = 0;
+	J9SharedHotFieldLayout record;
+	J9SharedDataDescriptor descriptor;
+	IDATA dataIsCorrupt = 0;
+
+	/* Records are written once: a class keeps the layout it was first given */
+	descriptor.address = (U_8 *)&record;
+	descriptor.length = sizeof(record);
+	descriptor.type = J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT;
+	descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+	if (NULL != vm->sharedClassConfig->findAttachedData(currentThread, J9ROMCLASS_ROMMETHODS(romClass), &descriptor, &dataIsCorrupt)) {
+		return;
+	}
+
+	/* The fields selected by the GC come first, then the rest of the reported fields from the hottest down */
+	U_8 selectedSlots[] = { hotFieldsInfo->hotFieldOffset1, hotFieldsInfo->hotFieldOffset2, hotFieldsInfo->hotFieldOffset3 };
+	for (UDATA i = 0; i < sizeof(selectedSlots) / sizeof(selectedSlots[0]); i++) {
+		if (U_8_MAX != selectedSlots[i]) {
+			hotSlots[hotSlotCount++] = selectedSlots[i];
+		}
+	}
+	omrthread_monitor_enter(clazz->classLoader->hotFieldPoolMutex);
+	while (hotSlotCount < J9_HOT_FIELD_LAYOUT_MAX_FIELDS) {
+		J9HotField *hottest = NULL;
+		for (J9HotField *hotField = hotFieldsInfo->hotFieldListHead; NULL != hotField; hotField = hotField->next) {
+			bool ranked = false;
+			for (U_32 i = 0; i < hotSlotCount; i++) {
+				if (hotSlots[i] == hotField->hotFieldOffset) {
+					ranked = true;
+					break;
+				}
+			}
+			if (!ranked && ((NULL == hottest) || (hotField->hotness > hottest->hotness))) {
+				hottest = hotField;
+			}
+		}
+		if (NULL == hottest) {
+			break;
+		}
+		hotSlots[hotSlotCount++] = hottest->hotFieldOffset;
+	}
+	omrthread_monitor_exit(clazz->classLoader->hotFieldPoolMutex);
+
+	/* Hot fields are reported as the slot index of the field in the object, including the header */
+	UDATA const referenceSize = J9JAVAVM_REFERENCE_SIZE(vm);
+	UDATA const objectHeaderSize = J9JAVAVM_OBJECT_HEADER_SIZE(vm);
+	J9ROMFieldOffsetWalkState state;
+	U_16 instanceIndex = 0;
+
+	memset(&record, 0, sizeof(record));
+#if defined(J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES)
+	J9ROMFieldOffsetWalkResult *result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(clazz), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE, clazz->flattenedClassCache);
+#else /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
+	J9ROMFieldOffsetWalkResult *result = fieldOffsetsStartDo(vm, romClass, SUPERCLASS(clazz), &state, J9VM_FIELD_OFFSET_WALK_INCLUDE_INSTANCE);
+#endif /* J9VM_OPT_VALHALLA_FLATTENABLE_VALUE_TYPES */
+	U_16 hotFields[J9_HOT_FIELD_LAYOUT_MAX_FIELDS];
+	bool found[J9_HOT_FIELD_LAYOUT_MAX_FIELDS] = { false };
+	while (NULL != result->field) {
+		if (J9_ARE_ALL_BITS_SET(result->field->modifiers, J9FieldFlagObject)) {
+			UDATA slot = (result->offset + objectHeaderSize) / referenceSize;
+			for (U_32 i = 0; i < hotSlotCount; i++) {
+				if (slot == hotSlots[i]) {
+					hotFields[i] = instanceIndex;
+					found[i] = true;
+				}
+			}
+		}
+		instanceIndex += 1;
+		result = fieldOffsetsNextDo(&state);
+	}
+	record.instanceFieldCount = instanceIndex;
+	for (U_32 i = 0; i < hotSlotCount; i++) {
+		/* Fields inherited from a superclass are recorded for the class that declares them */
+		if (found[i]) {
+			record.hotFields[record.hotFieldCount++] = hotFields[i];
+		}
+	}
+
+	if (0 != record.hotFieldCount) {
+		descriptor.address = (U_8 *)&record;
+		descriptor.length = sizeof(record);
+		descriptor.type = J9SHR_ATTACHED_DATA_TYPE_FIELDLAYOUT;
+		descriptor.flags = J9SHR_ATTACHED_DATA_NO_FLAGS;
+		vm->sharedClassConfig->storeAttachedData(currentThread, J9ROMCLASS_ROMMETHODS(romClass), &descriptor, FALSE);
+	}
+}
+
+/**
+ * Store the hot fields of the classes loaded by this JVM in the shared classes cache at shutdown.
+ * Classes of the bootstrap loader are excluded, as their layout is depended on by the VM and the JCL natives.
+ */
+static void
+hookStoreHotFieldLayouts(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9VMShutdownEvent *event = (J9VMShutdownEvent *)eventData;
+	J9VMThread *currentThread = event->vmThread;
+	J9JavaVM *vm = currentThread->javaVM;
+	J9ClassWalkState classWalkState;
+	bool hadVMAccess = J9_ARE_ANY_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS);
+
+	if ((NULL == vm->sharedClassConfig) || (NULL == vm->hotFieldClassInfoPool) || j9shr_Query_IsCacheFull(vm)) {
+		return;
+	}
+
+	if (!hadVMAccess) {
+		acquireVMAccess(currentThread);
+	}
+	J9Class *clazz = allClassesStartDo(&classWalkState, vm, NULL);
+	while (NULL != clazz) {
+		J9ROMClass *romClass = clazz->romClass;
+		if ((NULL != clazz->hotFieldsInfo)
+			&& (NULL != clazz->classLoader->hotFieldPoolMutex)
+			&& (vm->systemClassLoader != clazz->classLoader)
+			&& !J9_IS_CLASS_OBSOLETE(clazz)
+			&& (0 != J9CLASS_DEPTH(clazz))
+			&& (0 != romClass->romMethodCount)
+			&& j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)
+		) {
+			storeSharedHotFieldLayout(currentThread, clazz);
+		}
+		clazz = allClassesNextDo(&classWalkState);
+	}
+	allClassesEndDo(&classWalkState);
+	if (!hadVMAccess) {
+		releaseVMAccess(currentThread);
+	}
+}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+/**
+ * Remove the hot fields of unloaded ROM classes which are not in the shared classes cache,
+ * as their memory may be reused for other ROM classes.
+ */
+static void
+hookHotFieldLayoutTablePurge(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	J9VMClassesUnloadEvent *event = (J9VMClassesUnloadEvent *)eventData;
+	J9JavaVM *vm = (J9JavaVM *)userData;
+
+	omrthread_monitor_enter(vm->hotFieldLayoutMutex);
+	for (J9Class *clazz = event->classesToUnload; NULL != clazz; clazz = clazz->gcLink) {
+		J9ROMClass *romClass = clazz->romClass;
+		if (!j9shr_Query_IsAddressInCache(vm, romClass, romClass->romSize)) {
+			J9HotFieldLayoutTableEntry query;
+			query.romClass = romClass;
+			hashTableRemove(vm->hotFieldLayoutTable, &query);
+		}
+	}
+	omrthread_monitor_exit(vm->hotFieldLayoutMutex);
+}
+#endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+
+IDATA
+hotFieldLayoutTableNew(J9JavaVM *vm)
+{
+	J9HookInterface **vmHooks = getVMHookInterface(vm);
+
+	if (0 != omrthread_monitor_init_with_name(&vm->hotFieldLayoutMutex, 0, "Hot Field Layout Mutex")) {
+		return -1;
+	}
+	vm->hotFieldLayoutTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), 64,
+		sizeof(J9HotFieldLayoutTableEntry), sizeof(J9ROMClass *), 0, OMRMEM_CATEGORY_VM, hotFieldLayoutHashFn, hotFieldLayoutHashEqualFn, NULL, vm);
+	if (NULL == vm->hotFieldLayoutTable) {
+		return -1;
+	}
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_CLASSES_UNLOAD, hookHotFieldLayoutTablePurge, OMR_GET_CALLSITE(), vm)) {
+		return -1;
+	}
+#endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, hookStoreHotFieldLayouts, OMR_GET_CALLSITE(), vm)) {
+		return -1;
+	}
+#endif /* defined(J9VM_OPT_SHARED_CLASSES) */
+	return 0;
+}
+
+void
+hotFieldLayoutTableFree(J9JavaVM *vm)
+{
+	if (NULL != vm->hotFieldLayoutTable) {
+		hashTableFree(vm->hotFieldLayoutTable);
+		vm->hotFieldLayoutTable = NULL;
+	}
+	if (NULL != vm->hotFieldLayoutMutex) {
+		omrthread_monitor_destroy(vm->hotFieldLayoutMutex);
+		vm->hotFieldLayoutMutex = NULL;
+	}
+}
+
+BOOLEAN
+inheritHotFieldLayout(J9JavaVM *javaVM, J9ROMClass *originalROMClass, J9ROMClass *replacementROMClass)
+{
+	BOOLEAN result = TRUE;
+
+	if ((NULL != javaVM->hotFieldLayoutTable) && (originalROMClass != replacementROMClass)) {
+		J9HotFieldLayoutTableEntry query;
+		J9HotFieldLayoutTableEntry *entry = NULL;
+
+		query.romClass = replacementROMClass;
+		query.hotFields = getHotFieldLayout(javaVM, originalROMClass);
+		if ((0 != query.hotFields) && (countRomInstanceFields(originalROMClass) != countRomInstanceFields(replacementROMClass))) {
+			return FALSE;
+		}
+		/*
+		 * Pin the replacement to the layout of the original class before it is walked for the first time,
+		 * overriding any record the replacement has in the shared classes cache.
+		 */
+		omrthread_monitor_enter(javaVM->hotFieldLayoutMutex);
+		entry = (J9HotFieldLayoutTableEntry *)hashTableFind(javaVM->hotFieldLayoutTable, &query);
+		if (NULL == entry) {
+			entry = (J9HotFieldLayoutTableEntry *)hashTableAdd(javaVM->hotFieldLayoutTable, &query);
+		}
+		result = (NULL != entry) && (query.hotFields == entry->hotFields);
+		omrthread_monitor_exit(javaVM->hotFieldLayoutMutex);
+	}
+	return result;
+}
+
 } /* extern "C" */
@@ -27,9 +27,45 @@
 #include "j9cp.h"
 #include "vm_internal.h"
 #include "ut_j9vm.h"
+#include "util_api.h"
 
 #include "VMHelpers.hpp"
 
+/**
+ * Get the address of the elements of a primitive array which can be read directly,
+ * for use by the string kernels.
+ * @param *vmThread
+ * @param array the primitive array
+ * @returns the address of element 0, or NULL if the array must be read element by element
+ * because it is a discontiguous arraylet (or empty) or because all reads go through the access barrier
+ */
+static VMINLINE void *
+contiguousArrayData(J9VMThread *vmThread, j9object_t array)
+{
+	void *data = NULL;
+#if !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER)
+	if (J9ISCONTIGUOUSARRAY(vmThread, array)) {
+		data = J9JAVAARRAY_EA(vmThread, array, 0, U_8);
+	}
+#endif /* !defined(J9VM_GC_ALWAYS_CALL_OBJECT_ACCESS_BARRIER) */
+	return data;
+}
+
+/**
+ * Replace '.' with '/' in UTF8 data.
+ * @param *data
+ * @param length
+ */
+static VMINLINE void
+translateDotsToSlashes(U_8 *data, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		if ('.' == data[i]) {
+			data[i] = '/';
+		}
+	}
+}
+
 extern "C" {
 
 /**
@@ -45,16 +81,22 @@ compareUncompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9obj
 {
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
-		UDATA i = 0;
-		while (0 != length) {
-			U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
-			U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
-			if (unicodeChar1 != unicodeChar2) {
-				result = 0;
-				break;
+		void *data1 = contiguousArrayData(vmThread, unicodeBytes1);
+		void *data2 = contiguousArrayData(vmThread, unicodeBytes2);
+		if ((NULL != data1) && (NULL != data2)) {
+			result = (0 == memcmp(data1, data2, length * sizeof(U_16))) ? 1 : 0;
+		} else {
+			UDATA i = 0;
+			while (0 != length) {
+				U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
+				U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
+				if (unicodeChar1 != unicodeChar2) {
+					result = 0;
+					break;
+				}
+				length -= 1;
+				i += 1;
 			}
-			length -= 1;
-			i += 1;
 		}
 	}
 	return result;
@@ -73,16 +115,22 @@ compareCompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9objec
 {
 	UDATA result = 1;
 	if (unicodeBytes1 != unicodeBytes2) {
-		UDATA i = 0;
-		while (0 != length) {
-			U_16 unicodeChar1 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
-			U_16 unicodeChar2 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
-			if (unicodeChar1 != unicodeChar2) {
-				result = 0;
-				break;
+		void *data1 = contiguousArrayData(vmThread, unicodeBytes1);
+		void *data2 = contiguousArrayData(vmThread, unicodeBytes2);
+		if ((NULL != data1) && (NULL != data2)) {
+			result = (0 == memcmp(data1, data2, length)) ? 1 : 0;
+		} else {
+			UDATA i = 0;
+			while (0 != length) {
+				U_16 unicodeChar1 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
+				U_16 unicodeChar2 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
+				if (unicodeChar1 != unicodeChar2) {
+					result = 0;
+					break;
+				}
+				length -= 1;
+				i += 1;
 			}
-			length -= 1;
-			i += 1;
 		}
 	}
 	return result;
@@ -100,16 +148,22 @@ UDATA
 compareCompressedUnicodeToUncompressedUnicode(J9VMThread *vmThread, j9object_t unicodeBytes1, j9object_t unicodeBytes2, UDATA length)
 {
 	UDATA result = 1;
-	UDATA i = 0;
-	while (0 != length) {
-		U_16 unicodeChar1 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes1, i);
-		U_16 unicodeChar2 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes2, i);
-		if (unicodeChar1 != unicodeChar2) {
-			result = 0;
-			break;
+	const U_8 *latin1 = (const U_8 *)contiguousArrayData(vmThread, unicodeBytes1);
+	const U_16 *utf16 = (const U_16 *)contiguousArrayData(vmThread, unicodeBytes2);
+	if ((NULL != latin1) && (NULL != utf16)) {
+		result = compareLatin1ToUTF16(latin1, utf16, length);
+	} else {
+		UDATA i = 0;
+		while (0 != length) {
+			U_16 unicodeChar1 = (U_8)J9JAVAARRAYOFBYTE_LOAD(vmThread, unicodeBytes1, i);
+			U_16 unicodeChar2 = J9JAVAARRAYOFCHAR_LOAD(vmThread, unicodeBytes2, i);
+			if (unicodeChar1 != unicodeChar2) {
+				result = 0;
+				break;
+			}
+			length -=  1;
+			i += 1;
 		}
-		length -=  1;
-		i += 1;
 	}
 	return result;
 }
@@ -223,70 +277,73 @@ copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlag
 
 	j9object_t stringValue = J9VMJAVALANGSTRING_VALUE(vmThread, string);
 	U_8 *data = utf8Data;
+	UDATA i = stringOffset;
+	UDATA end = stringOffset + stringLength;
+	bool translateDots = J9_ARE_ANY_BITS_SET(stringFlags, J9_STR_XLAT);
 
+	/* Runs of characters in the range 0x01 - 0x7F encode as themselves, so for contiguous values they are
+	 * copied in bulk by the string kernels. The remaining characters are encoded one at a time.
+	 */
 	if (IS_STRING_COMPRESSED(vmThread, string)) {
-		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
-		if ((stringFlags & J9_STR_XLAT) == 0) {
-			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
-				I_8 unicode = J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i);
-				UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
-
-				/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
-				if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
+		const U_8 *latin1 = (const U_8 *)contiguousArrayData(vmThread, stringValue);
+		while (i < end) {
+			if (NULL != latin1) {
+				UDATA run = countLeadingASCIIBytes(latin1 + i, OMR_MIN(end - i, utf8DataLength - (UDATA)(data - utf8Data)));
+				memcpy(data, latin1 + i, run);
+				if (translateDots) {
+					translateDotsToSlashes(data, run);
+				}
+				data += run;
+				i += run;
+				if (i == end) {
 					break;
 				}
-
-				VM_VMHelpers::encodeUTF8CharI8(unicode, data);
-				data += encodedLength;
 			}
-		} else {
-			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
-				I_8 unicode = J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i);
-				UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
 
-				/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
-				if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
-					break;
-				}
+			I_8 unicode = J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i);
+			UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
 
-				VM_VMHelpers::encodeUTF8CharI8(unicode, data);
-				if ('.' == *data) {
-					*data = '/';
-				}
-				data += encodedLength;
+			/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
+			if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
+				break;
 			}
+
+			VM_VMHelpers::encodeUTF8CharI8(unicode, data);
+			if (translateDots && ('.' == *data)) {
+				*data = '/';
+			}
+			data += encodedLength;
+			i += 1;
 		}
 	} else {
-		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
-		if ((stringFlags & J9_STR_XLAT) == 0) {
-			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
-				U_16 unicode = J9JAVAARRAYOFCHAR_LOAD(vmThread, stringValue, i);
-				UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
-
-				/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
-				if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
+		const U_16 *utf16 = (const U_16 *)contiguousArrayData(vmThread, stringValue);
+		while (i < end) {
+			if (NULL != utf16) {
+				UDATA run = copyASCIIFromUTF16(data, utf16 + i, OMR_MIN(end - i, utf8DataLength - (UDATA)(data - utf8Data)));
+				if (translateDots) {
+					translateDotsToSlashes(data, run);
+				}
+				data += run;
+				i += run;
+				if (i == end) {
 					break;
 				}
-
-				VM_VMHelpers::encodeUTF8Char(unicode, data);
-				data += encodedLength;
 			}
-		} else {
-			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
-				U_16 unicode = J9JAVAARRAYOFCHAR_LOAD(vmThread, stringValue, i);
-				UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
 
-				/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
-				if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
-					break;
-				}
+			U_16 unicode = J9JAVAARRAYOFCHAR_LOAD(vmThread, stringValue, i);
+			UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
 
-				VM_VMHelpers::encodeUTF8Char(unicode, data);
-				if ('.' == *data) {
-					*data = '/';
-				}
-				data += encodedLength;
+			/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
+			if (encodedLength > (utf8DataLength - (UDATA)(data - utf8Data))) {
+				break;
+			}
+
+			VM_VMHelpers::encodeUTF8Char(unicode, data);
+			if (translateDots && ('.' == *data)) {
+				*data = '/';
 			}
+			data += encodedLength;
+			i += 1;
 		}
 	}
 
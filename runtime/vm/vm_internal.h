@@ -97,6 +97,23 @@ fieldIndexTableNew(J9JavaVM* vm, J9PortLibrary *portLib);
 void
 fieldIndexTableFree(J9JavaVM* vm);
 
+/**
+* @brief Create the table of hot field layouts used by -XX:+HotFieldLayout, and arrange
+* for the hot fields observed by this JVM to be persisted in the shared classes cache at shutdown.
+* @param *vm
+* @return 0 on success, -1 on failure
+*/
+IDATA
+hotFieldLayoutTableNew(J9JavaVM *vm);
+
+/**
+* @brief
+* @param *vm
+* @return void
+*/
+void
+hotFieldLayoutTableFree(J9JavaVM *vm);
+
 /* ---------------- jniinv.c ---------------- */
 
 /**
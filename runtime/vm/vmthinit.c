@@ -37,6 +37,24 @@
 /* processReferenceMonitor is only used for Java 9 and later */
 #define J9_IS_PROCESS_REFERENCE_MONITOR_ENABLED(vm) (J2SE_VERSION(vm) >= J2SE_V11)
 
+/**
+ * Initialize the lock stripes which guard the per class loader map caches.
+ *
+ * @param vm[in] the J9JavaVM
+ * @returns 0 on success, non-zero on failure
+ */
+static UDATA
+initializeMapCacheMutexes(J9JavaVM *vm)
+{
+	UDATA i = 0;
+	for (i = 0; i < J9_MAP_CACHE_SHARD_COUNT; ++i) {
+		if (0 != omrthread_monitor_init_with_name(&vm->mapCacheMutexes[i], 0, "map cache mutex")) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
 UDATA initializeVMThreading(J9JavaVM *vm)
 {
 	if (
@@ -109,6 +127,7 @@ UDATA initializeVMThreading(J9JavaVM *vm)
 #if defined(OMR_THR_YIELD_ALG)
 		omrthread_monitor_init_with_name(&vm->cpuUtilCacheMutex, 0, "CPU Utilization Cache Mutex") ||
 #endif /* defined(OMR_THR_YIELD_ALG) */
+		initializeMapCacheMutexes(vm) ||
 
 		initializeMonitorTable(vm)
 	)
@@ -226,5 +245,16 @@ void terminateVMThreading(J9JavaVM *vm)
 	}
 #endif /* defined(OMR_THR_YIELD_ALG) */
 
+	{
+		UDATA i = 0;
+		for (i = 0; i < J9_MAP_CACHE_SHARD_COUNT; ++i) {
+			if (NULL != vm->mapCacheMutexes[i]) {
+				omrthread_monitor_destroy(vm->mapCacheMutexes[i]);
+				vm->mapCacheMutexes[i] = NULL;
+			}
+		}
+	}
+
+	reportExclusiveAccessSyncHistograms(vm);
 	destroyMonitorTable(vm);
 }
@@ -21,7 +21,14 @@
  */
 package org.openj9.test.java.lang;
 
+import java.io.File;
+import java.io.IOException;
 import java.lang.ref.WeakReference;
+import java.nio.ByteBuffer;
+import java.nio.channels.Pipe;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicLong;
 import org.openj9.test.util.VersionCheck;
 import org.testng.annotations.AfterMethod;
 import org.testng.annotations.Test;
@@ -377,6 +384,65 @@ public class Test_Thread {
 		st.start();
 	}
 
+	/**
+	 * @tests java.lang.Thread#getStackTrace()
+	 */
+	@Test
+	public void test_getStackTrace_blockingNative() throws Exception {
+		final Pipe pipe = Pipe.open();
+		final CountDownLatch blocking = new CountDownLatch(1);
+		final AtomicLong traces = new AtomicLong();
+		final Thread target = new Thread("getStackTrace target") {
+			@Override
+			public void run() {
+				try {
+					/* Repeated JNI calls release and reacquire VM access many times while stack traces are requested */
+					File file = new File(".");
+					for (int i = 0; i < 200000; i++) {
+						file.exists();
+					}
+					blocking.countDown();
+					pipe.source().read(ByteBuffer.allocate(1));
+				} catch (IOException e) {
+					// ignore, the pipe is closed by the test
+				}
+			}
+		};
+		Thread requester = new Thread("getStackTrace requester") {
+			@Override
+			public void run() {
+				while (!isInterrupted()) {
+					target.getStackTrace();
+					traces.incrementAndGet();
+				}
+			}
+		};
+		requester.setDaemon(true);
+		target.setDaemon(true);
+		target.start();
+		requester.start();
+		try {
+			AssertJUnit.assertTrue("target did not finish its JNI calls", blocking.await(60, TimeUnit.SECONDS));
+			/* give the target time to block in the native read */
+			Thread.sleep(500);
+			long count = traces.get();
+			long deadline = System.nanoTime() + TimeUnit.SECONDS.toNanos(30);
+			while ((traces.get() <= (count + 10)) && (System.nanoTime() < deadline)) {
+				Thread.sleep(10);
+			}
+			AssertJUnit.assertTrue("getStackTrace() hung on a thread blocked in a native", traces.get() > (count + 10));
+		} finally {
+			requester.interrupt();
+			requester.join(30000);
+			pipe.sink().write(ByteBuffer.wrap(new byte[] { 1 }));
+			target.join(30000);
+			pipe.sink().close();
+			pipe.source().close();
+		}
+		AssertJUnit.assertFalse("requester did not stop", requester.isAlive());
+		AssertJUnit.assertFalse("target did not stop", target.isAlive());
+	}
+
 	/**
 	 * @tests java.lang.Thread#getThreadGroup()
 	 */
@@ -0,0 +1,334 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.jvm.ras.tests;
+
+import static com.ibm.jvm.ras.tests.DumpAPISuite.deleteFile;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataInputStream;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.zip.CRC32;
+import java.util.zip.DataFormatException;
+import java.util.zip.Inflater;
+
+import junit.framework.TestCase;
+
+/**
+ * Checks the content of heap dumps written with opts=PHD+PARALLEL: the file must be a single
+ * gzip member, and the records written by the worker threads, including the short records
+ * naming a class cache slot, must describe every object of a heap spanning many work units.
+ */
+public class DumpAPIParallelHeapTests extends TestCase {
+
+	private static final int NODE_COUNT = 400000;
+
+	static final class Node {
+		Node left;
+		Node right;
+		Node next;
+		int value;
+	}
+
+	private long uid = System.currentTimeMillis();
+	private Node[] nodes;
+
+	@Override
+	protected void setUp() throws Exception {
+		super.setUp();
+		nodes = new Node[NODE_COUNT];
+		for (int i = 0; i < NODE_COUNT; i++) {
+			Node node = new Node();
+			node.value = i;
+			if (i > 0) {
+				node.left = nodes[i - 1];
+				nodes[i - 1].next = node;
+			}
+			if (i > 1) {
+				node.right = nodes[i - 2];
+			}
+			nodes[i] = node;
+		}
+	}
+
+	@Override
+	protected void tearDown() throws Exception {
+		nodes = null;
+		super.tearDown();
+	}
+
+	public void testParallelHeapDumpContent() throws Exception {
+		String fileName = "heap." + getName() + "." + uid + ".phd";
+		String dumpName = com.ibm.jvm.Dump.triggerDump("heap:file=" + fileName + ",opts=PHD+PARALLEL");
+		assertNotNull("Expected triggerDump to return file name, not null", dumpName);
+
+		File dumpFile = new File(dumpName);
+		if (!dumpFile.exists()) {
+			dumpFile = new File(dumpName + ".gz");
+		}
+		assertTrue("Failed to find file " + dumpFile + " after requesting " + fileName, dumpFile.exists());
+		assertTrue("Expected a .gz suffix on " + dumpFile, dumpFile.getName().endsWith(".gz"));
+
+		try {
+			byte[] phd = inflateSingleMember(Files.readAllBytes(dumpFile.toPath()));
+			PHDContent content = new PHDContent();
+			content.parse(phd);
+
+			String nodeClassName = Node.class.getName().replace('.', '/');
+			Long nodeClass = content.classes.get(nodeClassName);
+			assertNotNull("No class record for " + nodeClassName, nodeClass);
+			Integer nodeCount = content.instances.get(nodeClass);
+			assertEquals("Objects of " + nodeClassName + " in the dump", NODE_COUNT, (nodeCount == null) ? 0 : nodeCount.intValue());
+			assertTrue("Expected short object records in the dump", content.shortRecords > 0);
+		} finally {
+			deleteFile(dumpFile.getPath(), getName());
+		}
+		/* keep the nodes alive until the dump has been written */
+		assertEquals(NODE_COUNT - 1, nodes[NODE_COUNT - 1].value);
+	}
+
+	/**
+	 * Inflate the deflate data of a gzip file, which must consist of a single member whose trailer
+	 * matches the data.
+	 */
+	private static byte[] inflateSingleMember(byte[] file) throws DataFormatException {
+		assertTrue("File too short for gzip", file.length >= 18);
+		assertEquals("gzip magic number", 0x1f, file[0] & 0xff);
+		assertEquals("gzip magic number", 0x8b, file[1] & 0xff);
+		assertEquals("gzip compression method", 8, file[2] & 0xff);
+		assertEquals("gzip flags", 0, file[3] & 0xff);
+
+		Inflater inflater = new Inflater(true);
+		inflater.setInput(file, 10, file.length - 10);
+		ByteArrayOutputStream data = new ByteArrayOutputStream();
+		byte[] buffer = new byte[64 * 1024];
+		while (!inflater.finished()) {
+			int length = inflater.inflate(buffer);
+			if ((0 == length) && (inflater.needsInput() || inflater.needsDictionary())) {
+				fail("Truncated deflate data");
+			}
+			data.write(buffer, 0, length);
+		}
+		assertEquals("Bytes after the first gzip member", 8, inflater.getRemaining());
+		inflater.end();
+
+		byte[] phd = data.toByteArray();
+		int trailer = file.length - 8;
+		CRC32 crc = new CRC32();
+		crc.update(phd, 0, phd.length);
+		assertEquals("gzip CRC-32", crc.getValue(), readLittleEndian(file, trailer));
+		assertEquals("gzip length", phd.length & 0xffffffffL, readLittleEndian(file, trailer + 4));
+		return phd;
+	}
+
+	private static long readLittleEndian(byte[] data, int offset) {
+		long value = 0;
+		for (int i = 3; i >= 0; i--) {
+			value = (value << 8) | (data[offset + i] & 0xff);
+		}
+		return value;
+	}
+
+	/**
+	 * The classes and the object counts of a PHD file, read the way the DTFJ HeapdumpReader reads them.
+	 */
+	private static final class PHDContent {
+		final Map<String, Long> classes = new HashMap<String, Long>();
+		final Map<Long, Integer> instances = new HashMap<Long, Integer>();
+		int shortRecords;
+
+		private DataInputStream in;
+		private boolean is64;
+		private boolean allHashed;
+		private int gapShift;
+		private int version;
+		private long address;
+
+		void parse(byte[] phd) throws IOException {
+			in = new DataInputStream(new ByteArrayInputStream(phd));
+			assertEquals("portable heap dump", readUTF());
+			version = in.readInt();
+			int flags = in.readInt();
+			is64 = (flags & 1) != 0;
+			allHashed = (flags & 2) != 0;
+			gapShift = ((flags & 4) != 0) ? 2 : 3;
+
+			assertEquals("start of header tag", 1, in.readUnsignedByte());
+			for (int tag = in.readUnsignedByte(); tag != 2; tag = in.readUnsignedByte()) {
+				if (4 == tag) {
+					readUTF();
+				} else if ((1 == tag) || (3 == tag)) {
+					in.readInt();
+					in.readInt();
+				} else {
+					fail("Unexpected header tag " + tag);
+				}
+			}
+			assertEquals("start of dump tag", 2, in.readUnsignedByte());
+
+			long[] classCache = new long[4];
+			int classCacheIndex = 0;
+			for (;;) {
+				int tag = in.readUnsignedByte();
+				if (0 != (tag & 0x80)) {
+					/* short object record, its class is in the cache */
+					readAddress((tag >> 2) & 1);
+					skipHashCode(false);
+					skipReferences((tag >> 3) & 3, tag & 3);
+					addInstance(classCache[(tag >> 5) & 3]);
+					shortRecords += 1;
+				} else if (0 != (tag & 0x40)) {
+					/* medium object record */
+					readAddress((tag >> 2) & 1);
+					long clazz = readWord();
+					classCache[classCacheIndex] = clazz;
+					classCacheIndex = (classCacheIndex + 1) % 4;
+					skipHashCode(false);
+					skipReferences((tag >> 3) & 7, tag & 3);
+					addInstance(clazz);
+				} else if (0 != (tag & 0x20)) {
+					/* primitive array record */
+					readAddress(tag & 3);
+					readNumber(tag & 3);
+					skipHashCode(false);
+					skipInstanceSize();
+				} else {
+					switch (tag) {
+					case 3:
+						return;
+					case 4: {
+						/* long object record */
+						int flags = in.readUnsignedByte();
+						readAddress((flags >> 6) & 3);
+						long clazz = readWord();
+						classCache[classCacheIndex] = clazz;
+						classCacheIndex = (classCacheIndex + 1) % 4;
+						skipHashCode(0 != (flags & 2));
+						skipReferences(in.readInt(), (flags >> 4) & 3);
+						addInstance(clazz);
+						break;
+					}
+					case 8: {
+						/* object array record */
+						int flags = in.readUnsignedByte();
+						readAddress((flags >> 6) & 3);
+						readWord();
+						skipHashCode(0 != (flags & 2));
+						skipReferences(in.readInt(), (flags >> 4) & 3);
+						in.readInt();
+						skipInstanceSize();
+						break;
+					}
+					case 6: {
+						/* class record */
+						int flags = in.readUnsignedByte();
+						long classAddress = readAddress((flags >> 6) & 3);
+						in.readInt();
+						skipHashCode(0 != (flags & 8));
+						readWord();
+						classes.put(readUTF(), Long.valueOf(classAddress));
+						skipReferences(in.readInt(), (flags >> 4) & 3);
+						break;
+					}
+					case 7: {
+						/* long primitive array record */
+						int flags = in.readUnsignedByte();
+						if (0 == (flags & 0x10)) {
+							address += (long)in.readByte() << gapShift;
+							in.readUnsignedByte();
+						} else {
+							address += readWord() << gapShift;
+							readWord();
+						}
+						skipHashCode(0 != (flags & 2));
+						skipInstanceSize();
+						break;
+					}
+					default:
+						fail("Unexpected record tag " + tag);
+					}
+				}
+			}
+		}
+
+		private void addInstance(long clazz) {
+			Long key = Long.valueOf(clazz);
+			Integer count = instances.get(key);
+			instances.put(key, Integer.valueOf((count == null) ? 1 : (count.intValue() + 1)));
+		}
+
+		private long readAddress(int encoding) throws IOException {
+			address += readNumber(encoding) << gapShift;
+			if (!is64) {
+				address &= 0xffffffffL;
+			}
+			return address;
+		}
+
+		private long readNumber(int encoding) throws IOException {
+			switch (encoding) {
+			case 0:
+				return in.readByte();
+			case 1:
+				return in.readShort();
+			case 2:
+				return in.readInt();
+			default:
+				return in.readLong();
+			}
+		}
+
+		private long readWord() throws IOException {
+			return is64 ? in.readLong() : (in.readInt() & 0xffffffffL);
+		}
+
+		private void skipHashCode(boolean present) throws IOException {
+			if (allHashed) {
+				in.readShort();
+			} else if (present) {
+				in.readInt();
+			}
+		}
+
+		private void skipReferences(int count, int encoding) throws IOException {
+			for (int i = 0; i < count; i++) {
+				readNumber(encoding);
+			}
+		}
+
+		private void skipInstanceSize() throws IOException {
+			if (version >= 6) {
+				in.readInt();
+			}
+		}
+
+		private String readUTF() throws IOException {
+			byte[] bytes = new byte[in.readUnsignedShort()];
+			in.readFully(bytes);
+			return new String(bytes, "UTF-8");
+		}
+	}
+}
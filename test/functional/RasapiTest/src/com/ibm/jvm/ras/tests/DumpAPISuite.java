@@ -75,6 +75,7 @@ public class DumpAPISuite {
 		suite.addTestSuite(DumpAPIQuerySetReset.class);
 		suite.addTestSuite(DumpAPITokensTests.class);
 		suite.addTestSuite(DumpAPISetTestXdumpdynamic.class);
+		suite.addTestSuite(DumpAPIParallelHeapTests.class);
 		//$JUnit-END$
 		return suite;
 	}
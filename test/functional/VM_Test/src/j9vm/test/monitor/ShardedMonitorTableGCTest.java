@@ -0,0 +1,140 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package j9vm.test.monitor;
+
+/**
+ * Inflates the monitors of many short-lived objects from several threads while the GC keeps collecting them, so that
+ * monitors are created, found again, moved and destroyed while lookups race with them. Run with -XX:+ShardedMonitorTable
+ * by its runner, it exercises the lookup caches of the monitor table shards, read without locking, and their clearing
+ * by the GC.
+ *
+ * Every lock object counts the increments made while holding its monitor. An increment lost because two threads held
+ * the same monitor at once, or because a thread was given the monitor of another object, makes the total wrong.
+ */
+public class ShardedMonitorTableGCTest {
+
+	private static final int THREADS = 8;
+	private static final int LOCKS = 512;
+	private static final int INCREMENTS_PER_THREAD = 200000;
+
+	static final class Lock {
+		int count;
+		boolean retired;
+	}
+
+	private static final Lock[] locks = new Lock[LOCKS];
+	private static long retiredCount;
+	private static volatile boolean done;
+
+	public static void main(String[] args) throws InterruptedException {
+		for (int i = 0; i < LOCKS; i++) {
+			locks[i] = new Lock();
+		}
+
+		Thread[] workers = new Thread[THREADS];
+		for (int t = 0; t < THREADS; t++) {
+			final int seed = t * 7919;
+			workers[t] = new Thread() {
+				public void run() {
+					int index = seed;
+					for (int i = 0; i < INCREMENTS_PER_THREAD; i++) {
+						index = (index * 1103515245 + 12345) & Integer.MAX_VALUE;
+						increment(index % LOCKS, (0 == (i % 1024)));
+						/* garbage, so that the nursery fills up and the lock objects move */
+						Object[] garbage = new Object[8];
+						garbage[0] = garbage;
+					}
+				}
+			};
+			workers[t].start();
+		}
+
+		/* replace the lock objects, so that their monitors die and are destroyed by the GC */
+		Thread replacer = new Thread() {
+			public void run() {
+				int index = 0;
+				while (!done) {
+					index = (index + 1) % LOCKS;
+					Lock old;
+					synchronized (locks) {
+						old = locks[index];
+						locks[index] = new Lock();
+					}
+					synchronized (old) {
+						old.retired = true;
+						synchronized (ShardedMonitorTableGCTest.class) {
+							retiredCount += old.count;
+						}
+					}
+					if (0 == (index % 64)) {
+						System.gc();
+					}
+				}
+			}
+		};
+		replacer.start();
+
+		for (Thread worker : workers) {
+			worker.join();
+		}
+		done = true;
+		replacer.join();
+
+		long total = retiredCount;
+		for (Lock lock : locks) {
+			synchronized (lock) {
+				total += lock.count;
+			}
+		}
+		long expected = (long)THREADS * INCREMENTS_PER_THREAD;
+		if (total != expected) {
+			throw new Error("Expected " + expected + " increments under the lock objects' monitors, counted " + total);
+		}
+		System.out.println("Counted " + total + " increments");
+	}
+
+	private static void increment(int index, boolean wait) {
+		while (true) {
+			Lock lock;
+			synchronized (locks) {
+				lock = locks[index];
+			}
+			synchronized (lock) {
+				if (!lock.retired) {
+					if (wait) {
+						/* waiting inflates the monitor, so that it is looked up in the monitor table */
+						try {
+							lock.wait(1);
+						} catch (InterruptedException e) {
+							throw new Error(e);
+						}
+						if (lock.retired) {
+							continue;
+						}
+					}
+					lock.count += 1;
+					return;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,286 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.InputStreamReader;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Microbenchmark for the copy-forward scanning of the balanced collector.  It keeps a rolling window of young linked lists or
+ * trees of nodes with several reference fields alive while allocating, so that every partial GC has to copy many objects whose headers are not in the cache.
+ * Run without arguments, it checks in a child VM with prefetching enabled that every structure in the window is intact after
+ * being copied.  Run with "benchmark", it runs each heap shape in a child VM with -Xgc:tarokCopyForwardPrefetchDistance=0 and
+ * with the given prefetch distance, and reports the partial GC time of both runs and their difference.
+ */
+public class CopyForwardPrefetchBenchmark
+{
+	private static final int WINDOW = 16;
+	private static final int NODES_PER_STRUCTURE = 64 * 1024;
+	private static final int TREE_DEPTH = 8;
+	private static final int VERIFY_PREFETCH_DISTANCE = 4;
+	private static final int VERIFY_ITERATIONS = 200;
+
+	static final class ListNode
+	{
+		ListNode next;
+		long payload;
+	}
+
+	static final class TreeNode
+	{
+		TreeNode first;
+		TreeNode second;
+		TreeNode third;
+		TreeNode fourth;
+		long payload;
+	}
+
+	/**
+	 * @param args Either no arguments to check the copied structures in child VMs, "benchmark [prefetchDistance] [iterations]"
+	 * to compare both settings in child VMs, or "run|verify &lt;list|tree&gt; &lt;iterations&gt;" to measure or check one heap
+	 * shape in this VM.
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		if ((args.length > 0) && args[0].equals("run"))
+		{
+			boolean tree = args[1].equals("tree");
+			int iterations = Integer.parseInt(args[2]);
+			long pgcMillis = run(tree, iterations);
+			System.out.println("pgcTimeMillis=" + pgcMillis);
+			return;
+		}
+		if ((args.length > 0) && args[0].equals("verify"))
+		{
+			boolean tree = args[1].equals("tree");
+			int iterations = Integer.parseInt(args[2]);
+			if (!verify(tree, iterations))
+			{
+				System.out.println("Structure corrupted");
+				System.exit(1);
+			}
+			return;
+		}
+
+		String[] shapes = { "list", "tree" };
+		if ((args.length == 0) || !args[0].equals("benchmark"))
+		{
+			/* the timings are noisy and slow to gather, so the default run only checks that prefetching copies correctly */
+			for (String shape : shapes)
+			{
+				if (runChild("verify", shape, VERIFY_ITERATIONS, VERIFY_PREFETCH_DISTANCE) < 0)
+				{
+					System.out.println("Test failed: the " + shape + " heap was not copied correctly");
+					return;
+				}
+			}
+			System.out.println("Test ran to completion");
+			return;
+		}
+
+		int prefetchDistance = (args.length > 1) ? Integer.parseInt(args[1]) : 4;
+		int iterations = (args.length > 2) ? Integer.parseInt(args[2]) : 2000;
+		for (String shape : shapes)
+		{
+			long baseline = runChild("run", shape, iterations, 0);
+			long prefetched = runChild("run", shape, iterations, prefetchDistance);
+			if ((baseline < 0) || (prefetched < 0))
+			{
+				System.err.println("Child VM failed for the " + shape + " heap");
+				System.exit(1);
+			}
+			System.out.println(shape + ": pgc time distance=0 " + baseline + "ms, distance=" + prefetchDistance + " " + prefetched
+				+ "ms, difference " + (prefetched - baseline) + "ms");
+		}
+		System.out.println("Test ran to completion");
+	}
+
+	private static long runChild(String mode, String shape, int iterations, int prefetchDistance) throws Exception
+	{
+		String java = System.getProperty("java.home") + File.separator + "bin" + File.separator + "java";
+		List<String> command = new ArrayList<String>();
+		command.add(java);
+		command.add("-Xgcpolicy:balanced");
+		command.add("-Xmx512m");
+		command.add("-Xms512m");
+		command.add("-Xgc:tarokCopyForwardPrefetchDistance=" + prefetchDistance);
+		command.add("-cp");
+		command.add(System.getProperty("java.class.path"));
+		command.add(CopyForwardPrefetchBenchmark.class.getName());
+		command.add(mode);
+		command.add(shape);
+		command.add(Integer.toString(iterations));
+
+		Process child = new ProcessBuilder(command).redirectErrorStream(true).start();
+		BufferedReader reader = new BufferedReader(new InputStreamReader(child.getInputStream()));
+		/* a verify child only reports failures, through its exit code */
+		long result = mode.equals("run") ? -1 : 0;
+		String line = null;
+		while (null != (line = reader.readLine()))
+		{
+			if (line.startsWith("pgcTimeMillis="))
+			{
+				result = Long.parseLong(line.substring("pgcTimeMillis=".length()));
+			} else {
+				System.out.println(line);
+			}
+		}
+		return (0 == child.waitFor()) ? result : -1;
+	}
+
+	/**
+	 * Replace the structures of the window while partial GCs copy them, and check the contents of every structure in the window.
+	 * @return true if every structure was intact
+	 */
+	private static boolean verify(boolean tree, int iterations)
+	{
+		Object[] window = new Object[WINDOW];
+		int[] seeds = new int[WINDOW];
+
+		for (int i = 0; i < iterations; i++)
+		{
+			window[i % WINDOW] = tree ? buildTree(i) : buildList(i);
+			seeds[i % WINDOW] = i;
+			if ((WINDOW - 1) == (i % WINDOW))
+			{
+				for (int w = 0; w < WINDOW; w++)
+				{
+					boolean intact = tree ? verifySubtree((TreeNode)window[w], seeds[w], TREE_DEPTH) : verifyList((ListNode)window[w], seeds[w]);
+					if (!intact)
+					{
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	private static boolean verifyList(ListNode head, int seed)
+	{
+		int count = 0;
+		for (ListNode node = head; null != node; node = node.next)
+		{
+			if (node.payload != (seed + NODES_PER_STRUCTURE - 1 - count))
+			{
+				return false;
+			}
+			count += 1;
+		}
+		return (NODES_PER_STRUCTURE == count);
+	}
+
+	private static boolean verifySubtree(TreeNode node, int seed, int depth)
+	{
+		if ((null == node) || (node.payload != (seed + depth)))
+		{
+			return false;
+		}
+		if (depth > 0)
+		{
+			return verifySubtree(node.first, seed, depth - 1)
+				&& verifySubtree(node.second, seed + 1, depth - 1)
+				&& verifySubtree(node.third, seed + 2, depth - 1)
+				&& verifySubtree(node.fourth, seed + 3, depth - 1);
+		}
+		return (null == node.first) && (null == node.second) && (null == node.third) && (null == node.fourth);
+	}
+
+	private static long run(boolean tree, int iterations)
+	{
+		Object[] window = new Object[WINDOW];
+		long checksum = 0;
+
+		/* warm up, so that the measured collections are not dominated by class loading and JIT activity */
+		for (int i = 0; i < (iterations / 10); i++)
+		{
+			window[i % WINDOW] = tree ? buildTree(i) : buildList(i);
+		}
+
+		long before = partialCollectionTime();
+		for (int i = 0; i < iterations; i++)
+		{
+			window[i % WINDOW] = tree ? buildTree(i) : buildList(i);
+			checksum += (tree ? ((TreeNode)window[i % WINDOW]).payload : ((ListNode)window[i % WINDOW]).payload);
+		}
+		long after = partialCollectionTime();
+
+		if (checksum == 42)
+		{
+			/* keep the structures from being optimized away */
+			System.out.println("checksum=" + checksum);
+		}
+		return after - before;
+	}
+
+	private static ListNode buildList(int seed)
+	{
+		ListNode head = null;
+		for (int i = 0; i < NODES_PER_STRUCTURE; i++)
+		{
+			ListNode node = new ListNode();
+			node.payload = seed + i;
+			node.next = head;
+			head = node;
+		}
+		return head;
+	}
+
+	private static TreeNode buildTree(int seed)
+	{
+		/* TREE_DEPTH levels below the root with four children each, for roughly NODES_PER_STRUCTURE nodes in total */
+		return buildSubtree(seed, TREE_DEPTH);
+	}
+
+	private static TreeNode buildSubtree(int seed, int depth)
+	{
+		TreeNode node = new TreeNode();
+		node.payload = seed + depth;
+		if (depth > 0)
+		{
+			/* the referents of every node are spread over four fields, rather than over the slots of an array */
+			node.first = buildSubtree(seed, depth - 1);
+			node.second = buildSubtree(seed + 1, depth - 1);
+			node.third = buildSubtree(seed + 2, depth - 1);
+			node.fourth = buildSubtree(seed + 3, depth - 1);
+		}
+		return node;
+	}
+
+	private static long partialCollectionTime()
+	{
+		long time = 0;
+		for (GarbageCollectorMXBean bean : ManagementFactory.getGarbageCollectorMXBeans())
+		{
+			if (bean.getName().toLowerCase().contains("partial"))
+			{
+				time += bean.getCollectionTime();
+			}
+		}
+		return time;
+	}
+}
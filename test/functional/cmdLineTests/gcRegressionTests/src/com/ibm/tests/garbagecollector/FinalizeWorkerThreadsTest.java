@@ -0,0 +1,180 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.concurrent.atomic.AtomicInteger;
+
+/**
+ * Exercises -Xgc:finalizeWorkerThreads.  Objects with slow finalizers, whose class is defined by several class loaders,
+ * are made unreachable and the test checks that every object is finalized, that the finalizers of one class loader never
+ * run at the same time, and (in "parallel" mode) that finalizers of different class loaders do.  In "exit" mode the test
+ * returns from main while the finalizer threads are still busy, so that the VM shuts them down in the middle of a drain.
+ */
+public class FinalizeWorkerThreadsTest
+{
+	private static final int LOADERS = 4;
+	private static final int OBJECTS_PER_LOADER = 200;
+	private static final int FINALIZE_MILLIS = 2;
+
+	public static final AtomicInteger finalized = new AtomicInteger();
+	public static final AtomicInteger running = new AtomicInteger();
+	public static final AtomicInteger maxRunning = new AtomicInteger();
+	public static volatile String failure;
+
+	public static abstract class Finalizable
+	{
+		public void runFinalizer(AtomicInteger runningOfLoader)
+		{
+			if (runningOfLoader.incrementAndGet() != 1) {
+				failure = "Finalizers of " + getClass().getClassLoader() + " ran concurrently";
+			}
+			int nowRunning = running.incrementAndGet();
+			int max = maxRunning.get();
+			while ((nowRunning > max) && !maxRunning.compareAndSet(max, nowRunning)) {
+				max = maxRunning.get();
+			}
+			try {
+				Thread.sleep(FINALIZE_MILLIS);
+			} catch (InterruptedException e) {
+				// ignore
+			}
+			running.decrementAndGet();
+			runningOfLoader.decrementAndGet();
+			finalized.incrementAndGet();
+		}
+	}
+
+	/**
+	 * Defined separately by every IsolatingLoader, so each loader has its own running counter.
+	 */
+	public static final class Member extends Finalizable
+	{
+		static final AtomicInteger running = new AtomicInteger();
+		protected void finalize() { runFinalizer(running); }
+	}
+
+	/**
+	 * Defines its own copy of Member and delegates every other class to the application class loader.
+	 */
+	static final class IsolatingLoader extends ClassLoader
+	{
+		IsolatingLoader(ClassLoader parent)
+		{
+			super(parent);
+		}
+
+		protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException
+		{
+			if (!Member.class.getName().equals(name)) {
+				return super.loadClass(name, resolve);
+			}
+			synchronized (this) {
+				Class<?> clazz = findLoadedClass(name);
+				if (null == clazz) {
+					byte[] bytes = readClass(name);
+					clazz = defineClass(name, bytes, 0, bytes.length);
+				}
+				if (resolve) {
+					resolveClass(clazz);
+				}
+				return clazz;
+			}
+		}
+
+		private byte[] readClass(String name) throws ClassNotFoundException
+		{
+			InputStream in = getParent().getResourceAsStream(name.replace('.', '/') + ".class");
+			if (null == in) {
+				throw new ClassNotFoundException(name);
+			}
+			try {
+				try {
+					ByteArrayOutputStream out = new ByteArrayOutputStream();
+					byte[] buffer = new byte[4096];
+					int read = 0;
+					while ((read = in.read(buffer)) > 0) {
+						out.write(buffer, 0, read);
+					}
+					return out.toByteArray();
+				} finally {
+					in.close();
+				}
+			} catch (IOException e) {
+				throw new ClassNotFoundException(name, e);
+			}
+		}
+	}
+
+	/**
+	 * @param args Takes one argument: "serial" or "parallel" to wait for all the finalizers and check them, expecting
+	 * finalizers of different class loaders to overlap in "parallel" mode, or "exit" to return while they are still running.
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		String mode = (args.length > 0) ? args[0] : "parallel";
+		int expected = allocate();
+
+		System.gc();
+		System.gc();
+
+		if ("exit".equals(mode)) {
+			/* let the finalizer threads start on the lists, then shut down under them */
+			Thread.sleep(100);
+			System.out.println("Test ran to completion");
+			return;
+		}
+
+		long deadline = System.currentTimeMillis() + 120000;
+		while ((finalized.get() < expected) && (System.currentTimeMillis() < deadline)) {
+			System.runFinalization();
+			Thread.sleep(10);
+		}
+
+		System.out.println("finalized=" + finalized.get() + " expected=" + expected + " max concurrent finalizers=" + maxRunning.get());
+		if (null != failure) {
+			System.out.println("Test failed: " + failure);
+		} else if (finalized.get() < expected) {
+			System.out.println("Test failed: not every object was finalized");
+		} else if ("parallel".equals(mode) && (maxRunning.get() < 2)) {
+			System.out.println("Test failed: finalizers of different class loaders never ran in parallel");
+		} else {
+			System.out.println("Test ran to completion");
+		}
+	}
+
+	private static int allocate() throws Exception
+	{
+		Class<?>[] members = new Class<?>[LOADERS];
+		for (int i = 0; i < LOADERS; i++) {
+			members[i] = new IsolatingLoader(FinalizeWorkerThreadsTest.class.getClassLoader()).loadClass(Member.class.getName());
+		}
+		for (int i = 0; i < OBJECTS_PER_LOADER; i++) {
+			for (Class<?> member : members) {
+				member.getDeclaredConstructor().newInstance();
+			}
+		}
+		return LOADERS * OBJECTS_PER_LOADER;
+	}
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.util.ArrayList;
+import java.util.List;
+
+import sun.misc.Unsafe;
+
+/**
+ * Checks the field offsets of classes laid out with -XX:+HotFieldLayout.  Run twice against the same shared classes cache:
+ * the first run makes a few reference fields of each class hot, so that the JIT reports them and they are recorded in the
+ * cache at shutdown, and the second run lays the classes out with the recorded hot fields first.
+ *
+ * Every run checks that the offset Unsafe.objectFieldOffset gives for each instance field is the one reflection and
+ * compiled code use: a value stored through reflection must be read back through Unsafe, a value stored through Unsafe
+ * must be read back through reflection and through a JIT-compiled getter, and no two fields may share an offset.
+ */
+public class HotFieldLayoutTest
+{
+	private static final int ITERATIONS = 200000;
+	private static final Unsafe unsafe = getUnsafe();
+
+	/* The last declared reference fields are made hot, so a hot layout moves them ahead of the others */
+	static class Base
+	{
+		Object b0;
+		int i0;
+		Object b1;
+		Object b2;
+		Object b3;
+		long l0;
+		Object hotB4;
+		Object hotB5;
+
+		Object getHotB4() { return hotB4; }
+		Object getHotB5() { return hotB5; }
+	}
+
+	static class Derived extends Base
+	{
+		Object d0;
+		Object d1;
+		short s0;
+		Object d2;
+		Object d3;
+		Object d4;
+		Object d5;
+		Object d6;
+		Object d7;
+		Object d8;
+		Object hotD9;
+		double f0;
+		Object hotD10;
+
+		Object getHotD9() { return hotD9; }
+		Object getHotD10() { return hotD10; }
+	}
+
+	/* A single int leaves a backfill slot which a reference field can take */
+	static class Backfill
+	{
+		int i0;
+		Object c0;
+		Object c1;
+		Object hotC2;
+
+		Object getHotC2() { return hotC2; }
+	}
+
+	public static void main(String[] args) throws Exception
+	{
+		List<String> failures = new ArrayList<String>();
+		Derived derived = new Derived();
+		Backfill backfill = new Backfill();
+
+		/* make the hot fields hot, and get the getters compiled */
+		long found = 0;
+		Derived[] chain = new Derived[64];
+		for (int i = 0; i < chain.length; i++) {
+			chain[i] = new Derived();
+			chain[i].hotB4 = chain[i].hotB5 = chain[i].hotD9 = chain[i].hotD10 = (i > 0) ? chain[i - 1] : null;
+		}
+		for (int i = 0; i < ITERATIONS; i++) {
+			for (Derived d = chain[chain.length - 1]; null != d; d = (Derived)d.getHotD10()) {
+				if (null != d.getHotB4() && null != d.getHotB5() && null != d.getHotD9()) {
+					found += 1;
+				}
+			}
+			if (null == backfill.getHotC2()) {
+				found += 1;
+			}
+			if (0 == (i % 10000)) {
+				System.gc();
+			}
+		}
+		System.out.println("found=" + found);
+
+		checkOffsets(derived, failures);
+		checkOffsets(backfill, failures);
+		checkCompiledGetters(derived, backfill, failures);
+
+		if (failures.isEmpty()) {
+			System.out.println("Test ran to completion");
+		} else {
+			for (String failure : failures) {
+				System.out.println("Test failed: " + failure);
+			}
+		}
+	}
+
+	/**
+	 * Check every instance field of the class of object and its superclasses, through reflection and Unsafe.
+	 */
+	private static void checkOffsets(Object object, List<String> failures) throws Exception
+	{
+		List<Field> fields = new ArrayList<Field>();
+		for (Class<?> clazz = object.getClass(); Object.class != clazz; clazz = clazz.getSuperclass()) {
+			for (Field field : clazz.getDeclaredFields()) {
+				if (!Modifier.isStatic(field.getModifiers())) {
+					field.setAccessible(true);
+					fields.add(field);
+				}
+			}
+		}
+
+		List<Long> offsets = new ArrayList<Long>();
+		for (Field field : fields) {
+			long offset = unsafe.objectFieldOffset(field);
+			String name = field.getDeclaringClass().getSimpleName() + "." + field.getName() + " at offset " + offset;
+			if (offsets.contains(Long.valueOf(offset))) {
+				failures.add(name + " overlaps another field");
+			}
+			offsets.add(Long.valueOf(offset));
+
+			Class<?> type = field.getType();
+			if (!type.isPrimitive()) {
+				Object marker = new Object();
+				field.set(object, marker);
+				if (unsafe.getObject(object, offset) != marker) {
+					failures.add(name + ": Unsafe did not read the value stored through reflection");
+				}
+				Object other = new Object();
+				unsafe.putObject(object, offset, other);
+				if (field.get(object) != other) {
+					failures.add(name + ": reflection did not read the value stored through Unsafe");
+				}
+			} else if (int.class == type) {
+				field.setInt(object, 0x12345678);
+				if (unsafe.getInt(object, offset) != 0x12345678) {
+					failures.add(name + ": Unsafe did not read the value stored through reflection");
+				}
+			} else if (long.class == type) {
+				field.setLong(object, 0x123456789abcdefL);
+				if (unsafe.getLong(object, offset) != 0x123456789abcdefL) {
+					failures.add(name + ": Unsafe did not read the value stored through reflection");
+				}
+			} else if (short.class == type) {
+				field.setShort(object, (short)0x1234);
+				if (unsafe.getShort(object, offset) != (short)0x1234) {
+					failures.add(name + ": Unsafe did not read the value stored through reflection");
+				}
+			} else if (double.class == type) {
+				field.setDouble(object, 1.5);
+				if (unsafe.getDouble(object, offset) != 1.5) {
+					failures.add(name + ": Unsafe did not read the value stored through reflection");
+				}
+			}
+		}
+
+		/* the primitive fields must not have been overwritten by the reference fields stored after them */
+		for (Field field : fields) {
+			Class<?> type = field.getType();
+			String name = field.getDeclaringClass().getSimpleName() + "." + field.getName();
+			if (((int.class == type) && (field.getInt(object) != 0x12345678))
+				|| ((long.class == type) && (field.getLong(object) != 0x123456789abcdefL))
+				|| ((short.class == type) && (field.getShort(object) != (short)0x1234))
+				|| ((double.class == type) && (field.getDouble(object) != 1.5))
+			) {
+				failures.add(name + " was overwritten by another field");
+			}
+		}
+	}
+
+	/**
+	 * Check that compiled code reads the hot fields at the offsets Unsafe gives for them.
+	 */
+	private static void checkCompiledGetters(Derived derived, Backfill backfill, List<String> failures) throws Exception
+	{
+		Object[] values = { new Object(), new Object(), new Object(), new Object(), new Object() };
+		unsafe.putObject(derived, unsafe.objectFieldOffset(Base.class.getDeclaredField("hotB4")), values[0]);
+		unsafe.putObject(derived, unsafe.objectFieldOffset(Base.class.getDeclaredField("hotB5")), values[1]);
+		unsafe.putObject(derived, unsafe.objectFieldOffset(Derived.class.getDeclaredField("hotD9")), values[2]);
+		unsafe.putObject(derived, unsafe.objectFieldOffset(Derived.class.getDeclaredField("hotD10")), values[3]);
+		unsafe.putObject(backfill, unsafe.objectFieldOffset(Backfill.class.getDeclaredField("hotC2")), values[4]);
+		if ((derived.getHotB4() != values[0])
+			|| (derived.getHotB5() != values[1])
+			|| (derived.getHotD9() != values[2])
+			|| (derived.getHotD10() != values[3])
+			|| (backfill.getHotC2() != values[4])
+		) {
+			failures.add("compiled getters do not read the hot fields at the offsets given by Unsafe");
+		}
+	}
+
+	private static Unsafe getUnsafe()
+	{
+		try {
+			Field field = Unsafe.class.getDeclaredField("theUnsafe");
+			field.setAccessible(true);
+			return (Unsafe)field.get(null);
+		} catch (Exception e) {
+			throw new RuntimeException(e);
+		}
+	}
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.lang.reflect.Field;
+import java.util.IdentityHashMap;
+
+import sun.misc.Unsafe;
+
+/**
+ * Checks -XX:+UseStringDeduplication.  Creates many equal Strings, each with its own value array, gets them tenured by
+ * scavenges and then waits for the deduplication thread to point the equal Strings at one shared value array.
+ *
+ * Run with -verbose:gc, the <string-deduplication> element at the end of the last scavenge reports the deduplicated count.
+ */
+public class StringDeduplicationTest
+{
+	private static final int DISTINCT_VALUES = 16;
+	private static final int COPIES = 256;
+	private static final long TIMEOUT_MILLIS = 60000;
+	private static final Unsafe unsafe = getUnsafe();
+
+	public static void main(String[] args) throws Exception
+	{
+		long valueOffset = unsafe.objectFieldOffset(String.class.getDeclaredField("value"));
+		String[] expected = new String[DISTINCT_VALUES];
+		String[] strings = new String[DISTINCT_VALUES * COPIES];
+		for (int i = 0; i < DISTINCT_VALUES; i++)
+		{
+			expected[i] = "deduplication test value " + i + " \u00e9\u4e2d";
+		}
+		for (int i = 0; i < strings.length; i++)
+		{
+			/* a new array for each copy, so that none of them share a value before deduplication */
+			strings[i] = new String(expected[i % DISTINCT_VALUES].toCharArray());
+		}
+
+		int before = countValueArrays(strings, valueOffset);
+		if (before != strings.length)
+		{
+			System.out.println("Test failed: " + before + " value arrays for " + strings.length + " new Strings");
+			return;
+		}
+
+		/* scavenge a few times, so that the Strings are tenured and queued */
+		for (int i = 0; i < 8; i++)
+		{
+			allocateGarbage();
+		}
+
+		/* allocation is avoided while waiting, since every collection discards the Strings still queued */
+		long deadline = System.currentTimeMillis() + TIMEOUT_MILLIS;
+		int arrays = countValueArrays(strings, valueOffset);
+		while ((arrays > DISTINCT_VALUES) && (System.currentTimeMillis() < deadline))
+		{
+			Thread.sleep(100);
+			arrays = countValueArrays(strings, valueOffset);
+		}
+		System.out.println(arrays + " value arrays for " + strings.length + " Strings with " + DISTINCT_VALUES + " values");
+
+		/* one more scavenge, so that verbose GC reports the deduplicated Strings */
+		allocateGarbage();
+
+		boolean passed = true;
+		for (int i = 0; i < strings.length; i++)
+		{
+			if (!strings[i].equals(expected[i % DISTINCT_VALUES]) || (strings[i].hashCode() != expected[i % DISTINCT_VALUES].hashCode()))
+			{
+				System.out.println("Test failed: the contents of String " + i + " changed to " + strings[i]);
+				passed = false;
+				break;
+			}
+		}
+		if (arrays > DISTINCT_VALUES)
+		{
+			System.out.println("Test failed: the Strings were not deduplicated within " + TIMEOUT_MILLIS + "ms");
+			passed = false;
+		}
+		if (passed)
+		{
+			System.out.println("Test ran to completion");
+		}
+	}
+
+	private static int countValueArrays(String[] strings, long valueOffset)
+	{
+		IdentityHashMap<Object, Object> arrays = new IdentityHashMap<Object, Object>();
+		for (String string : strings)
+		{
+			arrays.put(unsafe.getObject(string, valueOffset), string);
+		}
+		return arrays.size();
+	}
+
+	private static void allocateGarbage()
+	{
+		Object[] window = new Object[16];
+		for (int i = 0; i < 64 * 1024; i++)
+		{
+			window[i % window.length] = new byte[256];
+		}
+	}
+
+	private static Unsafe getUnsafe()
+	{
+		try {
+			Field field = Unsafe.class.getDeclaredField("theUnsafe");
+			field.setAccessible(true);
+			return (Unsafe)field.get(null);
+		} catch (Exception e) {
+			throw new RuntimeException(e);
+		}
+	}
+}
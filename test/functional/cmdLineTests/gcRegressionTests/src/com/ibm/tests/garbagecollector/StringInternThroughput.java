@@ -0,0 +1,201 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.util.concurrent.CountDownLatch;
+
+/**
+ * Microbenchmark for the interned string table.  Each thread repeatedly interns strings from a shared pool, most of which are
+ * already interned, which is the pattern seen in parsers that intern element and attribute names.  Run with "benchmark", it
+ * reports the intern throughput for 1, 2, 4, ... up to the given maximum number of threads (at most 64), so lock contention in
+ * the lookup path shows up as throughput that fails to scale with the thread count.
+ *
+ * Run without arguments, it only checks that threads interning the same strings concurrently, while the GC clears strings which
+ * are no longer referenced, always get the same instance.
+ */
+public class StringInternThroughput
+{
+	private static final int POOL_SIZE = 4096;
+	private static final int MAX_THREADS = 64;
+	private static final int CHECK_THREADS = 8;
+	private static final int CHECK_ROUNDS = 20;
+	private static final int FRESH_STRINGS = 1024;
+
+	/**
+	 * @param args Either no arguments to check the interned instances, or "benchmark" followed by two optional arguments: the
+	 * maximum number of threads (default 64) and the number of milliseconds to run each thread count for (default 1000).
+	 */
+	public static void main(String[] args) throws InterruptedException
+	{
+		if ((args.length == 0) || !args[0].equals("benchmark"))
+		{
+			if (checkInterns())
+			{
+				System.out.println("Test ran to completion");
+			}
+			return;
+		}
+
+		int maxThreads = (args.length > 1) ? Integer.parseInt(args[1]) : MAX_THREADS;
+		long millisPerRun = (args.length > 2) ? Long.parseLong(args[2]) : 1000;
+
+		if ((maxThreads < 1) || (maxThreads > MAX_THREADS) || (millisPerRun < 1))
+		{
+			System.err.println("Invalid arguments: the thread count must be in the range [1-" + MAX_THREADS + "] and the run time must be positive.");
+			System.exit(1);
+		}
+
+		final String[] pool = new String[POOL_SIZE];
+		for (int i = 0; i < POOL_SIZE; i++)
+		{
+			pool[i] = ("element" + i).intern();
+		}
+
+		/* warm up the intern paths before measuring */
+		runInterns(pool, 1, millisPerRun);
+
+		for (int threads = 1; threads <= maxThreads; threads *= 2)
+		{
+			long interns = runInterns(pool, threads, millisPerRun);
+			long internsPerSecond = (interns * 1000) / millisPerRun;
+			System.out.println("threads=" + threads + " interns/s=" + internsPerSecond + " per thread=" + (internsPerSecond / threads));
+		}
+		System.out.println("Test ran to completion");
+	}
+
+	/**
+	 * In each round, every thread interns its own copies of the same new strings, racing to insert them, and then looks them
+	 * up again.  The strings of a round are dropped before the next one, so the GC clears them from the table and its cache.
+	 * @return true if all threads got the same instance for every string
+	 */
+	private static boolean checkInterns() throws InterruptedException
+	{
+		boolean passed = true;
+		for (int round = 0; round < CHECK_ROUNDS; round++)
+		{
+			final String prefix = "round" + round + "string";
+			final String[][] results = new String[CHECK_THREADS][FRESH_STRINGS];
+			final CountDownLatch start = new CountDownLatch(1);
+			Thread[] threads = new Thread[CHECK_THREADS];
+			for (int t = 0; t < CHECK_THREADS; t++)
+			{
+				final int threadIndex = t;
+				threads[t] = new Thread() {
+					public void run()
+					{
+						try {
+							start.await();
+						} catch (InterruptedException e) {
+							return;
+						}
+						for (int i = 0; i < FRESH_STRINGS; i++)
+						{
+							int index = (i + (threadIndex * 97)) % FRESH_STRINGS;
+							results[threadIndex][index] = new StringBuilder(prefix).append(index).toString().intern();
+						}
+						for (int i = 0; i < FRESH_STRINGS; i++)
+						{
+							if (new StringBuilder(prefix).append(i).toString().intern() != results[threadIndex][i])
+							{
+								results[threadIndex][i] = null;
+							}
+						}
+					}
+				};
+				threads[t].start();
+			}
+			start.countDown();
+			for (Thread thread : threads)
+			{
+				thread.join();
+			}
+
+			for (int i = 0; i < FRESH_STRINGS; i++)
+			{
+				String expected = prefix + i;
+				for (int t = 0; t < CHECK_THREADS; t++)
+				{
+					if ((results[t][i] != results[0][i]) || !expected.equals(results[t][i]))
+					{
+						System.out.println("String.intern() returned a different instance for " + expected);
+						passed = false;
+						break;
+					}
+				}
+			}
+			System.gc();
+		}
+		return passed;
+	}
+
+	private static long runInterns(final String[] pool, int threadCount, final long millisPerRun) throws InterruptedException
+	{
+		final CountDownLatch start = new CountDownLatch(1);
+		final long[] counts = new long[threadCount];
+		Thread[] threads = new Thread[threadCount];
+
+		for (int t = 0; t < threadCount; t++)
+		{
+			final int threadIndex = t;
+			threads[t] = new Thread() {
+				public void run()
+				{
+					StringBuilder builder = new StringBuilder();
+					long count = 0;
+					int index = threadIndex * 31;
+					try {
+						start.await();
+					} catch (InterruptedException e) {
+						return;
+					}
+					long endTime = System.currentTimeMillis() + millisPerRun;
+					while (System.currentTimeMillis() < endTime)
+					{
+						for (int i = 0; i < 256; i++)
+						{
+							index = (index + 1) % POOL_SIZE;
+							/* intern a fresh copy so that the lookup cannot be satisfied by identity */
+							builder.setLength(0);
+							String interned = builder.append(pool[index]).toString().intern();
+							if (interned != pool[index])
+							{
+								throw new RuntimeException("String.intern() returned a different instance for " + pool[index]);
+							}
+						}
+						count += 256;
+					}
+					counts[threadIndex] = count;
+				}
+			};
+			threads[t].start();
+		}
+
+		start.countDown();
+		long total = 0;
+		for (int t = 0; t < threadCount; t++)
+		{
+			threads[t].join();
+			total += counts[t];
+		}
+		return total;
+	}
+}
@@ -0,0 +1,439 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.tests.garbagecollector;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileReader;
+import java.io.InputStreamReader;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import javax.xml.parsers.DocumentBuilderFactory;
+
+import org.w3c.dom.Document;
+import org.w3c.dom.Element;
+import org.w3c.dom.NodeList;
+
+/**
+ * Checks the logs of the asynchronous verbose GC writer.  Run without arguments, it runs a child VM with
+ * -Xgc:verboseFormat=json and one with -Xgc:asyncLogging, and checks that every line of the JSON log is a JSON
+ * object converted from a verbose element, and that the XML log is well formed.
+ *
+ * The child VMs are given so many options that the initialized stanza, which lists them all, is larger than half of
+ * the smallest ring, so it must be written by the thread producing it rather than dropped.  The options contain
+ * characters which the verbose output escapes, and which the JSON conversion must restore.
+ */
+public class VerboseJSONTest
+{
+	private static final int OPTION_COUNT = 1000;
+	private static final String OPTION_PREFIX = "-Dcom.ibm.tests.verbosejson";
+	private static final String OPTION_VALUE = "a&b<c>d";
+
+	/**
+	 * @param args Either no arguments to run and check both formats, or "run" to do some collections in this VM.
+	 */
+	public static void main(String[] args) throws Exception
+	{
+		if ((args.length > 0) && args[0].equals("run"))
+		{
+			run();
+			return;
+		}
+
+		List<String> failures = new ArrayList<String>();
+		File options = File.createTempFile("verbosejson", ".options");
+		File jsonLog = File.createTempFile("verbosejson", ".json");
+		File xmlLog = File.createTempFile("verbosejson", ".xml");
+		try {
+			PrintWriter writer = new PrintWriter(options);
+			for (int i = 0; i < OPTION_COUNT; i++)
+			{
+				writer.println(option(i));
+			}
+			writer.close();
+
+			if (runChild(options, jsonLog, "-Xgc:verboseFormat=json"))
+			{
+				checkJSONLog(jsonLog, failures);
+			} else {
+				failures.add("the child VM writing the JSON log failed");
+			}
+			if (runChild(options, xmlLog, "-Xgc:asyncLogging"))
+			{
+				checkXMLLog(xmlLog, failures);
+			} else {
+				failures.add("the child VM writing the XML log failed");
+			}
+		} finally {
+			options.delete();
+			jsonLog.delete();
+			xmlLog.delete();
+		}
+
+		if (failures.isEmpty())
+		{
+			System.out.println("Test ran to completion");
+		} else {
+			for (String failure : failures)
+			{
+				System.out.println("Test failed: " + failure);
+			}
+		}
+	}
+
+	private static String option(int i)
+	{
+		return OPTION_PREFIX + i + "=" + OPTION_VALUE;
+	}
+
+	private static boolean runChild(File options, File log, String format) throws Exception
+	{
+		String java = System.getProperty("java.home") + File.separator + "bin" + File.separator + "java";
+		List<String> command = new ArrayList<String>();
+		command.add(java);
+		command.add("-Xmx32m");
+		command.add("-Xms32m");
+		command.add("-Xoptionsfile=" + options.getAbsolutePath());
+		command.add(format);
+		/* the smallest ring, so that the initialized stanza does not fit */
+		command.add("-Xgc:asyncLoggingBufferSize=64k");
+		command.add("-Xverbosegclog:" + log.getAbsolutePath());
+		command.add("-cp");
+		command.add(System.getProperty("java.class.path"));
+		command.add(VerboseJSONTest.class.getName());
+		command.add("run");
+
+		Process child = new ProcessBuilder(command).redirectErrorStream(true).start();
+		BufferedReader reader = new BufferedReader(new InputStreamReader(child.getInputStream()));
+		String line = null;
+		while (null != (line = reader.readLine()))
+		{
+			System.out.println(line);
+		}
+		return (0 == child.waitFor());
+	}
+
+	private static void run()
+	{
+		Object[] window = new Object[64];
+		for (int i = 0; i < 200000; i++)
+		{
+			window[i % window.length] = new byte[1024];
+		}
+		for (int i = 0; i < 3; i++)
+		{
+			System.gc();
+		}
+	}
+
+	private static void checkJSONLog(File log, List<String> failures) throws Exception
+	{
+		BufferedReader reader = new BufferedReader(new FileReader(log));
+		int lineNumber = 0;
+		int vmargs = 0;
+		boolean initialized = false;
+		boolean collected = false;
+		try {
+			String line = null;
+			while (null != (line = reader.readLine()))
+			{
+				lineNumber += 1;
+				Object value = null;
+				try {
+					value = new JSONParser(line).parse();
+				} catch (IllegalArgumentException e) {
+					failures.add("line " + lineNumber + " of the JSON log is not JSON: " + e.getMessage());
+					continue;
+				}
+				if (!(value instanceof Map))
+				{
+					failures.add("line " + lineNumber + " of the JSON log is not a JSON object");
+					continue;
+				}
+				Map<?, ?> element = (Map<?, ?>)value;
+				if (!element.containsKey("element") && !element.containsKey("text"))
+				{
+					failures.add("line " + lineNumber + " of the JSON log is neither an element nor text");
+				}
+				if ("initialized".equals(element.get("element")))
+				{
+					initialized = true;
+					vmargs += countVmargs(element, failures);
+				} else if ("gc-start".equals(element.get("element")) || "cycle-start".equals(element.get("element")))
+				{
+					collected = true;
+				}
+			}
+		} finally {
+			reader.close();
+		}
+
+		if (!initialized)
+		{
+			failures.add("the JSON log has no initialized element");
+		}
+		if (vmargs < OPTION_COUNT)
+		{
+			failures.add("the JSON log lists " + vmargs + " of the " + OPTION_COUNT + " test options");
+		}
+		if (!collected)
+		{
+			failures.add("the JSON log has no collections");
+		}
+	}
+
+	/**
+	 * @return the number of vmarg elements below element which are test options, each of which must have kept its value
+	 */
+	private static int countVmargs(Map<?, ?> element, List<String> failures)
+	{
+		int count = 0;
+		if ("vmarg".equals(element.get("element")))
+		{
+			Object name = element.get("name");
+			if ((name instanceof String) && ((String)name).startsWith(OPTION_PREFIX))
+			{
+				String option = (String)name;
+				if (!option.endsWith("=" + OPTION_VALUE))
+				{
+					failures.add("the escaped option " + option + " was not converted back");
+				}
+				count += 1;
+			}
+		}
+		Object children = element.get("children");
+		if (children instanceof List)
+		{
+			for (Object child : (List<?>)children)
+			{
+				if (child instanceof Map)
+				{
+					count += countVmargs((Map<?, ?>)child, failures);
+				}
+			}
+		}
+		return count;
+	}
+
+	private static void checkXMLLog(File log, List<String> failures)
+	{
+		try {
+			Document document = DocumentBuilderFactory.newInstance().newDocumentBuilder().parse(log);
+			int vmargs = 0;
+			NodeList nodes = document.getElementsByTagName("vmarg");
+			for (int i = 0; i < nodes.getLength(); i++)
+			{
+				String name = ((Element)nodes.item(i)).getAttribute("name");
+				if (name.startsWith(OPTION_PREFIX) && name.endsWith("=" + OPTION_VALUE))
+				{
+					vmargs += 1;
+				}
+			}
+			if (vmargs < OPTION_COUNT)
+			{
+				failures.add("the XML log lists " + vmargs + " of the " + OPTION_COUNT + " test options");
+			}
+		} catch (Exception e) {
+			failures.add("the XML log is not well formed: " + e);
+		}
+	}
+
+	/**
+	 * A parser for the JSON the verbose writer produces: objects, arrays, strings, numbers, true and false.
+	 */
+	static final class JSONParser
+	{
+		private final String text;
+		private int index;
+
+		JSONParser(String text)
+		{
+			this.text = text;
+		}
+
+		Object parse()
+		{
+			Object value = parseValue();
+			if (index != text.length())
+			{
+				throw error("trailing characters");
+			}
+			return value;
+		}
+
+		private Object parseValue()
+		{
+			if (index >= text.length())
+			{
+				throw error("unexpected end");
+			}
+			char c = text.charAt(index);
+			if ('{' == c)
+			{
+				return parseObject();
+			} else if ('[' == c)
+			{
+				return parseArray();
+			} else if ('"' == c)
+			{
+				return parseString();
+			} else if (text.startsWith("true", index))
+			{
+				index += 4;
+				return Boolean.TRUE;
+			} else if (text.startsWith("false", index))
+			{
+				index += 5;
+				return Boolean.FALSE;
+			}
+			return parseNumber();
+		}
+
+		private Map<String, Object> parseObject()
+		{
+			Map<String, Object> object = new LinkedHashMap<String, Object>();
+			expect('{');
+			if (peek('}'))
+			{
+				index += 1;
+				return object;
+			}
+			do {
+				String key = parseString();
+				expect(':');
+				if (null != object.put(key, parseValue()))
+				{
+					throw error("duplicate key " + key);
+				}
+			} while (next(','));
+			expect('}');
+			return object;
+		}
+
+		private List<Object> parseArray()
+		{
+			List<Object> array = new ArrayList<Object>();
+			expect('[');
+			if (peek(']'))
+			{
+				index += 1;
+				return array;
+			}
+			do {
+				array.add(parseValue());
+			} while (next(','));
+			expect(']');
+			return array;
+		}
+
+		private String parseString()
+		{
+			StringBuilder string = new StringBuilder();
+			expect('"');
+			while (true)
+			{
+				if (index >= text.length())
+				{
+					throw error("unterminated string");
+				}
+				char c = text.charAt(index++);
+				if ('"' == c)
+				{
+					return string.toString();
+				} else if ('\\' == c)
+				{
+					if (index >= text.length())
+					{
+						throw error("unterminated escape");
+					}
+					char escaped = text.charAt(index++);
+					if ('u' == escaped)
+					{
+						if ((index + 4) > text.length())
+						{
+							throw error("short unicode escape");
+						}
+						string.append((char)Integer.parseInt(text.substring(index, index + 4), 16));
+						index += 4;
+					} else if (('"' == escaped) || ('\\' == escaped) || ('/' == escaped))
+					{
+						string.append(escaped);
+					} else {
+						throw error("invalid escape \\" + escaped);
+					}
+				} else if (c < 0x20)
+				{
+					throw error("unescaped control character");
+				} else {
+					string.append(c);
+				}
+			}
+		}
+
+		private Double parseNumber()
+		{
+			int start = index;
+			while ((index < text.length()) && ("-+.eE0123456789".indexOf(text.charAt(index)) >= 0))
+			{
+				index += 1;
+			}
+			String number = text.substring(start, index);
+			if (!number.matches("-?(0|[1-9][0-9]*)(\\.[0-9]+)?([eE][-+]?[0-9]+)?"))
+			{
+				throw error("invalid value");
+			}
+			return Double.valueOf(number);
+		}
+
+		private boolean peek(char c)
+		{
+			return (index < text.length()) && (c == text.charAt(index));
+		}
+
+		private boolean next(char c)
+		{
+			if (peek(c))
+			{
+				index += 1;
+				return true;
+			}
+			return false;
+		}
+
+		private void expect(char c)
+		{
+			if (!next(c))
+			{
+				throw error("expected " + c);
+			}
+		}
+
+		private IllegalArgumentException error(String message)
+		{
+			return new IllegalArgumentException(message + " at column " + index);
+		}
+	}
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test;
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.List;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+/**
+ * Run with -XX:StartFlightRecording=filename=<stem>.jfr,disk=true and checks the files
+ * written by the JFR writer thread while the application is still running.
+ *
+ * Arguments: <stem> <seconds> <minFiles> [maxFiles]
+ * - stem: the recording file name without the .jfr extension
+ * - seconds: how long to run the workload
+ * - minFiles: the minimum number of recording files written (by sequence number) during the run
+ * - maxFiles: if given, the maximum number of recording files left on disk, to check the retention budget
+ *
+ * Short lived threads are started throughout the run, so that events of ending threads
+ * are handed to the writer as well.
+ *
+ * Events dropped while the writer is busy must be reported by jdk.DataLoss events, whose
+ * amounts add up to the running total written with each of them.
+ */
+public class JFRContinuousRecordingTest {
+	private static final byte[] CHUNK_MAGIC = { 'F', 'L', 'R', 0 };
+
+	public static void main(String[] args) throws Exception {
+		String stem = args[0];
+		long seconds = Long.parseLong(args[1]);
+		int minFiles = Integer.parseInt(args[2]);
+		int maxFiles = (args.length > 3) ? Integer.parseInt(args[3]) : Integer.MAX_VALUE;
+		boolean failed = false;
+
+		long streamedLength = -1;
+		long deadline = System.currentTimeMillis() + (seconds * 1000);
+		while (System.currentTimeMillis() < deadline) {
+			runShortLivedThreads(8);
+			if (streamedLength <= 0) {
+				streamedLength = totalLength(recordingFiles(stem));
+			}
+		}
+
+		/* The writer streams the events at least once a second, not only at shutdown */
+		if (streamedLength <= 0) {
+			System.out.println("Failed: no events were streamed to " + stem + ".<n>.jfr while the application was running");
+			failed = true;
+		}
+
+		List<File> files = recordingFiles(stem);
+		int highestSequence = -1;
+		for (File file : files) {
+			highestSequence = Math.max(highestSequence, sequenceOf(stem, file));
+			if ((file.length() > 0) && !startsWithChunkMagic(file)) {
+				System.out.println("Failed: " + file + " does not start with a JFR chunk header");
+				failed = true;
+			}
+		}
+		int filesWritten = highestSequence + 1;
+		System.out.println("Recording files written: " + filesWritten + ", on disk: " + files.size());
+		if (filesWritten < minFiles) {
+			System.out.println("Failed: expected at least " + minFiles + " recording files, found " + filesWritten);
+			failed = true;
+		}
+		if (files.size() > maxFiles) {
+			System.out.println("Failed: expected at most " + maxFiles + " recording files on disk, found " + files.size());
+			failed = true;
+		}
+		if (!checkDataLoss(stem, files)) {
+			failed = true;
+		}
+
+		if (!failed) {
+			System.out.println("All runs complete.");
+		}
+	}
+
+	/**
+	 * Check the jdk.DataLoss events in the recording files, except the newest one which
+	 * may still be being written.
+	 *
+	 * @return true if the events are consistent, false otherwise
+	 */
+	private static boolean checkDataLoss(String stem, List<File> files) throws IOException {
+		boolean passed = true;
+		List<File> completeFiles = new ArrayList<>(files);
+		completeFiles.sort(Comparator.comparingInt(file -> sequenceOf(stem, file)));
+		if (!completeFiles.isEmpty()) {
+			completeFiles.remove(completeFiles.size() - 1);
+		}
+		boolean firstFileRetained = !completeFiles.isEmpty() && (0 == sequenceOf(stem, completeFiles.get(0)));
+
+		long amounts = 0;
+		long total = 0;
+		int events = 0;
+		for (File file : completeFiles) {
+			if (0 == file.length()) {
+				continue;
+			}
+			for (RecordedEvent event : RecordingFile.readAllEvents(file.toPath())) {
+				if (!"jdk.DataLoss".equals(event.getEventType().getName())) {
+					continue;
+				}
+				long amount = event.getLong("amount");
+				long eventTotal = event.getLong("total");
+				if ((amount <= 0) || (amount > eventTotal)) {
+					System.out.println("Failed: " + file + " reports an amount of " + amount + " bytes lost of a total of " + eventTotal);
+					passed = false;
+				}
+				if (eventTotal < total) {
+					System.out.println("Failed: " + file + " reports a total of " + eventTotal + " bytes lost, less than the previous " + total);
+					passed = false;
+				}
+				amounts += amount;
+				total = eventTotal;
+				events += 1;
+			}
+		}
+		System.out.println("Data loss events: " + events + ", bytes lost: " + total);
+		/* Without deleted files, every loss has been reported by one of the events */
+		if (firstFileRetained && (amounts != total)) {
+			System.out.println("Failed: the data loss amounts add up to " + amounts + " bytes, not the total of " + total);
+			passed = false;
+		}
+		return passed;
+	}
+
+	private static void runShortLivedThreads(int count) throws InterruptedException {
+		Thread[] threads = new Thread[count];
+		for (int i = 0; i < count; i++) {
+			threads[i] = new Thread(() -> {
+				long sum = 0;
+				for (int j = 0; j < 100000; j++) {
+					sum += Integer.toString(j).hashCode();
+				}
+				try {
+					Thread.sleep(10);
+				} catch (InterruptedException e) {
+					// ignore
+				}
+				if (sum == 42) {
+					System.out.println(sum);
+				}
+			});
+			threads[i].start();
+		}
+		for (Thread thread : threads) {
+			thread.join();
+		}
+	}
+
+	private static List<File> recordingFiles(String stem) {
+		File stemFile = new File(stem).getAbsoluteFile();
+		File directory = stemFile.getParentFile();
+		List<File> result = new ArrayList<>();
+		File[] files = directory.listFiles();
+		if (null != files) {
+			for (File file : files) {
+				if (sequenceOf(stem, file) >= 0) {
+					result.add(file);
+				}
+			}
+		}
+		return result;
+	}
+
+	private static int sequenceOf(String stem, File file) {
+		String name = new File(stem).getName();
+		Matcher matcher = Pattern.compile(Pattern.quote(name) + "\\.(\\d+)\\.jfr").matcher(file.getName());
+		return matcher.matches() ? Integer.parseInt(matcher.group(1)) : -1;
+	}
+
+	private static long totalLength(List<File> files) {
+		long length = 0;
+		for (File file : files) {
+			length += file.length();
+		}
+		return length;
+	}
+
+	private static boolean startsWithChunkMagic(File file) throws IOException {
+		byte[] magic = new byte[CHUNK_MAGIC.length];
+		try (FileInputStream in = new FileInputStream(file)) {
+			int read = 0;
+			while (read < magic.length) {
+				int n = in.read(magic, read, magic.length - read);
+				if (n < 0) {
+					return false;
+				}
+				read += n;
+			}
+		}
+		for (int i = 0; i < magic.length; i++) {
+			if (magic[i] != CHUNK_MAGIC[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package com.ibm.jvmti.tests.getStackTrace;
+
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Parks virtual threads after their stacks have grown, so that with -XX:+CompactParkedContinuationStacks
+ * their frames are frozen into a smaller stack while they are unmounted, and thawed when they resume.
+ */
+public class gst003 {
+	static final int DEEP = 2000;
+	static final int THREADS = 64;
+
+	native static boolean check(Thread t, String expectedMethod, int minFrames);
+
+	/**
+	 * Grow the stack of the current thread by recursing depth frames deep.
+	 * @return a value computed from every frame, to check the frames were intact
+	 */
+	static long recurse(int depth) {
+		long local = depth;
+		if (depth > 0) {
+			local += recurse(depth - 1);
+		}
+		return local;
+	}
+
+	static long expectedRecurse(int depth) {
+		return ((long)depth * (depth + 1)) / 2;
+	}
+
+	/**
+	 * Park with a few objects held in the frame, which the GC must find and update in the frozen stack.
+	 * A continuation is only frozen on its second consecutive shallow yield, so sleep briefly first.
+	 * @return true if the objects held in the frame are intact after resuming
+	 */
+	static boolean parkShallow(int id) throws InterruptedException {
+		Integer boxed = Integer.valueOf(id + 100000);
+		String text = "vthread " + id;
+		int[] array = new int[] { id, id * 2, id * 3 };
+		Thread.sleep(1);
+		LockSupport.park();
+		return (boxed.intValue() == (id + 100000))
+				&& text.equals("vthread " + id)
+				&& (array[0] == id) && (array[1] == (id * 2)) && (array[2] == (id * 3));
+	}
+
+	static Thread startParker(int id, boolean[] results) {
+		return Thread.ofVirtual().name("parker " + id).start(() -> {
+			boolean ok = (recurse(DEEP) == expectedRecurse(DEEP));
+			try {
+				ok &= parkShallow(id);
+			} catch (InterruptedException e) {
+				ok = false;
+			}
+			/* after resuming, the stack must still grow, whether or not it was thawed */
+			ok &= (recurse(DEEP) == expectedRecurse(DEEP));
+			results[id] = ok;
+		});
+	}
+
+	static void waitUntilParked(Thread t) throws InterruptedException {
+		while (t.getState() != Thread.State.WAITING) {
+			Thread.sleep(10);
+		}
+	}
+
+	public String helpParkedVthreadStackTrace() {
+		return "Check GetStackTrace on a virtual thread parked after its stack grew, and that it resumes with intact frames.";
+	}
+
+	public boolean testParkedVthreadStackTrace() throws InterruptedException {
+		boolean[] results = new boolean[1];
+		Thread t = startParker(0, results);
+		waitUntilParked(t);
+
+		/* the trace of the unmounted thread is walked on its frozen stack */
+		boolean rc = check(t, "parkShallow", 2);
+		rc &= check(t, "parkShallow", 2);
+
+		LockSupport.unpark(t);
+		t.join();
+		return rc && results[0];
+	}
+
+	public String helpFreezeThawUnderGC() {
+		return "Park many virtual threads after their stacks grew, collect garbage while they are parked and resuming, and check their frames.";
+	}
+
+	public boolean testFreezeThawUnderGC() throws InterruptedException {
+		boolean[] results = new boolean[THREADS];
+		Thread[] threads = new Thread[THREADS];
+		for (int i = 0; i < THREADS; i++) {
+			threads[i] = startParker(i, results);
+		}
+		for (Thread t : threads) {
+			waitUntilParked(t);
+		}
+
+		boolean rc = true;
+		for (int gc = 0; gc < 3; gc++) {
+			Object[] garbage = new Object[10000];
+			for (int i = 0; i < garbage.length; i++) {
+				garbage[i] = new byte[64];
+			}
+			System.gc();
+			for (Thread t : threads) {
+				rc &= check(t, "parkShallow", 2);
+			}
+		}
+
+		for (int i = 0; i < THREADS; i++) {
+			LockSupport.unpark(threads[i]);
+			if (0 == (i % 8)) {
+				System.gc();
+			}
+		}
+		for (Thread t : threads) {
+			t.join();
+		}
+		for (boolean result : results) {
+			rc &= result;
+		}
+		if (!rc) {
+			System.out.println("Frames of a parked virtual thread were not intact after it resumed");
+		}
+		return rc;
+	}
+}